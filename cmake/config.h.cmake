@@ -56,10 +56,14 @@
 #cmakedefine EL_HAVE_CXX11RANDOM
 #cmakedefine EL_HAVE_STEADYCLOCK
 #cmakedefine EL_HAVE_NOEXCEPT
+#cmakedefine EL_HAVE_MMAP
 #cmakedefine EL_HAVE_MPI_REDUCE_SCATTER_BLOCK
 #cmakedefine EL_HAVE_MPI_IN_PLACE
 #cmakedefine EL_HAVE_MPI_LONG_LONG
 #cmakedefine EL_HAVE_MPI_COMM_SET_ERRHANDLER
+#cmakedefine EL_HAVE_MPI_COMM_SPLIT_TYPE
+#cmakedefine EL_HAVE_MPI_WIN_ALLOCATE_SHARED
+#cmakedefine EL_HAVE_MPI3_RMA
 #cmakedefine EL_HAVE_MPI_INIT_THREAD
 #cmakedefine EL_HAVE_MPI_QUERY_THREAD
 #cmakedefine EL_HAVE_MPI3_NONBLOCKING_COLLECTIVES
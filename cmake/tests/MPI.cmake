@@ -19,6 +19,10 @@ check_function_exists(MPIX_Iallgather EL_HAVE_MPIX_NONBLOCKING_COLLECTIVES)
 check_function_exists(MPI_Init_thread EL_HAVE_MPI_INIT_THREAD)
 check_function_exists(MPI_Query_thread EL_HAVE_MPI_QUERY_THREAD)
 check_function_exists(MPI_Comm_set_errhandler EL_HAVE_MPI_COMM_SET_ERRHANDLER)
+check_function_exists(MPI_Comm_split_type EL_HAVE_MPI_COMM_SPLIT_TYPE)
+check_function_exists(
+  MPI_Win_allocate_shared EL_HAVE_MPI_WIN_ALLOCATE_SHARED)
+check_function_exists(MPI_Win_flush_all EL_HAVE_MPI3_RMA)
 check_function_exists(MPI_Type_create_struct EL_HAVE_MPI_TYPE_CREATE_STRUCT)
 if(NOT EL_HAVE_MPI_TYPE_CREATE_STRUCT)
   message(FATAL_ERROR "Could not find MPI_Type_create_struct")
@@ -0,0 +1,92 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+template<typename T>
+Int NumMismatches( const DistSparseMatrix<T>& A, const DistSparseMatrix<T>& B )
+{
+    Int numLocalMismatches = 0;
+    if( A.NumLocalEntries() != B.NumLocalEntries() )
+        numLocalMismatches = 1;
+    else
+        for( Int k=0; k<A.NumLocalEntries(); ++k )
+            if( A.Row(k) != B.Row(k) || A.Col(k) != B.Col(k) ||
+                A.Value(k) != B.Value(k) )
+                ++numLocalMismatches;
+    return mpi::AllReduce( numLocalMismatches, A.Comm() );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::Rank( comm );
+
+    try
+    {
+        const Int n1 = Input("--n1","first grid dimension",30);
+        const Int n2 = Input("--n2","second grid dimension",30);
+        const std::string basename =
+            Input("--basename","basename of file",std::string(""));
+        const bool print = Input("--print","print matrix?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( basename == "" )
+            LogicError("Please specify a basename for writing");
+
+        // Form a 2D five-point stencil with complex off-diagonal entries
+        const Int N = n1*n2;
+        DistSparseMatrix<Complex<double>> A( N, comm );
+        const Int firstLocalRow = A.FirstLocalRow();
+        const Int localHeight = A.LocalHeight();
+        A.Reserve( 5*localHeight );
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const Int i = firstLocalRow + iLoc;
+            const Int x = i % n1;
+            const Int y = i / n1;
+            A.QueueLocalUpdate( iLoc, i, 4 );
+            if( x != 0 )
+                A.QueueLocalUpdate( iLoc, i-1, Complex<double>(-1,0.5) );
+            if( x != n1-1 )
+                A.QueueLocalUpdate( iLoc, i+1, Complex<double>(-1,-0.5) );
+            if( y != 0 )
+                A.QueueLocalUpdate( iLoc, i-n1, -1 );
+            if( y != n2-1 )
+                A.QueueLocalUpdate( iLoc, i+n1, -1 );
+        }
+        A.MakeConsistent();
+        if( print )
+            Print( A, "A" );
+
+        DistSparseMatrix<Complex<double>> B( comm );
+        Write( A, basename, BINARY_CSR );
+        Read( B, basename+".csr" );
+        const Int numCSRMismatches = NumMismatches( A, B );
+
+        Write( A, basename, MATRIX_MARKET );
+        Read( B, basename+".mm" );
+        const Int numMMMismatches = NumMismatches( A, B );
+        if( print )
+            Print( B, "B" );
+
+        if( commRank == 0 )
+            std::cout << "Binary CSR round trip had " << numCSRMismatches
+                      << " mismatches\n"
+                      << "Matrix Market round trip had " << numMMMismatches
+                      << " mismatches" << std::endl;
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -785,10 +785,10 @@ inline ElPermutationMeta CReflect( const PermutationMeta& meta )
     metaC.comm = meta.comm.comm;
 
     const Int commSize = mpi::Size( meta.comm );
-    metaC.sendCounts = new int[commSize];
-    metaC.sendDispls = new int[commSize];
-    metaC.recvCounts = new int[commSize];
-    metaC.recvDispls = new int[commSize];
+    metaC.sendCounts = new ElInt[commSize];
+    metaC.sendDispls = new ElInt[commSize];
+    metaC.recvCounts = new ElInt[commSize];
+    metaC.recvDispls = new ElInt[commSize];
     MemCopy( metaC.sendCounts, meta.sendCounts.data(), commSize );
     MemCopy( metaC.sendDispls, meta.sendDispls.data(), commSize ); 
     MemCopy( metaC.recvCounts, meta.recvCounts.data(), commSize );
@@ -818,13 +818,13 @@ inline PermutationMeta CReflect( const ElPermutationMeta& metaC )
     int commSize;
     MPI_Comm_size( metaC.comm, &commSize );
     meta.sendCounts = 
-        std::vector<int>( metaC.sendCounts, metaC.sendCounts+commSize );
+        std::vector<Int>( metaC.sendCounts, metaC.sendCounts+commSize );
     meta.sendDispls = 
-        std::vector<int>( metaC.sendDispls, metaC.sendDispls+commSize );
+        std::vector<Int>( metaC.sendDispls, metaC.sendDispls+commSize );
     meta.recvCounts =
-        std::vector<int>( metaC.recvCounts, metaC.recvCounts+commSize );
+        std::vector<Int>( metaC.recvCounts, metaC.recvCounts+commSize );
     meta.recvDispls =
-        std::vector<int>( metaC.recvDispls, metaC.recvDispls+commSize );
+        std::vector<Int>( metaC.recvDispls, metaC.recvDispls+commSize );
 
     meta.sendIdx = 
         std::vector<int>( metaC.sendIdx, metaC.sendIdx+metaC.numSendIdx );
@@ -115,6 +115,12 @@ template<typename S,typename T>
 void Copy( const AbstractDistMatrix<S>& A, AbstractDistMatrix<T>& B );
 template<typename S,typename T>
 void Copy( const AbstractBlockDistMatrix<S>& A, AbstractBlockDistMatrix<T>& B );
+// Redistributions between element-wise and block distributions (possibly over
+// different grids) are performed using a cached RedistPlan
+template<typename T>
+void Copy( const AbstractDistMatrix<T>& A, AbstractBlockDistMatrix<T>& B );
+template<typename T>
+void Copy( const AbstractBlockDistMatrix<T>& A, AbstractDistMatrix<T>& B );
 
 void Copy( const Graph& A, Graph& B );
 void Copy( const DistGraph& A, DistGraph& B );
@@ -130,6 +136,8 @@ void Copy( const SparseMatrix<S>& A, Matrix<T>& B );
 template<typename T>
 void Copy( const DistSparseMatrix<T>& A, DistSparseMatrix<T>& B );
 template<typename S,typename T>
+void Copy( const DistSparseMatrix<S>& A, DistSparseMatrix<T>& B );
+template<typename S,typename T>
 void Copy( const DistSparseMatrix<S>& A, AbstractDistMatrix<T>& B );
 template<typename T>
 void CopyFromRoot( const DistSparseMatrix<T>& ADist, SparseMatrix<T>& A );
@@ -138,11 +146,24 @@ void CopyFromNonRoot( const DistSparseMatrix<T>& ADist, Int root=0 );
 
 template<typename T>
 void Copy( const DistMultiVec<T>& A, DistMultiVec<T>& B );
+template<typename S,typename T>
+void Copy( const DistMultiVec<S>& A, DistMultiVec<T>& B );
 template<typename T>
 void CopyFromRoot( const DistMultiVec<T>& XDist, Matrix<T>& X );
 template<typename T>
 void CopyFromNonRoot( const DistMultiVec<T>& XDist, Int root=0 );
 
+template<typename T>
+void Copy( const DistSparseMatrix<T>& A, DistSparseMatrix2D<T>& B );
+template<typename T>
+void Copy( const DistSparseMatrix2D<T>& A, DistSparseMatrix<T>& B );
+template<typename T>
+void Copy( const DistMultiVec<T>& A, DistMultiVec2D<T>& B );
+template<typename T>
+void Copy( const DistMultiVec2D<T>& A, DistMultiVec<T>& B );
+template<typename T>
+void Copy( const DistMultiVec2D<T>& A, DistMultiVec2D<T>& B );
+
 // DiagonalScale
 // =============
 template<typename TDiag,typename T>
@@ -147,6 +147,14 @@ void Multiply
   T alpha, const DistSparseMatrix<T>& A, const DistMultiVec<T>& X,
   T beta,                                      DistMultiVec<T>& Y );
 
+// NOTE: For orientation == NORMAL, X should be MR-distributed and Y 
+//       MC-distributed, and the reverse otherwise
+template<typename T>
+void Multiply
+( Orientation orientation,
+  T alpha, const DistSparseMatrix2D<T>& A, const DistMultiVec2D<T>& X,
+  T beta,                                        DistMultiVec2D<T>& Y );
+
 // MultiShiftQuasiTrsm
 // ===================
 template<typename F>
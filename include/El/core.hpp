@@ -46,6 +46,8 @@
 #ifdef EL_HAVE_OPENMP
 # include <omp.h>
 # define EL_PARALLEL_FOR _Pragma("omp parallel for")
+# define EL_PRAGMA(x) _Pragma(#x)
+# define EL_PARALLEL_FOR_IF(cond) EL_PRAGMA(omp parallel for if(cond))
 # ifdef EL_HAVE_OMP_COLLAPSE
 #  define EL_PARALLEL_FOR_COLLAPSE2 _Pragma("omp parallel for collapse(2)")
 # else
@@ -54,6 +56,7 @@
 #else
 # define EL_PARALLEL_FOR 
 # define EL_PARALLEL_FOR_COLLAPSE2
+# define EL_PARALLEL_FOR_IF(cond)
 #endif
 
 #ifdef EL_AVOID_OMP_FMA
@@ -153,6 +156,7 @@ template<typename T,Dist U=MC,Dist V=MR> class BlockDistMatrix;
 #include "El/core/random/decl.hpp"
 #include "El/core/random/impl.hpp"
 #include "El/core/AxpyInterface.hpp"
+#include "El/core/RedistPlan.hpp"
 
 #include "El/core/Graph.hpp"
 // TODO: Sequential map
@@ -163,5 +167,7 @@ template<typename T,Dist U=MC,Dist V=MR> class BlockDistMatrix;
 #include "El/core/DistMap.hpp"
 #include "El/core/DistMultiVec.hpp"
 #include "El/core/DistSparseMatrix.hpp"
+#include "El/core/DistMultiVec2D.hpp"
+#include "El/core/DistSparseMatrix2D.hpp"
 
 #endif // ifndef EL_CORE_HPP
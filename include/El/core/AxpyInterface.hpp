@@ -22,6 +22,15 @@ enum AxpyType { LOCAL_TO_GLOBAL, GLOBAL_TO_LOCAL };
 }
 using namespace AxpyTypeNS;
 
+// The two-sided backend exchanges tagged messages which are progressed by
+// polling (and so Detach must wait for every process to finish), whereas the
+// one-sided backend exposes the local data of the distributed matrix through
+// an MPI-3 window which is directly accumulated into and read from
+namespace AxpyBackendNS {
+enum AxpyBackend { AXPY_TWO_SIDED, AXPY_ONE_SIDED };
+}
+using namespace AxpyBackendNS;
+
 template<typename T>
 class AxpyInterface
 {   
@@ -29,17 +38,30 @@ public:
     AxpyInterface();
     ~AxpyInterface();
 
-    AxpyInterface( AxpyType type,       DistMatrix<T,MC,MR>& Z );
-    AxpyInterface( AxpyType type, const DistMatrix<T,MC,MR>& Z ); 
+    AxpyInterface
+    ( AxpyType type, DistMatrix<T,MC,MR>& Z,
+      AxpyBackend backend=AXPY_TWO_SIDED );
+    AxpyInterface
+    ( AxpyType type, const DistMatrix<T,MC,MR>& Z,
+      AxpyBackend backend=AXPY_TWO_SIDED );
 
-    void Attach( AxpyType type,       DistMatrix<T,MC,MR>& Z ); 
-    void Attach( AxpyType type, const DistMatrix<T,MC,MR>& Z ); 
+    void Attach
+    ( AxpyType type, DistMatrix<T,MC,MR>& Z,
+      AxpyBackend backend=AXPY_TWO_SIDED );
+    void Attach
+    ( AxpyType type, const DistMatrix<T,MC,MR>& Z,
+      AxpyBackend backend=AXPY_TWO_SIDED );
 
     void Axpy( T alpha,       Matrix<T>& Z, Int i, Int j );
     void Axpy( T alpha, const Matrix<T>& Z, Int i, Int j );
 
     void Detach();
 
+    // Small one-sided updates are left in flight (with their packed buffers)
+    // until this many entries are outstanding
+    void SetMaxBufferedEntries( Int maxEntries );
+    Int MaxBufferedEntries() const;
+
 private:
     static const Int 
         DATA_TAG        =1, 
@@ -64,6 +86,12 @@ private:
 
     byte sendDummy_, recvDummy_;
 
+    AxpyBackend backend_;
+    mpi::Window window_;
+    std::vector<Int> ldims_;
+    std::deque<std::vector<T>> rmaBuffers_;
+    Int numBufferedEntries_, maxBufferedEntries_;
+
     // Check if we are done with this attachment's work
     bool Finished();
 
@@ -78,6 +106,11 @@ private:
     void AxpyLocalToGlobal( T alpha, const Matrix<T>& X, Int i, Int j );
     void AxpyGlobalToLocal( T alpha,       Matrix<T>& Y, Int i, Int j );
 
+    // One-sided counterparts
+    void OpenWindow( const DistMatrix<T,MC,MR>& Z );
+    void AccumulateLocalToGlobal( T alpha, const Matrix<T>& X, Int i, Int j );
+    void GetGlobalToLocal( T alpha, Matrix<T>& Y, Int i, Int j );
+
     Int ReadyForSend
     ( Int sendSize,
       std::deque<std::vector<byte>>& sendVectors,
@@ -100,6 +100,19 @@ public:
       Int colAlign, Int rowAlign, Int colCut, Int rowCut,
       const El::Matrix<T>& A, Int root=0 );
 
+    // Ownership transfer of the local buffer
+    // --------------------------------------
+    // Assume ownership of a local buffer, which will be freed by calling
+    // 'deleter' (the buffer is ignored if this process does not participate)
+    void Control
+    ( Int height, Int width, const El::Grid& g,
+      Int blockHeight, Int blockWidth,
+      Int colAlign, Int rowAlign, Int colCut, Int rowCut,
+      T* buffer, Int ldim, std::function<void(T*)> deleter, Int root=0 );
+    // Give up ownership of the local buffer, which must then be freed with
+    // delete[] by the caller, and empty the matrix
+    T* Release();
+
     // Basic queries
     // =============
 
@@ -220,6 +233,20 @@ public:
     void MakeLocalReal( Int iLoc, Int jLoc );
     void ConjugateLocal( Int iLoc, Int jLoc );
 
+    // Batch manipulation of remote entries
+    // ------------------------------------
+    // Any process may queue updates of, or requests for, arbitrary entries,
+    // which are then handled by a single (collective) call that exchanges the
+    // entries with their owners. Each queued update is applied once to every
+    // copy of the entry (and so duplicates accumulate), and the pulled values
+    // are returned in the order in which they were queued.
+    void Reserve( Int numRemoteUpdates );
+    void QueueUpdate( Int i, Int j, T value );
+    void ProcessQueues();
+    void ReservePulls( Int numPulls ) const;
+    void QueuePull( Int i, Int j ) const;
+    void ProcessPullQueue( std::vector<T>& pullBuf ) const;
+
     // Diagonal manipulation
     // =====================
     bool DiagonalAlignedWith( const El::BlockDistData& d, Int offset=0 ) const;
@@ -368,6 +395,12 @@ protected:
     Int height_, width_;
     Memory<T> auxMemory_;
     El::Matrix<T> matrix_;
+
+    // Queues of remote updates and pulls
+    // ----------------------------------
+    std::vector<Int> updateRows_, updateCols_;
+    std::vector<T> updateVals_;
+    mutable std::vector<Int> pullRows_, pullCols_;
     
     // Process grid and distribution metadata
     // --------------------------------------
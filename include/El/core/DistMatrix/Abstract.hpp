@@ -89,6 +89,36 @@ public:
     ( Int height, Int width, const El::Grid& grid,
       Int colAlign, Int rowAlign, const El::Matrix<T>& A, Int root=0 );
 
+    // Ownership transfer of the local buffer
+    // --------------------------------------
+    // Assume ownership of a local buffer, which will be freed by calling
+    // 'deleter' (the buffer is ignored if this process does not participate)
+    void Control
+    ( Int height, Int width, const El::Grid& grid,
+      Int colAlign, Int rowAlign, T* buffer, Int ldim,
+      std::function<void(T*)> deleter, Int root=0 );
+    // Give up ownership of the local buffer, which must then be freed with
+    // delete[] by the caller, and empty the matrix
+    T* Release();
+
+    // Node-shared storage
+    // -------------------
+    // Store a single copy of our local data per node within an MPI-3 
+    // shared-memory window rather than one copy per process. This is intended
+    // for distributions which are redundant over processes that share a node,
+    // e.g., [STAR,STAR], [MC,STAR], and [STAR,MR]. Only the NodeWriter() 
+    // process may then modify the local data (followed by a call to NodeSync()
+    // by every member of NodeComm()), and so the local matrix is locked on the
+    // other processes. Redistributions into the matrix, as well as Scale,
+    // Axpy, Zero, and Fill, already follow this rule. All reallocations are
+    // collective over NodeComm().
+    void SetNodeShared( bool share=true );
+    bool NodeShared() const;
+    bool NodeWriter() const;
+    void NodeSync() const;
+    mpi::Comm NodeComm() const;
+    mpi::Comm InterNodeComm() const;
+
     // Basic queries
     // =============
 
@@ -205,6 +235,20 @@ public:
     void    MakeLocalReal( Int iLoc, Int jLoc );
     void    ConjugateLocal( Int iLoc, Int jLoc );
 
+    // Batch manipulation of remote entries
+    // ------------------------------------
+    // Any process may queue updates of, or requests for, arbitrary entries,
+    // which are then handled by a single (collective) call that exchanges the
+    // entries with their owners. Each queued update is applied once to every
+    // copy of the entry (and so duplicates accumulate), and the pulled values
+    // are returned in the order in which they were queued.
+    void Reserve( Int numRemoteUpdates );
+    void QueueUpdate( Int i, Int j, T value );
+    void ProcessQueues();
+    void ReservePulls( Int numPulls ) const;
+    void QueuePull( Int i, Int j ) const;
+    void ProcessPullQueue( std::vector<T>& pullBuf ) const;
+
     // Diagonal manipulation
     // =====================
     bool DiagonalAlignedWith( const El::DistData& d, Int offset=0 ) const;
@@ -352,6 +396,18 @@ protected:
     Int height_, width_;
     Memory<T> auxMemory_;
     El::Matrix<T> matrix_;
+
+    // Queues of remote updates and pulls
+    // ----------------------------------
+    std::vector<Int> updateRows_, updateCols_;
+    std::vector<T> updateVals_;
+    mutable std::vector<Int> pullRows_, pullCols_;
+
+    // Node-shared storage
+    // -------------------
+    bool nodeShared_;
+    mpi::Comm nodeComm_, interNodeComm_;
+    mpi::Window nodeWindow_;
     
     // Process grid and distribution metadata
     // --------------------------------------
@@ -377,6 +433,12 @@ protected:
     void SetRowShift();
     void SetGrid();
 
+    // Allocate the local data within a shared-memory window
+    // =====================================================
+    void ResizeNodeShared( Int localHeight, Int localWidth, Int ldim );
+    void SetUpNodeComms();
+    void FreeNodeComms();
+
     // Friend declarations
     // ===================
     template<typename S,Dist J,Dist K> friend class GeneralDistMatrix;
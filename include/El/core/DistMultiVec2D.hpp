@@ -0,0 +1,111 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson, Lexing Ying,
+   The University of Texas at Austin, Stanford University, and the
+   Georgia Insitute of Technology.
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_CORE_DISTMULTIVEC2D_DECL_HPP
+#define EL_CORE_DISTMULTIVEC2D_DECL_HPP
+
+namespace El {
+
+// A set of vectors whose rows are distributed in a manner compatible with
+// the row or column blocks of a DistSparseMatrix2D over the same grid.
+//
+// If the distribution is MC, the rows are split into one contiguous block per
+// process row (matching the row blocks of DistSparseMatrix2D), and each of
+// these blocks is then split contiguously over the processes within that
+// process row (the MR communicator).
+//
+// If the distribution is MR, the rows are split into one contiguous block per
+// process column (matching the column blocks of DistSparseMatrix2D), and each
+// of these blocks is then split over the processes within the process column
+// (the MC communicator).
+//
+// Thus, for Y := A X, X should be MR-distributed and Y MC-distributed, while
+// the roles are reversed for Y := A^T X and Y := A^H X.
+template<typename T>
+class DistMultiVec2D
+{
+public:
+    // Constructors and destructors
+    // ============================
+    DistMultiVec2D( El::Dist dist=MR, const El::Grid& grid=DefaultGrid() );
+    DistMultiVec2D
+    ( Int height, Int width, El::Dist dist=MR,
+      const El::Grid& grid=DefaultGrid() );
+    ~DistMultiVec2D();
+
+    // Assignment  and reconfiguration
+    // ===============================
+
+    // Assignment
+    // ----------
+    const DistMultiVec2D<T>& operator=( const DistMultiVec2D<T>& X );
+
+    // Change the matrix size
+    // ----------------------
+    void Empty();
+    void Resize( Int height, Int width );
+
+    // Change the distribution
+    // -----------------------
+    void SetGrid( const El::Grid& grid );
+    void SetDist( El::Dist dist );
+
+    // Queries
+    // =======
+
+    // High-level data
+    // ---------------
+    Int Height() const;
+    Int Width() const;
+    Int FirstLocalRow() const;
+    Int LocalHeight() const;
+          El::Matrix<T>& Matrix();
+    const El::Matrix<T>& LockedMatrix() const;
+
+    // Distribution information
+    // ------------------------
+    const El::Grid& Grid() const;
+    El::Dist Dist() const;
+    // The communicator over which each block is split (MR for an MC
+    // distribution and MC for an MR distribution)
+    mpi::Comm BlockComm() const;
+    Int NumBlocks() const;
+    Int Blocksize() const;
+    Int BlockOwner( Int i ) const;
+    Int FirstBlockRow( Int block ) const;
+    Int BlockHeight( Int block ) const;
+    // The height of piece 'q' of the split of the given block
+    Int PieceHeight( Int block, Int q ) const;
+    // The VC rank of the process owning row i
+    Int RowOwner( Int i ) const;
+
+    // Entrywise manipulation
+    // ======================
+    T GetLocal( Int localRow, Int col ) const;
+    void SetLocal( Int localRow, Int col, T value );
+    void UpdateLocal( Int localRow, Int col, T value );
+
+private:
+    Int height_, width_;
+    El::Dist dist_;
+    const El::Grid* grid_;
+
+    Int blocksize_;
+    Int firstLocalRow_;
+
+    El::Matrix<T> multiVec_;
+
+    void SetUpDistribution();
+};
+
+} // namespace El
+
+#endif // ifndef EL_CORE_DISTMULTIVEC2D_DECL_HPP
@@ -0,0 +1,125 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson, Lexing Ying,
+   The University of Texas at Austin, Stanford University, and the
+   Georgia Insitute of Technology.
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_CORE_DISTSPARSEMATRIX2D_DECL_HPP
+#define EL_CORE_DISTSPARSEMATRIX2D_DECL_HPP
+
+namespace El {
+
+// Use a checkerboard distribution over an r x c process grid, where the rows
+// are split into r contiguous blocks (one per process row) and the columns
+// into c contiguous blocks (one per process column) using the same rule as
+// the 1d distributions, i.e., each block has size
+//     if last block,  height - (r-1)*floor(height/r)
+//     otherwise,      floor(height/r)
+// and process (s,t) owns the nonzeros in row block s and column block t.
+template<typename T>
+class DistSparseMatrix2D
+{
+public:
+    // Constructors and destructors
+    // ============================
+    DistSparseMatrix2D( const El::Grid& grid=DefaultGrid() );
+    DistSparseMatrix2D
+    ( Int height, Int width, const El::Grid& grid=DefaultGrid() );
+    ~DistSparseMatrix2D();
+
+    // Assignment and reconfiguration
+    // ==============================
+
+    // Change the size of the matrix
+    // -----------------------------
+    void Empty();
+    void Resize( Int height, Int width );
+
+    // Change the distribution
+    // -----------------------
+    void SetGrid( const El::Grid& grid );
+
+    // Assembly
+    // --------
+    void Reserve( Int numLocalEntries );
+
+    // For applying a sequence of updates and then forcing consistency
+    // NOTE: Updates to nonlocal entries are silently ignored
+    void QueueUpdate( Int row, Int col, T value );
+    void QueueLocalUpdate( Int localRow, Int localCol, T value );
+    void QueueZero( Int row, Int col );
+    void QueueLocalZero( Int localRow, Int localCol );
+    void MakeConsistent();
+
+    // Queries
+    // =======
+
+    // High-level information
+    // ----------------------
+    Int Height() const;
+    Int Width() const;
+    Int FirstLocalRow() const;
+    Int FirstLocalCol() const;
+    Int LocalHeight() const;
+    Int LocalWidth() const;
+    Int NumLocalEntries() const;
+    Int Capacity() const;
+    bool Consistent() const;
+
+    // Distribution information
+    // ------------------------
+    const El::Grid& Grid() const;
+    Int RowBlocksize() const;
+    Int ColBlocksize() const;
+    // The process row owning row i and the process column owning column j
+    Int RowOwner( Int i ) const;
+    Int ColOwner( Int j ) const;
+    // The VC rank of the owner of entry (i,j)
+    Int Owner( Int i, Int j ) const;
+
+    // Detailed local information
+    // --------------------------
+    // NOTE: The row and column indices are global
+    Int Row( Int localInd ) const;
+    Int Col( Int localInd ) const;
+    T Value( Int localInd ) const;
+    Int EntryOffset( Int localRow ) const;
+    Int NumConnections( Int localRow ) const;
+    Int* SourceBuffer();
+    Int* TargetBuffer();
+    T* ValueBuffer();
+    const Int* LockedSourceBuffer() const;
+    const Int* LockedTargetBuffer() const;
+    const T* LockedValueBuffer() const;
+
+private:
+    Int height_, width_;
+    const El::Grid* grid_;
+
+    Int rowBlocksize_, colBlocksize_;
+    Int firstLocalRow_, firstLocalCol_;
+    Int localHeight_, localWidth_;
+
+    std::vector<Int> sources_, targets_;
+    std::vector<T> vals_;
+    std::set<std::pair<Int,Int>> markedForRemoval_;
+
+    // Helpers for local indexing
+    bool consistent_;
+    std::vector<Int> localEntryOffsets_;
+    void ComputeEntryOffsets();
+    void SetUpDistribution();
+
+    static bool CompareEntries( const Entry<T>& a, const Entry<T>& b );
+
+    void AssertConsistent() const;
+};
+
+} // namespace El
+
+#endif // ifndef EL_CORE_DISTSPARSEMATRIX2D_DECL_HPP
@@ -16,9 +16,15 @@ namespace El {
 class Grid
 {
 public:
+    // If nodeAware is true, the processes are ordered by the node they reside
+    // on so that, where possible, each process column (row) of a column-major
+    // (row-major) grid lies within a single node
     explicit Grid
-    ( mpi::Comm comm=mpi::COMM_WORLD, GridOrder order=COLUMN_MAJOR );
-    explicit Grid( mpi::Comm comm, int height, GridOrder order=COLUMN_MAJOR );
+    ( mpi::Comm comm=mpi::COMM_WORLD, GridOrder order=COLUMN_MAJOR,
+      bool nodeAware=false );
+    explicit Grid
+    ( mpi::Comm comm, int height, GridOrder order=COLUMN_MAJOR,
+      bool nodeAware=false );
     ~Grid();
 
     // Simple interface (simpler version of distributed-based interface)
@@ -69,11 +75,22 @@ public:
     int DiagPathRank( int vectorColRank ) const;
     int FirstVCRank( int diagPath ) const;
 
+    // Node-aware routines (the communicators are subsets of OwningComm)
+    bool NodeAware() const;
+    int NodeRank() const;
+    int NodeSize() const;
+    int NumNodes() const;
+    mpi::Comm NodeComm() const;      // the members of our node
+    mpi::Comm InterNodeComm() const; // the members with our node rank
+
     static int FindFactor( int p );
+    // Prefer a factorization which aligns the process columns (rows) of a
+    // column-major (row-major) grid with the node boundaries
+    static int FindNodeFactor( int p, int nodeSize, GridOrder order );
 
 private:
-    bool haveViewers_;
-    int height_, size_, gcd_;
+    bool haveViewers_, nodeAware_;
+    int height_, size_, gcd_, numNodes_;
     GridOrder order_;
     std::vector<int> diagPathsAndRanks_;
 
@@ -89,8 +106,10 @@ private:
     mpi::Comm cartComm_,  // the processes that are in the grid
               matrixColComm_, matrixRowComm_,
               matrixDiagComm_, matrixDiagPerpComm_,
-              vectorColComm_, vectorRowComm_;
+              vectorColComm_, vectorRowComm_,
+              nodeComm_, interNodeComm_;
 
+    int OrderByNode();
     void SetUpGrid();
 
     // Disable copying this class due to MPI_Comm/MPI_Group ownership issues
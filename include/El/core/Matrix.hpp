@@ -60,6 +60,17 @@ public:
     void LockedAttach( Int height, Int width, const T* buffer, Int ldim );
     // Reconfigure around the given buffer and assume ownership
     void Control( Int height, Int width, T* buffer, Int ldim );
+    // Reconfigure around the given buffer, which will be freed by calling
+    // 'deleter' once this matrix no longer refers to it
+    void Control
+    ( Int height, Int width, T* buffer, Int ldim, 
+      std::function<void(T*)> deleter );
+    void LockedControl
+    ( Int height, Int width, const T* buffer, Int ldim,
+      std::function<void(T*)> deleter );
+    // Give up ownership of the buffer, which must be freed with delete[] by
+    // the caller, and empty the matrix
+    T* Release();
 
     // Basic queries
     // =============
@@ -172,7 +183,12 @@ private:
     void Empty_();
     void Resize_( Int height, Int width );
     void Resize_( Int height, Int width, Int ldim );
+    void Reallocate_( Int size );
     void Control_( Int height, Int width, T* buffer, Int ldim );
+    void Control_
+    ( Int height, Int width, T* buffer, Int ldim,
+      std::function<void(T*)> deleter );
+    T* Release_();
     void Attach_( Int height, Int width, T* buffer, Int ldim );
     void LockedAttach_( Int height, Int width, const T* buffer, Int ldim );
 
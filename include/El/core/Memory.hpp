@@ -17,6 +17,10 @@ class Memory
 {
     std::size_t size_;
     G* buffer_;
+    // If nonempty, used in place of delete[] to free the buffer
+    std::function<void(G*)> deleter_;
+
+    void Free();
 public:
     Memory();
     Memory( std::size_t size );
@@ -32,6 +36,11 @@ public:
     std::size_t Size()   const;
 
     G* Require( std::size_t size );
+    // Assume ownership of an externally allocated buffer which is to be
+    // freed by calling 'deleter'
+    void Control( G* buffer, std::size_t size, std::function<void(G*)> deleter );
+    // Give up ownership of the buffer (without freeing it) and return it
+    G* Forfeit();
     void Release();
     void Empty();
 };
@@ -0,0 +1,221 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_REDISTPLAN_HPP
+#define EL_REDISTPLAN_HPP
+
+namespace El {
+
+template<typename T> class RedistRequest;
+
+// A reusable plan for redistributing matrices with the layout of A (its
+// dimensions, distribution, block sizes and cuts, alignments, root, and grid)
+// into the layout of B. Any combination of element-wise and block-cyclic
+// distributions is supported, and the two grids may differ so long as their
+// viewing communicators are congruent.
+//
+// Building the plan requires a single AllGather over the viewing communicator,
+// after which each process knows exactly which (strided) pieces of its local
+// data intersect the local data of every other process. Each execution then
+// only packs, exchanges messages with the processes which actually share data,
+// and unpacks; no intermediate distribution (e.g., [CIRC,CIRC] or [STAR,STAR])
+// is formed. The message buffers are released after each execution so that
+// idle plans only hold their (small) lists of segments.
+//
+// The typical usage is within an iterative method, e.g.,
+//
+//     RedistPlan<double> plan( A, B );
+//     for( Int it=0; it<maxIts; ++it )
+//     {
+//         ...
+//         plan.Execute( A, B );
+//         ...
+//     }
+//
+// where A and B must retain the layouts they had when the plan was built.
+
+template<typename T>
+class RedistPlan
+{
+public:
+    RedistPlan
+    ( const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B );
+    RedistPlan
+    ( const AbstractDistMatrix<T>& A, const AbstractBlockDistMatrix<T>& B );
+    RedistPlan
+    ( const AbstractBlockDistMatrix<T>& A, const AbstractDistMatrix<T>& B );
+    RedistPlan
+    ( const AbstractBlockDistMatrix<T>& A, 
+      const AbstractBlockDistMatrix<T>& B );
+
+    // Redistribute A into B (which is resized if necessary)
+    void Execute
+    ( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B );
+    void Execute
+    ( const AbstractDistMatrix<T>& A, AbstractBlockDistMatrix<T>& B );
+    void Execute
+    ( const AbstractBlockDistMatrix<T>& A, AbstractDistMatrix<T>& B );
+    void Execute
+    ( const AbstractBlockDistMatrix<T>& A, AbstractBlockDistMatrix<T>& B );
+
+    // A summary of the pair of layouts that a plan is valid for
+    static std::vector<Int> Signature
+    ( const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B );
+    static std::vector<Int> Signature
+    ( const AbstractDistMatrix<T>& A, const AbstractBlockDistMatrix<T>& B );
+    static std::vector<Int> Signature
+    ( const AbstractBlockDistMatrix<T>& A, const AbstractDistMatrix<T>& B );
+    static std::vector<Int> Signature
+    ( const AbstractBlockDistMatrix<T>& A, 
+      const AbstractBlockDistMatrix<T>& B );
+
+    const std::vector<Int>& Signature() const { return signature_; }
+
+    // The number of entries which this process sends and receives
+    Int SendSize() const { return sendSize_; }
+    Int RecvSize() const { return recvSize_; }
+
+private:
+    // A set of indices which are spaced by a fixed stride within both the
+    // local indexing of A and that of B
+    struct Segment
+    {
+        Int length;
+        Int begA, strideA;
+        Int begB, strideB;
+    };
+
+    // The entries shared with a particular process are the tensor product of
+    // sets of row and column segments, which are packed column-major
+    struct Block
+    {
+        int peer;
+        Int offset, size;
+        Int rowSegBeg, numRowSegs;
+        Int colSegBeg, numColSegs;
+    };
+
+    std::vector<Int> signature_;
+    std::vector<Segment> rowSegs_, colSegs_;
+    std::vector<Block> sends_, recvs_;
+    Int sendSize_, recvSize_;
+
+    template<typename AType,typename BType>
+    void Build( const AType& A, const BType& B );
+    template<typename AType,typename BType>
+    void Run( const AType& A, BType& B );
+
+    // Post the receives, pack and post the sends, and directly copy the local
+    // contributions; the number of posted requests is returned
+    template<typename AType,typename BType>
+    Int Start
+    ( const AType& A, BType& B,
+      std::vector<T>& sendBuf, std::vector<T>& recvBuf,
+      std::vector<mpi::Request>& requests ) const;
+    // Unpack the received data after the requests have completed
+    void Finish
+    ( T* BBuf, Int BLDim, const std::vector<T>& recvBuf, int commRank ) const;
+
+    friend class RedistRequest<T>;
+};
+
+// Return a plan for redistributing from the layout of A into that of B from a
+// small least-recently-used cache, which is extended if there is not already a
+// matching plan. Each cache is attached to the viewing communicator of A (and
+// freed along with it), so that the plans are only shared by redistributions
+// over the same communicator. Since building a plan is collective over that
+// communicator, its members always perform the same sequence of lookups.
+template<typename T>
+RedistPlan<T>& CachedRedistPlan
+( const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B );
+template<typename T>
+RedistPlan<T>& CachedRedistPlan
+( const AbstractDistMatrix<T>& A, const AbstractBlockDistMatrix<T>& B );
+template<typename T>
+RedistPlan<T>& CachedRedistPlan
+( const AbstractBlockDistMatrix<T>& A, const AbstractDistMatrix<T>& B );
+template<typename T>
+RedistPlan<T>& CachedRedistPlan
+( const AbstractBlockDistMatrix<T>& A, const AbstractBlockDistMatrix<T>& B );
+
+// A handle for a redistribution of A into B which was started by CopyAsync.
+// Since the contents of A are packed when the redistribution is started, A may
+// be freely modified afterwards, but B must not be accessed until either Wait
+// has been called or Test has returned true. If the handle is destroyed while
+// the redistribution is still pending, it waits for its completion.
+//
+// When nonblocking collectives are available, redistributions over the same
+// grid which only gather the data of one or both dimensions (e.g., from
+// [MC,MR] to [STAR,MR] or [STAR,STAR]) are performed with a single IAllGather.
+// Other redistributions between grids with congruent viewing communicators
+// use the nonblocking point-to-point messages of a cached RedistPlan, and any
+// remaining cases fall back to a synchronous Copy (in which case the returned
+// handle has already completed).
+template<typename T>
+class RedistRequest
+{
+public:
+    RedistRequest
+    ( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B );
+    RedistRequest
+    ( const AbstractDistMatrix<T>& A, AbstractBlockDistMatrix<T>& B );
+    RedistRequest
+    ( const AbstractBlockDistMatrix<T>& A, AbstractDistMatrix<T>& B );
+    RedistRequest
+    ( const AbstractBlockDistMatrix<T>& A, AbstractBlockDistMatrix<T>& B );
+    RedistRequest( RedistRequest<T>&& req );
+    ~RedistRequest();
+
+    RedistRequest<T>& operator=( RedistRequest<T>&& req );
+
+    // Block until the redistribution has completed
+    void Wait();
+    // Return whether or not the redistribution has completed (and, if so,
+    // finish unpacking into B)
+    bool Test();
+    bool Pending() const { return pending_; }
+
+private:
+    bool pending_;
+    std::vector<T> sendBuf_, recvBuf_;
+    std::vector<mpi::Request> requests_;
+    std::function<void(const std::vector<T>&)> finish_;
+
+    RedistRequest( const RedistRequest<T>& req ) = delete;
+    RedistRequest<T>& operator=( const RedistRequest<T>& req ) = delete;
+
+    bool StartGather
+    ( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B );
+    template<typename AType,typename BType>
+    void StartPlan( const AType& A, BType& B );
+    void Complete();
+};
+
+// Start redistributing A into B (which is resized if necessary)
+template<typename T>
+RedistRequest<T> CopyAsync
+( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B );
+template<typename T>
+RedistRequest<T> CopyAsync
+( const AbstractDistMatrix<T>& A, AbstractBlockDistMatrix<T>& B );
+template<typename T>
+RedistRequest<T> CopyAsync
+( const AbstractBlockDistMatrix<T>& A, AbstractDistMatrix<T>& B );
+template<typename T>
+RedistRequest<T> CopyAsync
+( const AbstractBlockDistMatrix<T>& A, AbstractBlockDistMatrix<T>& B );
+
+// The maximum number of plans cached for each datatype and communicator (the
+// default is 8)
+void SetRedistPlanCacheSize( Int numPlans );
+Int RedistPlanCacheSize();
+
+} // namespace El
+
+#endif // ifndef EL_REDISTPLAN_HPP
@@ -146,8 +146,8 @@ class IndexRange(ctypes.Structure):
 (NON_UNIT,UNIT)=(0,1)
 
 # File format 
-(AUTO,ASCII,ASCII_MATLAB,BINARY,BINARY_FLAT,BMP,JPG,JPEG,MATRIX_MARKET,
- PNG,PPM,XBM,XPM)=(0,1,2,3,4,5,6,7,8,9,10,11,12)
+(AUTO,ASCII,ASCII_MATLAB,BINARY,BINARY_FLAT,BMP,JPG,JPEG,
+ MATRIX_MARKET,PNG,PPM,XBM,XPM,BINARY_CSR)=(0,1,2,3,4,5,6,7,8,9,10,11,12,13)
 
 # Colormap
 (GRAYSCALE,GRAYSCALE_DISCRETE,RED_BLACK_GREEN,BLUE_RED)=(0,1,2,3)
@@ -89,6 +89,23 @@ void StridedMemCopy
 (       T* dest,   std::size_t destStride,
   const T* source, std::size_t sourceStride, std::size_t numEntries );
 
+// Copy a height x width matrix between buffers with arbitrary (non-negative)
+// row and column strides, where entry (i,j) of A lives at 
+// A[i*colStrideA+j*rowStrideA]. This is the kernel used for packing and 
+// unpacking the communication buffers of redistributions.
+template<typename T>
+void InterleaveMatrix
+( Int height, Int width,
+  const T* A, Int colStrideA, Int rowStrideA,
+        T* B, Int colStrideB, Int rowStrideB );
+// The same, but for use within (EL_OUTER_)PARALLEL_FOR loops, and so only
+// parallelized if EL_PARALLELIZE_INNER_LOOPS is defined
+template<typename T>
+void InnerInterleaveMatrix
+( Int height, Int width,
+  const T* A, Int colStrideA, Int rowStrideA,
+        T* B, Int colStrideB, Int rowStrideB );
+
 // Replacement for std::memset, which is likely suboptimal and hard to extend
 // to non-POD datatypes. Notice that sizeof(T) is no longer required.
 template<typename T>
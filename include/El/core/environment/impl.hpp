@@ -124,6 +124,103 @@ StridedMemCopy
     blas::Copy( numEntries, source, sourceStride, dest, destStride );
 }
 
+namespace interleave {
+
+template<typename T>
+inline void
+Kernel
+( bool parallel, Int height, Int width,
+  const T* A, Int colStrideA, Int rowStrideA,
+        T* B, Int colStrideB, Int rowStrideB )
+{
+    if( colStrideA == 1 && colStrideB == 1 )
+    {
+        // Contiguous columns
+        if( height == 1 )
+        {
+            for( Int j=0; j<width; ++j )
+                B[j*rowStrideB] = A[j*rowStrideA];
+        }
+        else
+        {
+            EL_PARALLEL_FOR_IF(parallel)
+            for( Int j=0; j<width; ++j )
+                MemCopy( &B[j*rowStrideB], &A[j*rowStrideA], height );
+        }
+    }
+    else if( rowStrideA == 1 && rowStrideB == 1 )
+    {
+        // Contiguous rows
+        EL_PARALLEL_FOR_IF(parallel)
+        for( Int i=0; i<height; ++i )
+            MemCopy( &B[i*colStrideB], &A[i*colStrideA], width );
+    }
+    else if( colStrideA == 1 || colStrideB == 1 )
+    {
+        // Only one side has contiguous columns, so stream down each column
+        EL_PARALLEL_FOR_IF(parallel)
+        for( Int j=0; j<width; ++j )
+        {
+            const T* ACol = &A[j*rowStrideA];
+            T* BCol = &B[j*rowStrideB];
+            for( Int i=0; i<height; ++i )
+                BCol[i*colStrideB] = ACol[i*colStrideA];
+        }
+    }
+    else
+    {
+        // Neither side is contiguous in either direction (e.g., transposing
+        // strided data), so work on small tiles which remain in cache
+        const Int tileSize = 32;
+        const Int numTileCols = (width+tileSize-1)/tileSize;
+        EL_PARALLEL_FOR_IF(parallel)
+        for( Int jTile=0; jTile<numTileCols; ++jTile )
+        {
+            const Int jBeg = jTile*tileSize;
+            const Int jEnd = Min( jBeg+tileSize, width );
+            for( Int iBeg=0; iBeg<height; iBeg+=tileSize )
+            {
+                const Int iEnd = Min( iBeg+tileSize, height );
+                for( Int j=jBeg; j<jEnd; ++j )
+                    for( Int i=iBeg; i<iEnd; ++i )
+                        B[i*colStrideB+j*rowStrideB] = 
+                          A[i*colStrideA+j*rowStrideA];
+            }
+        }
+    }
+}
+
+} // namespace interleave
+
+template<typename T>
+inline void
+InterleaveMatrix
+( Int height, Int width,
+  const T* A, Int colStrideA, Int rowStrideA,
+        T* B, Int colStrideB, Int rowStrideB )
+{
+    interleave::Kernel
+    ( true, height, width,
+      A, colStrideA, rowStrideA, B, colStrideB, rowStrideB );
+}
+
+template<typename T>
+inline void
+InnerInterleaveMatrix
+( Int height, Int width,
+  const T* A, Int colStrideA, Int rowStrideA,
+        T* B, Int colStrideB, Int rowStrideB )
+{
+#ifdef EL_PARALLELIZE_INNER_LOOPS
+    const bool parallel = true;
+#else
+    const bool parallel = false;
+#endif
+    interleave::Kernel
+    ( parallel, height, width,
+      A, colStrideA, rowStrideA, B, colStrideB, rowStrideB );
+}
+
 template<typename T>
 inline void 
 MemZero( T* buffer, std::size_t numEntries )
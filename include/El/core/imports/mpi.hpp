@@ -17,6 +17,7 @@ namespace mpi {
 #if defined(EL_HAVE_MPI3_NONBLOCKING_COLLECTIVES) || \
     defined(EL_HAVE_MPIX_NONBLOCKING_COLLECTIVES)
 #define EL_HAVE_NONBLOCKING 1
+#define EL_HAVE_NONBLOCKING_COLLECTIVES
 #else
 #define EL_HAVE_NONBLOCKING 0
 #endif
@@ -67,6 +68,7 @@ typedef MPI_Errhandler ErrorHandler;
 typedef MPI_Request Request;
 typedef MPI_Status Status;
 typedef MPI_User_function UserFunction;
+typedef MPI_Win Window;
 
 // Standard constants
 const int ANY_SOURCE = MPI_ANY_SOURCE;
@@ -91,6 +93,7 @@ const ErrorHandler ERRORS_RETURN = MPI_ERRORS_RETURN;
 const ErrorHandler ERRORS_ARE_FATAL = MPI_ERRORS_ARE_FATAL;
 const Group GROUP_EMPTY = MPI_GROUP_EMPTY;
 const Request REQUEST_NULL = MPI_REQUEST_NULL;
+const Window WINDOW_NULL = MPI_WIN_NULL;
 const Op MAX = MPI_MAX;
 const Op MIN = MPI_MIN;
 const Op MAXLOC = MPI_MAXLOC;
@@ -134,6 +137,52 @@ void Free( Comm& comm );
 bool Congruent( Comm comm1, Comm comm2 );
 void ErrorHandlerSet( Comm comm, ErrorHandler errorHandler );
 
+// Attach a pointer to a communicator under a key, which is handed to the
+// deleter of the key when the communicator is freed. Attributes are not
+// inherited by duplicates of the communicator.
+typedef void (AttributeDeleter)( void* value );
+int CreateKey( AttributeDeleter* deleter );
+void SetAttribute( Comm comm, int key, void* value );
+// Return the attribute of the given key (or nullptr if it has not been set)
+void* GetAttribute( Comm comm, int key );
+
+// Split a communicator into the processes which share our node (and can 
+// therefore share memory) and the processes with the same node rank as us
+void SplitNode( Comm comm, Comm& nodeComm, Comm& interNodeComm );
+
+// Shared-memory windows
+// ---------------------
+// Allocate 'numBytes' bytes which are shared by all members of 'comm' (which 
+// must share a node) and return a pointer to them
+byte* WindowAllocateShared( std::size_t numBytes, Comm comm, Window& window );
+// Ensure that the local view of the window is consistent with memory
+void WindowSync( Window window );
+void WindowFree( Window& window );
+
+// One-sided communication
+// -----------------------
+// Expose the 'numEntries' entries of 'buf' to the members of 'comm' and open a
+// passive-target epoch on every member (the window is closed by WindowFree)
+template<typename T>
+void WindowCreate( T* buf, Int numEntries, Comm comm, Window& window );
+// Add the column-major height x width matrix 'buf' into the matrix with
+// leading dimension 'targetLDim' which begins 'targetOffset' entries into the
+// window of process 'target'
+template<typename T>
+void Accumulate
+( const T* buf, Int height, Int width,
+  int target, Int targetOffset, Int targetLDim, Window window );
+// Copy the height x width matrix described as above into 'buf'
+template<typename T>
+void Get
+( T* buf, Int height, Int width,
+  int target, Int targetOffset, Int targetLDim, Window window );
+// Complete all outstanding operations at both their origins and targets
+void WindowFlush( Window window );
+// Complete all outstanding operations at their origins (so that the origin
+// buffers may be reused)
+void WindowFlushLocal( Window window );
+
 // Cartesian communicator routines
 void CartCreate
 ( Comm comm, int numDims, const int* dimensions, const int* periods, 
@@ -175,23 +224,83 @@ void Wait( Request& request, Status& status );
 void WaitAll( int numRequests, Request* requests );
 void WaitAll( int numRequests, Request* requests, Status* statuses );
 bool Test( Request& request );
+bool TestAll( int numRequests, Request* requests );
 bool IProbe( int source, int tag, Comm comm, Status& status );
 
 template<typename T>
 int GetCount( Status& status );
 
+// Parallel file I/O
+// =================
+typedef MPI_File File;
+typedef MPI_Offset Offset;
+const int MODE_RDONLY = MPI_MODE_RDONLY;
+const int MODE_WRONLY = MPI_MODE_WRONLY;
+const int MODE_RDWR = MPI_MODE_RDWR;
+const int MODE_CREATE = MPI_MODE_CREATE;
+
+void FileOpen( Comm comm, const std::string filename, int mode, File& file );
+void FileClose( File& file );
+Offset FileSize( File file );
+void FileSetSize( File file, Offset size );
+// NOTE: The following byte-level routines transparently handle byte counts 
+//       which are too large to be represented by an int. The collective 
+//       variants must be called by every process which opened the file.
+void FileReadAt( File file, Offset offset, byte* buf, Offset numBytes );
+void FileReadAtAll( File file, Offset offset, byte* buf, Offset numBytes );
+void FileWriteAt( File file, Offset offset, const byte* buf, Offset numBytes );
+void FileWriteAtAll
+( File file, Offset offset, const byte* buf, Offset numBytes );
+// Start independent nonblocking transfers, appending a request for each
+// piece to 'requests'. The buffer must remain valid until they complete, and
+// the file view may not be changed in the meantime.
+void FileIReadAt
+( File file, Offset offset, byte* buf, Offset numBytes,
+  std::vector<Request>& requests );
+void FileIWriteAt
+( File file, Offset offset, const byte* buf, Offset numBytes,
+  std::vector<Request>& requests );
+// Restrict the visible portion of the file to the byte ranges
+//   disp + blockOffsets[j] + runOffsets[k] + [0,runLengths[k]),
+// for each j and k, in that order, so that the subsequent FileReadAll and 
+// FileWriteAll calls transfer a packed buffer to/from a scattered pattern.
+// The offsets are required to be nondecreasing, and runs longer than the
+// maximum message count are split into several pieces.
+void FileSetView
+( File file, Offset disp, 
+  const std::vector<Offset>& runOffsets, const std::vector<Offset>& runLengths,
+  const std::vector<Offset>& blockOffsets );
+void FileResetView( File file );
+void FileReadAll( File file, byte* buf, Offset numBytes );
+void FileWriteAll( File file, const byte* buf, Offset numBytes );
+
+// NOTE: The counts of the following point-to-point and (uniform) collective
+//       routines may exceed the range of an int: such messages are sent as a
+//       single entry of a contiguous derived datatype, and reductions are
+//       performed in pieces. If any of the counts or displacements of a
+//       variable-length routine are too large, the exchange instead uses
+//       MPI_Alltoallw with a separate derived datatype for each process.
+//       Since the processes must agree upon which form is used, the
+//       variable-length Gather and AllToAll begin with a (small) collective.
+
+// The maximum number of entries which is passed directly to MPI (by default,
+// the largest int). Since collectives must agree upon how messages are formed,
+// every process must use the same value.
+void SetMaxMessageCount( Int maxCount );
+Int MaxMessageCount();
+
 // Point-to-point communication
 // ============================
 
 // Send
 // ----
 template<typename R>
-void TaggedSend( const R* buf, int count, int to, int tag, Comm comm );
+void TaggedSend( const R* buf, Int count, int to, int tag, Comm comm );
 template<typename R>
-void TaggedSend( const Complex<R>* buf, int count, int to, int tag, Comm comm );
+void TaggedSend( const Complex<R>* buf, Int count, int to, int tag, Comm comm );
 // If the tag is irrelevant
 template<typename T>
-void Send( const T* buf, int count, int to, Comm comm );
+void Send( const T* buf, Int count, int to, Comm comm );
 // If the send-count is one
 template<typename T>
 void TaggedSend( T b, int to, int tag, Comm comm );
@@ -203,14 +312,14 @@ void Send( T b, int to, Comm comm );
 // -----------------
 template<typename R>
 void TaggedISend
-( const R* buf, int count, int to, int tag, Comm comm, Request& request );
+( const R* buf, Int count, int to, int tag, Comm comm, Request& request );
 template<typename R>
 void TaggedISend
-( const Complex<R>* buf, int count, int to, int tag, Comm comm, 
+( const Complex<R>* buf, Int count, int to, int tag, Comm comm, 
   Request& request );
 // If the tag is irrelevant
 template<typename T>
-void ISend( const T* buf, int count, int to, Comm comm, Request& request );
+void ISend( const T* buf, Int count, int to, Comm comm, Request& request );
 // If the send count is one
 template<typename T>
 void TaggedISend( T b, int to, int tag, Comm comm, Request& request );
@@ -222,14 +331,14 @@ void ISend( T b, int to, Comm comm, Request& request );
 // -----------------------------
 template<typename R>
 void TaggedISSend
-( const R* buf, int count, int to, int tag, Comm comm, Request& request );
+( const R* buf, Int count, int to, int tag, Comm comm, Request& request );
 template<typename R>
 void TaggedISSend
-( const Complex<R>* buf, int count, int to, int tag, Comm comm, 
+( const Complex<R>* buf, Int count, int to, int tag, Comm comm, 
   Request& request );
 // If the tag is irrelevant
 template<typename T>
-void ISSend( const T* buf, int count, int to, Comm comm, Request& request );
+void ISSend( const T* buf, Int count, int to, Comm comm, Request& request );
 // If the send count is one
 template<typename T>
 void TaggedISSend( T b, int to, int tag, Comm comm, Request& request );
@@ -240,12 +349,12 @@ void ISSend( T b, int to, Comm comm, Request& request );
 // Recv
 // ----
 template<typename R>
-void TaggedRecv( R* buf, int count, int from, int tag, Comm comm );
+void TaggedRecv( R* buf, Int count, int from, int tag, Comm comm );
 template<typename R>
-void TaggedRecv( Complex<R>* buf, int count, int from, int tag, Comm comm );
+void TaggedRecv( Complex<R>* buf, Int count, int from, int tag, Comm comm );
 // If the tag is irrelevant
 template<typename T>
-void Recv( T* buf, int count, int from, Comm comm );
+void Recv( T* buf, Int count, int from, Comm comm );
 // If the recv count is one
 template<typename T>
 T TaggedRecv( int from, int tag, Comm comm );
@@ -257,13 +366,13 @@ T Recv( int from, Comm comm );
 // -----------------
 template<typename R>
 void TaggedIRecv
-( R* buf, int count, int from, int tag, Comm comm, Request& request );
+( R* buf, Int count, int from, int tag, Comm comm, Request& request );
 template<typename R>
 void TaggedIRecv
-( Complex<R>* buf, int count, int from, int tag, Comm comm, Request& request );
+( Complex<R>* buf, Int count, int from, int tag, Comm comm, Request& request );
 // If the tag is irrelevant
 template<typename T>
-void IRecv( T* buf, int count, int from, Comm comm, Request& request );
+void IRecv( T* buf, Int count, int from, Comm comm, Request& request );
 // If the recv count is one
 template<typename T>
 T TaggedIRecv( int from, int tag, Comm comm, Request& request );
@@ -275,17 +384,17 @@ T IRecv( int from, Comm comm, Request& request );
 // --------
 template<typename R>
 void TaggedSendRecv
-( const R* sbuf, int sc, int to,   int stag,
-        R* rbuf, int rc, int from, int rtag, Comm comm );
+( const R* sbuf, Int sc, int to,   int stag,
+        R* rbuf, Int rc, int from, int rtag, Comm comm );
 template<typename R>
 void TaggedSendRecv
-( const Complex<R>* sbuf, int sc, int to,   int stag,
-        Complex<R>* rbuf, int rc, int from, int rtag, Comm comm );
+( const Complex<R>* sbuf, Int sc, int to,   int stag,
+        Complex<R>* rbuf, Int rc, int from, int rtag, Comm comm );
 // If the tags are irrelevant
 template<typename T>
 void SendRecv
-( const T* sbuf, int sc, int to,
-        T* rbuf, int rc, int from, Comm comm );
+( const T* sbuf, Int sc, int to,
+        T* rbuf, Int rc, int from, Comm comm );
 // If the send and recv counts are one
 template<typename T>
 T TaggedSendRecv( T sb, int to, int stag, int from, int rtag, Comm comm );
@@ -297,13 +406,13 @@ T SendRecv( T sb, int to, int from, Comm comm );
 // ----------------------
 template<typename R>
 void TaggedSendRecv
-( R* buf, int count, int to, int stag, int from, int rtag, Comm comm );
+( R* buf, Int count, int to, int stag, int from, int rtag, Comm comm );
 template<typename R>
 void TaggedSendRecv
-( Complex<R>* buf, int count, int to, int stag, int from, int rtag, Comm comm );
+( Complex<R>* buf, Int count, int to, int stag, int from, int rtag, Comm comm );
 // If the tags don't matter
 template<typename T>
-void SendRecv( T* buf, int count, int to, int from, Comm comm );
+void SendRecv( T* buf, Int count, int to, int from, Comm comm );
 
 // Collective communication
 // ========================
@@ -311,9 +420,9 @@ void SendRecv( T* buf, int count, int to, int from, Comm comm );
 // Broadcast
 // ---------
 template<typename R>
-void Broadcast( R* buf, int count, int root, Comm comm );
+void Broadcast( R* buf, Int count, int root, Comm comm );
 template<typename R>
-void Broadcast( Complex<R>* buf, int count, int root, Comm comm );
+void Broadcast( Complex<R>* buf, Int count, int root, Comm comm );
 // If the message length is one
 template<typename T>
 void Broadcast( T& b, int root, Comm comm );
@@ -323,10 +432,10 @@ void Broadcast( T& b, int root, Comm comm );
 // ----------------------
 template<typename R>
 void IBroadcast
-( R* buf, int count, int root, Comm comm, Request& request );
+( R* buf, Int count, int root, Comm comm, Request& request );
 template<typename R>
 void IBroadcast
-( Complex<R>* buf, int count, int root, Comm comm, Request& request );
+( Complex<R>* buf, Int count, int root, Comm comm, Request& request );
 // If the message length is one
 template<typename T>
 void IBroadcast( T& b, int root, Comm comm, Request& request );
@@ -336,110 +445,136 @@ void IBroadcast( T& b, int root, Comm comm, Request& request );
 // ------
 template<typename R>
 void Gather
-( const R* sbuf, int sc,
-        R* rbuf, int rc, int root, Comm comm );
+( const R* sbuf, Int sc,
+        R* rbuf, Int rc, int root, Comm comm );
 template<typename R>
 void  Gather
-( const Complex<R>* sbuf, int sc,
-        Complex<R>* rbuf, int rc, int root, Comm comm );
+( const Complex<R>* sbuf, Int sc,
+        Complex<R>* rbuf, Int rc, int root, Comm comm );
 
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
 // Non-blocking gather
 // -------------------
 template<typename R>
 void IGather
-( const R* sbuf, int sc,
-        R* rbuf, int rc, int root, Comm comm, Request& request );
+( const R* sbuf, Int sc,
+        R* rbuf, Int rc, int root, Comm comm, Request& request );
 template<typename R>
 void IGather
-( const Complex<R>* sbuf, int sc,
-        Complex<R>* rbuf, int rc, int root, Comm comm, Request& request );
+( const Complex<R>* sbuf, Int sc,
+        Complex<R>* rbuf, Int rc, int root, Comm comm, Request& request );
 #endif
 
 // Gather with variable recv sizes
 // -------------------------------
 template<typename R>
 void Gather
-( const R* sbuf, int sc,
-        R* rbuf, const int* rcs, const int* rds, int root, Comm comm );
+( const R* sbuf, Int sc,
+        R* rbuf, const Int* rcs, const Int* rds, int root, Comm comm );
 template<typename R>
 void Gather
-( const Complex<R>* sbuf, int sc,
-        Complex<R>* rbuf, const int* rcs, const int* rds, 
+( const Complex<R>* sbuf, Int sc,
+        Complex<R>* rbuf, const Int* rcs, const Int* rds, 
   int root, Comm comm );
 
 // AllGather
 // ---------
 template<typename R>
 void AllGather
-( const R* sbuf, int sc,
-        R* rbuf, int rc, Comm comm );
+( const R* sbuf, Int sc,
+        R* rbuf, Int rc, Comm comm );
 template<typename R>
 void AllGather
-( const Complex<R>* sbuf, int sc,
-        Complex<R>* rbuf, int rc, Comm comm );
+( const Complex<R>* sbuf, Int sc,
+        Complex<R>* rbuf, Int rc, Comm comm );
+
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+// Non-blocking AllGather
+// ----------------------
+template<typename R>
+void IAllGather
+( const R* sbuf, Int sc,
+        R* rbuf, Int rc, Comm comm, Request& request );
+template<typename R>
+void IAllGather
+( const Complex<R>* sbuf, Int sc,
+        Complex<R>* rbuf, Int rc, Comm comm, Request& request );
+#endif
 
 // AllGather with variable recv sizes
 // ----------------------------------
 template<typename R>
 void AllGather
-( const R* sbuf, int sc,
-        R* rbuf, const int* rcs, const int* rds, Comm comm );
+( const R* sbuf, Int sc,
+        R* rbuf, const Int* rcs, const Int* rds, Comm comm );
 template<typename R>
 void AllGather
-( const Complex<R>* sbuf, int sc,
-        Complex<R>* rbuf, const int* rcs, const int* rds, Comm comm );
+( const Complex<R>* sbuf, Int sc,
+        Complex<R>* rbuf, const Int* rcs, const Int* rds, Comm comm );
 
 // Scatter
 // -------
 template<typename R>
 void Scatter
-( const R* sbuf, int sc,
-        R* rbuf, int rc, int root, Comm comm );
+( const R* sbuf, Int sc,
+        R* rbuf, Int rc, int root, Comm comm );
 template<typename R>
 void Scatter
-( const Complex<R>* sbuf, int sc,
-        Complex<R>* rbuf, int rc, int root, Comm comm );
+( const Complex<R>* sbuf, Int sc,
+        Complex<R>* rbuf, Int rc, int root, Comm comm );
 // In-place option
 template<typename R>
-void Scatter( R* buf, int sc, int rc, int root, Comm comm );
+void Scatter( R* buf, Int sc, Int rc, int root, Comm comm );
 template<typename R>
-void Scatter( Complex<R>* buf, int sc, int rc, int root, Comm comm );
+void Scatter( Complex<R>* buf, Int sc, Int rc, int root, Comm comm );
 
 // AllToAll
 // --------
 template<typename R>
 void AllToAll
-( const R* sbuf, int sc,
-        R* rbuf, int rc, Comm comm );
+( const R* sbuf, Int sc,
+        R* rbuf, Int rc, Comm comm );
 template<typename R>
 void AllToAll
-( const Complex<R>* sbuf, int sc,
-        Complex<R>* rbuf, int rc, Comm comm );
+( const Complex<R>* sbuf, Int sc,
+        Complex<R>* rbuf, Int rc, Comm comm );
+
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+// Non-blocking AllToAll
+// ---------------------
+template<typename R>
+void IAllToAll
+( const R* sbuf, Int sc,
+        R* rbuf, Int rc, Comm comm, Request& request );
+template<typename R>
+void IAllToAll
+( const Complex<R>* sbuf, Int sc,
+        Complex<R>* rbuf, Int rc, Comm comm, Request& request );
+#endif
 
 // AllToAll with non-uniform send/recv sizes
 // -----------------------------------------
 template<typename R>
 void AllToAll
-( const R* sbuf, const int* scs, const int* sds,
-        R* rbuf, const int* rcs, const int* rds, Comm comm );
+( const R* sbuf, const Int* scs, const Int* sds,
+        R* rbuf, const Int* rcs, const Int* rds, Comm comm );
 template<typename R>
 void AllToAll
-( const Complex<R>* sbuf, const int* scs, const int* sds,
-        Complex<R>* rbuf, const int* rcs, const int* rds, Comm comm );
+( const Complex<R>* sbuf, const Int* scs, const Int* sds,
+        Complex<R>* rbuf, const Int* rcs, const Int* rds, Comm comm );
 
 // Reduce
 // ------
 template<typename T>
 void Reduce
-( const T* sbuf, T* rbuf, int count, Op op, int root, Comm comm );
+( const T* sbuf, T* rbuf, Int count, Op op, int root, Comm comm );
 template<typename R>
 void Reduce
-( const Complex<R>* sbuf, Complex<R>* rbuf, int count, Op op, 
+( const Complex<R>* sbuf, Complex<R>* rbuf, Int count, Op op, 
   int root, Comm comm );
 // Default to mpi::SUM
 template<typename T>
-void Reduce( const T* sbuf, T* rbuf, int count, int root, Comm comm );
+void Reduce( const T* sbuf, T* rbuf, Int count, int root, Comm comm );
 // With a message-size of one
 template<typename T>
 T Reduce( T sb, Op op, int root, Comm comm );
@@ -450,23 +585,23 @@ T Reduce( T sb, int root, Comm comm );
 // Single-buffer reduce
 // --------------------
 template<typename T>
-void Reduce( T* buf, int count, Op op, int root, Comm comm );
+void Reduce( T* buf, Int count, Op op, int root, Comm comm );
 template<typename R>
-void Reduce( Complex<R>* buf, int count, Op op, int root, Comm comm );
+void Reduce( Complex<R>* buf, Int count, Op op, int root, Comm comm );
 // Default to mpi::SUM
 template<typename T>
-void Reduce( T* buf, int count, int root, Comm comm );
+void Reduce( T* buf, Int count, int root, Comm comm );
 
 // AllReduce
 // ---------
 template<typename T>
-void AllReduce( const T* sbuf, T* rbuf, int count, Op op, Comm comm );
+void AllReduce( const T* sbuf, T* rbuf, Int count, Op op, Comm comm );
 template<typename R>
 void AllReduce
-( const Complex<R>* sbuf, Complex<R>* rbuf, int count, Op op, Comm comm );
+( const Complex<R>* sbuf, Complex<R>* rbuf, Int count, Op op, Comm comm );
 // Default to mpi::SUM
 template<typename T>
-void AllReduce( const T* sbuf, T* rbuf, int count, Comm comm );
+void AllReduce( const T* sbuf, T* rbuf, Int count, Comm comm );
 // If the message-length is one
 template<typename T>
 T AllReduce( T sb, Op op, Comm comm );
@@ -477,34 +612,60 @@ T AllReduce( T sb, Comm comm );
 // Single-buffer AllReduce
 // -----------------------
 template<typename T>
-void AllReduce( T* buf, int count, Op op, Comm comm );
+void AllReduce( T* buf, Int count, Op op, Comm comm );
 template<typename R>
-void AllReduce( Complex<R>* buf, int count, Op op, Comm comm );
+void AllReduce( Complex<R>* buf, Int count, Op op, Comm comm );
 // Default to mpi::SUM
 template<typename T>
-void AllReduce( T* buf, int count, Comm comm );
+void AllReduce( T* buf, Int count, Comm comm );
+
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+// Non-blocking AllReduce
+// ----------------------
+// NOTE: Unlike their blocking counterparts, non-blocking reductions are not
+//       split into pieces, and so the count may not exceed MaxMessageCount().
+template<typename T>
+void IAllReduce
+( const T* sbuf, T* rbuf, Int count, Op op, Comm comm, Request& request );
+template<typename R>
+void IAllReduce
+( const Complex<R>* sbuf, Complex<R>* rbuf, Int count, Op op, Comm comm,
+  Request& request );
+#endif
 
 // ReduceScatter
 // -------------
 template<typename R>
 void ReduceScatter
-( R* sbuf, R* rbuf, int rc, Op op, Comm comm );
+( R* sbuf, R* rbuf, Int rc, Op op, Comm comm );
 template<typename R>
 void ReduceScatter
-( Complex<R>* sbuf, Complex<R>* rbuf, int rc, Op op, Comm comm );
+( Complex<R>* sbuf, Complex<R>* rbuf, Int rc, Op op, Comm comm );
 // Default to mpi::SUM
 template<typename T>
-void ReduceScatter( T* sbuf, T* rbuf, int rc, Comm comm );
+void ReduceScatter( T* sbuf, T* rbuf, Int rc, Comm comm );
 
 // Single-buffer ReduceScatter
 // ---------------------------
 template<typename R>
-void ReduceScatter( R* buf, int rc, Op op, Comm comm );
+void ReduceScatter( R* buf, Int rc, Op op, Comm comm );
 template<typename R>
-void ReduceScatter( Complex<R>* buf, int rc, Op op, Comm comm );
+void ReduceScatter( Complex<R>* buf, Int rc, Op op, Comm comm );
 // Default to mpi::SUM
 template<typename T>
-void ReduceScatter( T* buf, int rc, Comm comm );
+void ReduceScatter( T* buf, Int rc, Comm comm );
+
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+// Non-blocking ReduceScatter
+// --------------------------
+template<typename R>
+void IReduceScatter
+( const R* sbuf, R* rbuf, Int rc, Op op, Comm comm, Request& request );
+template<typename R>
+void IReduceScatter
+( const Complex<R>* sbuf, Complex<R>* rbuf, Int rc, Op op, Comm comm,
+  Request& request );
+#endif
 
 // Variable-length ReduceScatter
 // -----------------------------
@@ -518,6 +679,21 @@ void ReduceScatter
 template<typename T>
 void ReduceScatter( const T* sbuf, T* rbuf, const int* rcs, Comm comm );
 
+// Two-level collectives
+// ---------------------
+// Only the first process on each node communicates over the network, using
+// the communicators returned by SplitNode (or Grid::NodeComm and 
+// Grid::InterNodeComm). If 'broadcast' is false, the gathered data is only
+// returned to the first process on each node (e.g., for shared memory).
+template<typename T>
+void HierarchicalAllReduce
+( T* buf, Int count, Op op, Comm nodeComm, Comm interNodeComm );
+template<typename T>
+void HierarchicalAllGather
+( const T* sbuf, Int sc,
+        T* rbuf, Int rc, Comm comm, Comm nodeComm, Comm interNodeComm,
+  bool broadcast=true );
+
 template<typename R>
 void MaxLocFunc
 ( void* in, void* out, int* length, mpi::Datatype* datatype );
@@ -657,14 +833,14 @@ template<> inline Datatype TypeMap<ValueIntPair<double>>()
 template<typename T>
 void SparseAllToAll
 ( const std::vector<T>& sendBuffer,
-  const std::vector<int>& sendCounts, const std::vector<int>& sendDispls,
+  const std::vector<Int>& sendCounts, const std::vector<Int>& sendDispls,
         std::vector<T>& recvBuffer,
-  const std::vector<int>& recvCounts, const std::vector<int>& recvDispls,
+  const std::vector<Int>& recvCounts, const std::vector<Int>& recvDispls,
         mpi::Comm comm );
 
 void VerifySendsAndRecvs
-( const std::vector<int>& sendCounts,
-  const std::vector<int>& recvCounts, mpi::Comm comm );
+( const std::vector<Int>& sendCounts,
+  const std::vector<Int>& recvCounts, mpi::Comm comm );
 
 } // mpi
 } // elem
@@ -279,9 +279,9 @@ enum ViewType
     VIEW = 0x1,
     OWNER_FIXED = 0x2,
     VIEW_FIXED = 0x3,
-    LOCKED_OWNER = 0x4, // unused
+    LOCKED_OWNER = 0x4, // e.g., read-only memory-mapped files
     LOCKED_VIEW = 0x5,
-    LOCKED_OWNER_FIXED = 0x6, // unused
+    LOCKED_OWNER_FIXED = 0x6, // e.g., node-shared data on non-writers
     LOCKED_VIEW_FIXED = 0x7
 };
 static inline bool IsViewing( ViewType v )
@@ -406,6 +406,7 @@ enum FileFormat
     PPM,
     XBM,
     XPM,
+    BINARY_CSR,
     FileFormat_MAX // For detecting number of entries in enum
 };
 }
@@ -28,6 +28,7 @@ typedef enum {
   EL_PPM,
   EL_XBM,
   EL_XPM,
+  EL_BINARY_CSR,
   EL_FileFormat_MAX
 } ElFileFormat;
 
@@ -19,6 +19,19 @@ FileFormat DetectFormat( const std::string filename );
 
 std::ifstream::pos_type FileSize( std::ifstream& file );
 
+// Restrict the view of a file which stores a column-major matrix, after 
+// 'metaBytes' bytes of metadata, to the entries of A owned by this process.
+// If 'unique' is true, only one member of each redundant set of processes 
+// is given a nonempty view. Returns whether or not the view was nonempty.
+template<typename T>
+bool SetFileView
+( mpi::File file, const AbstractDistMatrix<T>& A, mpi::Offset metaBytes, 
+  bool unique=false );
+template<typename T>
+bool SetFileView
+( mpi::File file, const AbstractBlockDistMatrix<T>& A, mpi::Offset metaBytes,
+  bool unique=false );
+
 // TODO: Many more color maps
 namespace ColorMapNS {
 enum ColorMap
@@ -174,6 +187,108 @@ template<typename T>
 void Read
 ( AbstractBlockDistMatrix<T>& A, 
   const std::string filename, FileFormat format=AUTO, bool sequential=false );
+// Memory-map a BINARY or BINARY_FLAT file rather than copying it into a new
+// buffer. Unless 'copyOnWrite' is true, A is locked to the (shared) mapping.
+// In either case, the file is unmapped once A releases its buffer.
+template<typename T>
+void ReadMapped
+( Matrix<T>& A, const std::string filename, FileFormat format=AUTO,
+  bool copyOnWrite=false );
+template<typename T>
+void Read
+( SparseMatrix<T>& A, const std::string filename, FileFormat format=AUTO );
+template<typename T>
+void Read
+( DistSparseMatrix<T>& A, const std::string filename, FileFormat format=AUTO );
+
+// Checkpoint/restart
+// ==================
+// Collectively save A, along with its distribution and a checksum, to the
+// shared file 'basename'.ckpt. Since the data is stored independently of the
+// distribution, Restart can load it onto an arbitrary grid (or communicator).
+template<typename T>
+void Checkpoint
+( const AbstractDistMatrix<T>& A, std::string basename="DistMatrix" );
+template<typename T>
+void Checkpoint
+( const DistSparseMatrix<T>& A, std::string basename="DistSparseMatrix" );
+template<typename T>
+void Checkpoint
+( const DistMultiVec<T>& X, std::string basename="DistMultiVec" );
+
+template<typename T>
+void Restart( AbstractDistMatrix<T>& A, const std::string filename );
+template<typename T>
+void Restart( DistSparseMatrix<T>& A, const std::string filename );
+template<typename T>
+void Restart( DistMultiVec<T>& X, const std::string filename );
+
+// Nonblocking variants of Checkpoint and Restart, whose bulk data is moved
+// with independent nonblocking MPI-IO. The header and file view are set up
+// collectively before returning, and the local data of a checkpoint is
+// copied out immediately, so the source may be modified while the transfer
+// is pending. The target of a pending restart is resized up front, but it
+// must not be accessed until the transfer is complete.
+//
+// Wait must eventually be called by every process which started the
+// transfer (if it was not, the destructor does so), since it closes the file
+// and, for a restart, unpacks the data and verifies the checksum; Test only
+// reports whether this process's transfers have completed locally.
+class CheckpointRequest;
+
+template<typename T>
+CheckpointRequest ICheckpoint
+( const AbstractDistMatrix<T>& A, std::string basename="DistMatrix" );
+template<typename T>
+CheckpointRequest ICheckpoint
+( const DistMultiVec<T>& X, std::string basename="DistMultiVec" );
+
+template<typename T>
+CheckpointRequest IRestart
+( AbstractDistMatrix<T>& A, const std::string filename );
+template<typename T>
+CheckpointRequest IRestart( DistMultiVec<T>& X, const std::string filename );
+
+class CheckpointRequest
+{
+public:
+    CheckpointRequest();
+    CheckpointRequest( CheckpointRequest&& req );
+    ~CheckpointRequest();
+
+    CheckpointRequest& operator=( CheckpointRequest&& req );
+
+    void Wait();
+    bool Test();
+    bool Pending() const { return pending_; }
+
+private:
+    bool pending_;
+    mpi::File file_;
+    std::vector<mpi::Request> requests_;
+    std::function<void()> finish_;
+
+    CheckpointRequest( const CheckpointRequest& req ) = delete;
+    CheckpointRequest& operator=( const CheckpointRequest& req ) = delete;
+
+    template<typename T,typename DistType>
+    void StartCheckpoint( const DistType& A, std::string basename );
+    template<typename T,typename DistType>
+    void StartRestart( DistType& A, const std::string filename );
+
+    template<typename T>
+    friend CheckpointRequest ICheckpoint
+    ( const AbstractDistMatrix<T>& A, std::string basename );
+    template<typename T>
+    friend CheckpointRequest ICheckpoint
+    ( const DistMultiVec<T>& X, std::string basename );
+    template<typename T>
+    friend CheckpointRequest IRestart
+    ( AbstractDistMatrix<T>& A, const std::string filename );
+    template<typename T>
+    friend CheckpointRequest IRestart
+    ( DistMultiVec<T>& X, const std::string filename );
+};
 
 // Spy
 // ===
@@ -202,6 +317,14 @@ template<typename T>
 void Write
 ( const AbstractBlockDistMatrix<T>& A, std::string basename="BlockDistMatrix",
   FileFormat format=BINARY, std::string title="" );
+template<typename T>
+void Write
+( const SparseMatrix<T>& A, std::string basename="SparseMatrix",
+  FileFormat format=MATRIX_MARKET );
+template<typename T>
+void Write
+( const DistSparseMatrix<T>& A, std::string basename="DistSparseMatrix",
+  FileFormat format=MATRIX_MARKET );
 
 } // namespace El
 
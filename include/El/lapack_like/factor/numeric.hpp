@@ -17,6 +17,50 @@ namespace El {
 // Forward declaration
 template<typename T> class DistNodalMultiVec;
 
+// The communication pattern of DistNodalMultiVec::Pull and Push, which only
+// depends upon the reordering, the analysis, and the height of the
+// multi-vector. It may therefore be formed once and reused for every block of
+// columns streamed through the elimination tree.
+struct NodalRedistMeta
+{
+    bool ready;
+    int height;
+    std::vector<Int> sendSizes, sendOffs,
+                     recvSizes, recvOffs;
+    // The local rows of the DistMultiVec requested by each process
+    std::vector<int> sendInds;
+    // The position in the received buffer of each local row of the nodal
+    // multi-vector (in the order of the local and then distributed nodes)
+    std::vector<int> recvPos;
+
+    NodalRedistMeta() : ready(false), height(0) { }
+
+    void Clear()
+    {
+        ready = false;
+        height = 0;
+        SwapClear( sendSizes );
+        SwapClear( sendOffs );
+        SwapClear( recvSizes );
+        SwapClear( recvOffs );
+        SwapClear( sendInds );
+        SwapClear( recvPos );
+    }
+};
+
+// A redistribution of a block of columns between a DistMultiVec and the
+// elimination tree which was started with nonblocking point-to-point messages
+// (so that it may overlap the solve of another block)
+template<typename T>
+struct NodalRedistRequest
+{
+    int colOff, width;
+    std::vector<T> sendVals, recvVals;
+    std::vector<mpi::Request> requests;
+
+    NodalRedistRequest() : colOff(0), width(0) { }
+};
+
 // For handling a matrix distributed in a [MC,MR] manner over each node
 // of the elimination tree
 template<typename T>
@@ -74,6 +118,37 @@ public:
     ( const DistMap& inverseMap, const DistSymmInfo& info,
             DistMultiVec<T>& X ) const;
 
+    // Redistribute columns [colOff,colOff+width) of X to and from the
+    // elimination tree (Push requires X to already have the proper size).
+    // 'meta' is formed by the first call and reused by subsequent ones.
+    void Pull
+    ( const DistMap& inverseMap, const DistSymmInfo& info,
+      const DistMultiVec<T>& X, int colOff, int width,
+      NodalRedistMeta& meta );
+    void Push
+    ( const DistMap& inverseMap, const DistSymmInfo& info,
+            DistMultiVec<T>& X, int colOff,
+      NodalRedistMeta& meta ) const;
+
+    // Nonblocking versions of the above. The columns of X are packed when a
+    // Pull is started (so that X may then be reused) and are only written
+    // when a Push is finished. Redistributions which are simultaneously in
+    // flight must use different tags.
+    void StartPull
+    ( const DistMap& inverseMap, const DistSymmInfo& info,
+      const DistMultiVec<T>& X, int colOff, int width,
+      NodalRedistMeta& meta, NodalRedistRequest<T>& req, int tag ) const;
+    void FinishPull
+    ( const DistSymmInfo& info, const NodalRedistMeta& meta,
+      NodalRedistRequest<T>& req );
+    void StartPush
+    ( const DistMap& inverseMap, const DistSymmInfo& info,
+      const DistMultiVec<T>& X, int colOff,
+      NodalRedistMeta& meta, NodalRedistRequest<T>& req, int tag ) const;
+    void FinishPush
+    ( DistMultiVec<T>& X, const NodalRedistMeta& meta,
+      NodalRedistRequest<T>& req ) const;
+
     int Height() const;
     int Width() const;
 
@@ -84,6 +159,12 @@ public:
 
 private:
     int height_, width_;
+
+    void UnpackPull
+    ( const DistSymmInfo& info, int height, int width,
+      const NodalRedistMeta& meta, const std::vector<T>& recvVals );
+    void PackPush
+    ( const NodalRedistMeta& meta, std::vector<T>& sendVals ) const;
 };
 
 enum SymmFrontType
@@ -94,7 +175,8 @@ enum SymmFrontType
   LDL_INTRAPIV_1D,        LDL_INTRAPIV_2D,
   LDL_INTRAPIV_SELINV_1D, LDL_INTRAPIV_SELINV_2D,
   BLOCK_LDL_1D,           BLOCK_LDL_2D,
-  BLOCK_LDL_INTRAPIV_1D,  BLOCK_LDL_INTRAPIV_2D
+  BLOCK_LDL_INTRAPIV_1D,  BLOCK_LDL_INTRAPIV_2D,
+  CHOLESKY_1D,            CHOLESKY_2D
 };
 
 inline bool Unfactored( SymmFrontType type )
@@ -108,7 +190,8 @@ inline bool FrontsAre1d( SymmFrontType type )
            type == LDL_INTRAPIV_1D        ||
            type == LDL_INTRAPIV_SELINV_1D ||
            type == BLOCK_LDL_1D           ||
-           type == BLOCK_LDL_INTRAPIV_1D;
+           type == BLOCK_LDL_INTRAPIV_1D  ||
+           type == CHOLESKY_1D;
 }
 
 inline bool BlockFactorization( SymmFrontType type )
@@ -119,6 +202,11 @@ inline bool BlockFactorization( SymmFrontType type )
            type == BLOCK_LDL_INTRAPIV_2D;
 }
 
+// Cholesky factorizations (of Hermitian positive-definite matrices) store
+// the non-unit lower-triangular factors in the fronts and have no diagonal
+inline bool CholeskyFactorization( SymmFrontType type )
+{ return type == CHOLESKY_1D || type == CHOLESKY_2D; }
+
 inline bool SelInvFactorization( SymmFrontType type )
 {
     return type == LDL_SELINV_1D ||
@@ -157,6 +245,8 @@ inline SymmFrontType ConvertTo2d( SymmFrontType type )
     case BLOCK_LDL_2D:           newType = BLOCK_LDL_2D;           break;
     case BLOCK_LDL_INTRAPIV_1D:
     case BLOCK_LDL_INTRAPIV_2D:  newType = BLOCK_LDL_INTRAPIV_2D;  break;
+    case CHOLESKY_1D:
+    case CHOLESKY_2D:            newType = CHOLESKY_2D;            break;
     default: LogicError("Invalid front type");
     }
     return newType;
@@ -182,6 +272,8 @@ inline SymmFrontType ConvertTo1d( SymmFrontType type )
     case BLOCK_LDL_2D:           newType = BLOCK_LDL_1D;           break;
     case BLOCK_LDL_INTRAPIV_1D:
     case BLOCK_LDL_INTRAPIV_2D:  newType = BLOCK_LDL_INTRAPIV_1D;  break;
+    case CHOLESKY_1D:
+    case CHOLESKY_2D:            newType = CHOLESKY_1D;            break;
     default: LogicError("Invalid front type");
     }
     return newType;
@@ -221,7 +313,7 @@ inline SymmFrontType InitialFactorType( SymmFrontType type )
 {
     if( Unfactored(type) )
         LogicError("Front type does not require factorization");
-    if( BlockFactorization(type) )
+    if( BlockFactorization(type) || CholeskyFactorization(type) )
         return ConvertTo2d(type);
     else if( PivotedFactorization(type) )
         return LDL_INTRAPIV_2D;
@@ -229,6 +321,66 @@ inline SymmFrontType InitialFactorType( SymmFrontType type )
         return LDL_2D;
 }
 
+// A block low-rank (BLR) representation of a dense matrix: the matrix is split
+// into square tiles (except for those on its bottom and right edges), and each
+// tile is stored either densely or as the product of two thin matrices.
+template<typename T>
+struct BLRMatrix
+{
+    Int height, width, tileSize;
+
+    // Tile (i,j) is stored in entry i+j*NumTileRows() and is given by U V
+    // if V has a nonzero width and by U otherwise
+    std::vector<Matrix<T>> U, V;
+
+    BLRMatrix() : height(0), width(0), tileSize(1) { }
+
+    Int Height() const { return height; }
+    Int Width() const { return width; }
+    Int NumTileRows() const { return (height+tileSize-1)/tileSize; }
+    Int NumTileCols() const { return (width+tileSize-1)/tileSize; }
+
+    double NumEntries() const
+    {
+        double numEntries = 0;
+        const Int numTiles = U.size();
+        for( Int k=0; k<numTiles; ++k )
+            numEntries += double(U[k].Height())*U[k].Width() +
+                          double(V[k].Height())*V[k].Width();
+        return numEntries;
+    }
+
+    void Empty()
+    {
+        height = width = 0;
+        SwapClear( U );
+        SwapClear( V );
+    }
+};
+
+template<typename Real>
+struct BLRCtrl
+{
+    // Only fronts with at least this many rows are compressed
+    Int minHeight;
+    Int tileSize;
+    // The relative tolerance of the interpolative decomposition of each tile
+    Real tol;
+
+    BLRCtrl()
+    : minHeight(1000), tileSize(128),
+      tol(Sqrt(lapack::MachineEpsilon<Real>()))
+    { }
+};
+
+struct BLRStats
+{
+    int numFronts;
+    double numOrigEntries, numEntries;
+
+    BLRStats() : numFronts(0), numOrigEntries(0), numEntries(0) { }
+};
+
 // Only keep track of the left and bottom-right piece of the fronts
 // (with the bottom-right piece stored in workspace) since only the left side
 // needs to be kept after the factorization is complete.
@@ -237,6 +389,8 @@ template<typename T>
 struct SymmFront
 {
     Matrix<T> frontL;
+    // If the front was compressed, frontL only holds its top-left block
+    BLRMatrix<T> blrL;
 
     Matrix<T> diag;
     Matrix<T> subdiag;
@@ -256,6 +410,9 @@ struct DistSymmFront
 
     DistMatrix<T,VC,STAR> front1dL;
     DistMatrix<T> front2dL;
+    // If the front was compressed, front1dL only holds its top-left block
+    // and this holds the local rows of its bottom-left block
+    BLRMatrix<T> blr1dL;
 
     DistMatrix<T,VC,STAR> diag1d;
     DistMatrix<T,VC,STAR> subdiag1d;
@@ -265,13 +422,49 @@ struct DistSymmFront
     mutable DistMatrix<T> work2d;
 };
 
+// The communication pattern and destinations of the nonzeros of a sparse
+// matrix which are loaded into the fronts by DistSymmFrontTree::Initialize.
+// They are saved so that a matrix with the same sparsity pattern may be
+// reloaded (e.g., by an interior point method) without recomputing them.
+struct SymmFrontLoadMeta
+{
+    bool ready;
+    Int numLocalEntries;
+    std::vector<Int> sendSizes, sendOffs,
+                     recvSizes, recvOffs;
+    // The local offsets of the nonzeros to send, in the order they are packed
+    std::vector<int> sendInds;
+    // The front (with the distributed fronts numbered after the local ones),
+    // and the local row and column within it, of each received nonzero.
+    // Nonzeros which are not stored by this process have a front of -1.
+    std::vector<int> recvFronts, recvRows, recvCols;
+
+    SymmFrontLoadMeta() : ready(false), numLocalEntries(0) { }
+
+    void Clear()
+    {
+        ready = false;
+        numLocalEntries = 0;
+        SwapClear( sendSizes );
+        SwapClear( sendOffs );
+        SwapClear( recvSizes );
+        SwapClear( recvOffs );
+        SwapClear( sendInds );
+        SwapClear( recvFronts );
+        SwapClear( recvRows );
+        SwapClear( recvCols );
+    }
+};
+
 template<typename T>
 struct DistSymmFrontTree
 {
     bool isHermitian;
     SymmFrontType frontType;
+    bool compressed;
     std::vector<SymmFront<T>> localFronts;
     std::vector<DistSymmFront<T>> distFronts;
+    SymmFrontLoadMeta loadMeta;
 
     DistSymmFrontTree();
 
@@ -289,6 +482,11 @@ struct DistSymmFrontTree
       const DistSymmInfo& info,
       bool conjugate=false );
 
+    // Reload the fronts with the values of a matrix with the same sparsity
+    // pattern as the one passed to Initialize (reusing the existing front
+    // storage) so that it may be factored again
+    void Refactor( const DistSparseMatrix<T>& A );
+
     void TopLeftMemoryInfo
     ( double& numLocalEntries, double& minLocalEntries, double& maxLocalEntries,
       double& numGlobalEntries ) const;
@@ -313,6 +511,40 @@ struct DistSymmFrontTree
 template<typename F>
 void ChangeFrontType( DistSymmFrontTree<F>& L, SymmFrontType frontType );
 
+// Predict, from the symbolic analysis alone, the number of entries which this
+// process will store for a factorization into the given front type, as well
+// as the peak number (including the update matrices, but not communication
+// buffers) held at any point between DistSymmFrontTree::Initialize and the
+// end of the factorization. The maxima are over all processes.
+void PredictFactorMemory
+( const DistSymmInfo& info,
+  double& numLocalFactorEntries, double& maxLocalFactorEntries,
+  double& numLocalPeakEntries, double& maxLocalPeakEntries,
+  SymmFrontType frontType=LDL_2D );
+
+// Form a BLR approximation of A, compressing each tile with an interpolative
+// decomposition (and keeping it dense when that would not save storage)
+template<typename F>
+void BLRCompress
+( const Matrix<F>& A, BLRMatrix<F>& B,
+  Int tileSize, Base<F> tol );
+
+// Y := alpha op(A) X + beta Y
+template<typename F>
+void Multiply
+( Orientation orientation,
+  F alpha, const BLRMatrix<F>& A, const Matrix<F>& X,
+  F beta,                               Matrix<F>& Y );
+
+// Replace the bottom-left blocks of the large fronts of a factorization into
+// LDL_1D, LDL_INTRAPIV_1D, or CHOLESKY_1D fronts with BLR approximations,
+// which the (multi-vector) solves then apply directly. The statistics are
+// global and include any fronts compressed during the factorization.
+template<typename F>
+void CompressFronts
+( const DistSymmInfo& info, DistSymmFrontTree<F>& L, BLRStats& stats,
+  const BLRCtrl<Base<F>>& ctrl=BLRCtrl<Base<F>>() );
+
 template<typename F>
 void DiagonalSolve
 ( const DistSymmInfo& info, const DistSymmFrontTree<F>& L,
@@ -323,12 +555,28 @@ void DiagonalSolve
   DistNodalMatrix<F>& X );
 
 // All fronts of L are required to be initialized to the expansions of the 
-// original sparse matrix before calling LDL.
+// original sparse matrix before calling LDL. A CHOLESKY_1D or CHOLESKY_2D
+// front type requests a Cholesky factorization, which requires the matrix to
+// be Hermitian positive-definite (and L.isHermitian to be set if F is complex).
 template<typename F>
 void LDL
 ( DistSymmInfo& info, DistSymmFrontTree<F>& L,
   SymmFrontType newFrontType=LDL_2D );
 
+// A factorization into LDL_1D, LDL_INTRAPIV_1D, or CHOLESKY_1D fronts which
+// compresses the bottom-left blocks of the large fronts (see CompressFronts).
+// Each front within the local subtrees (other than the root of the subtree)
+// is compressed as soon as its bottom-left block is formed, and its Schur
+// complement is computed from the BLR approximation, which reduces both the
+// work of the update and the storage of the factor. The distributed fronts
+// are still factored densely, and so only their storage and solves benefit,
+// as they are compressed after the factorization.
+template<typename F>
+void LDL
+( DistSymmInfo& info, DistSymmFrontTree<F>& L,
+  const BLRCtrl<Base<F>>& ctrl, BLRStats& stats,
+  SymmFrontType newFrontType=LDL_1D );
+
 // TODO: Decide if this interface needs to be exposed
 template<typename T>
 void InitializeDistLeaf( const DistSymmInfo& info, DistSymmFrontTree<T>& L );
@@ -359,6 +607,79 @@ void Solve
 ( const DistSymmInfo& info,
   const DistSymmFrontTree<F>& L, DistNodalMatrix<F>& X );
 
+// Solve against all of the right-hand sides in X (in the original ordering)
+// by streaming blocks of at most 'blockSize' columns through the elimination
+// tree. The blocks are software-pipelined: while block k is solved, block k+1
+// is already being pulled into the tree and block k-1 pushed back out, so
+// that the redistributions are overlapped with the sweeps. At most one block
+// is held in the nodal distribution (and one more in each message buffer),
+// and the communication pattern of the redistributions is only formed once.
+template<typename F>
+void Solve
+( const DistMap& inverseMap, const DistSymmInfo& info,
+  const DistSymmFrontTree<F>& L, DistMultiVec<F>& X, Int blockSize=64 );
+
+// The same as above, but the 'width' right-hand sides are never resident at
+// once: 'produce' fills B with the columns starting at 'colOff' (B has already
+// been sized to the height of the tree and the width of the block), and
+// 'consume' receives the corresponding solutions.
+template<typename F>
+void Solve
+( const DistMap& inverseMap, const DistSymmInfo& info,
+  const DistSymmFrontTree<F>& L, Int width,
+  std::function<void(Int colOff,DistMultiVec<F>& B)> produce,
+  std::function<void(Int colOff,const DistMultiVec<F>& X)> consume,
+  Int blockSize=64 );
+
+template<typename Real>
+struct RefineCtrl
+{
+    // Stop once || B - A X ||_2 <= relTol || B ||_2 for every column
+    Real relTol;
+    Int maxRefineIts;
+    // Refinement has stalled once an iteration fails to reduce the largest
+    // relative residual by at least this factor
+    Real stallRatio;
+
+    // Whether to fall back to GMRES preconditioned by the factorization
+    // (GMRES-IR) if refinement stalls or does not converge, and its restart
+    // length and maximum number of iterations
+    bool gmresFallback;
+    Int restart;
+    Int maxGMRESIts;
+
+    bool progress;
+
+    RefineCtrl()
+    : relTol(Pow(lapack::MachineEpsilon<Real>(),Real(0.75))),
+      maxRefineIts(10), stallRatio(Real(0.5)),
+      gmresFallback(true), restart(30), maxGMRESIts(300), progress(false)
+    { }
+};
+
+struct RefineStats
+{
+    Int numRefineIts, numGMRESIts;
+    double relResidual;
+    bool converged;
+
+    RefineStats()
+    : numRefineIts(0), numGMRESIts(0), relResidual(0), converged(false)
+    { }
+};
+
+// Overwrite B with the solution of A X = B using the factorization L of A,
+// which may be in a lower precision than A (e.g., float fronts for a double
+// matrix, which halves the memory and communication of the factorization).
+// The solution is iteratively refined in the precision of A.
+template<typename F,typename FLow>
+void RefinedSolve
+( const DistSparseMatrix<F>& A,
+  const DistMap& inverseMap, const DistSymmInfo& info,
+  const DistSymmFrontTree<FLow>& L,
+  DistMultiVec<F>& B, RefineStats& stats,
+  const RefineCtrl<Base<F>>& ctrl=RefineCtrl<Base<F>>() );
+
 } // namespace El
 
 #endif // ifndef EL_SPARSEDIRECT_NUMERIC_HPP
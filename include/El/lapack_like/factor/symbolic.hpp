@@ -20,5 +20,6 @@
 
 #include "./symbolic/NestedDissection.hpp"
 #include "./symbolic/NaturalNestedDissection.hpp"
+#include "./symbolic/AnalysisCache.hpp"
 
 #endif // ifndef EL_SPARSEDIRECT_SYMBOLIC_HPP
@@ -0,0 +1,58 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson, Lexing Ying,
+   The University of Texas at Austin, Stanford University, and the
+   Georgia Insitute of Technology.
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_SYMBOLIC_ANALYSISCACHE_HPP
+#define EL_SYMBOLIC_ANALYSISCACHE_HPP
+
+namespace El {
+
+// Save the reordering, separator tree, and symbolic analysis computed by
+// (Natural)NestedDissection to the file 'basename.symb' so that repeated
+// factorizations of matrices with the same graph may skip the analysis.
+// The file is keyed on a hash of the graph, the number of processes, the
+// analysis parameters in 'ctrl', and the string 'ordering', which should
+// distinguish any other means of computing the analysis (e.g.,
+// NaturalNestedDissection along with its grid dimensions).
+void SaveAnalysis
+( const DistGraph& graph,
+  const DistMap& map,
+  const DistSeparatorTree& sepTree,
+  const DistSymmInfo& info,
+        std::string basename="Analysis",
+  const BisectCtrl& ctrl=BisectCtrl(),
+        std::string ordering="" );
+
+// Returns false (and leaves the arguments untouched) if the file does not
+// exist or was saved for a different graph, process count, 'ctrl', or
+// 'ordering'.
+// As with NestedDissection, 'sepTree' and 'info' should be empty.
+bool LoadAnalysis
+( const DistGraph& graph,
+        DistMap& map,
+        DistSeparatorTree& sepTree,
+        DistSymmInfo& info,
+        std::string basename="Analysis",
+  const BisectCtrl& ctrl=BisectCtrl(),
+        std::string ordering="" );
+
+// Load the analysis if possible and otherwise run NestedDissection and save
+// its result. Returns true if the analysis was loaded.
+bool CachedNestedDissection
+( const DistGraph& graph,
+        DistMap& map,
+        DistSeparatorTree& sepTree,
+        DistSymmInfo& info,
+        std::string basename="Analysis",
+  const BisectCtrl& ctrl=BisectCtrl() );
+
+} // namespace El
+
+#endif // ifndef EL_SYMBOLIC_ANALYSISCACHE_HPP
@@ -105,10 +105,28 @@ struct DistSymmNodeInfo
     MultiVecCommMeta multiVecMeta;
 };
 
+// The effect of relaxed supernode amalgamation on the local fronts, where the
+// entries are those of the lower-trapezoidal portion of each front
+struct AmalgamationStats
+{
+    int numOrigLocalFronts, numLocalFronts;
+    double numOrigLocalEntries, numLocalEntries;
+
+    AmalgamationStats()
+    : numOrigLocalFronts(0), numLocalFronts(0),
+      numOrigLocalEntries(0), numLocalEntries(0)
+    { }
+};
+
 struct DistSymmInfo
 {
     std::vector<SymmNodeInfo> localNodes;
     std::vector<DistSymmNodeInfo> distNodes;
+    AmalgamationStats amalgStats;
+
+    // An optional postorder of the local nodes which the factorization should
+    // follow (e.g., to reduce the peak memory), otherwise the natural order
+    std::vector<int> localFactorOrder;
     ~DistSymmInfo();
 };
 
@@ -23,7 +23,9 @@ void NaturalNestedDissection
         DistSeparatorTree& sepTree, 
         DistSymmInfo& info,
         int cutoff=128,
-        bool storeFactRecvInds=false );
+        bool storeFactRecvInds=false,
+        int relaxSize=0,
+        double relaxFraction=0.1 );
 
 int NaturalBisect
 (       int nx, 
@@ -46,10 +46,27 @@ struct BisectCtrl
     int cutoff;
     bool storeFactRecvInds;
 
+    // Relaxed supernode amalgamation: local subtrees are merged into a single
+    // front of at most 'relaxSize' indices if at most a fraction
+    // 'relaxFraction' of its entries are explicit zeros (a 'relaxSize' of
+    // zero disables amalgamation)
+    int relaxSize;
+    double relaxFraction;
+
+    // Use the native multilevel bisection rather than (Par)METIS (the native
+    // routine is always used if METIS is not available)
+    bool native;
+
     BisectCtrl()
     : sequential(true), numDistSeps(1), numSeqSeps(1), cutoff(128),
-      storeFactRecvInds(false) 
-    { }
+      storeFactRecvInds(false), relaxSize(0), relaxFraction(0.1)
+    {
+#ifdef EL_HAVE_METIS
+        native = false;
+#else
+        native = true;
+#endif
+    }
 };
 
 void NestedDissection
@@ -74,10 +91,29 @@ int Bisect
         bool& onLeft,
   const BisectCtrl& ctrl=BisectCtrl() );
 
+// Native multilevel bisection (heavy-edge matching, greedy graph growing,
+// and Fiduccia-Mattheyses refinement). The sources are permuted into the
+// order [left, right, separator] and the sizes of the three sets are returned
+// in 'sizes'. Distributed graphs are coarsened in parallel unless
+// ctrl.sequential is true.
+int MultilevelBisect
+( const Graph& graph,
+        std::vector<int>& perm,
+        std::vector<int>& sizes,
+  const BisectCtrl& ctrl=BisectCtrl() );
+int MultilevelBisect
+( const DistGraph& graph,
+        DistMap& perm,
+        std::vector<int>& sizes,
+  const BisectCtrl& ctrl=BisectCtrl() );
+
 int DistributedDepth( mpi::Comm comm );
 void EnsurePermutation( const std::vector<int>& map );
 void EnsurePermutation( const DistMap& map );
 void ReverseOrder( DistSeparatorTree& sepTree, DistSymmElimTree& eTree );
+void Amalgamate
+( DistSeparatorTree& sepTree, DistSymmElimTree& eTree,
+  AmalgamationStats& stats, int relaxSize, double relaxFraction );
 
 void BuildChildrenFromPerm
 ( const Graph& graph, const std::vector<int>& perm, 
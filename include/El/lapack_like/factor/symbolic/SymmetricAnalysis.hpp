@@ -18,6 +18,11 @@ void SymmetricAnalysis
 ( const DistSymmElimTree& eTree, DistSymmInfo& info, 
   bool storeFactRecvInds=true );
 
+// Choose the order in which the children of each local node are factored so
+// that the peak size of the stack of pending update matrices is minimized
+// (following Liu) and store the resulting postorder in info.localFactorOrder
+void MinimizeUpdateStack( DistSymmInfo& info );
+
 //----------------------------------------------------------------------------//
 // Implementation begins here                                                 //
 //----------------------------------------------------------------------------//
@@ -21,8 +21,8 @@ typedef struct
   ElInt align;
   MPI_Comm comm;
 
-  int *sendCounts, *sendDispls,
-      *recvCounts, *recvDispls;
+  ElInt *sendCounts, *sendDispls,
+        *recvCounts, *recvDispls;
 
   int numSendIdx, numRecvIdx;
   int *sendIdx, *sendRanks,
@@ -34,9 +34,9 @@ EL_EXPORT ElError ElPermutationMetaSet
 EL_EXPORT ElError ElPermutationMetaClear( const ElPermutationMeta* meta );
 
 EL_EXPORT ElError ElPermutationMetaTotalSend
-( const ElPermutationMeta* meta, int* total );
+( const ElPermutationMeta* meta, ElInt* total );
 EL_EXPORT ElError ElPermutationMetaTotalRecv
-( const ElPermutationMeta* meta, int* total );
+( const ElPermutationMeta* meta, ElInt* total );
 
 EL_EXPORT ElError ElPermutationMetaScaleUp
 ( ElPermutationMeta* meta, ElInt length );
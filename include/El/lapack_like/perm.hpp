@@ -18,14 +18,14 @@ struct PermutationMeta
     mpi::Comm comm;
 
     // Will treat vector lengths as one
-    std::vector<int> sendCounts, sendDispls,
+    std::vector<Int> sendCounts, sendDispls,
                      recvCounts, recvDispls;
 
     std::vector<int> sendIdx, sendRanks,
                      recvIdx, recvRanks;
 
-    int TotalSend() const { return sendCounts.back()+sendDispls.back(); }
-    int TotalRecv() const { return recvCounts.back()+recvDispls.back(); }
+    Int TotalSend() const { return sendCounts.back()+sendDispls.back(); }
+    Int TotalRecv() const { return recvCounts.back()+recvDispls.back(); }
 
     void ScaleUp( Int length )
     {
@@ -64,6 +64,114 @@ void HPDSolve
 ( UpperOrLower uplo, Orientation orientation,
   AbstractDistMatrix<F>& A, AbstractDistMatrix<F>& B );
 
+// Krylov subspace methods for A X = B with a distributed sparse A
+// ===============================================================
+// Operators and preconditioners act on all of the columns of a multivector
+// at once, Y := op(X), and are responsible for shaping Y. An empty
+// preconditioner is treated as the identity.
+template<typename F>
+using KrylovOperator =
+    std::function<void(const DistMultiVec<F>&,DistMultiVec<F>&)>;
+
+// Y := A X (A must outlive the operator)
+template<typename F>
+KrylovOperator<F> SparseOperator( const DistSparseMatrix<F>& A );
+
+// Y := inv(diag(A)) X, where zero diagonal entries are left unscaled
+template<typename F>
+KrylovOperator<F> JacobiPreconditioner( const DistSparseMatrix<F>& A );
+
+// Y := inv(L D L^T) X using a (possibly lower-precision) sparse-direct
+// factorization, which must outlive the operator
+template<typename F,typename FLow>
+KrylovOperator<F> LDLPreconditioner
+( const DistMap& inverseMap, const DistSymmInfo& info,
+  const DistSymmFrontTree<FLow>& L );
+
+template<typename Real>
+struct KrylovCtrl
+{
+    // Stop once || B - A X ||_2 <= relTol || B ||_2 for every column
+    // (MINRES measures the residuals in the norm induced by the
+    // preconditioner)
+    Real relTol;
+    Int maxIts;
+    // The restart length of GMRES
+    Int restart;
+    bool progress;
+
+    KrylovCtrl()
+    : relTol(Pow(lapack::MachineEpsilon<Real>(),Real(0.5))),
+      maxIts(1000), restart(30), progress(false)
+    { }
+};
+
+struct KrylovStats
+{
+    Int numIts;
+    bool converged;
+    // The largest relative residual over the columns after each iteration,
+    // starting with that of the initial guess
+    std::vector<double> history;
+
+    KrylovStats() : numIts(0), converged(false) { }
+};
+
+// Each of the following uses X as the initial guess if its dimensions match
+// those of B (and zero otherwise), treats the columns of B as independent
+// systems which are frozen as they converge, and combines the inner products
+// of all of the columns into a shared set of reductions per iteration.
+
+// Preconditioned Conjugate Gradients for Hermitian positive-definite A and M
+// (in the Chronopoulos/Gear form, which needs a single reduction per
+// iteration)
+template<typename F>
+void CG
+( const KrylovOperator<F>& A, const KrylovOperator<F>& M,
+  const DistMultiVec<F>& B, DistMultiVec<F>& X, KrylovStats& stats,
+  const KrylovCtrl<Base<F>>& ctrl=KrylovCtrl<Base<F>>() );
+template<typename F>
+void CG
+( const DistSparseMatrix<F>& A, const KrylovOperator<F>& M,
+  const DistMultiVec<F>& B, DistMultiVec<F>& X, KrylovStats& stats,
+  const KrylovCtrl<Base<F>>& ctrl=KrylovCtrl<Base<F>>() );
+
+// Preconditioned MINRES for Hermitian A and Hermitian positive-definite M
+template<typename F>
+void MINRES
+( const KrylovOperator<F>& A, const KrylovOperator<F>& M,
+  const DistMultiVec<F>& B, DistMultiVec<F>& X, KrylovStats& stats,
+  const KrylovCtrl<Base<F>>& ctrl=KrylovCtrl<Base<F>>() );
+template<typename F>
+void MINRES
+( const DistSparseMatrix<F>& A, const KrylovOperator<F>& M,
+  const DistMultiVec<F>& B, DistMultiVec<F>& X, KrylovStats& stats,
+  const KrylovCtrl<Base<F>>& ctrl=KrylovCtrl<Base<F>>() );
+
+// Restarted, right-preconditioned flexible GMRES for general A
+template<typename F>
+void GMRES
+( const KrylovOperator<F>& A, const KrylovOperator<F>& M,
+  const DistMultiVec<F>& B, DistMultiVec<F>& X, KrylovStats& stats,
+  const KrylovCtrl<Base<F>>& ctrl=KrylovCtrl<Base<F>>() );
+template<typename F>
+void GMRES
+( const DistSparseMatrix<F>& A, const KrylovOperator<F>& M,
+  const DistMultiVec<F>& B, DistMultiVec<F>& X, KrylovStats& stats,
+  const KrylovCtrl<Base<F>>& ctrl=KrylovCtrl<Base<F>>() );
+
+// Right-preconditioned BiCGStab for general A
+template<typename F>
+void BiCGStab
+( const KrylovOperator<F>& A, const KrylovOperator<F>& M,
+  const DistMultiVec<F>& B, DistMultiVec<F>& X, KrylovStats& stats,
+  const KrylovCtrl<Base<F>>& ctrl=KrylovCtrl<Base<F>>() );
+template<typename F>
+void BiCGStab
+( const DistSparseMatrix<F>& A, const KrylovOperator<F>& M,
+  const DistMultiVec<F>& B, DistMultiVec<F>& X, KrylovStats& stats,
+  const KrylovCtrl<Base<F>>& ctrl=KrylovCtrl<Base<F>>() );
+
 // min_X || A X - B ||_F
 // =====================
 template<typename F>
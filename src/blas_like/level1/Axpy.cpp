@@ -84,7 +84,8 @@ void Axpy( S alphaS, const AbstractDistMatrix<T>& X, AbstractDistMatrix<T>& Y )
 
     if( XDistData == YDistData )
     {
-        Axpy( alpha, X.LockedMatrix(), Y.Matrix() );
+        if( Y.NodeWriter() )
+            Axpy( alpha, X.LockedMatrix(), Y.Matrix() );
     }
     else
     {
@@ -92,8 +93,10 @@ void Axpy( S alphaS, const AbstractDistMatrix<T>& X, AbstractDistMatrix<T>& Y )
           XCopy( Y.Construct(Y.Grid(),Y.Root()) );
         XCopy->AlignWith( YDistData );
         Copy( X, *XCopy );
-        Axpy( alpha, XCopy->LockedMatrix(), Y.Matrix() );
+        if( Y.NodeWriter() )
+            Axpy( alpha, XCopy->LockedMatrix(), Y.Matrix() );
     }
+    Y.NodeSync();
 }
 
 template<typename T,typename S>
@@ -29,7 +29,11 @@ template<typename T,Dist U,Dist V>
 inline void Copy( const AbstractDistMatrix<T>& A, DistMatrix<T,U,V>& B )
 {
     DEBUG_ONLY(CallStackEntry cse("Copy"))
-    B = A;
+    if( A.Grid() != B.Grid() && 
+        mpi::Congruent( A.Grid().ViewingComm(), B.Grid().ViewingComm() ) )
+        CachedRedistPlan( A, B ).Execute( A, B );
+    else
+        B = A;
 }
 
 // Datatype conversions should not be very common, and so it is likely best to
@@ -50,7 +54,9 @@ inline void Copy( const AbstractDistMatrix<S>& A, DistMatrix<T,U,V>& B )
             A.ColAlign() == B.ColAlign() && A.RowAlign() == B.RowAlign() )
         {
             B.Resize( A.Height(), A.Width() );
-            Copy( A.LockedMatrix(), B.Matrix() );
+            if( B.NodeWriter() )
+                Copy( A.LockedMatrix(), B.Matrix() );
+            B.NodeSync();
             return;
         }
     }
@@ -58,7 +64,9 @@ inline void Copy( const AbstractDistMatrix<S>& A, DistMatrix<T,U,V>& B )
     BOrig.AlignWith( B );
     BOrig = A;
     B.Resize( A.Height(), A.Width() );
-    Copy( BOrig.LockedMatrix(), B.Matrix() );
+    if( B.NodeWriter() )
+        Copy( BOrig.LockedMatrix(), B.Matrix() );
+    B.NodeSync();
 }
 
 template<typename T,Dist U,Dist V>
@@ -66,7 +74,11 @@ inline void Copy
 ( const AbstractBlockDistMatrix<T>& A, BlockDistMatrix<T,U,V>& B )
 {
     DEBUG_ONLY(CallStackEntry cse("Copy"))
-    B = A;
+    if( A.Grid() != B.Grid() && 
+        mpi::Congruent( A.Grid().ViewingComm(), B.Grid().ViewingComm() ) )
+        CachedRedistPlan( A, B ).Execute( A, B );
+    else
+        B = A;
 }
 
 // Datatype conversions should not be very common, and so it is likely best to
@@ -124,6 +136,20 @@ void Copy( const AbstractBlockDistMatrix<S>& A, AbstractBlockDistMatrix<T>& B )
     #include "El/macros/GuardAndPayload.h"
 }
 
+template<typename T>
+void Copy( const AbstractDistMatrix<T>& A, AbstractBlockDistMatrix<T>& B )
+{
+    DEBUG_ONLY(CallStackEntry cse("Copy"))
+    CachedRedistPlan( A, B ).Execute( A, B );
+}
+
+template<typename T>
+void Copy( const AbstractBlockDistMatrix<T>& A, AbstractDistMatrix<T>& B )
+{
+    DEBUG_ONLY(CallStackEntry cse("Copy"))
+    CachedRedistPlan( A, B ).Execute( A, B );
+}
+
 void Copy( const Graph& A, Graph& B )
 {
     DEBUG_ONLY(CallStackEntry cse("Copy [Graph]"))
@@ -144,10 +170,10 @@ void CopyFromRoot( const DistGraph& distGraph, Graph& graph )
     const int commRank = mpi::Rank( comm );
 
     const Int numLocalEdges = distGraph.NumLocalEdges();
-    std::vector<int> edgeSizes(commSize);
+    std::vector<Int> edgeSizes(commSize);
     mpi::AllGather( &numLocalEdges, 1, edgeSizes.data(), 1, comm );
-    std::vector<int> edgeOffsets;
-    const int numEdges = Scan( edgeSizes, edgeOffsets );
+    std::vector<Int> edgeOffsets;
+    const Int numEdges = Scan( edgeSizes, edgeOffsets );
 
     graph.Resize( distGraph.NumSources(), distGraph.NumTargets() );
     graph.Reserve( numEdges );
@@ -174,10 +200,10 @@ void CopyFromNonRoot( const DistGraph& distGraph, Int root )
         LogicError("Root called CopyFromNonRoot");
 
     const Int numLocalEdges = distGraph.NumLocalEdges();
-    std::vector<int> edgeSizes(commSize);
+    std::vector<Int> edgeSizes(commSize);
     mpi::AllGather( &numLocalEdges, 1, edgeSizes.data(), 1, comm );
-    std::vector<int> edgeOffsets;
-    const int numEdges = Scan( edgeSizes, edgeOffsets );
+    std::vector<Int> edgeOffsets;
+    const Int numEdges = Scan( edgeSizes, edgeOffsets );
 
     mpi::Gather
     ( distGraph.LockedSourceBuffer(), numLocalEdges,
@@ -218,6 +244,14 @@ void Copy( const DistSparseMatrix<T>& A, DistSparseMatrix<T>& B )
     B = A;
 }
 
+template<typename S,typename T>
+void Copy( const DistSparseMatrix<S>& A, DistSparseMatrix<T>& B )
+{
+    DEBUG_ONLY(CallStackEntry cse("Copy [DistSparseMatrix]"))
+    auto convert = []( const S alpha ) { return T(alpha); };
+    EntrywiseMap( A, B, std::function<T(S)>(convert) );
+}
+
 template<typename S,typename T>
 void Copy( const DistSparseMatrix<S>& A, AbstractDistMatrix<T>& B )
 {
@@ -235,7 +269,7 @@ void Copy( const DistSparseMatrix<S>& A, AbstractDistMatrix<T>& B )
 
     // Compute the number of entries of A to send to each member of B
     // ==============================================================
-    std::vector<int> sendCounts(commSize,0);
+    std::vector<Int> sendCounts(commSize,0);
     for( Int k=0; k<A.NumLocalEntries(); ++k )
     {
         const Int i = A.Row(k);
@@ -248,9 +282,9 @@ void Copy( const DistSparseMatrix<S>& A, AbstractDistMatrix<T>& B )
 
     // Convert the send/recv counts into offsets and total sizes
     // =========================================================
-    std::vector<int> sendOffsets, recvOffsets;
-    const int totalSend = Scan( sendCounts, sendOffsets );
-    const int totalRecv = Scan( recvCounts, recvOffsets );
+    std::vector<Int> sendOffsets, recvOffsets;
+    const Int totalSend = Scan( sendCounts, sendOffsets );
+    const Int totalRecv = Scan( recvCounts, recvOffsets );
 
     // Pack the triplets
     // =================
@@ -295,11 +329,11 @@ void CopyFromRoot( const DistSparseMatrix<T>& ADist, SparseMatrix<T>& A )
     const int commSize = mpi::Size( comm );
     const int commRank = mpi::Rank( comm );
 
-    const int numLocalEntries = ADist.NumLocalEntries();
-    std::vector<int> entrySizes(commSize);
+    const Int numLocalEntries = ADist.NumLocalEntries();
+    std::vector<Int> entrySizes(commSize);
     mpi::AllGather( &numLocalEntries, 1, entrySizes.data(), 1, comm );
-    std::vector<int> entryOffsets;
-    const int numEntries = Scan( entrySizes, entryOffsets );
+    std::vector<Int> entryOffsets;
+    const Int numEntries = Scan( entrySizes, entryOffsets );
 
     A.Resize( ADist.Height(), ADist.Width() );
     A.Reserve( numEntries );
@@ -331,11 +365,11 @@ void CopyFromNonRoot( const DistSparseMatrix<T>& ADist, Int root )
     if( commRank == root )
         LogicError("Root called CopyFromNonRoot");
 
-    const int numLocalEntries = ADist.NumLocalEntries();
-    std::vector<int> entrySizes(commSize);
+    const Int numLocalEntries = ADist.NumLocalEntries();
+    std::vector<Int> entrySizes(commSize);
     mpi::AllGather( &numLocalEntries, 1, entrySizes.data(), 1, comm );
-    std::vector<int> entryOffsets;
-    const int numEntries = Scan( entrySizes, entryOffsets );
+    std::vector<Int> entryOffsets;
+    const Int numEntries = Scan( entrySizes, entryOffsets );
 
     mpi::Gather
     ( ADist.LockedSourceBuffer(), numLocalEntries,
@@ -355,6 +389,15 @@ void Copy( const DistMultiVec<T>& A, DistMultiVec<T>& B )
     B = A;
 }
 
+template<typename S,typename T>
+void Copy( const DistMultiVec<S>& A, DistMultiVec<T>& B )
+{
+    DEBUG_ONLY(CallStackEntry cse("Copy [DistMultiVec]"))
+    B.SetComm( A.Comm() );
+    B.Resize( A.Height(), A.Width() );
+    Copy( A.LockedMatrix(), B.Matrix() );
+}
+
 template<typename T>
 void CopyFromRoot( const DistMultiVec<T>& XDist, Matrix<T>& X )
 {
@@ -365,11 +408,11 @@ void CopyFromRoot( const DistMultiVec<T>& XDist, Matrix<T>& X )
 
     const Int m = XDist.Height();
     const Int n = XDist.Width();
-    const int numLocalEntries = XDist.LocalHeight()*n;
-    std::vector<int> entrySizes(commSize);
+    const Int numLocalEntries = XDist.LocalHeight()*n;
+    std::vector<Int> entrySizes(commSize);
     mpi::AllGather( &numLocalEntries, 1, entrySizes.data(), 1, comm );
-    std::vector<int> entryOffsets;
-    const int numEntries = Scan( entrySizes, entryOffsets );
+    std::vector<Int> entryOffsets;
+    const Int numEntries = Scan( entrySizes, entryOffsets );
 
     std::vector<T> recvBuf( m*n );
     X.Resize( m, n, m );
@@ -411,11 +454,11 @@ void CopyFromNonRoot( const DistMultiVec<T>& XDist, Int root )
     if( commRank == root )
         LogicError("Called CopyFromNonRoot from root");
 
-    const int numLocalEntries = XDist.LocalHeight()*XDist.Width();
-    std::vector<int> entrySizes(commSize);
+    const Int numLocalEntries = XDist.LocalHeight()*XDist.Width();
+    std::vector<Int> entrySizes(commSize);
     mpi::AllGather( &numLocalEntries, 1, entrySizes.data(), 1, comm );
-    std::vector<int> entryOffsets;
-    const int numEntries = Scan( entrySizes, entryOffsets );
+    std::vector<Int> entryOffsets;
+    const Int numEntries = Scan( entrySizes, entryOffsets );
 
     const auto& XDistLoc = XDist.LockedMatrix();
     if( XDistLoc.Height() == XDistLoc.LDim() )
@@ -436,12 +479,296 @@ void CopyFromNonRoot( const DistMultiVec<T>& XDist, Int root )
     }
 }
 
+namespace copy {
+
+// Route each triplet (sources[k],targets[k],values[k]) to process owners[k]
+// of the communicator and return the triplets which were received
+template<typename T>
+void ExchangeTriplets
+( const std::vector<int>& owners,
+  const std::vector<Int>& sources, const std::vector<Int>& targets,
+  const std::vector<T>& values,
+  std::vector<Int>& recvSources, std::vector<Int>& recvTargets,
+  std::vector<T>& recvValues, mpi::Comm comm )
+{
+    DEBUG_ONLY(CallStackEntry cse("copy::ExchangeTriplets"))
+    const int commSize = mpi::Size( comm );
+    const Int numSends = owners.size();
+
+    std::vector<Int> sendCounts(commSize,0);
+    for( Int k=0; k<numSends; ++k )
+        ++sendCounts[owners[k]];
+    std::vector<Int> recvCounts(commSize);
+    mpi::AllToAll( sendCounts.data(), 1, recvCounts.data(), 1, comm );
+    std::vector<Int> sendOffsets, recvOffsets;
+    const Int totalSend = Scan( sendCounts, sendOffsets );
+    const Int totalRecv = Scan( recvCounts, recvOffsets );
+
+    std::vector<Int> sSendBuf(totalSend), tSendBuf(totalSend);
+    std::vector<T> vSendBuf(totalSend);
+    auto offsets = sendOffsets;
+    for( Int k=0; k<numSends; ++k )
+    {
+        const int owner = owners[k];
+        sSendBuf[offsets[owner]] = sources[k];
+        tSendBuf[offsets[owner]] = targets[k];
+        vSendBuf[offsets[owner]] = values[k];
+        ++offsets[owner];
+    }
+
+    recvSources.resize( totalRecv );
+    recvTargets.resize( totalRecv );
+    recvValues.resize( totalRecv );
+    mpi::AllToAll
+    ( sSendBuf.data(), sendCounts.data(), sendOffsets.data(),
+      recvSources.data(), recvCounts.data(), recvOffsets.data(), comm );
+    mpi::AllToAll
+    ( tSendBuf.data(), sendCounts.data(), sendOffsets.data(),
+      recvTargets.data(), recvCounts.data(), recvOffsets.data(), comm );
+    mpi::AllToAll
+    ( vSendBuf.data(), sendCounts.data(), sendOffsets.data(),
+      recvValues.data(), recvCounts.data(), recvOffsets.data(), comm );
+}
+
+// Route row iLoc of X, which has global index rows[iLoc], to process 
+// owners[iLoc] of the communicator and return the received rows, which are
+// packed contiguously with X.Width() entries per row
+template<typename T>
+void ExchangeRows
+( const Matrix<T>& X,
+  const std::vector<int>& owners, const std::vector<Int>& rows,
+  std::vector<Int>& recvRows, std::vector<T>& recvValues, mpi::Comm comm )
+{
+    DEBUG_ONLY(CallStackEntry cse("copy::ExchangeRows"))
+    const int commSize = mpi::Size( comm );
+    const Int localHeight = X.Height();
+    const Int width = X.Width();
+
+    std::vector<Int> sendCounts(commSize,0);
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        ++sendCounts[owners[iLoc]];
+    std::vector<Int> recvCounts(commSize);
+    mpi::AllToAll( sendCounts.data(), 1, recvCounts.data(), 1, comm );
+    std::vector<Int> sendOffsets, recvOffsets;
+    const Int totalSend = Scan( sendCounts, sendOffsets );
+    const Int totalRecv = Scan( recvCounts, recvOffsets );
+
+    std::vector<Int> iSendBuf(totalSend);
+    std::vector<T> vSendBuf(totalSend*width);
+    auto offsets = sendOffsets;
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const int owner = owners[iLoc];
+        iSendBuf[offsets[owner]] = rows[iLoc];
+        for( Int t=0; t<width; ++t )
+            vSendBuf[offsets[owner]*width+t] = X.Get(iLoc,t);
+        ++offsets[owner];
+    }
+
+    recvRows.resize( totalRecv );
+    recvValues.resize( totalRecv*width );
+    mpi::AllToAll
+    ( iSendBuf.data(), sendCounts.data(), sendOffsets.data(),
+      recvRows.data(), recvCounts.data(), recvOffsets.data(), comm );
+    for( int q=0; q<commSize; ++q )
+    {
+        sendCounts[q] *= width;
+        sendOffsets[q] *= width;
+        recvCounts[q] *= width;
+        recvOffsets[q] *= width;
+    }
+    mpi::AllToAll
+    ( vSendBuf.data(), sendCounts.data(), sendOffsets.data(),
+      recvValues.data(), recvCounts.data(), recvOffsets.data(), comm );
+}
+
+} // namespace copy
+
+template<typename T>
+void Copy( const DistSparseMatrix<T>& A, DistSparseMatrix2D<T>& B )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("Copy [DistSparseMatrix -> DistSparseMatrix2D]");
+        if( mpi::Size(A.Comm()) != B.Grid().Size() )
+            LogicError("A's communicator and B's grid must be the same size");
+    )
+    B.Resize( A.Height(), A.Width() );
+
+    const Int numLocalEntries = A.NumLocalEntries();
+    std::vector<int> owners( numLocalEntries );
+    std::vector<Int> sources( numLocalEntries ), targets( numLocalEntries );
+    std::vector<T> values( numLocalEntries );
+    for( Int k=0; k<numLocalEntries; ++k )
+    {
+        sources[k] = A.Row(k);
+        targets[k] = A.Col(k);
+        values[k] = A.Value(k);
+        owners[k] = B.Owner( sources[k], targets[k] );
+    }
+    std::vector<Int> recvSources, recvTargets;
+    std::vector<T> recvValues;
+    copy::ExchangeTriplets
+    ( owners, sources, targets, values, 
+      recvSources, recvTargets, recvValues, B.Grid().VCComm() );
+
+    const Int numRecv = recvValues.size();
+    B.Reserve( numRecv );
+    for( Int k=0; k<numRecv; ++k )
+        B.QueueUpdate( recvSources[k], recvTargets[k], recvValues[k] );
+    B.MakeConsistent();
+}
+
+template<typename T>
+void Copy( const DistSparseMatrix2D<T>& A, DistSparseMatrix<T>& B )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("Copy [DistSparseMatrix2D -> DistSparseMatrix]");
+        if( mpi::Size(B.Comm()) != A.Grid().Size() )
+            LogicError("B's communicator and A's grid must be the same size");
+    )
+    B.Resize( A.Height(), A.Width() );
+
+    const Int numLocalEntries = A.NumLocalEntries();
+    std::vector<int> owners( numLocalEntries );
+    std::vector<Int> sources( numLocalEntries ), targets( numLocalEntries );
+    std::vector<T> values( numLocalEntries );
+    for( Int k=0; k<numLocalEntries; ++k )
+    {
+        sources[k] = A.Row(k);
+        targets[k] = A.Col(k);
+        values[k] = A.Value(k);
+        owners[k] = B.RowOwner( sources[k] );
+    }
+    std::vector<Int> recvSources, recvTargets;
+    std::vector<T> recvValues;
+    copy::ExchangeTriplets
+    ( owners, sources, targets, values, 
+      recvSources, recvTargets, recvValues, B.Comm() );
+
+    const Int numRecv = recvValues.size();
+    B.Reserve( numRecv );
+    for( Int k=0; k<numRecv; ++k )
+        B.QueueUpdate( recvSources[k], recvTargets[k], recvValues[k] );
+    B.MakeConsistent();
+}
+
+template<typename T>
+void Copy( const DistMultiVec<T>& A, DistMultiVec2D<T>& B )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("Copy [DistMultiVec -> DistMultiVec2D]");
+        if( mpi::Size(A.Comm()) != B.Grid().Size() )
+            LogicError("A's communicator and B's grid must be the same size");
+    )
+    B.Resize( A.Height(), A.Width() );
+
+    const Int localHeight = A.LocalHeight();
+    const Int firstLocalRow = A.FirstLocalRow();
+    std::vector<int> owners( localHeight );
+    std::vector<Int> rows( localHeight );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        rows[iLoc] = firstLocalRow + iLoc;
+        owners[iLoc] = B.RowOwner( rows[iLoc] );
+    }
+    std::vector<Int> recvRows;
+    std::vector<T> recvValues;
+    copy::ExchangeRows
+    ( A.LockedMatrix(), owners, rows, recvRows, recvValues, 
+      B.Grid().VCComm() );
+
+    const Int width = B.Width();
+    const Int numRecv = recvRows.size();
+    for( Int k=0; k<numRecv; ++k )
+    {
+        const Int iLoc = recvRows[k] - B.FirstLocalRow();
+        for( Int t=0; t<width; ++t )
+            B.SetLocal( iLoc, t, recvValues[k*width+t] );
+    }
+}
+
+template<typename T>
+void Copy( const DistMultiVec2D<T>& A, DistMultiVec<T>& B )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("Copy [DistMultiVec2D -> DistMultiVec]");
+        if( mpi::Size(B.Comm()) != A.Grid().Size() )
+            LogicError("B's communicator and A's grid must be the same size");
+    )
+    B.Resize( A.Height(), A.Width() );
+
+    const Int localHeight = A.LocalHeight();
+    const Int firstLocalRow = A.FirstLocalRow();
+    std::vector<int> owners( localHeight );
+    std::vector<Int> rows( localHeight );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        rows[iLoc] = firstLocalRow + iLoc;
+        owners[iLoc] = B.RowOwner( rows[iLoc] );
+    }
+    std::vector<Int> recvRows;
+    std::vector<T> recvValues;
+    copy::ExchangeRows
+    ( A.LockedMatrix(), owners, rows, recvRows, recvValues, B.Comm() );
+
+    const Int width = B.Width();
+    const Int numRecv = recvRows.size();
+    for( Int k=0; k<numRecv; ++k )
+    {
+        const Int iLoc = recvRows[k] - B.FirstLocalRow();
+        for( Int t=0; t<width; ++t )
+            B.SetLocal( iLoc, t, recvValues[k*width+t] );
+    }
+}
+
+template<typename T>
+void Copy( const DistMultiVec2D<T>& A, DistMultiVec2D<T>& B )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("Copy [DistMultiVec2D]");
+        AssertSameGrids( A.Grid(), B.Grid() );
+    )
+    if( A.Dist() == B.Dist() )
+    {
+        B = A;
+        return;
+    }
+    B.Resize( A.Height(), A.Width() );
+
+    const Int localHeight = A.LocalHeight();
+    const Int firstLocalRow = A.FirstLocalRow();
+    std::vector<int> owners( localHeight );
+    std::vector<Int> rows( localHeight );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        rows[iLoc] = firstLocalRow + iLoc;
+        owners[iLoc] = B.RowOwner( rows[iLoc] );
+    }
+    std::vector<Int> recvRows;
+    std::vector<T> recvValues;
+    copy::ExchangeRows
+    ( A.LockedMatrix(), owners, rows, recvRows, recvValues, 
+      B.Grid().VCComm() );
+
+    const Int width = B.Width();
+    const Int numRecv = recvRows.size();
+    for( Int k=0; k<numRecv; ++k )
+    {
+        const Int iLoc = recvRows[k] - B.FirstLocalRow();
+        for( Int t=0; t<width; ++t )
+            B.SetLocal( iLoc, t, recvValues[k*width+t] );
+    }
+}
+
 // TODO: include guards so that certain datatypes can be properly disabled 
 #define CONVERT(S,T) \
   template void Copy( const Matrix<S>& A, Matrix<T>& B ); \
   template void Copy( const SparseMatrix<S>& A, SparseMatrix<T>& B ); \
   template void Copy( const SparseMatrix<S>& A, Matrix<T>& B ); \
   template void Copy \
+  ( const DistSparseMatrix<S>& A, DistSparseMatrix<T>& B ); \
+  template void Copy( const DistMultiVec<S>& A, DistMultiVec<T>& B ); \
+  template void Copy \
   ( const DistSparseMatrix<S>& A, AbstractDistMatrix<T>& B ); \
   template void Copy \
   ( const AbstractDistMatrix<S>& A, AbstractDistMatrix<T>& B ); \
@@ -450,13 +777,22 @@ void CopyFromNonRoot( const DistMultiVec<T>& XDist, Int root )
 
 #define SAME(T) \
   CONVERT(T,T) \
-  template void Copy( const DistSparseMatrix<T>& A, DistSparseMatrix<T>& B ); \
+  template void Copy \
+  ( const AbstractDistMatrix<T>& A, AbstractBlockDistMatrix<T>& B ); \
+  template void Copy \
+  ( const AbstractBlockDistMatrix<T>& A, AbstractDistMatrix<T>& B ); \
   template void CopyFromRoot \
   ( const DistSparseMatrix<T>& ADist, SparseMatrix<T>& A ); \
   template void CopyFromNonRoot( const DistSparseMatrix<T>& ADist, Int root ); \
-  template void Copy( const DistMultiVec<T>& A, DistMultiVec<T>& B ); \
   template void CopyFromRoot( const DistMultiVec<T>& ADist, Matrix<T>& A ); \
-  template void CopyFromNonRoot( const DistMultiVec<T>& ADist, Int root );
+  template void CopyFromNonRoot( const DistMultiVec<T>& ADist, Int root ); \
+  template void Copy \
+  ( const DistSparseMatrix<T>& A, DistSparseMatrix2D<T>& B ); \
+  template void Copy \
+  ( const DistSparseMatrix2D<T>& A, DistSparseMatrix<T>& B ); \
+  template void Copy( const DistMultiVec<T>& A, DistMultiVec2D<T>& B ); \
+  template void Copy( const DistMultiVec2D<T>& A, DistMultiVec<T>& B ); \
+  template void Copy( const DistMultiVec2D<T>& A, DistMultiVec2D<T>& B );
 
 #define PROTO_INT(T) SAME(T) 
 
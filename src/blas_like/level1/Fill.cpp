@@ -25,7 +25,9 @@ template<typename T>
 void Fill( AbstractDistMatrix<T>& A, T alpha )
 {
     DEBUG_ONLY(CallStackEntry cse("Fill"))
-    Fill( A.Matrix(), alpha );
+    if( A.NodeWriter() )
+        Fill( A.Matrix(), alpha );
+    A.NodeSync();
 }
 
 template<typename T>
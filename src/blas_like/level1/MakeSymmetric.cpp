@@ -144,7 +144,7 @@ void MakeSymmetric( UpperOrLower uplo, DistSparseMatrix<T>& A, bool conjugate )
     // =====================================================
     mpi::Comm comm = A.Comm();
     const int commSize = mpi::Size(comm);
-    std::vector<int> sendCounts(commSize,0);
+    std::vector<Int> sendCounts(commSize,0);
     for( Int k=0; k<numLocalEntries; ++k )
     {
         const Int i = sBuf[k];
@@ -152,20 +152,20 @@ void MakeSymmetric( UpperOrLower uplo, DistSparseMatrix<T>& A, bool conjugate )
         if( (uplo == LOWER && i > j) || (uplo == UPPER && i < j) )
             ++sendCounts[ A.RowOwner(j) ];
     }
-    std::vector<int> recvCounts(commSize);
+    std::vector<Int> recvCounts(commSize);
     mpi::AllToAll( sendCounts.data(), 1, recvCounts.data(), 1, comm );
 
     // Convert the send/recv counts into offsets and total sizes
     // =========================================================
-    std::vector<int> sendOffsets, recvOffsets;
-    const int totalSend = Scan( sendCounts, sendOffsets );
-    const int totalRecv = Scan( recvCounts, recvOffsets );
+    std::vector<Int> sendOffsets, recvOffsets;
+    const Int totalSend = Scan( sendCounts, sendOffsets );
+    const Int totalRecv = Scan( recvCounts, recvOffsets );
 
     // Pack the triplets
     // =================
     std::vector<Int> sSendBuf(totalSend), tSendBuf(totalSend);
     std::vector<T> vSendBuf(totalSend);
-    std::vector<int> offsets = sendOffsets;
+    std::vector<Int> offsets = sendOffsets;
     for( Int k=0; k<numLocalEntries; ++k )
     {
         const Int i = sBuf[k];
@@ -62,12 +62,20 @@ void Scale( S alphaS, Matrix<Real>& AReal, Matrix<Real>& AImag )
 
 template<typename T,typename S>
 void Scale( S alpha, AbstractDistMatrix<T>& A )
-{ Scale( alpha, A.Matrix() ); }
+{
+    if( A.NodeWriter() )
+        Scale( alpha, A.Matrix() );
+    A.NodeSync();
+}
 
 template<typename Real,typename S>
 void Scale( S alpha, AbstractDistMatrix<Real>& AReal, 
                      AbstractDistMatrix<Real>& AImag )
-{ Scale( alpha, AReal.Matrix(), AImag.Matrix() ); }
+{
+    if( AReal.NodeShared() || AImag.NodeShared() )
+        LogicError("Node-shared real and imaginary parts are not supported");
+    Scale( alpha, AReal.Matrix(), AImag.Matrix() );
+}
 
 template<typename T,typename S>
 void Scale( S alpha, AbstractBlockDistMatrix<T>& A )
@@ -132,17 +132,17 @@ void Transpose
 
     // Compute the number of entries of A to send to each process
     // ==========================================================
-    std::vector<int> sendCounts(commSize,0);
+    std::vector<Int> sendCounts(commSize,0);
     for( Int k=0; k<A.NumLocalEntries(); ++k )
         ++sendCounts[ B.RowOwner(A.Col(k)) ];
-    std::vector<int> recvCounts(commSize);
+    std::vector<Int> recvCounts(commSize);
     mpi::AllToAll( sendCounts.data(), 1, recvCounts.data(), 1, comm );
 
     // Convert the send/recv counts into offsets and total sizes
     // =========================================================
-    std::vector<int> sendOffsets, recvOffsets;
-    const int totalSend = Scan( sendCounts, sendOffsets );
-    const int totalRecv = Scan( recvCounts, recvOffsets );
+    std::vector<Int> sendOffsets, recvOffsets;
+    const Int totalSend = Scan( sendCounts, sendOffsets );
+    const Int totalRecv = Scan( recvCounts, recvOffsets );
 
     // Pack the triplets
     // =================
@@ -25,7 +25,9 @@ template<typename T>
 void Zero( AbstractDistMatrix<T>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("Zero"))
-    Zero( A.Matrix() );
+    if( A.NodeWriter() )
+        Zero( A.Matrix() );
+    A.NodeSync();
 }
 
 template<typename T>
@@ -171,7 +171,7 @@ void Multiply
 
     // Convert the sizes and offsets to be compatible with the current width
     const Int b = X.Width();
-    std::vector<int> recvSizes=meta.recvSizes,
+    std::vector<Int> recvSizes=meta.recvSizes,
                      recvOffs=meta.recvOffs,
                      sendSizes=meta.sendSizes,
                      sendOffs=meta.sendOffs;
@@ -285,6 +285,146 @@ void Multiply
     }
 }
 
+template<typename T>
+void Multiply
+( Orientation orientation, 
+  T alpha, const DistSparseMatrix2D<T>& A, const DistMultiVec2D<T>& X,
+  T beta,                                        DistMultiVec2D<T>& Y )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("Multiply");
+        AssertSameGrids( A.Grid(), X.Grid(), Y.Grid() );
+        if( X.Width() != Y.Width() )
+            LogicError("X and Y must have the same width");
+    )
+    const bool normal = ( orientation == NORMAL );
+    if( normal )
+    {
+        if( A.Height() != Y.Height() )
+            LogicError("A and Y must have the same height");
+        if( A.Width() != X.Height() )
+            LogicError("The width of A must match the height of X");
+        if( X.Dist() != MR || Y.Dist() != MC )
+            LogicError("Expected X to be MR-distributed and Y MC-distributed");
+    }
+    else
+    {
+        if( A.Width() != Y.Height() )
+            LogicError("The width of A must match the height of Y");
+        if( A.Height() != X.Height() )
+            LogicError("The height of A must match the height of X");
+        if( X.Dist() != MC || Y.Dist() != MR )
+            LogicError("Expected X to be MC-distributed and Y MR-distributed");
+    }
+    const Int b = X.Width();
+    const bool conjugate = ( orientation == ADJOINT );
+
+    // Y := beta Y
+    Scale( beta, Y.Matrix() );
+
+    // Gather the block of X which lines up with our local portion of A
+    // within the communicator that the block is split over
+    // ================================================================
+    mpi::Comm gatherComm = X.BlockComm();
+    const int gatherSize = mpi::Size( gatherComm );
+    const Int gatherBlock = ( normal ? A.Grid().Col() : A.Grid().Row() );
+    const Int XBlockHeight = X.BlockHeight( gatherBlock );
+    std::vector<Int> gatherSizes( gatherSize ), gatherOffs;
+    for( int q=0; q<gatherSize; ++q )
+        gatherSizes[q] = X.PieceHeight( gatherBlock, q )*b;
+    const Int totalGather = Scan( gatherSizes, gatherOffs );
+    std::vector<T> XLocPacked( X.LocalHeight()*b ), XBlockPacked( totalGather );
+    {
+        const Matrix<T>& XLoc = X.LockedMatrix();
+        const Int XLocHeight = XLoc.Height();
+        for( Int t=0; t<b; ++t )
+            MemCopy
+            ( &XLocPacked[t*XLocHeight], XLoc.LockedBuffer(0,t), XLocHeight );
+    }
+    mpi::AllGather
+    ( XLocPacked.data(), X.LocalHeight()*b,
+      XBlockPacked.data(), gatherSizes.data(), gatherOffs.data(), 
+      gatherComm );
+    // Unpack into a column-major XBlockHeight x b matrix
+    Matrix<T> XBlock( XBlockHeight, b );
+    {
+        Int pieceOff = 0;
+        for( int q=0; q<gatherSize; ++q )
+        {
+            const Int pieceHeight = gatherSizes[q] / Max(b,Int(1));
+            const T* pieceBuf = &XBlockPacked[gatherOffs[q]];
+            for( Int t=0; t<b; ++t )
+                MemCopy
+                ( XBlock.Buffer(pieceOff,t), &pieceBuf[t*pieceHeight], 
+                  pieceHeight );
+            pieceOff += pieceHeight;
+        }
+    }
+    XLocPacked.clear();
+    XBlockPacked.clear();
+
+    // Form the local contributions to the block of Y
+    // ==============================================
+    mpi::Comm scatterComm = Y.BlockComm();
+    const int scatterSize = mpi::Size( scatterComm );
+    const Int scatterBlock = ( normal ? A.Grid().Row() : A.Grid().Col() );
+    const Int YBlockHeight = Y.BlockHeight( scatterBlock );
+    Matrix<T> ZBlock;
+    Zeros( ZBlock, YBlockHeight, b );
+    const Int firstLocalRow = A.FirstLocalRow();
+    const Int firstLocalCol = A.FirstLocalCol();
+    const Int numLocalEntries = A.NumLocalEntries();
+    for( Int k=0; k<numLocalEntries; ++k )
+    {
+        const Int iLoc = A.Row(k) - firstLocalRow;
+        const Int jLoc = A.Col(k) - firstLocalCol;
+        const T AVal = A.Value(k);
+        if( normal )
+        {
+            for( Int t=0; t<b; ++t )
+                ZBlock.Update( iLoc, t, AVal*XBlock.Get(jLoc,t) );
+        }
+        else
+        {
+            const T AValMod = ( conjugate ? Conj(AVal) : AVal );
+            for( Int t=0; t<b; ++t )
+                ZBlock.Update( jLoc, t, AValMod*XBlock.Get(iLoc,t) );
+        }
+    }
+    XBlock.Empty();
+
+    // Sum the contributions over the communicator that Y's block is split 
+    // over and add the result into our local portion of Y
+    // ===================================================================
+    std::vector<int> scatterSizes( scatterSize ), scatterOffs;
+    for( int q=0; q<scatterSize; ++q )
+        scatterSizes[q] = Y.PieceHeight( scatterBlock, q )*b;
+    const int totalScatter = Scan( scatterSizes, scatterOffs );
+    std::vector<T> ZPacked( totalScatter );
+    {
+        Int pieceOff = 0;
+        for( int q=0; q<scatterSize; ++q )
+        {
+            const Int pieceHeight = scatterSizes[q] / Max(b,Int(1));
+            T* pieceBuf = &ZPacked[scatterOffs[q]];
+            for( Int t=0; t<b; ++t )
+                MemCopy
+                ( &pieceBuf[t*pieceHeight], ZBlock.LockedBuffer(pieceOff,t), 
+                  pieceHeight );
+            pieceOff += pieceHeight;
+        }
+    }
+    ZBlock.Empty();
+    Matrix<T>& YLoc = Y.Matrix();
+    const Int YLocHeight = YLoc.Height();
+    std::vector<T> YLocUpdates( YLocHeight*b );
+    mpi::ReduceScatter
+    ( ZPacked.data(), YLocUpdates.data(), scatterSizes.data(), scatterComm );
+    for( Int t=0; t<b; ++t )
+        for( Int iLoc=0; iLoc<YLocHeight; ++iLoc )
+            YLoc.Update( iLoc, t, alpha*YLocUpdates[iLoc+t*YLocHeight] );
+}
+
 #define PROTO(T) \
     template void Multiply \
     ( Orientation orientation, \
@@ -293,7 +433,11 @@ void Multiply
     template void Multiply \
     ( Orientation orientation, \
       T alpha, const DistSparseMatrix<T>& A, const DistMultiVec<T>& X, \
-      T beta,                                      DistMultiVec<T>& Y );
+      T beta,                                      DistMultiVec<T>& Y ); \
+    template void Multiply \
+    ( Orientation orientation, \
+      T alpha, const DistSparseMatrix2D<T>& A, const DistMultiVec2D<T>& X, \
+      T beta,                                        DistMultiVec2D<T>& Y );
 
 #include "El/macros/Instantiate.h"
 
@@ -202,7 +202,7 @@ void Syrk
 
     // Count the number of entries that we will send to each process
     // =============================================================
-    std::vector<int> sendSizes(commSize,0);
+    std::vector<Int> sendSizes(commSize,0);
     const Int localHeightA = A.LocalHeight();
     for( Int kLoc=0; kLoc<localHeightA; ++kLoc )
     {
@@ -220,14 +220,14 @@ void Syrk
             }
         }
     }
-    std::vector<int> recvSizes(commSize);
+    std::vector<Int> recvSizes(commSize);
     mpi::AllToAll( sendSizes.data(), 1, recvSizes.data(), 1, comm );
 
     // Convert the send and recv counts to offsets and total sizes
     // ===========================================================
-    std::vector<int> sendOffsets, recvOffsets;
-    const int totalSend = Scan( sendSizes, sendOffsets );
-    const int totalRecv = Scan( recvSizes, recvOffsets );
+    std::vector<Int> sendOffsets, recvOffsets;
+    const Int totalSend = Scan( sendSizes, sendOffsets );
+    const Int totalRecv = Scan( recvSizes, recvOffsets );
 
     // Pack the send buffers
     // ===================== 
@@ -268,82 +268,35 @@ template<typename T>
 AxpyInterface<T>::AxpyInterface()
 : attachedForLocalToGlobal_(false), attachedForGlobalToLocal_(false), 
   localToGlobalMat_(0), globalToLocalMat_(0),
-  sendDummy_(0), recvDummy_(0)
+  sendDummy_(0), recvDummy_(0),
+  backend_(AXPY_TWO_SIDED), window_(mpi::WINDOW_NULL),
+  numBufferedEntries_(0), maxBufferedEntries_(1<<20)
 { }
 
 template<typename T>
-AxpyInterface<T>::AxpyInterface( AxpyType type, DistMatrix<T>& Z )
-: sendDummy_(0), recvDummy_(0)
+AxpyInterface<T>::AxpyInterface
+( AxpyType type, DistMatrix<T>& Z, AxpyBackend backend )
+: attachedForLocalToGlobal_(false), attachedForGlobalToLocal_(false),
+  localToGlobalMat_(0), globalToLocalMat_(0),
+  sendDummy_(0), recvDummy_(0),
+  backend_(AXPY_TWO_SIDED), window_(mpi::WINDOW_NULL),
+  numBufferedEntries_(0), maxBufferedEntries_(1<<20)
 {
     DEBUG_ONLY(CallStackEntry cse("AxpyInterface::AxpyInterface"))
-    if( type == LOCAL_TO_GLOBAL )
-    {
-        attachedForLocalToGlobal_ = true;
-        attachedForGlobalToLocal_ = false;
-        localToGlobalMat_ = &Z;
-        globalToLocalMat_ = 0;
-    }
-    else
-    {
-        attachedForLocalToGlobal_ = false;
-        attachedForGlobalToLocal_ = true;
-        localToGlobalMat_ = 0;
-        globalToLocalMat_ = &Z;
-    }
-
-    const Int p = Z.Grid().Size();
-    sentEomTo_.resize( p, false );
-    haveEomFrom_.resize( p, false );
-
-    sendingData_.resize( p );
-    sendingRequest_.resize( p );
-    sendingReply_.resize( p );
-
-    dataVectors_.resize( p );
-    requestVectors_.resize( p );
-    replyVectors_.resize( p );
-
-    dataSendRequests_.resize( p );
-    requestSendRequests_.resize( p );
-    replySendRequests_.resize( p );
-
-    eomSendRequests_.resize( p );
+    Attach( type, Z, backend );
 }
 
 template<typename T>
-AxpyInterface<T>::AxpyInterface( AxpyType type, const DistMatrix<T>& X )
-: sendDummy_(0), recvDummy_(0)
+AxpyInterface<T>::AxpyInterface
+( AxpyType type, const DistMatrix<T>& X, AxpyBackend backend )
+: attachedForLocalToGlobal_(false), attachedForGlobalToLocal_(false),
+  localToGlobalMat_(0), globalToLocalMat_(0),
+  sendDummy_(0), recvDummy_(0),
+  backend_(AXPY_TWO_SIDED), window_(mpi::WINDOW_NULL),
+  numBufferedEntries_(0), maxBufferedEntries_(1<<20)
 {
     DEBUG_ONLY(CallStackEntry cse("AxpyInterface::AxpyInterface"))
-    if( type == LOCAL_TO_GLOBAL )
-    {
-        LogicError("Cannot update a constant matrix");
-    }
-    else
-    {
-        attachedForLocalToGlobal_ = false;
-        attachedForGlobalToLocal_ = true;
-        localToGlobalMat_ = 0;
-        globalToLocalMat_ = &X;
-    }
-
-    const Int p = X.Grid().Size();
-    sentEomTo_.resize( p, false );
-    haveEomFrom_.resize( p, false );
-
-    sendingData_.resize( p );
-    sendingRequest_.resize( p );
-    sendingReply_.resize( p );
-
-    dataVectors_.resize( p );
-    requestVectors_.resize( p );
-    replyVectors_.resize( p );
-
-    dataSendRequests_.resize( p );
-    requestSendRequests_.resize( p );
-    replySendRequests_.resize( p );
-
-    eomSendRequests_.resize( p );
+    Attach( type, X, backend );
 }
 
 template<typename T>
@@ -375,7 +328,8 @@ AxpyInterface<T>::~AxpyInterface()
 }
 
 template<typename T>
-void AxpyInterface<T>::Attach( AxpyType type, DistMatrix<T>& Z )
+void AxpyInterface<T>::Attach
+( AxpyType type, DistMatrix<T>& Z, AxpyBackend backend )
 {
     DEBUG_ONLY(CallStackEntry cse("AxpyInterface::Attach"))
     if( attachedForLocalToGlobal_ || attachedForGlobalToLocal_ )
@@ -392,6 +346,13 @@ void AxpyInterface<T>::Attach( AxpyType type, DistMatrix<T>& Z )
         globalToLocalMat_ = &Z;
     }
 
+    backend_ = backend;
+    if( backend == AXPY_ONE_SIDED )
+    {
+        OpenWindow( Z );
+        return;
+    }
+
     const Int p = Z.Grid().Size();
     sentEomTo_.resize( p, false );
     haveEomFrom_.resize( p, false );
@@ -412,7 +373,8 @@ void AxpyInterface<T>::Attach( AxpyType type, DistMatrix<T>& Z )
 }
 
 template<typename T>
-void AxpyInterface<T>::Attach( AxpyType type, const DistMatrix<T>& X )
+void AxpyInterface<T>::Attach
+( AxpyType type, const DistMatrix<T>& X, AxpyBackend backend )
 {
     DEBUG_ONLY(CallStackEntry cse("AxpyInterface::Attach"))
     if( attachedForLocalToGlobal_ || attachedForGlobalToLocal_ )
@@ -428,6 +390,13 @@ void AxpyInterface<T>::Attach( AxpyType type, const DistMatrix<T>& X )
         globalToLocalMat_ = &X;
     }
 
+    backend_ = backend;
+    if( backend == AXPY_ONE_SIDED )
+    {
+        OpenWindow( X );
+        return;
+    }
+
     const Int p = X.Grid().Size();
     sentEomTo_.resize( p, false );
     haveEomFrom_.resize( p, false );
@@ -452,9 +421,19 @@ void AxpyInterface<T>::Axpy( T alpha, Matrix<T>& Z, Int i, Int j )
 {
     DEBUG_ONLY(CallStackEntry cse("AxpyInterface::Axpy"))
     if( attachedForLocalToGlobal_ )
-        AxpyLocalToGlobal( alpha, Z, i, j );
+    {
+        if( backend_ == AXPY_ONE_SIDED )
+            AccumulateLocalToGlobal( alpha, Z, i, j );
+        else
+            AxpyLocalToGlobal( alpha, Z, i, j );
+    }
     else if( attachedForGlobalToLocal_ )
-        AxpyGlobalToLocal( alpha, Z, i, j );
+    {
+        if( backend_ == AXPY_ONE_SIDED )
+            GetGlobalToLocal( alpha, Z, i, j );
+        else
+            AxpyGlobalToLocal( alpha, Z, i, j );
+    }
     else
         LogicError("Cannot axpy before attaching.");
 }
@@ -464,7 +443,12 @@ void AxpyInterface<T>::Axpy( T alpha, const Matrix<T>& Z, Int i, Int j )
 {
     DEBUG_ONLY(CallStackEntry cse("AxpyInterface::Axpy"))
     if( attachedForLocalToGlobal_ )
-        AxpyLocalToGlobal( alpha, Z, i, j );
+    {
+        if( backend_ == AXPY_ONE_SIDED )
+            AccumulateLocalToGlobal( alpha, Z, i, j );
+        else
+            AxpyLocalToGlobal( alpha, Z, i, j );
+    }
     else if( attachedForGlobalToLocal_ )
         LogicError("Cannot update a constant matrix.");
     else
@@ -642,6 +626,162 @@ void AxpyInterface<T>::AxpyGlobalToLocal( T alpha, Matrix<T>& Y, Int i, Int j )
     }
 }
 
+template<typename T>
+void AxpyInterface<T>::OpenWindow( const DistMatrix<T>& Z )
+{
+    DEBUG_ONLY(CallStackEntry cse("AxpyInterface::OpenWindow"))
+    const Grid& g = Z.Grid();
+    const Int ldim = Z.LDim();
+    ldims_.resize( g.Size() );
+    mpi::AllGather( &ldim, 1, ldims_.data(), 1, g.VCComm() );
+    mpi::WindowCreate
+    ( const_cast<T*>(Z.LockedBuffer()), ldim*Z.LocalWidth(), g.VCComm(),
+      window_ );
+    numBufferedEntries_ = 0;
+}
+
+// Update Y(i:i+height-1,j:j+width-1) += alpha X by accumulating directly into
+// the local data of each owning process
+template<typename T>
+void AxpyInterface<T>::AccumulateLocalToGlobal
+( T alpha, const Matrix<T>& X, Int i, Int j )
+{
+    DEBUG_ONLY(CallStackEntry cse("AxpyInterface::AccumulateLocalToGlobal"))
+    const DistMatrix<T>& Y = *localToGlobalMat_;
+    if( i < 0 || j < 0 )
+        LogicError("Submatrix offsets must be non-negative");
+    if( i+X.Height() > Y.Height() || j+X.Width() > Y.Width() )
+        LogicError("Submatrix out of bounds of global matrix");
+
+    const Grid& g = Y.Grid();
+    const Int r = g.Height();
+    const Int c = g.Width();
+    const Int p = g.Size();
+    const Int colAlign = (Y.ColAlign() + i) % r;
+    const Int rowAlign = (Y.RowAlign() + j) % c;
+
+    const Int height = X.Height();
+    const Int width = X.Width();
+    const T* XBuffer = X.LockedBuffer();
+    const Int XLDim = X.LDim();
+
+    // Start with our own process to avoid every process simultaneously
+    // targeting the same window
+    Int receivingRow = g.Row();
+    Int receivingCol = g.Col();
+    for( Int step=0; step<p; ++step )
+    {
+        const Int colShift = Shift( receivingRow, colAlign, r );
+        const Int rowShift = Shift( receivingCol, rowAlign, c );
+        const Int localHeight = Length( height, colShift, r );
+        const Int localWidth = Length( width, rowShift, c );
+        const Int numEntries = localHeight*localWidth;
+
+        if( numEntries != 0 )
+        {
+            const Int destination = receivingRow + r*receivingCol;
+            const Int iLocalOffset =
+                Length( i, Shift(receivingRow,Y.ColAlign(),r), r );
+            const Int jLocalOffset =
+                Length( j, Shift(receivingCol,Y.RowAlign(),c), c );
+            const Int ldim = ldims_[destination];
+
+            // Pack alpha times our contribution, which must remain unmodified
+            // until the accumulation has locally completed
+            rmaBuffers_.emplace_back( numEntries );
+            T* sendData = rmaBuffers_.back().data();
+            for( Int t=0; t<localWidth; ++t )
+            {
+                T* thisSendCol = &sendData[t*localHeight];
+                const T* thisXCol = &XBuffer[(rowShift+t*c)*XLDim];
+                for( Int s=0; s<localHeight; ++s )
+                    thisSendCol[s] = alpha*thisXCol[colShift+s*r];
+            }
+            mpi::Accumulate
+            ( sendData, localHeight, localWidth,
+              destination, iLocalOffset+jLocalOffset*ldim, ldim, window_ );
+            numBufferedEntries_ += numEntries;
+        }
+
+        receivingRow = (receivingRow + 1) % r;
+        if( receivingRow == 0 )
+            receivingCol = (receivingCol + 1) % c;
+    }
+
+    if( numBufferedEntries_ > maxBufferedEntries_ )
+    {
+        mpi::WindowFlushLocal( window_ );
+        rmaBuffers_.clear();
+        numBufferedEntries_ = 0;
+    }
+}
+
+// Update Y += alpha X(i:i+height-1,j:j+width-1) by directly reading from the
+// local data of each owning process
+template<typename T>
+void AxpyInterface<T>::GetGlobalToLocal( T alpha, Matrix<T>& Y, Int i, Int j )
+{
+    DEBUG_ONLY(CallStackEntry cse("AxpyInterface::GetGlobalToLocal"))
+    const DistMatrix<T>& X = *globalToLocalMat_;
+
+    const Int height = Y.Height();
+    const Int width = Y.Width();
+    if( i+height > X.Height() || j+width > X.Width() )
+        LogicError("Invalid AxpyGlobalToLocal submatrix");
+
+    const Grid& g = X.Grid();
+    const Int r = g.Height();
+    const Int c = g.Width();
+    const Int p = g.Size();
+    const Int colAlign = (X.ColAlign()+i) % r;
+    const Int rowAlign = (X.RowAlign()+j) % c;
+
+    // Start reading the contribution of every process
+    std::vector<std::vector<T>> recvBufs( p );
+    for( Int rank=0; rank<p; ++rank )
+    {
+        const Int row = rank % r;
+        const Int col = rank / r;
+        const Int colShift = Shift( row, colAlign, r );
+        const Int rowShift = Shift( col, rowAlign, c );
+        const Int localHeight = Length( height, colShift, r );
+        const Int localWidth = Length( width, rowShift, c );
+        const Int iLocalOffset = Length( i, Shift(row,X.ColAlign(),r), r );
+        const Int jLocalOffset = Length( j, Shift(col,X.RowAlign(),c), c );
+        const Int ldim = ldims_[rank];
+        recvBufs[rank].resize( localHeight*localWidth );
+        mpi::Get
+        ( recvBufs[rank].data(), localHeight, localWidth,
+          rank, iLocalOffset+jLocalOffset*ldim, ldim, window_ );
+    }
+    mpi::WindowFlushLocal( window_ );
+
+    // Unpack the local matrices
+    for( Int rank=0; rank<p; ++rank )
+    {
+        const Int colShift = Shift( rank % r, colAlign, r );
+        const Int rowShift = Shift( rank / r, rowAlign, c );
+        const Int localHeight = Length( height, colShift, r );
+        const Int localWidth = Length( width, rowShift, c );
+        const T* recvData = recvBufs[rank].data();
+        for( Int t=0; t<localWidth; ++t )
+        {
+            T* YCol = Y.Buffer(0,rowShift+t*c);
+            const T* XCol = &recvData[t*localHeight];
+            for( Int s=0; s<localHeight; ++s )
+                YCol[colShift+s*r] += alpha*XCol[s];
+        }
+    }
+}
+
+template<typename T>
+void AxpyInterface<T>::SetMaxBufferedEntries( Int maxEntries )
+{ maxBufferedEntries_ = maxEntries; }
+
+template<typename T>
+Int AxpyInterface<T>::MaxBufferedEntries() const
+{ return maxBufferedEntries_; }
+
 template<typename T>
 Int AxpyInterface<T>::ReadyForSend
 ( Int sendSize,
@@ -721,16 +861,29 @@ void AxpyInterface<T>::Detach()
                       localToGlobalMat_->Grid() : 
                       globalToLocalMat_->Grid() );
 
-    while( !Finished() )
+    if( backend_ == AXPY_ONE_SIDED )
     {
-        if( attachedForLocalToGlobal_ )
-            HandleLocalToGlobalData();
-        else
-            HandleGlobalToLocalRequest();
-        HandleEoms();
+        // Freeing the window is collective and waits for every process to
+        // complete its accesses
+        mpi::WindowFlush( window_ );
+        mpi::WindowFree( window_ );
+        window_ = mpi::WINDOW_NULL;
+        ldims_.clear();
+        rmaBuffers_.clear();
+        numBufferedEntries_ = 0;
+    }
+    else
+    {
+        while( !Finished() )
+        {
+            if( attachedForLocalToGlobal_ )
+                HandleLocalToGlobalData();
+            else
+                HandleGlobalToLocalRequest();
+            HandleEoms();
+        }
+        mpi::Barrier( g.VCComm() );
     }
-
-    mpi::Barrier( g.VCComm() );
 
     attachedForLocalToGlobal_ = false;
     attachedForGlobalToLocal_ = false;
@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include "El.hpp"
+#include "../RemoteQueues.hpp"
 
 namespace El {
 
@@ -60,6 +61,11 @@ AbstractBlockDistMatrix<T>::AbstractBlockDistMatrix
 { 
     matrix_.ShallowSwap( A.matrix_ );
     auxMemory_.ShallowSwap( A.auxMemory_ );
+    updateRows_.swap( A.updateRows_ );
+    updateCols_.swap( A.updateCols_ );
+    updateVals_.swap( A.updateVals_ );
+    pullRows_.swap( A.pullRows_ );
+    pullCols_.swap( A.pullCols_ );
 }
 
 // Optional to override
@@ -84,22 +90,27 @@ AbstractBlockDistMatrix<T>::operator=( AbstractBlockDistMatrix<T>&& A )
     {
         auxMemory_.ShallowSwap( A.auxMemory_ );
         matrix_.ShallowSwap( A.matrix_ );
-        viewType_ = A.viewType_;
-        height_ = A.height_;
-        width_ = A.width_;
-        colConstrained_ = A.colConstrained_;
-        rowConstrained_ = A.rowConstrained_;
-        rootConstrained_ = A.rootConstrained_;
-        blockHeight_ = A.blockHeight_;
-        blockWidth_ = A.blockWidth_;
-        colAlign_ = A.colAlign_;
-        rowAlign_ = A.rowAlign_;
-        colCut_ = A.colCut_;
-        rowCut_ = A.rowCut_;
-        colShift_ = A.colShift_;
-        rowShift_ = A.rowShift_;
-        root_ = A.root_;
-        grid_ = A.grid_;
+        updateRows_.swap( A.updateRows_ );
+        updateCols_.swap( A.updateCols_ );
+        updateVals_.swap( A.updateVals_ );
+        pullRows_.swap( A.pullRows_ );
+        pullCols_.swap( A.pullCols_ );
+        std::swap( viewType_, A.viewType_ );
+        std::swap( height_, A.height_ );
+        std::swap( width_, A.width_ );
+        std::swap( colConstrained_, A.colConstrained_ );
+        std::swap( rowConstrained_, A.rowConstrained_ );
+        std::swap( rootConstrained_, A.rootConstrained_ );
+        std::swap( blockHeight_, A.blockHeight_ );
+        std::swap( blockWidth_, A.blockWidth_ );
+        std::swap( colAlign_, A.colAlign_ );
+        std::swap( rowAlign_, A.rowAlign_ );
+        std::swap( colCut_, A.colCut_ );
+        std::swap( rowCut_, A.rowCut_ );
+        std::swap( colShift_, A.colShift_ );
+        std::swap( rowShift_, A.rowShift_ );
+        std::swap( root_, A.root_ );
+        std::swap( grid_, A.grid_ );
     }
     return *this;
 }
@@ -589,6 +600,56 @@ void AbstractBlockDistMatrix<T>::LockedAttach
       colAlign, rowAlign, colCut, rowCut, A.LockedBuffer(), A.LDim(), root );
 }
 
+// Ownership transfer of the local buffer
+// --------------------------------------
+
+template<typename T>
+void AbstractBlockDistMatrix<T>::Control
+( Int height, Int width, const El::Grid& g,
+  Int blockHeight, Int blockWidth,
+  Int colAlign, Int rowAlign, Int colCut, Int rowCut,
+  T* buffer, Int ldim, std::function<void(T*)> deleter, Int root )
+{
+    DEBUG_ONLY(CallStackEntry cse("ABDM::Control"))
+    Empty();
+
+    grid_ = &g;
+    root_ = root;
+    height_ = height;
+    width_ = width;
+    blockHeight_ = blockHeight;
+    blockWidth_ = blockWidth;
+    colAlign_ = colAlign;
+    rowAlign_ = rowAlign;
+    colCut_ = colCut;
+    rowCut_ = rowCut;
+    colConstrained_ = true;
+    rowConstrained_ = true;
+    viewType_ = OWNER;
+    SetShifts();
+    if( Participating() )
+    {
+        Int localHeight =
+            BlockedLength(height,colShift_,blockHeight,colCut,ColStride());
+        Int localWidth =
+            BlockedLength(width,rowShift_,blockWidth,rowCut,RowStride());
+        matrix_.Control_( localHeight, localWidth, buffer, ldim, deleter );
+    }
+}
+
+template<typename T>
+T* AbstractBlockDistMatrix<T>::Release()
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("ABDM::Release");
+        if( Viewing() )
+            LogicError("Cannot release the buffer of a view");
+    )
+    T* buffer = matrix_.Release_();
+    Empty();
+    return buffer;
+}
+
 // Basic queries
 // =============
 
@@ -1083,6 +1144,62 @@ template<typename T>
 void AbstractBlockDistMatrix<T>::ConjugateLocal( Int iLoc, Int jLoc )
 { matrix_.Conjugate( iLoc, jLoc ); }
 
+// Batch manipulation of remote entries
+// ------------------------------------
+template<typename T>
+void AbstractBlockDistMatrix<T>::Reserve( Int numRemoteUpdates )
+{
+    DEBUG_ONLY(CallStackEntry cse("ABDM::Reserve"))
+    updateRows_.reserve( numRemoteUpdates );
+    updateCols_.reserve( numRemoteUpdates );
+    updateVals_.reserve( numRemoteUpdates );
+}
+
+template<typename T>
+void AbstractBlockDistMatrix<T>::QueueUpdate( Int i, Int j, T value )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("ABDM::QueueUpdate");
+        AssertValidEntry( i, j );
+    )
+    updateRows_.push_back( i );
+    updateCols_.push_back( j );
+    updateVals_.push_back( value );
+}
+
+template<typename T>
+void AbstractBlockDistMatrix<T>::ProcessQueues()
+{
+    DEBUG_ONLY(CallStackEntry cse("ABDM::ProcessQueues"))
+    queues::ProcessUpdates( *this, updateRows_, updateCols_, updateVals_ );
+}
+
+template<typename T>
+void AbstractBlockDistMatrix<T>::ReservePulls( Int numPulls ) const
+{
+    DEBUG_ONLY(CallStackEntry cse("ABDM::ReservePulls"))
+    pullRows_.reserve( numPulls );
+    pullCols_.reserve( numPulls );
+}
+
+template<typename T>
+void AbstractBlockDistMatrix<T>::QueuePull( Int i, Int j ) const
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("ABDM::QueuePull");
+        AssertValidEntry( i, j );
+    )
+    pullRows_.push_back( i );
+    pullCols_.push_back( j );
+}
+
+template<typename T>
+void AbstractBlockDistMatrix<T>::ProcessPullQueue( std::vector<T>& pullBuf ) const
+{
+    DEBUG_ONLY(CallStackEntry cse("ABDM::ProcessPullQueue"))
+    queues::ProcessPulls( *this, pullRows_, pullCols_, pullBuf );
+}
+
 // Diagonal manipulation
 // =====================
 template<typename T>
@@ -146,7 +146,7 @@ GeneralBlockDistMatrix<T,U,V>::Translate( BlockDistMatrix<T,U,V>& A ) const
 
         // Determine how much data our process sends and recvs from every 
         // other process
-        std::vector<int> sendCounts(distSize,0),
+        std::vector<Int> sendCounts(distSize,0),
                          recvCounts(distSize,0);
         for( Int jLoc=0; jLoc<nLocal; ++jLoc )
         {
@@ -171,13 +171,13 @@ GeneralBlockDistMatrix<T,U,V>::Translate( BlockDistMatrix<T,U,V>& A ) const
 
         // Translate the send/recv counts into displacements and allocate
         // the send and recv buffers
-        std::vector<int> sendDispls, recvDispls;
+        std::vector<Int> sendDispls, recvDispls;
         const Int totalSend = Scan( sendCounts, sendDispls );
         const Int totalRecv = Scan( recvCounts, recvDispls );
         std::vector<T> sendBuf(totalSend), recvBuf(totalRecv);
 
         // Pack the send data
-        std::vector<int> offsets = sendDispls;
+        std::vector<Int> offsets = sendDispls;
         for( Int jLoc=0; jLoc<nLocal; ++jLoc )
         {
             const Int j = this->GlobalCol(jLoc);
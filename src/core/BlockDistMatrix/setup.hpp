@@ -153,9 +153,7 @@ template<Dist U,Dist V>
 BDM& BDM::operator=( const DistMatrix<T,U,V>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("BDM = DM[U,V]"))
-    BlockDistMatrix<T,U,V> ABlock(A.Grid());
-    LockedView( ABlock, A );
-    *this = ABlock;
+    CachedRedistPlan( A, *this ).Execute( A, *this );
     return *this;
 }
 
@@ -175,7 +173,19 @@ BDM& BDM::operator=( const AbstractBlockDistMatrix<T>& A )
 template<typename T>
 BDM& BDM::operator=( BDM&& A )
 {
-    if( this->Viewing() && !A.Viewing() )
+    // Fall back to a copy if taking the buffer of A would violate the
+    // alignments this matrix is constrained to
+    const bool misaligned =
+        ( this->ColConstrained() &&
+          ( this->BlockHeight() != A.BlockHeight() ||
+            this->ColAlign() != A.ColAlign() ||
+            this->ColCut() != A.ColCut() ) ) ||
+        ( this->RowConstrained() &&
+          ( this->BlockWidth() != A.BlockWidth() ||
+            this->RowAlign() != A.RowAlign() ||
+            this->RowCut() != A.RowCut() ) ) ||
+        ( this->RootConstrained() && this->Root() != A.Root() );
+    if( this->Viewing() ? !A.Viewing() : misaligned )
         this->operator=( (const BDM&)A );
     else
         GBDM::operator=( std::move(A) );
@@ -41,7 +41,7 @@ void DistMap::StoreOwners
     const int firstLocalSource = FirstLocalSource();
 
     // Exchange via AllToAlls
-    std::vector<int> sendSizes( commSize, 0 );
+    std::vector<Int> sendSizes( commSize, 0 );
     const int numLocalInds = localInds.size();
     for( int s=0; s<numLocalInds; ++s )
     {
@@ -49,10 +49,10 @@ void DistMap::StoreOwners
         const int q = RowToProcess( i, blocksize, commSize );
         ++sendSizes[q];
     }
-    std::vector<int> recvSizes( commSize );
+    std::vector<Int> recvSizes( commSize );
     mpi::AllToAll( &sendSizes[0], 1, &recvSizes[0], 1, comm );
-    std::vector<int> sendOffs( commSize ), recvOffs( commSize );
-    int numSends=0, numRecvs=0;
+    std::vector<Int> sendOffs( commSize ), recvOffs( commSize );
+    Int numSends=0, numRecvs=0;
     for( int q=0; q<commSize; ++q )
     {
         sendOffs[q] = numSends;
@@ -64,7 +64,7 @@ void DistMap::StoreOwners
         if( numRecvs != NumLocalSources() )
             LogicError("Incorrect number of recv indices");
     )
-    std::vector<int> offs = sendOffs;
+    std::vector<Int> offs = sendOffs;
     std::vector<int> sendInds( numSends );
     for( int s=0; s<numLocalInds; ++s )
     {
@@ -98,7 +98,7 @@ void DistMap::Translate( std::vector<int>& localInds ) const
     const int numLocalInds = localInds.size();
 
     // Count how many indices we need each process to map
-    std::vector<int> requestSizes( commSize, 0 );
+    std::vector<Int> requestSizes( commSize, 0 );
     for( int s=0; s<numLocalInds; ++s )
     {
         const int i = localInds[s];
@@ -114,19 +114,19 @@ void DistMap::Translate( std::vector<int>& localInds ) const
     }
 
     // Send our requests and find out what we need to fulfill
-    std::vector<int> fulfillSizes( commSize );
+    std::vector<Int> fulfillSizes( commSize );
     mpi::AllToAll( &requestSizes[0], 1, &fulfillSizes[0], 1, comm_ );
 
     // Prepare for the AllToAll to exchange request sizes
-    int numRequests=0;
-    std::vector<int> requestOffs( commSize );
+    Int numRequests=0;
+    std::vector<Int> requestOffs( commSize );
     for( int q=0; q<commSize; ++q )
     {
         requestOffs[q] = numRequests;
         numRequests += requestSizes[q];
     }
-    int numFulfills=0;
-    std::vector<int> fulfillOffs( commSize );
+    Int numFulfills=0;
+    std::vector<Int> fulfillOffs( commSize );
     for( int q=0; q<commSize; ++q )
     {
         fulfillOffs[q] = numFulfills;
@@ -135,7 +135,7 @@ void DistMap::Translate( std::vector<int>& localInds ) const
 
     // Pack the requested information 
     std::vector<int> requests( numRequests );
-    std::vector<int> offs = requestOffs;
+    std::vector<Int> offs = requestOffs;
     for( int s=0; s<numLocalInds; ++s )
     {
         const int i = localInds[s];
@@ -194,7 +194,7 @@ void DistMap::FormInverse( DistMap& inverseMap ) const
     const int numLocalSources = map_.size();
 
     // How many pairs of original and mapped indices to send to each process
-    std::vector<int> sendSizes( commSize, 0 );
+    std::vector<Int> sendSizes( commSize, 0 );
     for( int s=0; s<numLocalSources; ++s )
     {
         const int i = map_[s];
@@ -203,12 +203,12 @@ void DistMap::FormInverse( DistMap& inverseMap ) const
     }
 
     // Coordinate all of the processes on their send sizes
-    std::vector<int> recvSizes( commSize );
+    std::vector<Int> recvSizes( commSize );
     mpi::AllToAll( &sendSizes[0], 1, &recvSizes[0], 1, comm_ );
 
     // Prepare for the AllToAll to exchange send sizes
-    int numSends=0;
-    std::vector<int> sendOffs( commSize );
+    Int numSends=0;
+    std::vector<Int> sendOffs( commSize );
     for( int q=0; q<commSize; ++q )
     {
         sendOffs[q] = numSends;
@@ -218,8 +218,8 @@ void DistMap::FormInverse( DistMap& inverseMap ) const
         if( numSends != 2*numLocalSources )
             LogicError("Miscalculated numSends");
     )
-    int numReceives=0;
-    std::vector<int> recvOffs( commSize );
+    Int numReceives=0;
+    std::vector<Int> recvOffs( commSize );
     for( int q=0; q<commSize; ++q )
     {
         recvOffs[q] = numReceives;
@@ -232,7 +232,7 @@ void DistMap::FormInverse( DistMap& inverseMap ) const
 
     // Pack our map information
     std::vector<int> sends( numSends );
-    std::vector<int> offs = sendOffs;
+    std::vector<Int> offs = sendOffs;
     for( int s=0; s<numLocalSources; ++s )
     {
         const int i = map_[s];
@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include "El.hpp"
+#include "../RemoteQueues.hpp"
 
 namespace El {
 
@@ -22,6 +23,9 @@ AbstractDistMatrix<T>::AbstractDistMatrix( const El::Grid& grid, Int root )
   height_(0), width_(0),
   auxMemory_(),
   matrix_(0,0,true),
+  nodeShared_(false), 
+  nodeComm_(mpi::COMM_NULL), interNodeComm_(mpi::COMM_NULL),
+  nodeWindow_(mpi::WINDOW_NULL),
   colConstrained_(false), rowConstrained_(false), rootConstrained_(false),
   colAlign_(0), rowAlign_(0),
   root_(root), grid_(&grid)
@@ -32,6 +36,9 @@ AbstractDistMatrix<T>::AbstractDistMatrix( AbstractDistMatrix<T>&& A )
 EL_NOEXCEPT
 : viewType_(A.viewType_),
   height_(A.height_), width_(A.width_), 
+  nodeShared_(A.nodeShared_), 
+  nodeComm_(A.nodeComm_), interNodeComm_(A.interNodeComm_),
+  nodeWindow_(A.nodeWindow_),
   colConstrained_(A.colConstrained_), rowConstrained_(A.rowConstrained_),
   rootConstrained_(A.rootConstrained_),
   colAlign_(A.colAlign_), rowAlign_(A.rowAlign_),
@@ -41,13 +48,22 @@ EL_NOEXCEPT
 { 
     matrix_.ShallowSwap( A.matrix_ );
     auxMemory_.ShallowSwap( A.auxMemory_ );
+    A.nodeShared_ = false;
+    A.nodeComm_ = mpi::COMM_NULL;
+    A.interNodeComm_ = mpi::COMM_NULL;
+    A.nodeWindow_ = mpi::WINDOW_NULL;
+    updateRows_.swap( A.updateRows_ );
+    updateCols_.swap( A.updateCols_ );
+    updateVals_.swap( A.updateVals_ );
+    pullRows_.swap( A.pullRows_ );
+    pullCols_.swap( A.pullCols_ );
 }
 
 // Optional to override
 // --------------------
 
 template<typename T>
-AbstractDistMatrix<T>::~AbstractDistMatrix() { }
+AbstractDistMatrix<T>::~AbstractDistMatrix() { FreeNodeComms(); }
 
 // Assignment and reconfiguration
 // ==============================
@@ -64,18 +80,27 @@ AbstractDistMatrix<T>::operator=( AbstractDistMatrix<T>&& A )
     {
         auxMemory_.ShallowSwap( A.auxMemory_ );
         matrix_.ShallowSwap( A.matrix_ );
-        viewType_ = A.viewType_;
-        height_ = A.height_;
-        width_ = A.width_;
-        colConstrained_ = A.colConstrained_;
-        rowConstrained_ = A.rowConstrained_;
-        rootConstrained_ = A.rootConstrained_;
-        colAlign_ = A.colAlign_;
-        rowAlign_ = A.rowAlign_;
-        colShift_ = A.colShift_;
-        rowShift_ = A.rowShift_;
-        root_ = A.root_;
-        grid_ = A.grid_;
+        std::swap( nodeShared_, A.nodeShared_ );
+        std::swap( nodeComm_, A.nodeComm_ );
+        std::swap( interNodeComm_, A.interNodeComm_ );
+        std::swap( nodeWindow_, A.nodeWindow_ );
+        updateRows_.swap( A.updateRows_ );
+        updateCols_.swap( A.updateCols_ );
+        updateVals_.swap( A.updateVals_ );
+        pullRows_.swap( A.pullRows_ );
+        pullCols_.swap( A.pullCols_ );
+        std::swap( viewType_, A.viewType_ );
+        std::swap( height_, A.height_ );
+        std::swap( width_, A.width_ );
+        std::swap( colConstrained_, A.colConstrained_ );
+        std::swap( rowConstrained_, A.rowConstrained_ );
+        std::swap( rootConstrained_, A.rootConstrained_ );
+        std::swap( colAlign_, A.colAlign_ );
+        std::swap( rowAlign_, A.rowAlign_ );
+        std::swap( colShift_, A.colShift_ );
+        std::swap( rowShift_, A.rowShift_ );
+        std::swap( root_, A.root_ );
+        std::swap( grid_, A.grid_ );
     }
     return *this;
 }
@@ -85,6 +110,7 @@ void
 AbstractDistMatrix<T>::Empty()
 {
     matrix_.Empty_();
+    nodeWindow_ = mpi::WINDOW_NULL;
     viewType_ = OWNER;
     height_ = 0;
     width_ = 0;
@@ -101,6 +127,7 @@ void
 AbstractDistMatrix<T>::EmptyData()
 {
     matrix_.Empty_();
+    nodeWindow_ = mpi::WINDOW_NULL;
     viewType_ = OWNER;
     height_ = 0;
     width_ = 0;
@@ -112,8 +139,12 @@ AbstractDistMatrix<T>::SetGrid( const El::Grid& grid )
 {
     if( grid_ != &grid )
     {
+        // The node communicators are specific to the old grid
+        Empty();
+        FreeNodeComms();
         grid_ = &grid; 
         Empty();
+        SetUpNodeComms();
     }
 }
 
@@ -130,9 +161,14 @@ AbstractDistMatrix<T>::Resize( Int height, Int width )
     height_ = height; 
     width_ = width;
     if( Participating() )
-        matrix_.Resize_
-        ( Length(height,ColShift(),ColStride()),
-          Length(width,RowShift(),RowStride()) );
+    {
+        const Int localHeight = Length(height,ColShift(),ColStride());
+        const Int localWidth = Length(width,RowShift(),RowStride());
+        if( nodeShared_ )
+            ResizeNodeShared( localHeight, localWidth, Max(localHeight,1) );
+        else
+            matrix_.Resize_( localHeight, localWidth );
+    }
 }
 
 template<typename T>
@@ -149,9 +185,14 @@ AbstractDistMatrix<T>::Resize( Int height, Int width, Int ldim )
     height_ = height; 
     width_ = width;
     if( Participating() )
-        matrix_.Resize_
-        ( Length(height,ColShift(),ColStride()),
-          Length(width,RowShift(),RowStride()), ldim );
+    {
+        const Int localHeight = Length(height,ColShift(),ColStride());
+        const Int localWidth = Length(width,RowShift(),RowStride());
+        if( nodeShared_ )
+            ResizeNodeShared( localHeight, localWidth, ldim );
+        else
+            matrix_.Resize_( localHeight, localWidth, ldim );
+    }
 }
 
 template<typename T>
@@ -415,6 +456,8 @@ AbstractDistMatrix<T>::Attach
 {
     DEBUG_ONLY(CallStackEntry cse("ADM::Attach"))
     Empty();
+    FreeNodeComms();
+    nodeShared_ = false;
 
     grid_ = &g;
     root_ = root;
@@ -453,6 +496,8 @@ AbstractDistMatrix<T>::LockedAttach
 {
     DEBUG_ONLY(CallStackEntry cse("ADM::LockedAttach"))
     Empty();
+    FreeNodeComms();
+    nodeShared_ = false;
 
     grid_ = &g;
     root_ = root;
@@ -484,6 +529,117 @@ AbstractDistMatrix<T>::LockedAttach
     ( height, width, g, colAlign, rowAlign, A.LockedBuffer(), A.LDim(), root );
 }
 
+// Ownership transfer of the local buffer
+// --------------------------------------
+
+template<typename T>
+void
+AbstractDistMatrix<T>::Control
+( Int height, Int width, const El::Grid& g,
+  Int colAlign, Int rowAlign, T* buffer, Int ldim,
+  std::function<void(T*)> deleter, Int root )
+{
+    DEBUG_ONLY(CallStackEntry cse("ADM::Control"))
+    Empty();
+    FreeNodeComms();
+    nodeShared_ = false;
+
+    grid_ = &g;
+    root_ = root;
+    height_ = height;
+    width_ = width;
+    colAlign_ = colAlign;
+    rowAlign_ = rowAlign;
+    colConstrained_ = true;
+    rowConstrained_ = true;
+    rootConstrained_ = true;
+    viewType_ = OWNER;
+    SetShifts();
+    if( Participating() )
+    {
+        Int localHeight = Length(height,colShift_,ColStride());
+        Int localWidth = Length(width,rowShift_,RowStride());
+        matrix_.Control_( localHeight, localWidth, buffer, ldim, deleter );
+    }
+}
+
+template<typename T>
+T*
+AbstractDistMatrix<T>::Release()
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("ADM::Release");
+        if( Viewing() )
+            LogicError("Cannot release the buffer of a view");
+    )
+    if( nodeShared_ )
+        LogicError("Cannot release a node-shared buffer");
+    T* buffer = matrix_.Release_();
+    Empty();
+    return buffer;
+}
+
+// Node-shared storage
+// -------------------
+
+template<typename T>
+void
+AbstractDistMatrix<T>::SetNodeShared( bool share )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("ADM::SetNodeShared");
+        if( Viewing() )
+            LogicError("Cannot change the storage of a view");
+    )
+    if( share == nodeShared_ )
+        return;
+
+    // Preserve the current local data
+    El::Matrix<T> contents;
+    if( Participating() )
+        contents = matrix_;
+    matrix_.Empty_();
+    nodeWindow_ = mpi::WINDOW_NULL;
+    FreeNodeComms();
+
+    nodeShared_ = share;
+    SetUpNodeComms();
+    Resize( height_, width_ );
+    if( Participating() && NodeWriter() )
+        InterleaveMatrix
+        ( contents.Height(), contents.Width(),
+          contents.LockedBuffer(), 1, contents.LDim(),
+          matrix_.Buffer(),        1, matrix_.LDim() );
+    NodeSync();
+}
+
+template<typename T>
+bool AbstractDistMatrix<T>::NodeShared() const { return nodeShared_; }
+
+template<typename T>
+bool AbstractDistMatrix<T>::NodeWriter() const
+{ return !nodeShared_ || mpi::Rank(nodeComm_) == 0; }
+
+template<typename T>
+void AbstractDistMatrix<T>::NodeSync() const
+{
+    DEBUG_ONLY(CallStackEntry cse("ADM::NodeSync"))
+    if( !nodeShared_ || nodeComm_ == mpi::COMM_NULL || 
+        mpi::Size(nodeComm_) == 1 )
+        return;
+    if( nodeWindow_ != mpi::WINDOW_NULL )
+        mpi::WindowSync( nodeWindow_ );
+    mpi::Barrier( nodeComm_ );
+    if( nodeWindow_ != mpi::WINDOW_NULL )
+        mpi::WindowSync( nodeWindow_ );
+}
+
+template<typename T>
+mpi::Comm AbstractDistMatrix<T>::NodeComm() const { return nodeComm_; }
+template<typename T>
+mpi::Comm AbstractDistMatrix<T>::InterNodeComm() const 
+{ return interNodeComm_; }
+
 // Basic queries
 // =============
 
@@ -963,6 +1119,68 @@ void
 AbstractDistMatrix<T>::ConjugateLocal( Int iLoc, Int jLoc )
 { matrix_.Conjugate( iLoc, jLoc ); }
 
+// Batch manipulation of remote entries
+// ------------------------------------
+template<typename T>
+void
+AbstractDistMatrix<T>::Reserve( Int numRemoteUpdates )
+{
+    DEBUG_ONLY(CallStackEntry cse("ADM::Reserve"))
+    updateRows_.reserve( numRemoteUpdates );
+    updateCols_.reserve( numRemoteUpdates );
+    updateVals_.reserve( numRemoteUpdates );
+}
+
+template<typename T>
+void
+AbstractDistMatrix<T>::QueueUpdate( Int i, Int j, T value )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("ADM::QueueUpdate");
+        AssertValidEntry( i, j );
+    )
+    updateRows_.push_back( i );
+    updateCols_.push_back( j );
+    updateVals_.push_back( value );
+}
+
+template<typename T>
+void
+AbstractDistMatrix<T>::ProcessQueues()
+{
+    DEBUG_ONLY(CallStackEntry cse("ADM::ProcessQueues"))
+    queues::ProcessUpdates( *this, updateRows_, updateCols_, updateVals_ );
+}
+
+template<typename T>
+void
+AbstractDistMatrix<T>::ReservePulls( Int numPulls ) const
+{
+    DEBUG_ONLY(CallStackEntry cse("ADM::ReservePulls"))
+    pullRows_.reserve( numPulls );
+    pullCols_.reserve( numPulls );
+}
+
+template<typename T>
+void
+AbstractDistMatrix<T>::QueuePull( Int i, Int j ) const
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("ADM::QueuePull");
+        AssertValidEntry( i, j );
+    )
+    pullRows_.push_back( i );
+    pullCols_.push_back( j );
+}
+
+template<typename T>
+void
+AbstractDistMatrix<T>::ProcessPullQueue( std::vector<T>& pullBuf ) const
+{
+    DEBUG_ONLY(CallStackEntry cse("ADM::ProcessPullQueue"))
+    queues::ProcessPulls( *this, pullRows_, pullCols_, pullBuf );
+}
+
 // Diagonal manipulation
 // =====================
 template<typename T>
@@ -1866,6 +2084,65 @@ AbstractDistMatrix<T>::ShallowSwap( AbstractDistMatrix<T>& A )
     std::swap( rowShift_, A.rowShift_ );
     std::swap( root_, A.root_ );
     std::swap( grid_, A.grid_ );
+    std::swap( nodeShared_, A.nodeShared_ );
+    std::swap( nodeComm_, A.nodeComm_ );
+    std::swap( interNodeComm_, A.interNodeComm_ );
+    std::swap( nodeWindow_, A.nodeWindow_ );
+}
+
+// Allocate the local data within a shared-memory window
+// =====================================================
+
+template<typename T>
+void
+AbstractDistMatrix<T>::ResizeNodeShared
+( Int localHeight, Int localWidth, Int ldim )
+{
+    DEBUG_ONLY(CallStackEntry cse("ADM::ResizeNodeShared"))
+    // Every member of the node communicator has the same local dimensions, so
+    // they will uniformly decide whether or not to reallocate
+    if( ldim*localWidth <= matrix_.MemorySize() )
+    {
+        matrix_.Resize_( localHeight, localWidth, ldim );
+        return;
+    }
+    matrix_.Empty_();
+    mpi::Window window;
+    T* buffer = reinterpret_cast<T*>
+      ( mpi::WindowAllocateShared( ldim*localWidth*sizeof(T), nodeComm_, 
+                                   window ) );
+    matrix_.Control_( localHeight, localWidth, buffer, ldim );
+    matrix_.memory_.Control
+    ( buffer, ldim*localWidth, 
+      [window]( T* ) mutable 
+      { if( !mpi::Finalized() ) mpi::WindowFree( window ); } );
+    nodeWindow_ = window;
+
+    // The other members of the node may only read the shared data
+    if( !NodeWriter() )
+        matrix_.viewType_ = (ViewType)( matrix_.viewType_ | LOCKED_OWNER );
+}
+
+template<typename T>
+void
+AbstractDistMatrix<T>::SetUpNodeComms()
+{
+    DEBUG_ONLY(CallStackEntry cse("ADM::SetUpNodeComms"))
+    if( nodeShared_ && Participating() )
+        mpi::SplitNode( RedundantComm(), nodeComm_, interNodeComm_ );
+}
+
+template<typename T>
+void
+AbstractDistMatrix<T>::FreeNodeComms()
+{
+    if( nodeComm_ != mpi::COMM_NULL && !mpi::Finalized() )
+    {
+        mpi::Free( nodeComm_ );
+        mpi::Free( interNodeComm_ );
+    }
+    nodeComm_ = mpi::COMM_NULL;
+    interNodeComm_ = mpi::COMM_NULL;
 }
 
 // Modify the distribution metadata
@@ -105,7 +105,8 @@ GeneralDistMatrix<T,U,V>::Translate( DistMatrix<T,U,V>& A ) const
     const bool aligned = colAlign == A.ColAlign() && rowAlign == A.RowAlign();
     if( aligned && root == A.Root() )
     {
-        A.matrix_ = this->matrix_;
+        if( A.NodeWriter() )
+            A.matrix_ = this->matrix_;
     }
     else
     {
@@ -137,10 +138,10 @@ GeneralDistMatrix<T,U,V>::Translate( DistMatrix<T,U,V>& A ) const
             // Pack the local data
             const Int localHeight = this->LocalHeight();
             const Int localWidth = this->LocalWidth();
-            for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-                MemCopy
-                ( &buffer[jLoc*localHeight], this->LockedBuffer(0,jLoc), 
-                  localHeight );
+            InterleaveMatrix
+            ( localHeight, localWidth,
+              this->LockedBuffer(), 1, this->LDim(),
+              buffer,               1, localHeight );
 
             if( !aligned )
             {
@@ -164,13 +165,15 @@ GeneralDistMatrix<T,U,V>::Translate( DistMatrix<T,U,V>& A ) const
                 mpi::Recv( buffer, recvSize, root, A.CrossComm() );
         }
         // Unpack
-        if( crossRank == A.Root() )
-            for( Int jLoc=0; jLoc<localWidthA; ++jLoc )
-                MemCopy
-                ( A.Buffer(0,jLoc), &buffer[jLoc*localHeightA], localHeightA );
+        if( crossRank == A.Root() && A.NodeWriter() )
+            InterleaveMatrix
+            ( localHeightA, localWidthA,
+              buffer,     1, localHeightA,
+              A.Buffer(), 1, A.LDim() );
         if( crossRank == root || crossRank == A.Root() )
             A.auxMemory_.Release();
     }
+    A.NodeSync();
 }
 
 template<typename T,Dist U,Dist V>
@@ -202,39 +205,46 @@ GeneralDistMatrix<T,U,V>::AllGather( DistMatrix<T,UGath,VGath>& A ) const
         // Pack
         const Int ldim = this->LDim();
         const T* thisBuf = this->LockedBuffer();
-        EL_PARALLEL_FOR
-        for( Int jLoc=0; jLoc<thisLocalWidth; ++jLoc )
-            MemCopy
-            ( &sendBuf[jLoc*thisLocalHeight], &thisBuf[jLoc*ldim], 
-              thisLocalHeight );
-
-        // Communicate
-        mpi::AllGather
-        ( sendBuf, portionSize, recvBuf, portionSize, this->DistComm() );
+        InterleaveMatrix
+        ( thisLocalHeight, thisLocalWidth,
+          thisBuf, 1, ldim,
+          sendBuf, 1, thisLocalHeight );
+
+        // Communicate (if A is shared within each node and is redundant over
+        // our distribution communicator, then only its node writers need to
+        // receive, and each node need only receive the data once)
+        if( A.NodeShared() && 
+            mpi::Congruent( this->DistComm(), A.RedundantComm() ) )
+            mpi::HierarchicalAllGather
+            ( sendBuf, portionSize, recvBuf, portionSize, this->DistComm(),
+              A.NodeComm(), A.InterNodeComm(), false );
+        else
+            mpi::AllGather
+            ( sendBuf, portionSize, recvBuf, portionSize, this->DistComm() );
 
         // Unpack
-        T* ABuf = A.Buffer();
-        const Int ALDim = A.LDim();
-        const Int colAlign = this->ColAlign();
-        const Int rowAlign = this->RowAlign();
-        EL_OUTER_PARALLEL_FOR
-        for( Int l=0; l<rowStride; ++l )
+        if( A.NodeWriter() )
         {
-            const Int rowShift = Shift_( l, rowAlign, rowStride );
-            const Int localWidth = Length_( width, rowShift, rowStride );
-            for( Int k=0; k<colStride; ++k )
+            T* ABuf = A.Buffer();
+            const Int ALDim = A.LDim();
+            const Int colAlign = this->ColAlign();
+            const Int rowAlign = this->RowAlign();
+            EL_OUTER_PARALLEL_FOR
+            for( Int l=0; l<rowStride; ++l )
             {
-                const T* data = &recvBuf[(k+l*colStride)*portionSize];
-                const Int colShift = Shift_( k, colAlign, colStride );
-                const Int localHeight = Length_( height, colShift, colStride );
-                EL_INNER_PARALLEL_FOR
-                for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+                const Int rowShift = Shift_( l, rowAlign, rowStride );
+                const Int localWidth = Length_( width, rowShift, rowStride );
+                for( Int k=0; k<colStride; ++k )
                 {
-                    T* destCol = 
-                        &ABuf[colShift+(rowShift+jLoc*rowStride)*ALDim];
-                    const T* sourceCol = &data[jLoc*localHeight];
-                    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-                        destCol[iLoc*colStride] = sourceCol[iLoc];
+                    const T* data = &recvBuf[(k+l*colStride)*portionSize];
+                    const Int colShift = Shift_( k, colAlign, colStride );
+                    const Int localHeight = 
+                        Length_( height, colShift, colStride );
+                    InnerInterleaveMatrix
+                    ( localHeight, localWidth,
+                      data, 1, localHeight,
+                      &ABuf[colShift+rowShift*ALDim], 
+                      colStride, rowStride*ALDim );
                 }
             }
         }
@@ -247,11 +257,10 @@ GeneralDistMatrix<T,U,V>::AllGather( DistMatrix<T,UGath,VGath>& A ) const
         const Int localWidth = A.LocalWidth();
         T* buf = A.auxMemory_.Require( localHeight*localWidth );
         if( this->CrossRank() == this->Root() )
-        {
-            for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-                MemCopy
-                ( &buf[jLoc*localHeight], A.LockedBuffer(0,jLoc), localHeight );
-        }
+            InterleaveMatrix
+            ( localHeight, localWidth,
+              A.LockedBuffer(), 1, A.LDim(),
+              buf,              1, localHeight );
 
         // Broadcast from the root
         mpi::Broadcast
@@ -259,13 +268,13 @@ GeneralDistMatrix<T,U,V>::AllGather( DistMatrix<T,UGath,VGath>& A ) const
 
         // Unpack if not the root
         if( this->CrossRank() != this->Root() )
-        {
-            for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-                MemCopy
-                ( A.Buffer(0,jLoc), &buf[jLoc*localHeight], localHeight );
-        }
+            InterleaveMatrix
+            ( localHeight, localWidth,
+              buf,        1, localHeight,
+              A.Buffer(), 1, A.LDim() );
         A.auxMemory_.Release();
     }
+    A.NodeSync();
 }
 
 template<typename T,Dist U,Dist V>
@@ -294,7 +303,7 @@ GeneralDistMatrix<T,U,V>::ColAllGather( DistMatrix<T,UGath,V>& A ) const
     {
         if( this->RowAlign() == A.RowAlign() )
         {
-            if( height == 1 )
+            if( height == 1 && !A.NodeShared() )
             {
                 const Int localWidthA = A.LocalWidth();
                 T* bcastBuf = A.auxMemory_.Require( localWidthA );
@@ -337,36 +346,32 @@ GeneralDistMatrix<T,U,V>::ColAllGather( DistMatrix<T,UGath,V>& A ) const
                 // Pack
                 const Int ldim = this->LDim();
                 const T* thisBuf = this->LockedBuffer();
-                EL_PARALLEL_FOR
-                for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-                {
-                    const T* thisCol = &thisBuf[jLoc*ldim];
-                    T* sendBufCol = &sendBuf[jLoc*thisLocalHeight];
-                    MemCopy( sendBufCol, thisCol, thisLocalHeight );
-                }
+                InterleaveMatrix
+                ( thisLocalHeight, localWidth,
+                  thisBuf, 1, ldim,
+                  sendBuf, 1, thisLocalHeight );
 
                 // Communicate
                 mpi::AllGather
                 ( sendBuf, portionSize, recvBuf, portionSize, this->ColComm() );
 
                 // Unpack
-                T* ABuf = A.Buffer();
-                const Int ALDim = A.LDim();
-                const Int colAlign = this->ColAlign();
-                EL_OUTER_PARALLEL_FOR
-                for( Int k=0; k<colStride; ++k )
+                if( A.NodeWriter() )
                 {
-                    const T* data = &recvBuf[k*portionSize];
-                    const Int colShift = Shift_( k, colAlign, colStride );
-                    const Int localHeight = 
-                        Length_( height, colShift, colStride );
-                    EL_INNER_PARALLEL_FOR
-                    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+                    T* ABuf = A.Buffer();
+                    const Int ALDim = A.LDim();
+                    const Int colAlign = this->ColAlign();
+                    EL_OUTER_PARALLEL_FOR
+                    for( Int k=0; k<colStride; ++k )
                     {
-                        T* destCol = &ABuf[colShift+jLoc*ALDim];
-                        const T* sourceCol = &data[jLoc*localHeight];
-                        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-                            destCol[iLoc*colStride] = sourceCol[iLoc];
+                        const T* data = &recvBuf[k*portionSize];
+                        const Int colShift = Shift_( k, colAlign, colStride );
+                        const Int localHeight = 
+                            Length_( height, colShift, colStride );
+                        InnerInterleaveMatrix
+                        ( localHeight, localWidth,
+                          data,            1, localHeight,
+                          &ABuf[colShift], colStride, ALDim );
                     }
                 }
                 A.auxMemory_.Release();
@@ -389,7 +394,7 @@ GeneralDistMatrix<T,U,V>::ColAllGather( DistMatrix<T,UGath,V>& A ) const
             const Int recvRowRank = 
                 (rowRank+rowStride+rowAlign-rowAlignA) % rowStride;
 
-            if( height == 1 )
+            if( height == 1 && !A.NodeShared() )
             {
                 const Int localWidthA = A.LocalWidth();
                 T* bcastBuf;
@@ -448,13 +453,10 @@ GeneralDistMatrix<T,U,V>::ColAllGather( DistMatrix<T,UGath,V>& A ) const
                 // Pack
                 const Int ldim = this->LDim();
                 const T* thisBuf = this->LockedBuffer();
-                EL_PARALLEL_FOR
-                for( Int jLoc=0; jLoc<thisLocalWidth; ++jLoc )
-                {
-                    const T* thisCol = &thisBuf[jLoc*ldim];
-                    T* secondBufCol = &secondBuf[jLoc*thisLocalHeight];
-                    MemCopy( secondBufCol, thisCol, thisLocalHeight ); 
-                }
+                InterleaveMatrix
+                ( thisLocalHeight, thisLocalWidth,
+                  thisBuf,   1, ldim,
+                  secondBuf, 1, thisLocalHeight );
  
                 // Realign
                 mpi::SendRecv
@@ -467,23 +469,22 @@ GeneralDistMatrix<T,U,V>::ColAllGather( DistMatrix<T,UGath,V>& A ) const
                   secondBuf, portionSize, this->ColComm() ); 
 
                 // Unpack the contents of each member of the column team
-                T* ABuf = A.Buffer();
-                const Int ALDim = A.LDim();
-                const Int colAlign = this->ColAlign();
-                EL_OUTER_PARALLEL_FOR
-                for( Int k=0; k<colStride; ++k )
+                if( A.NodeWriter() )
                 {
-                    const T* data = &secondBuf[k*portionSize];
-                    const Int colShift = Shift_( k, colAlign, colStride );
-                    const Int localHeight = 
-                        Length_( height, colShift, colStride );
-                    EL_INNER_PARALLEL_FOR
-                    for( Int jLoc=0; jLoc<localWidthA; ++jLoc )
+                    T* ABuf = A.Buffer();
+                    const Int ALDim = A.LDim();
+                    const Int colAlign = this->ColAlign();
+                    EL_OUTER_PARALLEL_FOR
+                    for( Int k=0; k<colStride; ++k )
                     {
-                        T* destCol = &ABuf[colShift+jLoc*ALDim];
-                        const T* sourceCol = &data[jLoc*localHeight];
-                        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-                            destCol[iLoc*colStride] = sourceCol[iLoc]; 
+                        const T* data = &secondBuf[k*portionSize];
+                        const Int colShift = Shift_( k, colAlign, colStride );
+                        const Int localHeight = 
+                            Length_( height, colShift, colStride );
+                        InnerInterleaveMatrix
+                        ( localHeight, localWidthA,
+                          data,            1, localHeight,
+                          &ABuf[colShift], colStride, ALDim );
                     }
                 }
                 A.auxMemory_.Release();
@@ -497,11 +498,10 @@ GeneralDistMatrix<T,U,V>::ColAllGather( DistMatrix<T,UGath,V>& A ) const
         const Int localWidth = A.LocalWidth();
         T* buf = A.auxMemory_.Require( localHeight*localWidth );
         if( this->CrossRank() == this->Root() )
-        {
-            for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-                MemCopy
-                ( &buf[jLoc*localHeight], A.LockedBuffer(0,jLoc), localHeight );
-        }
+            InterleaveMatrix
+            ( localHeight, localWidth,
+              A.LockedBuffer(), 1, A.LDim(),
+              buf,              1, localHeight );
 
         // Broadcast from the root
         mpi::Broadcast
@@ -509,13 +509,13 @@ GeneralDistMatrix<T,U,V>::ColAllGather( DistMatrix<T,UGath,V>& A ) const
 
         // Unpack if not the root
         if( this->CrossRank() != this->Root() )
-        {
-            for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-                MemCopy
-                ( A.Buffer(0,jLoc), &buf[jLoc*localHeight], localHeight );
-        }
+            InterleaveMatrix
+            ( localHeight, localWidth,
+              buf,        1, localHeight,
+              A.Buffer(), 1, A.LDim() );
         A.auxMemory_.Release();
     }
+    A.NodeSync();
 }
 
 template<typename T,Dist U,Dist V>
@@ -534,7 +534,7 @@ GeneralDistMatrix<T,U,V>::RowAllGather( DistMatrix<T,U,VGath>& A ) const
     {
         if( this->ColAlign() == A.ColAlign() )
         {
-            if( width == 1 )
+            if( width == 1 && !A.NodeShared() )
             {
                 if( this->RowRank() == this->RowAlign() )
                     A.matrix_ = this->LockedMatrix();
@@ -557,35 +557,32 @@ GeneralDistMatrix<T,U,V>::RowAllGather( DistMatrix<T,U,VGath>& A ) const
                 // Pack
                 const Int ldim = this->LDim();
                 const T* thisBuf = this->LockedBuffer();
-                EL_PARALLEL_FOR
-                for( Int jLoc=0; jLoc<thisLocalWidth; ++jLoc )
-                {
-                    const T* thisCol = &thisBuf[jLoc*ldim];
-                    T* sendBufCol = &sendBuf[jLoc*localHeight];
-                    MemCopy( sendBufCol, thisCol, localHeight );
-                }
+                InterleaveMatrix
+                ( localHeight, thisLocalWidth,
+                  thisBuf, 1, ldim,
+                  sendBuf, 1, localHeight );
 
                 // Communicate
                 mpi::AllGather
                 ( sendBuf, portionSize, recvBuf, portionSize, this->RowComm() );
 
                 // Unpack
-                T* ABuf = A.Buffer();
-                const Int ALDim = A.LDim();
-                const Int rowAlign = this->RowAlign();
-                EL_OUTER_PARALLEL_FOR 
-                for( Int k=0; k<rowStride; ++k )
+                if( A.NodeWriter() )
                 {
-                    const T* data = &recvBuf[k*portionSize];
-                    const Int rowShift = Shift_( k, rowAlign, rowStride );
-                    const Int localWidth = 
-                        Length_( width, rowShift, rowStride );
-                    EL_INNER_PARALLEL_FOR
-                    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+                    T* ABuf = A.Buffer();
+                    const Int ALDim = A.LDim();
+                    const Int rowAlign = this->RowAlign();
+                    EL_OUTER_PARALLEL_FOR 
+                    for( Int k=0; k<rowStride; ++k )
                     {
-                        const T* dataCol = &data[jLoc*localHeight];
-                        T* ACol = &ABuf[(rowShift+jLoc*rowStride)*ALDim];
-                        MemCopy( ACol, dataCol, localHeight );
+                        const T* data = &recvBuf[k*portionSize];
+                        const Int rowShift = Shift_( k, rowAlign, rowStride );
+                        const Int localWidth = 
+                            Length_( width, rowShift, rowStride );
+                        InnerInterleaveMatrix
+                        ( localHeight, localWidth,
+                          data,                  1, localHeight,
+                          &ABuf[rowShift*ALDim], 1, rowStride*ALDim );
                     }
                 }
                 A.auxMemory_.Release();
@@ -608,7 +605,7 @@ GeneralDistMatrix<T,U,V>::RowAllGather( DistMatrix<T,U,VGath>& A ) const
             const Int recvColRank = 
                 (colRank+colStride+colAlign-colAlignA) % colStride;
 
-            if( width == 1 )
+            if( width == 1 && !A.NodeShared() )
             {
                 const Int localHeightA = A.LocalHeight();
                 if( this->RowRank() == this->RowAlign() )
@@ -650,13 +647,10 @@ GeneralDistMatrix<T,U,V>::RowAllGather( DistMatrix<T,U,VGath>& A ) const
                 // Pack
                 const Int ldim = this->LDim();
                 const T* thisBuf = this->LockedBuffer();
-                EL_PARALLEL_FOR
-                for( Int jLoc=0; jLoc<thisLocalWidth; ++jLoc )
-                {
-                    const T* thisCol = &thisBuf[jLoc*ldim];
-                    T* secondBufCol = &secondBuf[jLoc*localHeight];
-                    MemCopy( secondBufCol, thisCol, localHeight );
-                }
+                InterleaveMatrix
+                ( localHeight, thisLocalWidth,
+                  thisBuf,   1, ldim,
+                  secondBuf, 1, localHeight );
 
                 // Realign
                 mpi::SendRecv
@@ -669,22 +663,22 @@ GeneralDistMatrix<T,U,V>::RowAllGather( DistMatrix<T,U,VGath>& A ) const
                   secondBuf, portionSize, this->RowComm() );
 
                 // Unpack
-                T* ABuf = A.Buffer();
-                const Int ALDim = A.LDim();
-                const Int rowAlign = this->RowAlign();
-                EL_OUTER_PARALLEL_FOR
-                for( Int k=0; k<rowStride; ++k )
+                if( A.NodeWriter() )
                 {
-                    const T* data = &secondBuf[k*portionSize];
-                    const Int rowShift = Shift_( k, rowAlign, rowStride );
-                    const Int localWidth = 
-                        Length_( width, rowShift, rowStride );
-                    EL_INNER_PARALLEL_FOR
-                    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+                    T* ABuf = A.Buffer();
+                    const Int ALDim = A.LDim();
+                    const Int rowAlign = this->RowAlign();
+                    EL_OUTER_PARALLEL_FOR
+                    for( Int k=0; k<rowStride; ++k )
                     {
-                        const T* dataCol = &data[jLoc*localHeightA];
-                        T* ACol = &ABuf[(rowShift+jLoc*rowStride)*ALDim]; 
-                        MemCopy( ACol, dataCol, localHeightA );
+                        const T* data = &secondBuf[k*portionSize];
+                        const Int rowShift = Shift_( k, rowAlign, rowStride );
+                        const Int localWidth = 
+                            Length_( width, rowShift, rowStride );
+                        InnerInterleaveMatrix
+                        ( localHeightA, localWidth,
+                          data,                  1, localHeightA,
+                          &ABuf[rowShift*ALDim], 1, rowStride*ALDim );
                     }
                 }
                 A.auxMemory_.Release();
@@ -698,11 +692,10 @@ GeneralDistMatrix<T,U,V>::RowAllGather( DistMatrix<T,U,VGath>& A ) const
         const Int localWidth = A.LocalWidth();
         T* buf = A.auxMemory_.Require( localHeight*localWidth );
         if( this->CrossRank() == this->Root() )
-        {
-            for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-                MemCopy
-                ( &buf[jLoc*localHeight], A.LockedBuffer(0,jLoc), localHeight );
-        }
+            InterleaveMatrix
+            ( localHeight, localWidth,
+              A.LockedBuffer(), 1, A.LDim(),
+              buf,              1, localHeight );
 
         // Broadcast from the root
         mpi::Broadcast
@@ -710,13 +703,13 @@ GeneralDistMatrix<T,U,V>::RowAllGather( DistMatrix<T,U,VGath>& A ) const
 
         // Unpack if not the root
         if( this->CrossRank() != this->Root() )
-        {
-            for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-                MemCopy
-                ( A.Buffer(0,jLoc), &buf[jLoc*localHeight], localHeight );
-        }
+            InterleaveMatrix
+            ( localHeight, localWidth,
+              buf,        1, localHeight,
+              A.Buffer(), 1, A.LDim() );
         A.auxMemory_.Release();
     }
+    A.NodeSync();
 }
 
 template<typename T,Dist U,Dist V>
@@ -758,7 +751,7 @@ GeneralDistMatrix<T,U,V>::PartialColAllGather( DistMatrix<T,UPart,V>& A ) const
     )
     const T* thisBuf = this->LockedBuffer();
     const Int ldim = this->LDim();
-    T* ABuf = A.Buffer();
+    T* ABuf = ( A.NodeWriter() ? A.Buffer() : nullptr );
     const Int ALDim = A.LDim();
 
     const Int colAlign = this->ColAlign();
@@ -793,21 +786,24 @@ GeneralDistMatrix<T,U,V>::PartialColAllGather( DistMatrix<T,UPart,V>& A ) const
           this->PartialUnionColComm() );
 
         // Unpack
-        EL_OUTER_PARALLEL_FOR
-        for( Int k=0; k<colStrideUnion; ++k )
+        if( A.NodeWriter() )
         {
-            const T* data = &secondBuf[k*portionSize];
-            const Int colShift = 
-                Shift_( colRankPart+k*colStridePart, colAlign, colStride );
-            const Int colOffset = (colShift-colShiftA) / colStridePart;
-            const Int localHeight = Length_( height, colShift, colStride );
-            EL_INNER_PARALLEL_FOR
-            for( Int j=0; j<width; ++j )
+            EL_OUTER_PARALLEL_FOR
+            for( Int k=0; k<colStrideUnion; ++k )
             {
-                const T* dataCol = &data[j*localHeight];
-                T* ACol = &ABuf[colOffset+j*ALDim];
-                for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-                    ACol[iLoc*colStrideUnion] = dataCol[iLoc];
+                const T* data = &secondBuf[k*portionSize];
+                const Int colShift = 
+                    Shift_( colRankPart+k*colStridePart, colAlign, colStride );
+                const Int colOffset = (colShift-colShiftA) / colStridePart;
+                const Int localHeight = Length_( height, colShift, colStride );
+                EL_INNER_PARALLEL_FOR
+                for( Int j=0; j<width; ++j )
+                {
+                    const T* dataCol = &data[j*localHeight];
+                    T* ACol = &ABuf[colOffset+j*ALDim];
+                    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                        ACol[iLoc*colStrideUnion] = dataCol[iLoc];
+                }
             }
         }
     }
@@ -840,25 +836,29 @@ GeneralDistMatrix<T,U,V>::PartialColAllGather( DistMatrix<T,UPart,V>& A ) const
           secondBuf, portionSize, this->PartialUnionColComm() );
 
         // Unpack
-        EL_OUTER_PARALLEL_FOR
-        for( Int k=0; k<colStrideUnion; ++k )
+        if( A.NodeWriter() )
         {
-            const T* data = &secondBuf[k*portionSize];
-            const Int colShift = 
-                Shift_( colRankPart+colStridePart*k, colAlignA, colStride );
-            const Int colOffset = (colShift-colShiftA) / colStridePart;
-            const Int localHeight = Length_( height, colShift, colStride );
-            EL_INNER_PARALLEL_FOR
-            for( Int j=0; j<width; ++j )
+            EL_OUTER_PARALLEL_FOR
+            for( Int k=0; k<colStrideUnion; ++k )
             {
-                const T* dataCol = &data[j*localHeight];
-                T* ACol = &ABuf[colOffset+j*ALDim];
-                for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-                    ACol[iLoc*colStrideUnion] = dataCol[iLoc];
+                const T* data = &secondBuf[k*portionSize];
+                const Int colShift = 
+                    Shift_( colRankPart+colStridePart*k, colAlignA, colStride );
+                const Int colOffset = (colShift-colShiftA) / colStridePart;
+                const Int localHeight = Length_( height, colShift, colStride );
+                EL_INNER_PARALLEL_FOR
+                for( Int j=0; j<width; ++j )
+                {
+                    const T* dataCol = &data[j*localHeight];
+                    T* ACol = &ABuf[colOffset+j*ALDim];
+                    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                        ACol[iLoc*colStrideUnion] = dataCol[iLoc];
+                }
             }
         }
     }
     A.auxMemory_.Release();
+    A.NodeSync();
 }
 
 template<typename T,Dist U,Dist V>
@@ -882,7 +882,7 @@ GeneralDistMatrix<T,U,V>::PartialRowAllGather( DistMatrix<T,U,VPart>& A ) const
     )
     const T* thisBuf = this->LockedBuffer();
     const Int ldim = this->LDim();
-    T* ABuf = A.Buffer();
+    T* ABuf = ( A.NodeWriter() ? A.Buffer() : nullptr );
     const Int ALDim = A.LDim();
 
     const Int rowAlign = this->RowAlign();
@@ -903,13 +903,10 @@ GeneralDistMatrix<T,U,V>::PartialRowAllGather( DistMatrix<T,U,VPart>& A ) const
     if( rowAlignA == rowAlign % rowStridePart ) 
     {
         // Pack
-        EL_PARALLEL_FOR
-        for( Int jLoc=0; jLoc<thisLocalWidth; ++jLoc )
-        {
-            const T* thisCol = &thisBuf[jLoc*ldim];
-            T* firstBufCol = &firstBuf[jLoc*height];
-            MemCopy( firstBufCol, thisCol, height );
-        }
+        InterleaveMatrix
+        ( height, thisLocalWidth,
+          thisBuf,  1, ldim,
+          firstBuf, 1, height );
 
         // Communicate
         mpi::AllGather
@@ -917,20 +914,20 @@ GeneralDistMatrix<T,U,V>::PartialRowAllGather( DistMatrix<T,U,VPart>& A ) const
           this->PartialUnionRowComm() );
 
         // Unpack
-        EL_OUTER_PARALLEL_FOR
-        for( Int k=0; k<rowStrideUnion; ++k )
+        if( A.NodeWriter() )
         {
-            const T* data = &secondBuf[k*portionSize];
-            const Int rowShift = 
-                Shift_( rowRankPart+k*rowStridePart, rowAlign, rowStride );
-            const Int rowOffset = (rowShift-rowShiftA) / rowStridePart;
-            const Int localWidth = Length_( width, rowShift, rowStride );
-            EL_INNER_PARALLEL_FOR
-            for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+            EL_OUTER_PARALLEL_FOR
+            for( Int k=0; k<rowStrideUnion; ++k )
             {
-                const T* dataCol = &data[jLoc*height];
-                T* ACol = &ABuf[(rowOffset+jLoc*rowStrideUnion)*ALDim];
-                MemCopy( ACol, dataCol, height );
+                const T* data = &secondBuf[k*portionSize];
+                const Int rowShift = 
+                    Shift_( rowRankPart+k*rowStridePart, rowAlign, rowStride );
+                const Int rowOffset = (rowShift-rowShiftA) / rowStridePart;
+                const Int localWidth = Length_( width, rowShift, rowStride );
+                InnerInterleaveMatrix
+                ( height, localWidth,
+                  data,                   1, height,
+                  &ABuf[rowOffset*ALDim], 1, rowStrideUnion*ALDim );
             }
         }
     }
@@ -963,24 +960,25 @@ GeneralDistMatrix<T,U,V>::PartialRowAllGather( DistMatrix<T,U,VPart>& A ) const
           secondBuf, portionSize, this->PartialUnionRowComm() );
 
         // Unpack
-        EL_OUTER_PARALLEL_FOR
-        for( Int k=0; k<rowStrideUnion; ++k )
+        if( A.NodeWriter() )
         {
-            const T* data = &secondBuf[k*portionSize];
-            const Int rowShift = 
-                Shift_( rowRankPart+rowStridePart*k, rowAlignA, rowStride );
-            const Int rowOffset = (rowShift-rowShiftA) / rowStridePart;
-            const Int localWidth = Length_( width, rowShift, rowStride );
-            EL_INNER_PARALLEL_FOR
-            for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+            EL_OUTER_PARALLEL_FOR
+            for( Int k=0; k<rowStrideUnion; ++k )
             {
-                const T* dataCol = &data[jLoc*height];
-                T* ACol = &ABuf[(rowOffset+jLoc*rowStrideUnion)*ALDim];
-                MemCopy( ACol, dataCol, height );
+                const T* data = &secondBuf[k*portionSize];
+                const Int rowShift = 
+                    Shift_( rowRankPart+rowStridePart*k, rowAlignA, rowStride );
+                const Int rowOffset = (rowShift-rowShiftA) / rowStridePart;
+                const Int localWidth = Length_( width, rowShift, rowStride );
+                InnerInterleaveMatrix
+                ( height, localWidth,
+                  data,                   1, height,
+                  &ABuf[rowOffset*ALDim], 1, rowStrideUnion*ALDim );
             }
         }
     }
     A.auxMemory_.Release();
+    A.NodeSync();
 }
 
 template<typename T,Dist U,Dist V>
@@ -1009,14 +1007,10 @@ GeneralDistMatrix<T,U,V>::FilterFrom( const DistMatrix<T,UGath,VGath>& A )
     const Int ldim = this->LDim();
     const T* ABuf = A.LockedBuffer();
     const Int ALDim = A.LDim();
-    EL_PARALLEL_FOR
-    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-    {
-        T* thisCol = &thisBuf[jLoc*ldim];
-        const T* ACol = &ABuf[colShift+(rowShift+jLoc*rowStride)*ALDim];
-        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-            thisCol[iLoc] = ACol[iLoc*colStride];
-    }
+    InterleaveMatrix
+    ( localHeight, localWidth,
+      &ABuf[colShift+rowShift*ALDim], colStride, rowStride*ALDim,
+      thisBuf,                        1, ldim );
 }
 
 template<typename T,Dist U,Dist V>
@@ -1032,6 +1026,8 @@ GeneralDistMatrix<T,U,V>::ColFilterFrom( const DistMatrix<T,UGath,V>& A )
     this->AlignRowsAndResize( A.RowAlign(), height, width, false, false );
     if( !this->Participating() )
         return;
+    // Only the node writer of a node-shared matrix modifies its data
+    const bool write = this->NodeWriter();
 
     const Int colStride = this->ColStride();
     const Int colShift = this->ColShift();
@@ -1041,21 +1037,18 @@ GeneralDistMatrix<T,U,V>::ColFilterFrom( const DistMatrix<T,UGath,V>& A )
     const Int localHeight = this->LocalHeight();
     const Int localWidth = this->LocalWidth();
     
-    T* thisBuf = this->Buffer();
+    T* thisBuf = ( write ? this->Buffer() : nullptr );
     const Int ldim = this->LDim();
     const T* ABuf = A.LockedBuffer();
     const Int ALDim = A.LDim();
 
     if( rowAlign == rowAlignA )
     {
-        EL_PARALLEL_FOR
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            T* thisCol = &thisBuf[jLoc*ldim];
-            const T* ACol = &ABuf[colShift+jLoc*ALDim];
-            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-                thisCol[iLoc] = ACol[iLoc*colStride];
-        }
+        if( write )
+            InterleaveMatrix
+            ( localHeight, localWidth,
+              &ABuf[colShift], colStride, ALDim,
+              thisBuf,         1, ldim );
     }
     else
     {
@@ -1077,14 +1070,10 @@ GeneralDistMatrix<T,U,V>::ColFilterFrom( const DistMatrix<T,UGath,V>& A )
         T* recvBuf = &buffer[sendSize];
         
         // Pack
-        EL_PARALLEL_FOR
-        for( Int jLoc=0; jLoc<localWidthA; ++jLoc )
-        {
-            T* sendCol = &sendBuf[jLoc*localHeight];
-            const T* ACol = &ABuf[colShift+jLoc*ALDim];
-            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-                sendCol[iLoc] = ACol[iLoc*colStride];
-        }
+        InterleaveMatrix
+        ( localHeight, localWidthA,
+          &ABuf[colShift], colStride, ALDim,
+          sendBuf,         1, localHeight );
 
         // Realign
         mpi::SendRecv
@@ -1092,12 +1081,17 @@ GeneralDistMatrix<T,U,V>::ColFilterFrom( const DistMatrix<T,UGath,V>& A )
           recvBuf, recvSize, recvRowRank, this->RowComm() );
 
         // Unpack
-        EL_PARALLEL_FOR
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-            MemCopy
-            ( &thisBuf[jLoc*ldim], &recvBuf[jLoc*localHeight], localHeight );
+        if( write )
+        {
+            EL_PARALLEL_FOR
+            for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+                MemCopy
+                ( &thisBuf[jLoc*ldim], &recvBuf[jLoc*localHeight], 
+                  localHeight );
+        }
         this->auxMemory_.Release();
     }
+    this->NodeSync();
 }
 
 template<typename T,Dist U,Dist V>
@@ -1113,6 +1107,8 @@ GeneralDistMatrix<T,U,V>::RowFilterFrom( const DistMatrix<T,U,VGath>& A )
     this->AlignColsAndResize( A.ColAlign(), height, width, false, false );
     if( !this->Participating() )
         return;
+    // Only the node writer of a node-shared matrix modifies its data
+    const bool write = this->NodeWriter();
 
     const Int colAlign = this->ColAlign();
     const Int colAlignA = A.ColAlign();
@@ -1122,20 +1118,18 @@ GeneralDistMatrix<T,U,V>::RowFilterFrom( const DistMatrix<T,U,VGath>& A )
     const Int localHeight = this->LocalHeight();
     const Int localWidth = this->LocalWidth();
     
-    T* thisBuf = this->Buffer();
+    T* thisBuf = ( write ? this->Buffer() : nullptr );
     const Int ldim = this->LDim();
     const T* ABuf = A.LockedBuffer();
     const Int ALDim = A.LDim();
     
     if( colAlign == colAlignA )
     {
-        EL_PARALLEL_FOR
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            T* thisCol = &thisBuf[jLoc*ldim];
-            const T* ACol = &ABuf[(rowShift+jLoc*rowStride)*ALDim];
-            MemCopy( thisCol, ACol, localHeight );
-        }
+        if( write )
+            InterleaveMatrix
+            ( localHeight, localWidth,
+              &ABuf[rowShift*ALDim], 1, rowStride*ALDim,
+              thisBuf,               1, ldim );
     }
     else
     {
@@ -1170,12 +1164,17 @@ GeneralDistMatrix<T,U,V>::RowFilterFrom( const DistMatrix<T,U,VGath>& A )
           recvBuf, recvSize, recvColRank, this->ColComm() );
 
         // Unpack
-        EL_PARALLEL_FOR
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-            MemCopy
-            ( &thisBuf[jLoc*ldim], &recvBuf[jLoc*localHeight], localHeight );
+        if( write )
+        {
+            EL_PARALLEL_FOR
+            for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+                MemCopy
+                ( &thisBuf[jLoc*ldim], &recvBuf[jLoc*localHeight], 
+                  localHeight );
+        }
         this->auxMemory_.Release();
     }
+    this->NodeSync();
 }
 
 template<typename T,Dist U,Dist V>
@@ -1303,13 +1302,10 @@ GeneralDistMatrix<T,U,V>::PartialRowFilterFrom( const DistMatrix<T,U,VPart>& A )
     {
         const Int rowShift = this->RowShift();
         const Int rowOffset = (rowShift-rowShiftA) / rowStridePart;
-        EL_PARALLEL_FOR
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            T* thisCol = &thisBuf[jLoc*ldim];
-            const T* ACol = &ABuf[(rowOffset+jLoc*rowStrideUnion)*ALDim];
-            MemCopy( thisCol, ACol, height );
-        }
+        InterleaveMatrix
+        ( height, localWidth,
+          &ABuf[rowOffset*ALDim], 1, rowStrideUnion*ALDim,
+          thisBuf,                1, ldim );
     }
     else
     {
@@ -1339,13 +1335,10 @@ GeneralDistMatrix<T,U,V>::PartialRowFilterFrom( const DistMatrix<T,U,VPart>& A )
         T* sendBuf = &buffer[0];
         T* recvBuf = &buffer[sendSize];
         // Pack
-        EL_PARALLEL_FOR
-        for( Int jLoc=0; jLoc<localWidthSend; ++jLoc )
-        {
-            T* sendCol = &sendBuf[jLoc*height];
-            const T* ACol = &ABuf[(sendRowOffset+jLoc*rowStrideUnion)*ALDim];
-            MemCopy( sendCol, ACol, height );
-        }
+        InterleaveMatrix
+        ( height, localWidthSend,
+          &ABuf[sendRowOffset*ALDim], 1, rowStrideUnion*ALDim,
+          sendBuf,                    1, height );
         // Change the column alignment
         mpi::SendRecv
         ( sendBuf, sendSize, sendRowRankPart,
@@ -1353,13 +1346,10 @@ GeneralDistMatrix<T,U,V>::PartialRowFilterFrom( const DistMatrix<T,U,VPart>& A )
 
         // Unpack
         // ------
-        EL_PARALLEL_FOR
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            const T* recvCol = &recvBuf[jLoc*height];
-            T* thisCol = &thisBuf[jLoc*ldim];
-            MemCopy( thisCol, recvCol, height );
-        }
+        InterleaveMatrix
+        ( height, localWidth,
+          recvBuf, 1, height,
+          thisBuf, 1, ldim );
         this->auxMemory_.Release();
     }
 }
@@ -1416,14 +1406,10 @@ GeneralDistMatrix<T,U,V>::PartialColAllToAllFrom
             const Int colShift = Shift_( colRank, colAlign, colStride );
             const Int colOffset = (colShift-colShiftA) / colStridePart;
             const Int localHeight = Length_( height, colShift, colStride );
-            EL_INNER_PARALLEL_FOR
-            for( Int jLoc=0; jLoc<localWidthA; ++jLoc )
-            {
-                T* dataCol = &data[jLoc*localHeight];
-                const T* ACol = &ABuf[colOffset+jLoc*ALDim];
-                for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-                    dataCol[iLoc] = ACol[iLoc*colStrideUnion];
-            }
+            InnerInterleaveMatrix
+            ( localHeight, localWidthA,
+              &ABuf[colOffset], colStrideUnion, ALDim,
+              data,             1, localHeight );
         }
 
         // Simultaneously Scatter in columns and Gather in rows
@@ -1438,13 +1424,10 @@ GeneralDistMatrix<T,U,V>::PartialColAllToAllFrom
             const T* data = &secondBuf[k*portionSize];
             const Int rowShift = Shift_( k, rowAlignA, colStrideUnion );
             const Int localWidth = Length_( width, rowShift, colStrideUnion );
-            EL_INNER_PARALLEL_FOR
-            for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-            {
-                const T* dataCol = &data[jLoc*thisLocalHeight];
-                T* thisCol = &thisBuf[(rowShift+jLoc*colStrideUnion)*ldim]; 
-                MemCopy( thisCol, dataCol, thisLocalHeight );
-            }
+            InnerInterleaveMatrix
+            ( thisLocalHeight, localWidth,
+              data,                    1, thisLocalHeight,
+              &thisBuf[rowShift*ldim], 1, colStrideUnion*ldim );
         }
     }
     else
@@ -1469,14 +1452,10 @@ GeneralDistMatrix<T,U,V>::PartialColAllToAllFrom
             const Int colShift = Shift_( colRank, colAlign, colStride );
             const Int colOffset = (colShift-colShiftA) / colStridePart;
             const Int localHeight = Length_( height, colShift, colStride );
-            EL_INNER_PARALLEL_FOR
-            for( Int jLoc=0; jLoc<localWidthA; ++jLoc )
-            {
-                T* dataCol = &data[jLoc*localHeight];
-                const T* ACol = &ABuf[colOffset+jLoc*ALDim];
-                for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-                    dataCol[iLoc] = ACol[iLoc*colStrideUnion];
-            }
+            InnerInterleaveMatrix
+            ( localHeight, localWidthA,
+              &ABuf[colOffset], colStrideUnion, ALDim,
+              data,             1, localHeight );
         }
 
         // Simultaneously Scatter in columns and Gather in rows
@@ -1497,13 +1476,10 @@ GeneralDistMatrix<T,U,V>::PartialColAllToAllFrom
             const T* data = &secondBuf[k*portionSize];
             const Int rowShift = Shift_( k, rowAlignA, colStrideUnion );
             const Int localWidth = Length_( width, rowShift, colStrideUnion );
-            EL_INNER_PARALLEL_FOR
-            for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-            {
-                const T* dataCol = &data[jLoc*thisLocalHeight];
-                T* thisCol = &thisBuf[(rowShift+jLoc*colStrideUnion)*ldim]; 
-                MemCopy( thisCol, dataCol, thisLocalHeight );
-            }
+            InnerInterleaveMatrix
+            ( thisLocalHeight, localWidth,
+              data,                    1, thisLocalHeight,
+              &thisBuf[rowShift*ldim], 1, colStrideUnion*ldim );
         }
     }
     this->auxMemory_.Release();
@@ -1561,13 +1537,10 @@ GeneralDistMatrix<T,U,V>::PartialRowAllToAllFrom
             const Int rowShift = Shift_( rowRank, rowAlign, rowStride );
             const Int rowOffset = (rowShift-rowShiftA) / rowStridePart;
             const Int localWidth = Length_( width, rowShift, rowStride );
-            EL_INNER_PARALLEL_FOR
-            for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-            {
-                T* dataCol = &data[jLoc*localHeightA];
-                const T* ACol = &ABuf[(rowOffset+jLoc*rowStrideUnion)*ALDim];
-                MemCopy( dataCol, ACol, localHeightA );
-            }
+            InnerInterleaveMatrix
+            ( localHeightA, localWidth,
+              &ABuf[rowOffset*ALDim], 1, rowStrideUnion*ALDim,
+              data,                   1, localHeightA );
         }
 
         // Simultaneously Scatter in rows and Gather in columns
@@ -1582,14 +1555,10 @@ GeneralDistMatrix<T,U,V>::PartialRowAllToAllFrom
             const T* data = &secondBuf[k*portionSize];
             const Int colShift = Shift_( k, colAlignA, rowStrideUnion );
             const Int localHeight = Length_( height, colShift, rowStrideUnion );
-            EL_INNER_PARALLEL_FOR
-            for( Int jLoc=0; jLoc<thisLocalWidth; ++jLoc )
-            {
-                const T* dataCol = &data[jLoc*localHeight];
-                T* thisCol = &thisBuf[colShift+jLoc*ldim]; 
-                for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-                    thisCol[iLoc*rowStrideUnion] = dataCol[iLoc];
-            }
+            InnerInterleaveMatrix
+            ( localHeight, thisLocalWidth,
+              data,               1, localHeight,
+              &thisBuf[colShift], rowStrideUnion, ldim );
         }
     }
     else
@@ -1614,13 +1583,10 @@ GeneralDistMatrix<T,U,V>::PartialRowAllToAllFrom
             const Int rowShift = Shift_( rowRank, rowAlign, rowStride );
             const Int rowOffset = (rowShift-rowShiftA) / rowStridePart;
             const Int localWidth = Length_( width, rowShift, rowStride );
-            EL_INNER_PARALLEL_FOR
-            for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-            {
-                T* dataCol = &data[jLoc*localHeightA];
-                const T* ACol = &ABuf[(rowOffset+jLoc*rowStrideUnion)*ALDim];
-                MemCopy( dataCol, ACol, localHeightA );
-            }
+            InnerInterleaveMatrix
+            ( localHeightA, localWidth,
+              &ABuf[rowOffset*ALDim], 1, rowStrideUnion*ALDim,
+              data,                   1, localHeightA );
         }
 
         // Simultaneously Scatter in rows and Gather in columns
@@ -1641,14 +1607,10 @@ GeneralDistMatrix<T,U,V>::PartialRowAllToAllFrom
             const T* data = &secondBuf[k*portionSize];
             const Int colShift = Shift_( k, colAlignA, rowStrideUnion );
             const Int localHeight = Length_( height, colShift, rowStrideUnion );
-            EL_INNER_PARALLEL_FOR
-            for( Int jLoc=0; jLoc<thisLocalWidth; ++jLoc )
-            {
-                const T* dataCol = &data[jLoc*localHeight];
-                T* thisCol = &thisBuf[colShift+jLoc*ldim]; 
-                for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-                    thisCol[iLoc*rowStrideUnion] = dataCol[iLoc];
-            }
+            InnerInterleaveMatrix
+            ( localHeight, thisLocalWidth,
+              data,               1, localHeight,
+              &thisBuf[colShift], rowStrideUnion, ldim );
         }
     }
     this->auxMemory_.Release();
@@ -1727,14 +1689,10 @@ GeneralDistMatrix<T,U,V>::PartialColAllToAll
             const Int colShift = Shift_( colRank, colAlign, colStride );
             const Int colOffset = (colShift-colShiftA) / colStridePart;
             const Int localHeight = Length_( height, colShift, colStride );
-            EL_INNER_PARALLEL_FOR
-            for( Int jLoc=0; jLoc<localWidthA; ++jLoc )
-            {
-                T* ACol = &ABuf[colOffset+jLoc*ALDim];
-                const T* dataCol = &data[jLoc*localHeight];
-                for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-                    ACol[iLoc*colStrideUnion] = dataCol[iLoc];
-            }
+            InnerInterleaveMatrix
+            ( localHeight, localWidthA,
+              data,             1, localHeight,
+              &ABuf[colOffset], colStrideUnion, ALDim );
         }
     }
     else
@@ -1784,14 +1742,10 @@ GeneralDistMatrix<T,U,V>::PartialColAllToAll
             const Int colShift = Shift_( colRank, colAlign, colStride );
             const Int colOffset = (colShift-colShiftA) / colStridePart;
             const Int localHeight = Length_( height, colShift, colStride );
-            EL_INNER_PARALLEL_FOR
-            for( Int jLoc=0; jLoc<localWidthA; ++jLoc )
-            {
-                T* ACol = &ABuf[colOffset+jLoc*ALDim];
-                const T* dataCol = &data[jLoc*localHeight];
-                for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-                    ACol[iLoc*colStrideUnion] = dataCol[iLoc];
-            }
+            InnerInterleaveMatrix
+            ( localHeight, localWidthA,
+              data,             1, localHeight,
+              &ABuf[colOffset], colStrideUnion, ALDim );
         }
     }
     A.auxMemory_.Release();
@@ -1848,14 +1802,10 @@ GeneralDistMatrix<T,U,V>::PartialRowAllToAll
             T* data = &firstBuf[k*portionSize];
             const Int colShift = Shift_( k, colAlignA, rowStrideUnion );
             const Int localHeight = Length_( height, colShift, rowStrideUnion );
-            EL_INNER_PARALLEL_FOR
-            for( Int jLoc=0; jLoc<thisLocalWidth; ++jLoc )
-            {
-                T* dataCol = &data[jLoc*localHeight];
-                const T* thisCol = &thisBuf[colShift+jLoc*ldim];
-                for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-                    dataCol[iLoc] = thisCol[iLoc*rowStrideUnion];
-            }
+            InnerInterleaveMatrix
+            ( localHeight, thisLocalWidth,
+              &thisBuf[colShift], rowStrideUnion, ldim,
+              data,               1, localHeight );
         }
 
         // Simultaneously Gather in rows and Scatter in columns
@@ -1898,14 +1848,10 @@ GeneralDistMatrix<T,U,V>::PartialRowAllToAll
             T* data = &secondBuf[k*portionSize];    
             const Int colShift = Shift_( k, colAlignA, rowStrideUnion );
             const Int localHeight = Length_( height, colShift, rowStrideUnion );
-            EL_INNER_PARALLEL_FOR
-            for( Int jLoc=0; jLoc<thisLocalWidth; ++jLoc )
-            {
-                T* dataCol = &data[jLoc*localHeight];
-                const T* sourceCol = &thisBuf[colShift+jLoc*ldim];
-                for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-                    dataCol[iLoc] = sourceCol[iLoc*rowStrideUnion]; 
-            }
+            InnerInterleaveMatrix
+            ( localHeight, thisLocalWidth,
+              &thisBuf[colShift], rowStrideUnion, ldim,
+              data,               1, localHeight );
         }
 
         // Realign the input
@@ -2088,14 +2034,10 @@ GeneralDistMatrix<T,U,V>::RowSumScatterUpdate
                 const Int thisRowShift = Shift_( k, rowAlign, rowStride );
                 const Int thisLocalWidth = 
                     Length_(width,thisRowShift,rowStride);
-                EL_INNER_PARALLEL_FOR
-                for( Int jLoc=0; jLoc<thisLocalWidth; ++jLoc )
-                {
-                    const T* ACol = 
-                        &ABuffer[(thisRowShift+jLoc*rowStride)*ALDim];
-                    T* dataCol = &data[jLoc*localHeight];
-                    MemCopy( dataCol, ACol, localHeight );
-                }
+                InnerInterleaveMatrix
+                ( localHeight, thisLocalWidth,
+                  &ABuffer[thisRowShift*ALDim], 1, rowStride*ALDim,
+                  data,                         1, localHeight );
             }
             // Communicate
             mpi::ReduceScatter( buffer, portionSize, this->RowComm() );
@@ -2204,14 +2146,10 @@ GeneralDistMatrix<T,U,V>::RowSumScatterUpdate
                 const Int thisRowShift = Shift_( k, rowAlign, rowStride );
                 const Int thisLocalWidth = 
                     Length_(width,thisRowShift,rowStride);
-                EL_INNER_PARALLEL_FOR
-                for( Int jLoc=0; jLoc<thisLocalWidth; ++jLoc )
-                {
-                    const T* ACol = 
-                        &ABuffer[(thisRowShift+jLoc*rowStride)*ALDim];
-                    T* dataCol = &data[jLoc*localHeightA];
-                    MemCopy( dataCol, ACol, localHeightA );
-                }
+                InnerInterleaveMatrix
+                ( localHeightA, thisLocalWidth,
+                  &ABuffer[thisRowShift*ALDim], 1, rowStride*ALDim,
+                  data,                         1, localHeightA );
             }
 
             // Reduce-scatter over each process row
@@ -2294,14 +2232,10 @@ GeneralDistMatrix<T,U,V>::ColSumScatterUpdate
             T* data = &buffer[k*recvSize];
             const Int thisColShift = Shift_( k, colAlign, colStride );
             const Int thisLocalHeight = Length_(height,thisColShift,colStride);
-            EL_INNER_PARALLEL_FOR
-            for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-            {
-                T* destCol = &data[jLoc*thisLocalHeight];
-                const T* sourceCol = &ABuffer[thisColShift+jLoc*ALDim];
-                for( Int iLoc=0; iLoc<thisLocalHeight; ++iLoc )
-                    destCol[iLoc] = sourceCol[iLoc*colStride];
-            }
+            InnerInterleaveMatrix
+            ( thisLocalHeight, localWidth,
+              &ABuffer[thisColShift], colStride, ALDim,
+              data,                   1, thisLocalHeight );
         }
 
         // Communicate
@@ -2360,14 +2294,10 @@ GeneralDistMatrix<T,U,V>::ColSumScatterUpdate
             T* data = &secondBuf[k*recvSize_RS];
             const Int thisColShift = Shift_( k, colAlign, colStride );
             const Int thisLocalHeight = Length_(height,thisColShift,colStride);
-            EL_INNER_PARALLEL_FOR
-            for( Int jLoc=0; jLoc<localWidthA; ++jLoc )
-            {
-                T* destCol = &data[jLoc*thisLocalHeight];
-                const T* sourceCol = &ABuffer[thisColShift+jLoc*ALDim];
-                for( Int iLoc=0; iLoc<thisLocalHeight; ++iLoc )
-                    destCol[iLoc] = sourceCol[iLoc*colStride];
-            }
+            InnerInterleaveMatrix
+            ( thisLocalHeight, localWidthA,
+              &ABuffer[thisColShift], colStride, ALDim,
+              data,                   1, thisLocalHeight );
         }
 
         // Reduce-scatter over each col
@@ -2436,15 +2366,11 @@ GeneralDistMatrix<T,U,V>::SumScatterUpdate
             T* data = &buffer[(k+l*colStride)*recvSize];
             const Int thisColShift = Shift_( k, colAlign, colStride );
             const Int thisLocalHeight = Length_(height,thisColShift,colStride);
-            EL_INNER_PARALLEL_FOR
-            for( Int jLoc=0; jLoc<thisLocalWidth; ++jLoc )
-            {
-                T* destCol = &data[jLoc*thisLocalHeight];
-                const T* sourceCol =
-                    &ABuffer[thisColShift+(thisRowShift+jLoc*rowStride)*ALDim];
-                for( Int iLoc=0; iLoc<thisLocalHeight; ++iLoc )
-                    destCol[iLoc] = sourceCol[iLoc*colStride];
-            }
+            InnerInterleaveMatrix
+            ( thisLocalHeight, thisLocalWidth,
+              &ABuffer[thisColShift+thisRowShift*ALDim],
+              colStride, rowStride*ALDim,
+              data, 1, thisLocalHeight );
         }
     }
 
@@ -2509,14 +2435,10 @@ GeneralDistMatrix<T,U,V>::PartialRowSumScatterUpdate
                 (thisRowShift-rowShiftOfA) / rowStridePart;
             const Int thisLocalWidth = 
                 Length_( width, thisRowShift, rowStride );
-            EL_INNER_PARALLEL_FOR
-            for( Int jLoc=0; jLoc<thisLocalWidth; ++jLoc )
-            {
-                const T* ACol = 
-                    &ABuf[(thisRowOffset+jLoc*rowStrideUnion)*ALDim];
-                T* dataCol = &data[jLoc*height];
-                MemCopy( dataCol, ACol, height );
-            }
+            InnerInterleaveMatrix
+            ( height, thisLocalWidth,
+              &ABuf[thisRowOffset*ALDim], 1, rowStrideUnion*ALDim,
+              data,                       1, height );
         }
     
         // Communicate
@@ -2596,14 +2518,10 @@ GeneralDistMatrix<T,U,V>::PartialColSumScatterUpdate
                 (thisColShift-colShiftOfA) / colStridePart;
             const Int thisLocalHeight = 
                 Length_( height, thisColShift, colStride );
-            EL_INNER_PARALLEL_FOR
-            for( Int j=0; j<width; ++j )
-            {
-                T* destCol = &data[j*thisLocalHeight];
-                const T* sourceCol = &ABuf[thisColOffset+j*ALDim];
-                for( Int iLoc=0; iLoc<thisLocalHeight; ++iLoc )
-                    destCol[iLoc] = sourceCol[iLoc*colStrideUnion];
-            }
+            InnerInterleaveMatrix
+            ( thisLocalHeight, width,
+              &ABuf[thisColOffset], colStrideUnion, ALDim,
+              data,                 1,              thisLocalHeight );
         }
 
         // Communicate
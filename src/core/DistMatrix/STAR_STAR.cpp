@@ -49,7 +49,8 @@ DM& DM::operator=( const DM& A )
     this->Resize( A.Height(), A.Width() );
     if( this->Grid() == A.Grid() )
     {
-        this->matrix_ = A.LockedMatrix();
+        if( this->NodeWriter() )
+            this->matrix_ = A.LockedMatrix();
     }
     else
     {
@@ -101,15 +102,17 @@ DM& DM::operator=( const DM& A )
             mpi::Broadcast
             ( bcastBuffer, A.Height()*A.Width(), 0, this->Grid().VCComm() );
 
-            for( Int j=0; j<A.Width(); ++j )
-                for( Int i=0; i<A.Height(); ++i )
-                    this->SetLocal(i,j,bcastBuffer[i+j*A.Height()]);
+            if( this->NodeWriter() )
+                for( Int j=0; j<A.Width(); ++j )
+                    for( Int i=0; i<A.Height(); ++i )
+                        this->SetLocal(i,j,bcastBuffer[i+j*A.Height()]);
         }
 
         if( A.Grid().VCRank() == 0 )
             mpi::Wait( sendRequest );
         this->auxMemory_.Release();
     }
+    this->NodeSync();
     return *this;
 }
 
@@ -237,12 +240,16 @@ DM& DM::operator=( const DistMatrix<T,CIRC,CIRC>& A )
         mpi::Broadcast( commBuffer, pkgSize, A.Root(), g.VCComm() );
 
         // Unpack
-        T* buffer = this->Buffer();
-        const Int ldim = this->LDim();
-        for( Int j=0; j<n; ++j )
-            for( Int i=0; i<m; ++i )
-                buffer[i+j*ldim] = commBuffer[i+j*m];        
+        if( this->NodeWriter() )
+        {
+            T* buffer = this->Buffer();
+            const Int ldim = this->LDim();
+            for( Int j=0; j<n; ++j )
+                for( Int i=0; i<m; ++i )
+                    buffer[i+j*ldim] = commBuffer[i+j*m];        
+        }
     }
+    this->NodeSync();
 
     return *this;
 }
@@ -130,11 +130,7 @@ template<Dist U,Dist V>
 DM& DM::operator=( const BlockDistMatrix<T,U,V>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("DM = BDM[U,V]"))
-    BlockDistMatrix<T,ColDist,RowDist> AElem(A.Grid(),1,1);
-    AElem = A;
-    DistMatrix<T,ColDist,RowDist> AElemView(A.Grid());
-    LockedView( AElemView, AElem ); 
-    *this = AElemView;
+    CachedRedistPlan( A, *this ).Execute( A, *this );
     return *this;
 }
 
@@ -154,7 +150,13 @@ DM& DM::operator=( const AbstractDistMatrix<T>& A )
 template<typename T>
 DM& DM::operator=( DM&& A )
 {
-    if( this->Viewing() && !A.Viewing() )
+    // Fall back to a copy if taking the buffer of A would violate the
+    // alignments this matrix is constrained to
+    const bool misaligned =
+        ( this->ColConstrained() && this->ColAlign() != A.ColAlign() ) ||
+        ( this->RowConstrained() && this->RowAlign() != A.RowAlign() ) ||
+        ( this->RootConstrained() && this->Root() != A.Root() );
+    if( this->Viewing() ? !A.Viewing() : misaligned )
         this->operator=( (const DM&)A );
     else
         GDM::operator=( std::move(A) );
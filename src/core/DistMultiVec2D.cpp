@@ -0,0 +1,227 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson, Lexing Ying,
+   The University of Texas at Austin, Stanford University, and the
+   Georgia Insitute of Technology.
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+namespace El {
+
+// Constructors and destructors
+// ============================
+
+template<typename T>
+DistMultiVec2D<T>::DistMultiVec2D( El::Dist dist, const El::Grid& grid )
+: height_(0), width_(0), dist_(dist), grid_(&grid)
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("DistMultiVec2D::DistMultiVec2D");
+        if( dist != MC && dist != MR )
+            LogicError("DistMultiVec2D only supports MC and MR distributions");
+    )
+    SetUpDistribution();
+}
+
+template<typename T>
+DistMultiVec2D<T>::DistMultiVec2D
+( Int height, Int width, El::Dist dist, const El::Grid& grid )
+: height_(height), width_(width), dist_(dist), grid_(&grid)
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("DistMultiVec2D::DistMultiVec2D");
+        if( dist != MC && dist != MR )
+            LogicError("DistMultiVec2D only supports MC and MR distributions");
+    )
+    SetUpDistribution();
+}
+
+template<typename T>
+DistMultiVec2D<T>::~DistMultiVec2D()
+{ }
+
+// Assignment and reconfiguration
+// ==============================
+
+// Make a copy
+// -----------
+template<typename T>
+const DistMultiVec2D<T>&
+DistMultiVec2D<T>::operator=( const DistMultiVec2D<T>& X )
+{
+    DEBUG_ONLY(CallStackEntry cse("DistMultiVec2D::operator="))
+    height_ = X.height_;
+    width_ = X.width_;
+    dist_ = X.dist_;
+    grid_ = X.grid_;
+    blocksize_ = X.blocksize_;
+    firstLocalRow_ = X.firstLocalRow_;
+    multiVec_ = X.multiVec_;
+    return *this;
+}
+
+// Change the size of the matrix
+// -----------------------------
+template<typename T>
+void DistMultiVec2D<T>::Empty()
+{
+    height_ = 0;
+    width_ = 0;
+    blocksize_ = 0;
+    firstLocalRow_ = 0;
+    multiVec_.Empty();
+}
+
+template<typename T>
+void DistMultiVec2D<T>::Resize( Int height, Int width )
+{
+    height_ = height;
+    width_ = width;
+    SetUpDistribution();
+}
+
+// Change the distribution
+// -----------------------
+template<typename T>
+void DistMultiVec2D<T>::SetGrid( const El::Grid& grid )
+{
+    grid_ = &grid;
+    SetUpDistribution();
+}
+
+template<typename T>
+void DistMultiVec2D<T>::SetDist( El::Dist dist )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("DistMultiVec2D::SetDist");
+        if( dist != MC && dist != MR )
+            LogicError("DistMultiVec2D only supports MC and MR distributions");
+    )
+    dist_ = dist;
+    SetUpDistribution();
+}
+
+// Queries
+// =======
+
+// High-level information
+// ----------------------
+template<typename T>
+Int DistMultiVec2D<T>::Height() const { return height_; }
+template<typename T>
+Int DistMultiVec2D<T>::Width() const { return width_; }
+template<typename T>
+Int DistMultiVec2D<T>::FirstLocalRow() const { return firstLocalRow_; }
+template<typename T>
+Int DistMultiVec2D<T>::LocalHeight() const { return multiVec_.Height(); }
+template<typename T>
+El::Matrix<T>& DistMultiVec2D<T>::Matrix() { return multiVec_; }
+template<typename T>
+const El::Matrix<T>& DistMultiVec2D<T>::LockedMatrix() const
+{ return multiVec_; }
+
+// Distribution information
+// ------------------------
+template<typename T>
+const El::Grid& DistMultiVec2D<T>::Grid() const { return *grid_; }
+template<typename T>
+El::Dist DistMultiVec2D<T>::Dist() const { return dist_; }
+
+template<typename T>
+mpi::Comm DistMultiVec2D<T>::BlockComm() const
+{ return ( dist_ == MC ? grid_->MRComm() : grid_->MCComm() ); }
+
+template<typename T>
+Int DistMultiVec2D<T>::NumBlocks() const
+{ return ( dist_ == MC ? grid_->Height() : grid_->Width() ); }
+
+template<typename T>
+Int DistMultiVec2D<T>::Blocksize() const { return blocksize_; }
+
+template<typename T>
+Int DistMultiVec2D<T>::BlockOwner( Int i ) const
+{ return RowToProcess( i, blocksize_, NumBlocks() ); }
+
+template<typename T>
+Int DistMultiVec2D<T>::FirstBlockRow( Int block ) const
+{ return block*blocksize_; }
+
+template<typename T>
+Int DistMultiVec2D<T>::BlockHeight( Int block ) const
+{
+    const Int numBlocks = NumBlocks();
+    return ( block<numBlocks-1 ? blocksize_
+                               : height_-(numBlocks-1)*blocksize_ );
+}
+
+template<typename T>
+Int DistMultiVec2D<T>::PieceHeight( Int block, Int q ) const
+{
+    const Int numPieces = mpi::Size( BlockComm() );
+    const Int blockHeight = BlockHeight( block );
+    const Int pieceSize = blockHeight / numPieces;
+    return ( q<numPieces-1 ? pieceSize : blockHeight-(numPieces-1)*pieceSize );
+}
+
+template<typename T>
+Int DistMultiVec2D<T>::RowOwner( Int i ) const
+{
+    const Int block = BlockOwner( i );
+    const Int numPieces = mpi::Size( BlockComm() );
+    const Int pieceSize = BlockHeight( block ) / numPieces;
+    const Int piece =
+        RowToProcess( i-FirstBlockRow(block), pieceSize, numPieces );
+    const Int gridHeight = grid_->Height();
+    if( dist_ == MC )
+        return block + piece*gridHeight;
+    else
+        return piece + block*gridHeight;
+}
+
+// Detailed local information
+// --------------------------
+template<typename T>
+T DistMultiVec2D<T>::GetLocal( Int localRow, Int col ) const
+{
+    DEBUG_ONLY(CallStackEntry cse("DistMultiVec2D::GetLocal"))
+    return multiVec_.Get(localRow,col);
+}
+
+template<typename T>
+void DistMultiVec2D<T>::SetLocal( Int localRow, Int col, T value )
+{
+    DEBUG_ONLY(CallStackEntry cse("DistMultiVec2D::SetLocal"))
+    multiVec_.Set(localRow,col,value);
+}
+
+template<typename T>
+void DistMultiVec2D<T>::UpdateLocal( Int localRow, Int col, T value )
+{
+    DEBUG_ONLY(CallStackEntry cse("DistMultiVec2D::UpdateLocal"))
+    multiVec_.Update(localRow,col,value);
+}
+
+// Auxiliary routines
+// ==================
+
+template<typename T>
+void DistMultiVec2D<T>::SetUpDistribution()
+{
+    DEBUG_ONLY(CallStackEntry cse("DistMultiVec2D::SetUpDistribution"))
+    const Int numBlocks = NumBlocks();
+    const Int block = ( dist_ == MC ? grid_->Row() : grid_->Col() );
+    const Int piece = mpi::Rank( BlockComm() );
+    blocksize_ = height_/numBlocks;
+    const Int pieceSize = BlockHeight(block) / mpi::Size(BlockComm());
+    firstLocalRow_ = FirstBlockRow(block) + piece*pieceSize;
+    multiVec_.Resize( PieceHeight(block,piece), width_ );
+}
+
+#define PROTO(T) template class DistMultiVec2D<T>;
+#include "El/macros/Instantiate.h"
+
+} // namespace El
@@ -0,0 +1,397 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson, Lexing Ying,
+   The University of Texas at Austin, Stanford University, and the
+   Georgia Insitute of Technology.
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+namespace El {
+
+// Constructors and destructors
+// ============================
+
+template<typename T>
+DistSparseMatrix2D<T>::DistSparseMatrix2D( const El::Grid& grid )
+: height_(0), width_(0), grid_(&grid), consistent_(true)
+{ SetUpDistribution(); }
+
+template<typename T>
+DistSparseMatrix2D<T>::DistSparseMatrix2D
+( Int height, Int width, const El::Grid& grid )
+: height_(height), width_(width), grid_(&grid), consistent_(true)
+{ SetUpDistribution(); }
+
+template<typename T>
+DistSparseMatrix2D<T>::~DistSparseMatrix2D()
+{ }
+
+// Assignment and reconfiguration
+// ==============================
+
+// Change the matrix size
+// ----------------------
+template<typename T>
+void DistSparseMatrix2D<T>::Empty()
+{
+    height_ = 0;
+    width_ = 0;
+    SwapClear( sources_ );
+    SwapClear( targets_ );
+    SwapClear( vals_ );
+    markedForRemoval_.clear();
+    consistent_ = true;
+    SetUpDistribution();
+}
+
+template<typename T>
+void DistSparseMatrix2D<T>::Resize( Int height, Int width )
+{
+    height_ = height;
+    width_ = width;
+    SwapClear( sources_ );
+    SwapClear( targets_ );
+    SwapClear( vals_ );
+    markedForRemoval_.clear();
+    consistent_ = true;
+    SetUpDistribution();
+}
+
+// Change the distribution
+// -----------------------
+template<typename T>
+void DistSparseMatrix2D<T>::SetGrid( const El::Grid& grid )
+{
+    grid_ = &grid;
+    SwapClear( sources_ );
+    SwapClear( targets_ );
+    SwapClear( vals_ );
+    markedForRemoval_.clear();
+    consistent_ = true;
+    SetUpDistribution();
+}
+
+// Assembly
+// --------
+template<typename T>
+void DistSparseMatrix2D<T>::Reserve( Int numLocalEntries )
+{
+    sources_.reserve( numLocalEntries );
+    targets_.reserve( numLocalEntries );
+    vals_.reserve( numLocalEntries );
+}
+
+template<typename T>
+void DistSparseMatrix2D<T>::QueueUpdate( Int row, Int col, T value )
+{
+    DEBUG_ONLY(CallStackEntry cse("DistSparseMatrix2D::QueueUpdate"))
+    if( row >= firstLocalRow_ && row < firstLocalRow_+localHeight_ &&
+        col >= firstLocalCol_ && col < firstLocalCol_+localWidth_ )
+        QueueLocalUpdate( row-firstLocalRow_, col-firstLocalCol_, value );
+}
+
+template<typename T>
+void DistSparseMatrix2D<T>::QueueLocalUpdate
+( Int localRow, Int localCol, T value )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("DistSparseMatrix2D::QueueLocalUpdate");
+        if( localRow < 0 || localRow >= localHeight_ ||
+            localCol < 0 || localCol >= localWidth_ )
+            LogicError
+            ("Local index (",localRow,",",localCol,") out of bounds of ",
+             localHeight_," x ",localWidth_," local matrix");
+    )
+    sources_.push_back( firstLocalRow_+localRow );
+    targets_.push_back( firstLocalCol_+localCol );
+    vals_.push_back( value );
+    consistent_ = false;
+}
+
+template<typename T>
+void DistSparseMatrix2D<T>::QueueZero( Int row, Int col )
+{
+    DEBUG_ONLY(CallStackEntry cse("DistSparseMatrix2D::QueueZero"))
+    if( row >= firstLocalRow_ && row < firstLocalRow_+localHeight_ &&
+        col >= firstLocalCol_ && col < firstLocalCol_+localWidth_ )
+        QueueLocalZero( row-firstLocalRow_, col-firstLocalCol_ );
+}
+
+template<typename T>
+void DistSparseMatrix2D<T>::QueueLocalZero( Int localRow, Int localCol )
+{
+    DEBUG_ONLY(CallStackEntry cse("DistSparseMatrix2D::QueueLocalZero"))
+    markedForRemoval_.insert
+    ( std::pair<Int,Int>(firstLocalRow_+localRow,firstLocalCol_+localCol) );
+    consistent_ = false;
+}
+
+template<typename T>
+void DistSparseMatrix2D<T>::MakeConsistent()
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("DistSparseMatrix2D::MakeConsistent");
+        if( sources_.size() != targets_.size() ||
+            targets_.size() != vals_.size() )
+            LogicError("Inconsistent sparse matrix buffer sizes");
+    )
+    if( !consistent_ )
+    {
+        const Int numLocalEntries = vals_.size();
+        Int numRemoved = 0;
+        std::vector<Entry<T>> entries( numLocalEntries );
+        for( Int s=0; s<numLocalEntries; ++s )
+        {
+            std::pair<Int,Int> candidate(sources_[s],targets_[s]);
+            if( markedForRemoval_.find(candidate) == markedForRemoval_.end() )
+            {
+                entries[s-numRemoved].indices[0] = sources_[s];
+                entries[s-numRemoved].indices[1] = targets_[s];
+                entries[s-numRemoved].value = vals_[s];
+            }
+            else
+            {
+                ++numRemoved;
+            }
+        }
+        markedForRemoval_.clear();
+        const Int numKept = numLocalEntries-numRemoved;
+        entries.resize( numKept );
+        std::sort( entries.begin(), entries.end(), CompareEntries );
+
+        // Compress out duplicates
+        Int lastUnique=0;
+        for( Int s=1; s<numKept; ++s )
+        {
+            if( entries[s].indices[0] != entries[lastUnique].indices[0] ||
+                entries[s].indices[1] != entries[lastUnique].indices[1] )
+            {
+                ++lastUnique;
+                if( s != lastUnique )
+                    entries[lastUnique] = entries[s];
+            }
+            else
+                entries[lastUnique].value += entries[s].value;
+        }
+        const Int numUnique = ( numKept > 0 ? lastUnique+1 : 0 );
+        entries.resize( numUnique );
+
+        sources_.resize( numUnique );
+        targets_.resize( numUnique );
+        vals_.resize( numUnique );
+        for( Int s=0; s<numUnique; ++s )
+        {
+            sources_[s] = entries[s].indices[0];
+            targets_[s] = entries[s].indices[1];
+            vals_[s] = entries[s].value;
+        }
+
+        ComputeEntryOffsets();
+
+        consistent_ = true;
+    }
+}
+
+// Queries
+// =======
+
+// High-level information
+// ----------------------
+template<typename T>
+Int DistSparseMatrix2D<T>::Height() const { return height_; }
+template<typename T>
+Int DistSparseMatrix2D<T>::Width() const { return width_; }
+
+template<typename T>
+Int DistSparseMatrix2D<T>::FirstLocalRow() const { return firstLocalRow_; }
+template<typename T>
+Int DistSparseMatrix2D<T>::FirstLocalCol() const { return firstLocalCol_; }
+template<typename T>
+Int DistSparseMatrix2D<T>::LocalHeight() const { return localHeight_; }
+template<typename T>
+Int DistSparseMatrix2D<T>::LocalWidth() const { return localWidth_; }
+
+template<typename T>
+Int DistSparseMatrix2D<T>::NumLocalEntries() const
+{
+    DEBUG_ONLY(CallStackEntry cse("DistSparseMatrix2D::NumLocalEntries"))
+    return vals_.size();
+}
+
+template<typename T>
+Int DistSparseMatrix2D<T>::Capacity() const
+{
+    DEBUG_ONLY(CallStackEntry cse("DistSparseMatrix2D::Capacity"))
+    return vals_.capacity();
+}
+
+template<typename T>
+bool DistSparseMatrix2D<T>::Consistent() const { return consistent_; }
+
+// Distribution information
+// ------------------------
+template<typename T>
+const El::Grid& DistSparseMatrix2D<T>::Grid() const { return *grid_; }
+template<typename T>
+Int DistSparseMatrix2D<T>::RowBlocksize() const { return rowBlocksize_; }
+template<typename T>
+Int DistSparseMatrix2D<T>::ColBlocksize() const { return colBlocksize_; }
+
+template<typename T>
+Int DistSparseMatrix2D<T>::RowOwner( Int i ) const
+{ return RowToProcess( i, rowBlocksize_, grid_->Height() ); }
+
+template<typename T>
+Int DistSparseMatrix2D<T>::ColOwner( Int j ) const
+{ return RowToProcess( j, colBlocksize_, grid_->Width() ); }
+
+template<typename T>
+Int DistSparseMatrix2D<T>::Owner( Int i, Int j ) const
+{ return RowOwner(i) + ColOwner(j)*grid_->Height(); }
+
+// Detailed local information
+// --------------------------
+template<typename T>
+Int DistSparseMatrix2D<T>::Row( Int localInd ) const
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("DistSparseMatrix2D::Row");
+        if( localInd < 0 || localInd >= (Int)sources_.size() )
+            LogicError("Entry number out of bounds");
+    )
+    return sources_[localInd];
+}
+
+template<typename T>
+Int DistSparseMatrix2D<T>::Col( Int localInd ) const
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("DistSparseMatrix2D::Col");
+        if( localInd < 0 || localInd >= (Int)targets_.size() )
+            LogicError("Entry number out of bounds");
+    )
+    return targets_[localInd];
+}
+
+template<typename T>
+T DistSparseMatrix2D<T>::Value( Int localInd ) const
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("DistSparseMatrix2D::Value");
+        if( localInd < 0 || localInd >= (Int)vals_.size() )
+            LogicError("Entry number out of bounds");
+        AssertConsistent();
+    )
+    return vals_[localInd];
+}
+
+template<typename T>
+Int DistSparseMatrix2D<T>::EntryOffset( Int localRow ) const
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("DistSparseMatrix2D::EntryOffset");
+        if( localRow < 0 || localRow > localHeight_ )
+            LogicError("Out of bounds local row");
+        AssertConsistent();
+    )
+    return localEntryOffsets_[localRow];
+}
+
+template<typename T>
+Int DistSparseMatrix2D<T>::NumConnections( Int localRow ) const
+{
+    DEBUG_ONLY(CallStackEntry cse("DistSparseMatrix2D::NumConnections"))
+    return EntryOffset(localRow+1) - EntryOffset(localRow);
+}
+
+template<typename T>
+Int* DistSparseMatrix2D<T>::SourceBuffer() { return sources_.data(); }
+template<typename T>
+Int* DistSparseMatrix2D<T>::TargetBuffer() { return targets_.data(); }
+template<typename T>
+T* DistSparseMatrix2D<T>::ValueBuffer() { return vals_.data(); }
+
+template<typename T>
+const Int* DistSparseMatrix2D<T>::LockedSourceBuffer() const
+{ return sources_.data(); }
+template<typename T>
+const Int* DistSparseMatrix2D<T>::LockedTargetBuffer() const
+{ return targets_.data(); }
+template<typename T>
+const T* DistSparseMatrix2D<T>::LockedValueBuffer() const
+{ return vals_.data(); }
+
+// Auxiliary routines
+// ==================
+
+template<typename T>
+void DistSparseMatrix2D<T>::SetUpDistribution()
+{
+    DEBUG_ONLY(CallStackEntry cse("DistSparseMatrix2D::SetUpDistribution"))
+    const Int gridHeight = grid_->Height();
+    const Int gridWidth = grid_->Width();
+    const Int gridRow = grid_->Row();
+    const Int gridCol = grid_->Col();
+
+    rowBlocksize_ = height_/gridHeight;
+    colBlocksize_ = width_/gridWidth;
+    firstLocalRow_ = gridRow*rowBlocksize_;
+    firstLocalCol_ = gridCol*colBlocksize_;
+    localHeight_ =
+        ( gridRow<gridHeight-1 ?
+          rowBlocksize_ :
+          height_ - (gridHeight-1)*rowBlocksize_ );
+    localWidth_ =
+        ( gridCol<gridWidth-1 ?
+          colBlocksize_ :
+          width_ - (gridWidth-1)*colBlocksize_ );
+    localEntryOffsets_.resize( localHeight_+1 );
+    ComputeEntryOffsets();
+}
+
+template<typename T>
+void DistSparseMatrix2D<T>::ComputeEntryOffsets()
+{
+    DEBUG_ONLY(CallStackEntry cse("DistSparseMatrix2D::ComputeEntryOffsets"))
+    Int rowOffset = 0;
+    Int prevRow = firstLocalRow_-1;
+    localEntryOffsets_.resize( localHeight_+1 );
+    const Int numLocalEntries = sources_.size();
+    for( Int k=0; k<numLocalEntries; ++k )
+    {
+        const Int i = sources_[k];
+        DEBUG_ONLY(
+            if( i < prevRow )
+                RuntimeError("rows were not properly sorted");
+        )
+        while( i != prevRow )
+        {
+            localEntryOffsets_[rowOffset++] = k;
+            ++prevRow;
+        }
+    }
+    while( rowOffset <= localHeight_ )
+        localEntryOffsets_[rowOffset++] = numLocalEntries;
+}
+
+template<typename T>
+bool DistSparseMatrix2D<T>::CompareEntries
+( const Entry<T>& a, const Entry<T>& b )
+{ return a.indices[0] < b.indices[0] ||
+         (a.indices[0] == b.indices[0] && a.indices[1] < b.indices[1]); }
+
+template<typename T>
+void DistSparseMatrix2D<T>::AssertConsistent() const
+{
+    if( !Consistent() )
+        LogicError("Distributed sparse matrix must be consistent");
+}
+
+#define PROTO(T) template class DistSparseMatrix2D<T>;
+#include "El/macros/Instantiate.h"
+
+} // namespace El
@@ -19,8 +19,30 @@ int Grid::FindFactor( int p )
     return factor;
 }
 
-Grid::Grid( mpi::Comm comm, GridOrder order )
-: haveViewers_(false), order_(order)
+int Grid::FindNodeFactor( int p, int nodeSize, GridOrder order )
+{
+    // Among the factorizations whose process columns (rows) either lie within
+    // a single node or consist of entire nodes, choose the most square one
+    int height = -1, bestScore = p+1;
+    for( int h=1; h<=p; ++h )
+    {
+        if( p % h != 0 )
+            continue;
+        const int contigSize = ( order==COLUMN_MAJOR ? h : p/h );
+        if( nodeSize % contigSize != 0 && contigSize % nodeSize != 0 )
+            continue;
+        const int score = Max( h, p/h );
+        if( score < bestScore || (score == bestScore && h > height) )
+        {
+            height = h;
+            bestScore = score;
+        }
+    }
+    return ( height == -1 ? FindFactor(p) : height );
+}
+
+Grid::Grid( mpi::Comm comm, GridOrder order, bool nodeAware )
+: haveViewers_(false), nodeAware_(nodeAware), order_(order)
 {
     DEBUG_ONLY(CallStackEntry cse("Grid::Grid"))
 
@@ -30,15 +52,24 @@ Grid::Grid( mpi::Comm comm, GridOrder order )
     size_ = mpi::Size( viewingComm_ );
 
     // All processes own the grid, so we have to trivially split viewingGroup_
+    // (unless the processes are to be reordered by node)
     owningGroup_ = viewingGroup_;
 
     // Factor p
-    height_ = FindFactor( size_ );
+    if( nodeAware_ )
+    {
+        const int nodeSize = OrderByNode();
+        height_ = 
+          ( nodeSize > 0 ? FindNodeFactor( size_, nodeSize, order_ )
+                         : FindFactor( size_ ) );
+    }
+    else
+        height_ = FindFactor( size_ );
     SetUpGrid();
 }
 
-Grid::Grid( mpi::Comm comm, int height, GridOrder order )
-: haveViewers_(false), order_(order)
+Grid::Grid( mpi::Comm comm, int height, GridOrder order, bool nodeAware )
+: haveViewers_(false), nodeAware_(nodeAware), order_(order)
 {
     DEBUG_ONLY(CallStackEntry cse("Grid::Grid"))
 
@@ -48,7 +79,10 @@ Grid::Grid( mpi::Comm comm, int height, GridOrder order )
     size_ = mpi::Size( viewingComm_ );
 
     // All processes own the grid, so we have to trivially split viewingGroup_
+    // (unless the processes are to be reordered by node)
     owningGroup_ = viewingGroup_;
+    if( nodeAware_ )
+        OrderByNode();
 
     height_ = height;
     if( height_ < 0 )
@@ -57,6 +91,42 @@ Grid::Grid( mpi::Comm comm, int height, GridOrder order )
     SetUpGrid();
 }
 
+// Form an owning group which orders the processes by their node (and then by
+// their original rank) and return the number of processes per node (or zero 
+// if the nodes do not have the same number of processes)
+int Grid::OrderByNode()
+{
+    DEBUG_ONLY(CallStackEntry cse("Grid::OrderByNode"))
+    mpi::Comm nodeComm, interNodeComm;
+    mpi::SplitNode( viewingComm_, nodeComm, interNodeComm );
+    const int nodeSize = mpi::Size( nodeComm );
+    const int nodeRank = mpi::Rank( nodeComm );
+
+    // The node roots number the nodes
+    int node = ( nodeRank==0 ? mpi::Rank(interNodeComm) : 0 );
+    mpi::Broadcast( node, 0, nodeComm );
+    mpi::Free( nodeComm );
+    mpi::Free( interNodeComm );
+
+    std::vector<int> myKey(2), keys(2*size_);
+    myKey[0] = node;
+    myKey[1] = nodeRank;
+    mpi::AllGather( myKey.data(), 2, keys.data(), 2, viewingComm_ );
+    std::vector<int> ranks(size_);
+    for( int q=0; q<size_; ++q )
+        ranks[q] = q;
+    std::stable_sort
+    ( ranks.begin(), ranks.end(), 
+      [&]( int a, int b ) 
+      { return keys[2*a] < keys[2*b] ||
+               (keys[2*a] == keys[2*b] && keys[2*a+1] < keys[2*b+1]); } );
+    mpi::Incl( viewingGroup_, size_, ranks.data(), owningGroup_ );
+
+    const int minNodeSize = mpi::AllReduce( nodeSize, mpi::MIN, viewingComm_ );
+    const int maxNodeSize = mpi::AllReduce( nodeSize, mpi::MAX, viewingComm_ );
+    return ( minNodeSize == maxNodeSize ? nodeSize : 0 );
+}
+
 void Grid::SetUpGrid()
 {
     DEBUG_ONLY(CallStackEntry cse("Grid::SetUpGrid"))
@@ -151,6 +221,11 @@ void Grid::SetUpGrid()
         mpi::Split
         ( cartComm_, DiagPathRank(), DiagPath(), matrixDiagPerpComm_ );
 
+        // Split the owning processes by node
+        mpi::SplitNode( owningComm_, nodeComm_, interNodeComm_ );
+        numNodes_ = mpi::Size( interNodeComm_ );
+        mpi::Broadcast( numNodes_, 0, nodeComm_ );
+
         DEBUG_ONLY(
             mpi::ErrorHandlerSet( matrixColComm_,      mpi::ERRORS_RETURN );
             mpi::ErrorHandlerSet( matrixRowComm_,      mpi::ERRORS_RETURN );
@@ -168,6 +243,8 @@ void Grid::SetUpGrid()
         vectorRowComm_      = mpi::COMM_NULL;
         matrixDiagComm_     = mpi::COMM_NULL; 
         matrixDiagPerpComm_ = mpi::COMM_NULL;
+        nodeComm_           = mpi::COMM_NULL;
+        interNodeComm_      = mpi::COMM_NULL;
         // diag paths and ranks are implicitly set to undefined
     }
     // Translate the rank of the root process of the owningGroup so that we can
@@ -177,6 +254,7 @@ void Grid::SetUpGrid()
     ( vectorColToViewingMap_.data(), size_, owningRoot, viewingComm_ );
     mpi::Broadcast
     ( diagPathsAndRanks_.data(), 2*size_, owningRoot, viewingComm_ );
+    mpi::Broadcast( numNodes_, owningRoot, viewingComm_ );
 }
 
 Grid::~Grid()
@@ -191,11 +269,13 @@ Grid::~Grid()
             mpi::Free( matrixRowComm_ );
             mpi::Free( vectorColComm_ );
             mpi::Free( vectorRowComm_ );
+            mpi::Free( nodeComm_ );
+            mpi::Free( interNodeComm_ );
             mpi::Free( cartComm_ );
             mpi::Free( owningComm_ );
         }
         mpi::Free( viewingComm_ );
-        if( HaveViewers() )
+        if( HaveViewers() || NodeAware() )
             mpi::Free( owningGroup_ );
         mpi::Free( viewingGroup_ );
     }
@@ -242,7 +322,7 @@ mpi::Comm Grid::Comm() const
 
 // Currently forces a columnMajor absolute rank on the grid
 Grid::Grid( mpi::Comm viewers, mpi::Group owners, int height, GridOrder order )
-: haveViewers_(true), order_(order)
+: haveViewers_(true), nodeAware_(false), order_(order)
 {
     DEBUG_ONLY(CallStackEntry cse("Grid::Grid"))
 
@@ -314,6 +394,13 @@ int Grid::DiagPathRank( int vectorColRank ) const
 
 int Grid::FirstVCRank( int diagPath ) const{ return diagPath*height_; }
 
+bool Grid::NodeAware() const { return nodeAware_; }
+int Grid::NodeRank() const { return mpi::Rank(nodeComm_); }
+int Grid::NodeSize() const { return mpi::Size(nodeComm_); }
+int Grid::NumNodes() const { return numNodes_; }
+mpi::Comm Grid::NodeComm() const { return nodeComm_; }
+mpi::Comm Grid::InterNodeComm() const { return interNodeComm_; }
+
 // Comparison functions
 // ====================
 
@@ -95,7 +95,12 @@ Matrix<T>::Matrix( Matrix<T>&& A ) EL_NOEXCEPT
 : viewType_(A.viewType_),
   height_(A.height_), width_(A.width_), ldim_(A.ldim_),
   data_(nullptr), memory_(std::move(A.memory_))
-{ std::swap( data_, A.data_ ); }
+{
+    std::swap( data_, A.data_ );
+    A.height_ = 0;
+    A.width_ = 0;
+    A.ldim_ = 1;
+}
 
 template<typename T>
 Matrix<T>::~Matrix() { }
@@ -161,12 +166,8 @@ Matrix<T>& Matrix<T>::operator=( Matrix<T>&& A )
     }
     else
     {
-        memory_.ShallowSwap( A.memory_ );
-        std::swap( data_, A.data_ );
-        viewType_ = A.viewType_;
-        height_ = A.height_;
-        width_ = A.width_;
-        ldim_ = A.ldim_;
+        // Swap, rather than copy, the metadata so that A is left consistent
+        ShallowSwap( A );
     }
     return *this;
 }
@@ -244,6 +245,47 @@ void Matrix<T>::Control( Int height, Int width, T* buffer, Int ldim )
     Control_( height, width, buffer, ldim );
 }
 
+template<typename T>
+void Matrix<T>::Control
+( Int height, Int width, T* buffer, Int ldim, std::function<void(T*)> deleter )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("Matrix::Control");
+        if( FixedSize() )
+            LogicError("Cannot attach a new buffer to a view with fixed size");
+    )
+    Control_( height, width, buffer, ldim, deleter );
+}
+
+template<typename T>
+void Matrix<T>::LockedControl
+( Int height, Int width, const T* buffer, Int ldim, 
+  std::function<void(T*)> deleter )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("Matrix::LockedControl");
+        if( FixedSize() )
+            LogicError("Cannot attach a new buffer to a view with fixed size");
+    )
+    Control_( height, width, const_cast<T*>(buffer), ldim, deleter );
+    viewType_ = (ViewType)( viewType_ | LOCKED_OWNER );
+}
+
+template<typename T>
+T* Matrix<T>::Release()
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("Matrix::Release");
+        if( Viewing() )
+            LogicError("Cannot release the buffer of a view");
+        if( FixedSize() )
+            LogicError("Cannot release the buffer of a fixed-size matrix");
+        if( data_ != memory_.Buffer() )
+            LogicError("Cannot release a buffer which is not owned");
+    )
+    return Release_();
+}
+
 // Basic queries
 // =============
 
@@ -976,6 +1018,22 @@ void Matrix<T>::Control_( Int height, Int width, T* buffer, Int ldim )
     viewType_ = (ViewType)( viewType_ & ~LOCKED_VIEW );
 }
 
+template<typename T>
+void Matrix<T>::Control_
+( Int height, Int width, T* buffer, Int ldim, std::function<void(T*)> deleter )
+{
+    Control_( height, width, buffer, ldim );
+    memory_.Control( buffer, ldim*width, deleter );
+}
+
+template<typename T>
+T* Matrix<T>::Release_()
+{
+    T* buffer = memory_.Forfeit();
+    Empty_();
+    return buffer;
+}
+
 // Return a reference to a single entry without error-checking
 // ===========================================================
 template<typename T>
@@ -1040,8 +1098,7 @@ void Matrix<T>::Resize_( Int height, Int width )
     if( reallocate )
     {
         ldim_ = Max( height, 1 );
-        memory_.Require( ldim_ * width );
-        data_ = memory_.Buffer();
+        Reallocate_( ldim_*width );
     }
 }
 
@@ -1054,11 +1111,21 @@ void Matrix<T>::Resize_( Int height, Int width, Int ldim )
     if( reallocate )
     {
         ldim_ = ldim;
-        memory_.Require(ldim*width);
-        data_ = memory_.Buffer();
+        Reallocate_( ldim*width );
     }
 }
 
+template<typename T>
+void Matrix<T>::Reallocate_( Int size )
+{
+    // A freshly allocated buffer is private to this matrix, so any lock on the
+    // previous (e.g., memory-mapped or node-shared) buffer no longer applies
+    if( std::size_t(size) > memory_.Size() )
+        viewType_ = (ViewType)( viewType_ & ~LOCKED_OWNER );
+    memory_.Require( size );
+    data_ = memory_.Buffer();
+}
+
 #define PROTO(T) template class Matrix<T>;
 #include "El/macros/Instantiate.h"
 
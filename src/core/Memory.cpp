@@ -23,7 +23,7 @@ Memory<G>::Memory( std::size_t size )
 
 template<typename G>
 Memory<G>::Memory( Memory<G>&& mem )
-: size_(mem.size_), buffer_(nullptr)
+: size_(0), buffer_(nullptr)
 { ShallowSwap(mem); }
 
 template<typename G>
@@ -35,10 +35,23 @@ void Memory<G>::ShallowSwap( Memory<G>& mem )
 {
     std::swap(size_,mem.size_);
     std::swap(buffer_,mem.buffer_);
+    std::swap(deleter_,mem.deleter_);
 }
 
 template<typename G>
-Memory<G>::~Memory() { delete[] buffer_; }
+Memory<G>::~Memory() { Free(); }
+
+template<typename G>
+void Memory<G>::Free()
+{
+    if( deleter_ )
+    {
+        deleter_( buffer_ );
+        deleter_ = nullptr;
+    }
+    else
+        delete[] buffer_;
+}
 
 template<typename G>
 G* Memory<G>::Buffer() const { return buffer_; }
@@ -51,7 +64,7 @@ G* Memory<G>::Require( std::size_t size )
 {
     if( size > size_ )
     {
-        delete[] buffer_;
+        Free();
 #ifndef EL_RELEASE
         try {
 #endif
@@ -78,6 +91,27 @@ G* Memory<G>::Require( std::size_t size )
     return buffer_;
 }
 
+template<typename G>
+void Memory<G>::Control
+( G* buffer, std::size_t size, std::function<void(G*)> deleter )
+{
+    Free();
+    buffer_ = buffer;
+    size_ = size;
+    deleter_ = deleter;
+}
+
+template<typename G>
+G* Memory<G>::Forfeit()
+{
+    if( deleter_ )
+        LogicError("Cannot forfeit a buffer with a custom deleter");
+    G* buffer = buffer_;
+    buffer_ = nullptr;
+    size_ = 0;
+    return buffer;
+}
+
 template<typename G>
 void Memory<G>::Release()
 {
@@ -89,7 +123,7 @@ void Memory<G>::Release()
 template<typename G>
 void Memory<G>::Empty()
 {
-    delete[] buffer_;
+    Free();
     size_ = 0;
     buffer_ = nullptr;
 }
@@ -0,0 +1,827 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+#include <list>
+
+namespace El {
+
+namespace {
+Int redistPlanCacheSize = 8;
+} // anonymous namespace
+
+// The helpers which describe the local indices of a distribution are used by
+// the (externally visible) plans and must therefore not have internal linkage
+namespace redist {
+
+// The distribution of one dimension of a matrix. Element-wise distributions
+// are treated separately from block distributions with unit block sizes so
+// that their indices can be described by a single progression.
+struct Layout1D
+{
+    Int n, stride, bsize, cut;
+    bool blocked;
+};
+
+template<typename T>
+Layout1D ColLayout( const AbstractDistMatrix<T>& A, Int n )
+{ return Layout1D{ n, A.ColStride(), 1, 0, false }; }
+template<typename T>
+Layout1D RowLayout( const AbstractDistMatrix<T>& A, Int n )
+{ return Layout1D{ n, A.RowStride(), 1, 0, false }; }
+template<typename T>
+Layout1D ColLayout( const AbstractBlockDistMatrix<T>& A, Int n )
+{ return Layout1D{ n, A.ColStride(), A.BlockHeight(), A.ColCut(), true }; }
+template<typename T>
+Layout1D RowLayout( const AbstractBlockDistMatrix<T>& A, Int n )
+{ return Layout1D{ n, A.RowStride(), A.BlockWidth(), A.RowCut(), true }; }
+
+// The global indices owned by a process along one dimension, as a list of
+// arithmetic progressions which are each contiguous in the local indexing
+struct Piece
+{
+    Int beg, stride, length, localBeg;
+};
+
+void GetPieces( const Layout1D& L, Int shift, std::vector<Piece>& pieces )
+{
+    pieces.clear();
+    if( !L.blocked )
+    {
+        const Int length = Length_( L.n, shift, L.stride );
+        if( length > 0 )
+            pieces.push_back( Piece{ shift, L.stride, length, 0 } );
+        return;
+    }
+    Int localBeg = 0;
+    for( Int b=shift; ; b+=L.stride )
+    {
+        const Int beg = Max( b*L.bsize-L.cut, Int(0) );
+        if( beg >= L.n )
+            break;
+        const Int end = Min( (b+1)*L.bsize-L.cut, L.n );
+        pieces.push_back( Piece{ beg, 1, end-beg, localBeg } );
+        localBeg += end-beg;
+    }
+}
+
+} // namespace redist
+
+namespace {
+
+template<typename T>
+void AppendLayout( const AbstractDistMatrix<T>& A, std::vector<Int>& sig )
+{
+    const Grid& g = A.Grid();
+    sig.push_back( 0 );
+    sig.push_back( A.ColDist() );
+    sig.push_back( A.RowDist() );
+    sig.push_back( A.ColAlign() );
+    sig.push_back( A.RowAlign() );
+    sig.push_back( A.Root() );
+    sig.push_back( A.NodeShared() );
+    sig.push_back( g.Height() );
+    sig.push_back( g.Width() );
+    sig.push_back( mpi::Size(g.ViewingComm()) );
+    for( Int q=0; q<g.Size(); ++q )
+        sig.push_back( g.VCToViewingMap(q) );
+}
+
+template<typename T>
+void AppendLayout( const AbstractBlockDistMatrix<T>& A, std::vector<Int>& sig )
+{
+    const Grid& g = A.Grid();
+    sig.push_back( 1 );
+    sig.push_back( A.ColDist() );
+    sig.push_back( A.RowDist() );
+    sig.push_back( A.BlockHeight() );
+    sig.push_back( A.BlockWidth() );
+    sig.push_back( A.ColCut() );
+    sig.push_back( A.RowCut() );
+    sig.push_back( A.ColAlign() );
+    sig.push_back( A.RowAlign() );
+    sig.push_back( A.Root() );
+    sig.push_back( g.Height() );
+    sig.push_back( g.Width() );
+    sig.push_back( mpi::Size(g.ViewingComm()) );
+    for( Int q=0; q<g.Size(); ++q )
+        sig.push_back( g.VCToViewingMap(q) );
+}
+
+// Only the node writer of a node-shared matrix receives (and unpacks) its data,
+// after which the other members of the node are synchronized with it
+template<typename T>
+bool Receiving( const AbstractDistMatrix<T>& B )
+{ return B.Participating() && B.NodeWriter(); }
+template<typename T>
+bool Receiving( const AbstractBlockDistMatrix<T>& B )
+{ return B.Participating(); }
+template<typename T>
+void SyncReceived( const AbstractDistMatrix<T>& B ) { B.NodeSync(); }
+template<typename T>
+void SyncReceived( const AbstractBlockDistMatrix<T>& B ) { }
+
+template<typename T,typename AType,typename BType>
+std::vector<Int> BuildSignature( const AType& A, const BType& B )
+{
+    std::vector<Int> sig;
+    sig.push_back( A.Height() );
+    sig.push_back( A.Width() );
+    AppendLayout( A, sig );
+    AppendLayout( B, sig );
+    return sig;
+}
+
+// The plans are shared so that pending asynchronous redistributions keep their
+// plan alive even if it is evicted from the cache (or the cache is freed along
+// with its communicator)
+template<typename T>
+using PlanList = std::list<std::shared_ptr<RedistPlan<T>>>;
+
+template<typename T>
+void DeletePlanCache( void* cache )
+{ delete static_cast<PlanList<T>*>(cache); }
+
+// Each viewing communicator holds its own cache so that only the members of a
+// communicator (which redistribute over it collectively) look up its plans
+template<typename T>
+PlanList<T>& PlanCache( mpi::Comm comm )
+{
+    static const int key = mpi::CreateKey( DeletePlanCache<T> );
+    void* cache = mpi::GetAttribute( comm, key );
+    if( cache == nullptr )
+    {
+        cache = new PlanList<T>;
+        mpi::SetAttribute( comm, key, cache );
+    }
+    return *static_cast<PlanList<T>*>(cache);
+}
+
+template<typename T,typename AType,typename BType>
+std::shared_ptr<RedistPlan<T>> LookupPlan( const AType& A, const BType& B )
+{
+    auto& cache = PlanCache<T>( A.Grid().ViewingComm() );
+    const std::vector<Int> signature = RedistPlan<T>::Signature( A, B );
+    for( auto it=cache.begin(); it!=cache.end(); ++it )
+    {
+        if( (*it)->Signature() == signature )
+        {
+            // Move the plan to the front of the cache
+            cache.splice( cache.begin(), cache, it );
+            return cache.front();
+        }
+    }
+    cache.push_front( std::make_shared<RedistPlan<T>>( A, B ) );
+    while( Int(cache.size()) > redistPlanCacheSize )
+        cache.pop_back();
+    return cache.front();
+}
+
+} // anonymous namespace
+
+template<typename T>
+template<typename AType,typename BType>
+void RedistPlan<T>::Build( const AType& A, const BType& B )
+{
+    DEBUG_ONLY(CallStackEntry cse("RedistPlan::Build"))
+    using namespace redist;
+    mpi::Comm comm = A.Grid().ViewingComm();
+    if( !mpi::Congruent( comm, B.Grid().ViewingComm() ) )
+        LogicError("Viewing communicators of A and B must be congruent");
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    const Int height = A.Height();
+    const Int width = A.Width();
+    const Layout1D colLayoutA = ColLayout( A, height );
+    const Layout1D rowLayoutA = RowLayout( A, width );
+    const Layout1D colLayoutB = ColLayout( B, height );
+    const Layout1D rowLayoutB = RowLayout( B, width );
+
+    // Exchange the shifts of every process. Only one member of each redundant
+    // team of A sends its data.
+    const Int infoSize = 6;
+    const bool sending = A.Participating() && A.RedundantRank() == 0;
+    const bool receiving = Receiving( B );
+    const Int info[infoSize] =
+      { sending, A.ColShift(), A.RowShift(),
+        receiving, B.ColShift(), B.RowShift() };
+    std::vector<Int> allInfo(infoSize*commSize);
+    mpi::AllGather( info, infoSize, allInfo.data(), infoSize, comm );
+
+    // Append the intersections of each pair of pieces from the two (sorted)
+    // lists to the list of segments and return the total length
+    auto intersect =
+      []( const std::vector<Piece>& P, const std::vector<Piece>& Q,
+          std::vector<Segment>& segs )
+      {
+          Int totalLength = 0;
+          Int k=0, l=0;
+          while( k < Int(P.size()) && l < Int(Q.size()) )
+          {
+              const Piece& p = P[k];
+              const Piece& q = Q[l];
+              const Int pEnd = p.beg + (p.length-1)*p.stride + 1;
+              const Int qEnd = q.beg + (q.length-1)*q.stride + 1;
+              const Int lo = Max( p.beg, q.beg );
+              const Int hi = Min( pEnd, qEnd );
+              if( lo < hi )
+              {
+                  const Int lcm = (p.stride/GCD(p.stride,q.stride))*q.stride;
+                  const Int pFirst =
+                      p.beg + ((lo-p.beg+p.stride-1)/p.stride)*p.stride;
+                  for( Int i=pFirst; i<Min(pFirst+lcm,hi); i+=p.stride )
+                  {
+                      if( Mod(i-q.beg,q.stride) == 0 )
+                      {
+                          Segment seg;
+                          seg.length = (hi-1-i)/lcm + 1;
+                          seg.begA = p.localBeg + (i-p.beg)/p.stride;
+                          seg.strideA = lcm/p.stride;
+                          seg.begB = q.localBeg + (i-q.beg)/q.stride;
+                          seg.strideB = lcm/q.stride;
+                          segs.push_back( seg );
+                          totalLength += seg.length;
+                          break;
+                      }
+                  }
+              }
+              if( pEnd <= qEnd )
+                  ++k;
+              else
+                  ++l;
+          }
+          return totalLength;
+      };
+
+    // Form the list of blocks shared between each relevant pair of processes
+    std::vector<Piece> colPiecesA, rowPiecesA, colPiecesB, rowPiecesB;
+    auto addBlock =
+      [&]( int peer, std::vector<Block>& blocks, Int& offset )
+      {
+          Block block;
+          block.peer = peer;
+          block.offset = offset;
+          block.rowSegBeg = rowSegs_.size();
+          block.colSegBeg = colSegs_.size();
+          const Int blockHeight =
+              intersect( colPiecesA, colPiecesB, rowSegs_ );
+          const Int blockWidth =
+              intersect( rowPiecesA, rowPiecesB, colSegs_ );
+          block.numRowSegs = rowSegs_.size() - block.rowSegBeg;
+          block.numColSegs = colSegs_.size() - block.colSegBeg;
+          block.size = blockHeight*blockWidth;
+          if( block.size > 0 )
+          {
+              blocks.push_back( block );
+              // Data sent to ourself is copied directly into B
+              if( peer != commRank )
+                  offset += block.size;
+          }
+          else
+          {
+              rowSegs_.resize( block.rowSegBeg );
+              colSegs_.resize( block.colSegBeg );
+          }
+      };
+    if( sending )
+    {
+        GetPieces( colLayoutA, A.ColShift(), colPiecesA );
+        GetPieces( rowLayoutA, A.RowShift(), rowPiecesA );
+        Int offset = 0;
+        for( int q=0; q<commSize; ++q )
+        {
+            const Int* qInfo = &allInfo[q*infoSize];
+            if( !qInfo[3] )
+                continue;
+            GetPieces( colLayoutB, qInfo[4], colPiecesB );
+            GetPieces( rowLayoutB, qInfo[5], rowPiecesB );
+            addBlock( q, sends_, offset );
+        }
+        sendSize_ = offset;
+    }
+    if( receiving )
+    {
+        GetPieces( colLayoutB, B.ColShift(), colPiecesB );
+        GetPieces( rowLayoutB, B.RowShift(), rowPiecesB );
+        Int offset = 0;
+        for( int q=0; q<commSize; ++q )
+        {
+            const Int* qInfo = &allInfo[q*infoSize];
+            if( !qInfo[0] )
+                continue;
+            GetPieces( colLayoutA, qInfo[1], colPiecesA );
+            GetPieces( rowLayoutA, qInfo[2], rowPiecesA );
+            addBlock( q, recvs_, offset );
+        }
+        recvSize_ = offset;
+    }
+}
+
+template<typename T>
+template<typename AType,typename BType>
+Int RedistPlan<T>::Start
+( const AType& A, BType& B,
+  std::vector<T>& sendBuf, std::vector<T>& recvBuf,
+  std::vector<mpi::Request>& requests ) const
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("RedistPlan::Start");
+        if( Signature( A, B ) != signature_ )
+            LogicError("Redistribution plan does not match A and B");
+    )
+    B.Resize( A.Height(), A.Width() );
+    mpi::Comm comm = A.Grid().ViewingComm();
+    const int commRank = mpi::Rank( comm );
+    const T* ABuf = A.LockedBuffer();
+    const Int ALDim = A.LDim();
+    T* BBuf = ( recvs_.empty() ? nullptr : B.Buffer() );
+    const Int BLDim = B.LDim();
+    sendBuf.resize( sendSize_ );
+    recvBuf.resize( recvSize_ );
+
+    // Post the receives
+    requests.resize( sends_.size()+recvs_.size() );
+    Int numRequests = 0;
+    for( const Block& r : recvs_ )
+        if( r.peer != commRank )
+            mpi::IRecv
+            ( &recvBuf[r.offset], r.size, r.peer, comm,
+              requests[numRequests++] );
+
+    // Pack and send (or, for our own data, directly copy)
+    for( const Block& s : sends_ )
+    {
+        Int offset = s.offset;
+        for( Int t=0; t<s.numColSegs; ++t )
+        {
+            const Segment& colSeg = colSegs_[s.colSegBeg+t];
+            for( Int r=0; r<s.numRowSegs; ++r )
+            {
+                const Segment& rowSeg = rowSegs_[s.rowSegBeg+r];
+                const T* ASub = &ABuf[rowSeg.begA+colSeg.begA*ALDim];
+                if( s.peer == commRank )
+                {
+                    InterleaveMatrix
+                    ( rowSeg.length, colSeg.length,
+                      ASub, rowSeg.strideA, colSeg.strideA*ALDim,
+                      &BBuf[rowSeg.begB+colSeg.begB*BLDim],
+                      rowSeg.strideB, colSeg.strideB*BLDim );
+                }
+                else
+                {
+                    InterleaveMatrix
+                    ( rowSeg.length, colSeg.length,
+                      ASub, rowSeg.strideA, colSeg.strideA*ALDim,
+                      &sendBuf[offset], 1, rowSeg.length );
+                    offset += rowSeg.length*colSeg.length;
+                }
+            }
+        }
+        if( s.peer != commRank )
+            mpi::ISend
+            ( &sendBuf[s.offset], s.size, s.peer, comm,
+              requests[numRequests++] );
+    }
+    return numRequests;
+}
+
+template<typename T>
+void RedistPlan<T>::Finish
+( T* BBuf, Int BLDim, const std::vector<T>& recvBuf, int commRank ) const
+{
+    DEBUG_ONLY(CallStackEntry cse("RedistPlan::Finish"))
+    for( const Block& r : recvs_ )
+    {
+        if( r.peer == commRank )
+            continue;
+        Int offset = r.offset;
+        for( Int t=0; t<r.numColSegs; ++t )
+        {
+            const Segment& colSeg = colSegs_[r.colSegBeg+t];
+            for( Int s=0; s<r.numRowSegs; ++s )
+            {
+                const Segment& rowSeg = rowSegs_[r.rowSegBeg+s];
+                InterleaveMatrix
+                ( rowSeg.length, colSeg.length,
+                  &recvBuf[offset], 1, rowSeg.length,
+                  &BBuf[rowSeg.begB+colSeg.begB*BLDim],
+                  rowSeg.strideB, colSeg.strideB*BLDim );
+                offset += rowSeg.length*colSeg.length;
+            }
+        }
+    }
+}
+
+template<typename T>
+template<typename AType,typename BType>
+void RedistPlan<T>::Run( const AType& A, BType& B )
+{
+    DEBUG_ONLY(CallStackEntry cse("RedistPlan::Run"))
+    std::vector<T> sendBuf, recvBuf;
+    std::vector<mpi::Request> requests;
+    const Int numRequests = Start( A, B, sendBuf, recvBuf, requests );
+    mpi::WaitAll( numRequests, requests.data() );
+    if( !recvs_.empty() )
+        Finish
+        ( B.Buffer(), B.LDim(), recvBuf, mpi::Rank(A.Grid().ViewingComm()) );
+    SyncReceived( B );
+}
+
+template<typename T>
+RedistPlan<T>::RedistPlan
+( const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B )
+: signature_(Signature(A,B)), sendSize_(0), recvSize_(0)
+{ Build( A, B ); }
+
+template<typename T>
+RedistPlan<T>::RedistPlan
+( const AbstractDistMatrix<T>& A, const AbstractBlockDistMatrix<T>& B )
+: signature_(Signature(A,B)), sendSize_(0), recvSize_(0)
+{ Build( A, B ); }
+
+template<typename T>
+RedistPlan<T>::RedistPlan
+( const AbstractBlockDistMatrix<T>& A, const AbstractDistMatrix<T>& B )
+: signature_(Signature(A,B)), sendSize_(0), recvSize_(0)
+{ Build( A, B ); }
+
+template<typename T>
+RedistPlan<T>::RedistPlan
+( const AbstractBlockDistMatrix<T>& A, const AbstractBlockDistMatrix<T>& B )
+: signature_(Signature(A,B)), sendSize_(0), recvSize_(0)
+{ Build( A, B ); }
+
+template<typename T>
+void RedistPlan<T>::Execute
+( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B )
+{ Run( A, B ); }
+
+template<typename T>
+void RedistPlan<T>::Execute
+( const AbstractDistMatrix<T>& A, AbstractBlockDistMatrix<T>& B )
+{ Run( A, B ); }
+
+template<typename T>
+void RedistPlan<T>::Execute
+( const AbstractBlockDistMatrix<T>& A, AbstractDistMatrix<T>& B )
+{ Run( A, B ); }
+
+template<typename T>
+void RedistPlan<T>::Execute
+( const AbstractBlockDistMatrix<T>& A, AbstractBlockDistMatrix<T>& B )
+{ Run( A, B ); }
+
+template<typename T>
+std::vector<Int> RedistPlan<T>::Signature
+( const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B )
+{ return BuildSignature<T>( A, B ); }
+
+template<typename T>
+std::vector<Int> RedistPlan<T>::Signature
+( const AbstractDistMatrix<T>& A, const AbstractBlockDistMatrix<T>& B )
+{ return BuildSignature<T>( A, B ); }
+
+template<typename T>
+std::vector<Int> RedistPlan<T>::Signature
+( const AbstractBlockDistMatrix<T>& A, const AbstractDistMatrix<T>& B )
+{ return BuildSignature<T>( A, B ); }
+
+template<typename T>
+std::vector<Int> RedistPlan<T>::Signature
+( const AbstractBlockDistMatrix<T>& A, const AbstractBlockDistMatrix<T>& B )
+{ return BuildSignature<T>( A, B ); }
+
+template<typename T>
+RedistPlan<T>& CachedRedistPlan
+( const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B )
+{
+    DEBUG_ONLY(CallStackEntry cse("CachedRedistPlan"))
+    return *LookupPlan<T>( A, B );
+}
+
+template<typename T>
+RedistPlan<T>& CachedRedistPlan
+( const AbstractDistMatrix<T>& A, const AbstractBlockDistMatrix<T>& B )
+{
+    DEBUG_ONLY(CallStackEntry cse("CachedRedistPlan"))
+    return *LookupPlan<T>( A, B );
+}
+
+template<typename T>
+RedistPlan<T>& CachedRedistPlan
+( const AbstractBlockDistMatrix<T>& A, const AbstractDistMatrix<T>& B )
+{
+    DEBUG_ONLY(CallStackEntry cse("CachedRedistPlan"))
+    return *LookupPlan<T>( A, B );
+}
+
+template<typename T>
+RedistPlan<T>& CachedRedistPlan
+( const AbstractBlockDistMatrix<T>& A, const AbstractBlockDistMatrix<T>& B )
+{
+    DEBUG_ONLY(CallStackEntry cse("CachedRedistPlan"))
+    return *LookupPlan<T>( A, B );
+}
+
+// Asynchronous redistributions
+// =============================
+
+template<typename T>
+bool RedistRequest<T>::StartGather
+( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B )
+{
+    DEBUG_ONLY(CallStackEntry cse("RedistRequest::StartGather"))
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    const Grid& g = A.Grid();
+    if( g != B.Grid() || g.Size() != mpi::Size(g.ViewingComm()) ||
+        mpi::Size(A.CrossComm()) != 1 || mpi::Size(B.CrossComm()) != 1 ||
+        B.NodeShared() )
+        return false;
+
+    // Each dimension of B must either be a gathered version of that of A or
+    // be (or be able to be realigned to be) identical to it
+    const bool gatherCols = ( B.ColDist() == STAR && A.ColDist() != STAR );
+    const bool gatherRows = ( B.RowDist() == STAR && A.RowDist() != STAR );
+    if( !gatherCols && !gatherRows )
+        return false;
+    const bool realignCols =
+        !gatherCols && B.ColAlign() != A.ColAlign();
+    const bool realignRows =
+        !gatherRows && B.RowAlign() != A.RowAlign();
+    if( (!gatherCols && B.ColDist() != A.ColDist()) ||
+        (!gatherRows && B.RowDist() != A.RowDist()) )
+        return false;
+    if( (realignCols && B.ColConstrained()) ||
+        (realignRows && B.RowConstrained()) ||
+        ((realignCols || realignRows) && B.Viewing()) )
+        return false;
+    if( realignCols )
+        B.AlignCols( A.ColAlign(), false );
+    if( realignRows )
+        B.AlignRows( A.RowAlign(), false );
+
+    const Int height = A.Height();
+    const Int width = A.Width();
+    B.Resize( height, width );
+    const Int colStride = A.ColStride();
+    const Int rowStride = A.RowStride();
+    const Int colAlign = A.ColAlign();
+    const Int rowAlign = A.RowAlign();
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    const Int maxLocalHeight =
+        ( gatherCols ? MaxLength(height,colStride) : localHeight );
+    const Int maxLocalWidth =
+        ( gatherRows ? MaxLength(width,rowStride) : localWidth );
+    const Int portionSize = mpi::Pad( maxLocalHeight*maxLocalWidth );
+    mpi::Comm comm =
+        ( gatherCols ? (gatherRows ? A.DistComm() : A.ColComm())
+                     : A.RowComm() );
+    const Int commSize = mpi::Size( comm );
+
+    // Pack our local data and start the AllGather
+    sendBuf_.resize( portionSize );
+    recvBuf_.resize( portionSize*commSize );
+    InterleaveMatrix
+    ( localHeight, localWidth,
+      A.LockedBuffer(), 1, A.LDim(),
+      sendBuf_.data(), 1, localHeight );
+    requests_.resize( 1 );
+    mpi::IAllGather
+    ( sendBuf_.data(), portionSize, recvBuf_.data(), portionSize, comm,
+      requests_[0] );
+
+    // Each portion of the result is the local data of a process with a
+    // (possibly) different column and/or row shift
+    T* BBuf = B.Buffer();
+    const Int BLDim = B.LDim();
+    finish_ =
+      [=]( const std::vector<T>& recvBuf )
+      {
+          for( Int q=0; q<commSize; ++q )
+          {
+              const Int k = ( gatherRows ? q % colStride : q );
+              const Int l = ( gatherCols ? q / colStride : q );
+              const Int colShift =
+                  ( gatherCols ? Shift_(k,colAlign,colStride) : 0 );
+              const Int rowShift =
+                  ( gatherRows ? Shift_(l,rowAlign,rowStride) : 0 );
+              const Int qLocalHeight =
+                  ( gatherCols ? Length_(height,colShift,colStride)
+                               : localHeight );
+              const Int qLocalWidth =
+                  ( gatherRows ? Length_(width,rowShift,rowStride)
+                               : localWidth );
+              InterleaveMatrix
+              ( qLocalHeight, qLocalWidth,
+                &recvBuf[q*portionSize], 1, qLocalHeight,
+                &BBuf[colShift+rowShift*BLDim],
+                ( gatherCols ? colStride : 1 ),
+                ( gatherRows ? rowStride : 1 )*BLDim );
+          }
+      };
+    pending_ = true;
+    return true;
+#else
+    return false;
+#endif
+}
+
+template<typename T>
+template<typename AType,typename BType>
+void RedistRequest<T>::StartPlan( const AType& A, BType& B )
+{
+    DEBUG_ONLY(CallStackEntry cse("RedistRequest::StartPlan"))
+    if( mpi::Congruent( A.Grid().ViewingComm(), B.Grid().ViewingComm() ) )
+    {
+        std::shared_ptr<RedistPlan<T>> plan = LookupPlan<T>( A, B );
+        const Int numRequests =
+            plan->Start( A, B, sendBuf_, recvBuf_, requests_ );
+        requests_.resize( numRequests );
+        T* BBuf = ( plan->recvs_.empty() ? nullptr : B.Buffer() );
+        const Int BLDim = B.LDim();
+        const int commRank = mpi::Rank( A.Grid().ViewingComm() );
+        BType* BPtr = &B;
+        finish_ =
+          [=]( const std::vector<T>& recvBuf )
+          {
+              if( BBuf != nullptr )
+                  plan->Finish( BBuf, BLDim, recvBuf, commRank );
+              SyncReceived( *BPtr );
+          };
+        pending_ = true;
+    }
+    else
+        Copy( A, B );
+}
+
+template<typename T>
+void RedistRequest<T>::Complete()
+{
+    finish_( recvBuf_ );
+    pending_ = false;
+    finish_ = nullptr;
+    std::vector<T>().swap( sendBuf_ );
+    std::vector<T>().swap( recvBuf_ );
+    std::vector<mpi::Request>().swap( requests_ );
+}
+
+template<typename T>
+RedistRequest<T>::RedistRequest
+( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B )
+: pending_(false)
+{
+    DEBUG_ONLY(CallStackEntry cse("RedistRequest::RedistRequest"))
+    if( !StartGather( A, B ) )
+        StartPlan( A, B );
+}
+
+template<typename T>
+RedistRequest<T>::RedistRequest
+( const AbstractDistMatrix<T>& A, AbstractBlockDistMatrix<T>& B )
+: pending_(false)
+{
+    DEBUG_ONLY(CallStackEntry cse("RedistRequest::RedistRequest"))
+    StartPlan( A, B );
+}
+
+template<typename T>
+RedistRequest<T>::RedistRequest
+( const AbstractBlockDistMatrix<T>& A, AbstractDistMatrix<T>& B )
+: pending_(false)
+{
+    DEBUG_ONLY(CallStackEntry cse("RedistRequest::RedistRequest"))
+    StartPlan( A, B );
+}
+
+template<typename T>
+RedistRequest<T>::RedistRequest
+( const AbstractBlockDistMatrix<T>& A, AbstractBlockDistMatrix<T>& B )
+: pending_(false)
+{
+    DEBUG_ONLY(CallStackEntry cse("RedistRequest::RedistRequest"))
+    StartPlan( A, B );
+}
+
+template<typename T>
+RedistRequest<T>::RedistRequest( RedistRequest<T>&& req )
+: pending_(req.pending_),
+  sendBuf_(std::move(req.sendBuf_)), recvBuf_(std::move(req.recvBuf_)),
+  requests_(std::move(req.requests_)), finish_(std::move(req.finish_))
+{ req.pending_ = false; }
+
+template<typename T>
+RedistRequest<T>::~RedistRequest()
+{
+    if( pending_ && !mpi::Finalized() )
+        Wait();
+}
+
+template<typename T>
+RedistRequest<T>& RedistRequest<T>::operator=( RedistRequest<T>&& req )
+{
+    DEBUG_ONLY(CallStackEntry cse("RedistRequest::operator="))
+    Wait();
+    pending_ = req.pending_;
+    sendBuf_ = std::move(req.sendBuf_);
+    recvBuf_ = std::move(req.recvBuf_);
+    requests_ = std::move(req.requests_);
+    finish_ = std::move(req.finish_);
+    req.pending_ = false;
+    return *this;
+}
+
+template<typename T>
+void RedistRequest<T>::Wait()
+{
+    DEBUG_ONLY(CallStackEntry cse("RedistRequest::Wait"))
+    if( !pending_ )
+        return;
+    mpi::WaitAll( requests_.size(), requests_.data() );
+    Complete();
+}
+
+template<typename T>
+bool RedistRequest<T>::Test()
+{
+    DEBUG_ONLY(CallStackEntry cse("RedistRequest::Test"))
+    if( !pending_ )
+        return true;
+    if( !mpi::TestAll( requests_.size(), requests_.data() ) )
+        return false;
+    Complete();
+    return true;
+}
+
+template<typename T>
+RedistRequest<T> CopyAsync
+( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B )
+{
+    DEBUG_ONLY(CallStackEntry cse("CopyAsync"))
+    return RedistRequest<T>( A, B );
+}
+
+template<typename T>
+RedistRequest<T> CopyAsync
+( const AbstractDistMatrix<T>& A, AbstractBlockDistMatrix<T>& B )
+{
+    DEBUG_ONLY(CallStackEntry cse("CopyAsync"))
+    return RedistRequest<T>( A, B );
+}
+
+template<typename T>
+RedistRequest<T> CopyAsync
+( const AbstractBlockDistMatrix<T>& A, AbstractDistMatrix<T>& B )
+{
+    DEBUG_ONLY(CallStackEntry cse("CopyAsync"))
+    return RedistRequest<T>( A, B );
+}
+
+template<typename T>
+RedistRequest<T> CopyAsync
+( const AbstractBlockDistMatrix<T>& A, AbstractBlockDistMatrix<T>& B )
+{
+    DEBUG_ONLY(CallStackEntry cse("CopyAsync"))
+    return RedistRequest<T>( A, B );
+}
+
+void SetRedistPlanCacheSize( Int numPlans )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("SetRedistPlanCacheSize");
+        if( numPlans < 1 )
+            LogicError("The plan cache must hold at least one plan");
+    )
+    redistPlanCacheSize = numPlans;
+}
+
+Int RedistPlanCacheSize() { return redistPlanCacheSize; }
+
+#define PROTO(T) \
+  template class RedistPlan<T>; \
+  template RedistPlan<T>& CachedRedistPlan \
+  ( const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B ); \
+  template RedistPlan<T>& CachedRedistPlan \
+  ( const AbstractDistMatrix<T>& A, const AbstractBlockDistMatrix<T>& B ); \
+  template RedistPlan<T>& CachedRedistPlan \
+  ( const AbstractBlockDistMatrix<T>& A, const AbstractDistMatrix<T>& B ); \
+  template RedistPlan<T>& CachedRedistPlan \
+  ( const AbstractBlockDistMatrix<T>& A, const AbstractBlockDistMatrix<T>& B ); \
+  template class RedistRequest<T>; \
+  template RedistRequest<T> CopyAsync \
+  ( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B ); \
+  template RedistRequest<T> CopyAsync \
+  ( const AbstractDistMatrix<T>& A, AbstractBlockDistMatrix<T>& B ); \
+  template RedistRequest<T> CopyAsync \
+  ( const AbstractBlockDistMatrix<T>& A, AbstractDistMatrix<T>& B ); \
+  template RedistRequest<T> CopyAsync \
+  ( const AbstractBlockDistMatrix<T>& A, AbstractBlockDistMatrix<T>& B );
+
+#include "El/macros/Instantiate.h"
+
+} // namespace El
@@ -0,0 +1,282 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_CORE_REMOTEQUEUES_HPP
+#define EL_CORE_REMOTEQUEUES_HPP
+
+// Processing of the queues of remote updates and pulls which are shared by
+// AbstractDistMatrix and AbstractBlockDistMatrix. The queued indices (and
+// values) are packed into Entry structures so that each of the following
+// stages requires a single exchange:
+//  1) members of the cross communicator forward their entries to the root,
+//  2) the root buckets the entries by their owner within the distribution
+//     communicator and exchanges them with a single AllToAll, and
+//  3) (for updates) the received entries are gathered over the redundant
+//     communicator so that every copy of the data is updated identically.
+// Node-shared matrices only apply the updates on their node writer.
+
+namespace El {
+namespace queues {
+
+// Exchange the entries which are bucketed (and ordered) by the destinations
+// in 'sendCounts'
+template<typename S>
+inline void Exchange
+( const std::vector<S>& sendBuf, const std::vector<Int>& sendCounts,
+        std::vector<S>& recvBuf, const std::vector<Int>& recvCounts,
+  mpi::Comm comm )
+{
+    DEBUG_ONLY(CallStackEntry cse("queues::Exchange"))
+    std::vector<Int> sendOffsets, recvOffsets;
+    Scan( sendCounts, sendOffsets );
+    const Int totalRecv = Scan( recvCounts, recvOffsets );
+    recvBuf.resize( totalRecv );
+    mpi::AllToAll
+    ( sendBuf.data(), sendCounts.data(), sendOffsets.data(),
+      recvBuf.data(), recvCounts.data(), recvOffsets.data(), comm );
+}
+
+// Same as above, but for structures without an MPI datatype, which are
+// sent as raw bytes
+template<typename S>
+inline void ExchangePacked
+( const std::vector<S>& sendBuf, const std::vector<Int>& sendCounts,
+        std::vector<S>& recvBuf, const std::vector<Int>& recvCounts,
+  mpi::Comm comm )
+{
+    DEBUG_ONLY(CallStackEntry cse("queues::ExchangePacked"))
+    const Int numProcs = sendCounts.size();
+    std::vector<Int> sendBytes(numProcs), recvBytes(numProcs);
+    for( Int q=0; q<numProcs; ++q )
+    {
+        sendBytes[q] = sendCounts[q]*sizeof(S);
+        recvBytes[q] = recvCounts[q]*sizeof(S);
+    }
+    std::vector<Int> sendOffsets, recvOffsets;
+    Scan( sendBytes, sendOffsets );
+    const Int totalRecv = Scan( recvBytes, recvOffsets );
+    recvBuf.resize( totalRecv/sizeof(S) );
+    mpi::AllToAll
+    ( reinterpret_cast<const byte*>(sendBuf.data()),
+      sendBytes.data(), sendOffsets.data(),
+      reinterpret_cast<byte*>(recvBuf.data()),
+      recvBytes.data(), recvOffsets.data(), comm );
+}
+
+inline void ExchangeCounts
+( const std::vector<Int>& sendCounts, std::vector<Int>& recvCounts,
+  mpi::Comm comm )
+{
+    recvCounts.resize( sendCounts.size() );
+    mpi::AllToAll( sendCounts.data(), 1, recvCounts.data(), 1, comm );
+}
+
+template<typename T>
+inline void Pack
+( std::vector<Int>& rows, std::vector<Int>& cols, std::vector<T>* vals,
+  std::vector<Entry<T>>& entries )
+{
+    const Int numEntries = rows.size();
+    entries.resize( numEntries );
+    for( Int k=0; k<numEntries; ++k )
+    {
+        entries[k].indices[0] = rows[k];
+        entries[k].indices[1] = cols[k];
+        entries[k].value = ( vals==nullptr ? T(0) : (*vals)[k] );
+    }
+    std::vector<Int>().swap( rows );
+    std::vector<Int>().swap( cols );
+    if( vals != nullptr )
+        std::vector<T>().swap( *vals );
+}
+
+// Forward all of the packed entries to the root of the cross communicator
+template<typename T>
+inline void ForwardToRoot
+( std::vector<Entry<T>>& entries,
+  std::vector<Int>& crossSendCounts, std::vector<Int>& crossRecvCounts,
+  int root, mpi::Comm crossComm )
+{
+    DEBUG_ONLY(CallStackEntry cse("queues::ForwardToRoot"))
+    const int crossSize = mpi::Size( crossComm );
+    crossSendCounts.assign( crossSize, 0 );
+    crossSendCounts[root] = entries.size();
+    ExchangeCounts( crossSendCounts, crossRecvCounts, crossComm );
+    std::vector<Entry<T>> recvEntries;
+    ExchangePacked
+    ( entries, crossSendCounts, recvEntries, crossRecvCounts, crossComm );
+    entries.swap( recvEntries );
+}
+
+// Bucket the entries by their owners within the distribution communicator
+template<typename T,typename DistType>
+inline void Bucket
+( const DistType& A, const std::vector<Entry<T>>& entries,
+  std::vector<Entry<T>>& sendEntries,
+  std::vector<Int>& sendCounts, std::vector<Int>& sendOffsets )
+{
+    const Int numEntries = entries.size();
+    sendCounts.assign( A.DistSize(), 0 );
+    for( Int k=0; k<numEntries; ++k )
+        ++sendCounts[A.Owner(entries[k].indices[0],entries[k].indices[1])];
+    Scan( sendCounts, sendOffsets );
+    sendEntries.resize( numEntries );
+    auto offsets = sendOffsets;
+    for( Int k=0; k<numEntries; ++k )
+    {
+        const Int owner = A.Owner(entries[k].indices[0],entries[k].indices[1]);
+        sendEntries[offsets[owner]++] = entries[k];
+    }
+}
+
+// Only the writer of a node-shared matrix may apply updates, after which the
+// other members of the node must wait for the writes to become visible
+template<typename T>
+inline bool Writer( const AbstractDistMatrix<T>& A )
+{ return A.NodeWriter(); }
+template<typename T>
+inline bool Writer( const AbstractBlockDistMatrix<T>& A )
+{ return true; }
+
+template<typename T>
+inline void Sync( const AbstractDistMatrix<T>& A )
+{ A.NodeSync(); }
+template<typename T>
+inline void Sync( const AbstractBlockDistMatrix<T>& A )
+{ }
+
+template<typename T,typename DistType>
+inline void ProcessUpdates
+( DistType& A,
+  std::vector<Int>& rows, std::vector<Int>& cols, std::vector<T>& vals )
+{
+    DEBUG_ONLY(CallStackEntry cse("queues::ProcessUpdates"))
+    if( !A.Grid().InGrid() )
+        return;
+
+    std::vector<Entry<T>> entries;
+    Pack( rows, cols, &vals, entries );
+
+    if( A.CrossSize() > 1 )
+    {
+        std::vector<Int> crossSendCounts, crossRecvCounts;
+        ForwardToRoot
+        ( entries, crossSendCounts, crossRecvCounts, A.Root(), A.CrossComm() );
+    }
+
+    if( A.Participating() )
+    {
+        // Exchange the updates with their owners
+        mpi::Comm distComm = A.DistComm();
+        std::vector<Entry<T>> sendEntries;
+        std::vector<Int> sendCounts, sendOffsets, recvCounts;
+        Bucket( A, entries, sendEntries, sendCounts, sendOffsets );
+        ExchangeCounts( sendCounts, recvCounts, distComm );
+        ExchangePacked
+        ( sendEntries, sendCounts, entries, recvCounts, distComm );
+        std::vector<Entry<T>>().swap( sendEntries );
+
+        // Ensure that every copy of the data receives every update
+        if( A.RedundantSize() > 1 )
+        {
+            mpi::Comm redundantComm = A.RedundantComm();
+            const Int redundantSize = A.RedundantSize();
+            const Int numBytes = entries.size()*sizeof(Entry<T>);
+            std::vector<Int> redundantBytes(redundantSize), redundantOffsets;
+            mpi::AllGather
+            ( &numBytes, 1, redundantBytes.data(), 1, redundantComm );
+            const Int totalBytes = Scan( redundantBytes, redundantOffsets );
+            std::vector<Entry<T>> allEntries( totalBytes/sizeof(Entry<T>) );
+            mpi::AllGather
+            ( reinterpret_cast<const byte*>(entries.data()), numBytes,
+              reinterpret_cast<byte*>(allEntries.data()),
+              redundantBytes.data(), redundantOffsets.data(), redundantComm );
+            entries.swap( allEntries );
+        }
+
+        // Apply the updates (so that duplicates are accumulated)
+        if( Writer(A) )
+        {
+            const Int numRecv = entries.size();
+            for( Int k=0; k<numRecv; ++k )
+            {
+                const Entry<T>& entry = entries[k];
+                A.UpdateLocal
+                ( A.LocalRow(entry.indices[0]), A.LocalCol(entry.indices[1]),
+                  entry.value );
+            }
+        }
+    }
+    Sync( A );
+}
+
+template<typename T,typename DistType>
+inline void ProcessPulls
+( const DistType& A,
+  std::vector<Int>& rows, std::vector<Int>& cols, std::vector<T>& pullBuf )
+{
+    DEBUG_ONLY(CallStackEntry cse("queues::ProcessPulls"))
+    if( !A.Grid().InGrid() )
+        return;
+
+    std::vector<Entry<T>> entries;
+    Pack<T>( rows, cols, nullptr, entries );
+
+    const bool crossForward = ( A.CrossSize() > 1 );
+    std::vector<Int> crossSendCounts, crossRecvCounts;
+    if( crossForward )
+        ForwardToRoot
+        ( entries, crossSendCounts, crossRecvCounts, A.Root(), A.CrossComm() );
+
+    std::vector<T> vals;
+    if( A.Participating() )
+    {
+        // Send the requests to the owners, who fill in the values and
+        // return them in the same order
+        mpi::Comm distComm = A.DistComm();
+        std::vector<Entry<T>> sendEntries, recvEntries;
+        std::vector<Int> sendCounts, sendOffsets, recvCounts;
+        Bucket( A, entries, sendEntries, sendCounts, sendOffsets );
+        ExchangeCounts( sendCounts, recvCounts, distComm );
+        ExchangePacked
+        ( sendEntries, sendCounts, recvEntries, recvCounts, distComm );
+        const Int numRecv = recvEntries.size();
+        std::vector<T> replyVals(numRecv);
+        for( Int k=0; k<numRecv; ++k )
+            replyVals[k] =
+                A.GetLocal
+                ( A.LocalRow(recvEntries[k].indices[0]),
+                  A.LocalCol(recvEntries[k].indices[1]) );
+        std::vector<T> sortedVals;
+        Exchange( replyVals, recvCounts, sortedVals, sendCounts, distComm );
+
+        // Return the values to the order of the requests
+        const Int numPulls = entries.size();
+        vals.resize( numPulls );
+        auto offsets = sendOffsets;
+        for( Int k=0; k<numPulls; ++k )
+        {
+            const Int owner =
+                A.Owner(entries[k].indices[0],entries[k].indices[1]);
+            vals[k] = sortedVals[offsets[owner]++];
+        }
+    }
+
+    // Return the values to the processes which forwarded the requests
+    if( crossForward )
+        Exchange
+        ( vals, crossRecvCounts, pullBuf, crossSendCounts, A.CrossComm() );
+    else
+        pullBuf.swap( vals );
+}
+
+} // namespace queues
+} // namespace El
+
+#endif // ifndef EL_CORE_REMOTEQUEUES_HPP
@@ -192,6 +192,275 @@ void ErrorHandlerSet( Comm comm, ErrorHandler errorHandler )
 #endif
 }
 
+namespace {
+
+int DeleteAttribute( MPI_Comm comm, int key, void* value, void* deleter )
+{
+    (*reinterpret_cast<AttributeDeleter*>(deleter))( value );
+    return MPI_SUCCESS;
+}
+
+} // anonymous namespace
+
+int CreateKey( AttributeDeleter* deleter )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::CreateKey"))
+    int key;
+    SafeMpi
+    ( MPI_Comm_create_keyval
+      ( MPI_COMM_NULL_COPY_FN, DeleteAttribute, &key,
+        reinterpret_cast<void*>(deleter) ) );
+    return key;
+}
+
+void SetAttribute( Comm comm, int key, void* value )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::SetAttribute"))
+    SafeMpi( MPI_Comm_set_attr( comm.comm, key, value ) );
+}
+
+void* GetAttribute( Comm comm, int key )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::GetAttribute"))
+    void* value;
+    int found;
+    SafeMpi( MPI_Comm_get_attr( comm.comm, key, &value, &found ) );
+    return ( found ? value : nullptr );
+}
+
+void SplitNode( Comm comm, Comm& nodeComm, Comm& interNodeComm )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::SplitNode"))
+    const int rank = Rank( comm );
+#ifdef EL_HAVE_MPI_COMM_SPLIT_TYPE
+    SafeMpi
+    ( MPI_Comm_split_type
+      ( comm.comm, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, 
+        &nodeComm.comm ) );
+#else
+    // Fall back to grouping the processes with the same processor name
+    const int commSize = Size( comm );
+    std::vector<char> name(MPI_MAX_PROCESSOR_NAME,'\0'),
+                      names(commSize*MPI_MAX_PROCESSOR_NAME);
+    int nameLength;
+    SafeMpi( MPI_Get_processor_name( name.data(), &nameLength ) );
+    SafeMpi
+    ( MPI_Allgather
+      ( name.data(),  MPI_MAX_PROCESSOR_NAME, MPI_CHAR,
+        names.data(), MPI_MAX_PROCESSOR_NAME, MPI_CHAR, comm.comm ) );
+    int color = rank;
+    for( int q=0; q<rank; ++q )
+    {
+        if( std::equal
+            ( name.begin(), name.end(), 
+              names.begin()+q*MPI_MAX_PROCESSOR_NAME ) )
+        {
+            color = q;
+            break;
+        }
+    }
+    Split( comm, color, rank, nodeComm );
+#endif
+    Split( comm, Rank(nodeComm), rank, interNodeComm );
+}
+
+// Shared-memory windows
+// =====================
+
+byte* WindowAllocateShared( std::size_t numBytes, Comm comm, Window& window )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::WindowAllocateShared"))
+#ifdef EL_HAVE_MPI_WIN_ALLOCATE_SHARED
+    // Only the first process contributes memory, so that the buffer is
+    // contiguous and can be returned to every member
+    const Aint localBytes = ( Rank(comm)==0 ? numBytes : 0 );
+    byte* localBuffer;
+    SafeMpi
+    ( MPI_Win_allocate_shared
+      ( localBytes, 1, MPI_INFO_NULL, comm.comm, &localBuffer, &window ) );
+    Aint size;
+    int dispUnit;
+    byte* buffer;
+    SafeMpi( MPI_Win_shared_query( window, 0, &size, &dispUnit, &buffer ) );
+    // Open a passive-target epoch so that MPI_Win_sync may be used 
+    SafeMpi( MPI_Win_lock_all( MPI_MODE_NOCHECK, window ) );
+    return buffer;
+#else
+    LogicError("MPI-3 shared-memory windows are not available");
+    return nullptr;
+#endif
+}
+
+void WindowSync( Window window )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::WindowSync"))
+#ifdef EL_HAVE_MPI_WIN_ALLOCATE_SHARED
+    SafeMpi( MPI_Win_sync( window ) );
+#endif
+}
+
+void WindowFree( Window& window )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::WindowFree"))
+#if defined(EL_HAVE_MPI_WIN_ALLOCATE_SHARED) || defined(EL_HAVE_MPI3_RMA)
+    SafeMpi( MPI_Win_unlock_all( window ) );
+    SafeMpi( MPI_Win_free( &window ) );
+#endif
+}
+
+// One-sided communication
+// =======================
+
+namespace {
+
+// Complex data is treated as pairs of real entries if complex MPI datatypes
+// are to be avoided
+template<typename T>
+struct RmaEntry
+{
+    static Datatype Type() { return TypeMap<T>(); }
+    static const int numReals = 1;
+};
+#ifdef EL_AVOID_COMPLEX_MPI
+template<typename R>
+struct RmaEntry<Complex<R>>
+{
+    static Datatype Type() { return TypeMap<R>(); }
+    static const int numReals = 2;
+};
+#endif
+
+#ifdef EL_HAVE_MPI3_RMA
+// A (committed) datatype for a height x width submatrix with the given
+// leading dimension
+template<typename T>
+Datatype SubmatrixType( Int height, Int width, Int ldim )
+{
+    const int numReals = RmaEntry<T>::numReals;
+    Datatype type;
+    SafeMpi
+    ( MPI_Type_vector
+      ( width, numReals*height, numReals*ldim, RmaEntry<T>::Type(), &type ) );
+    SafeMpi( MPI_Type_commit( &type ) );
+    return type;
+}
+#endif
+
+} // anonymous namespace
+
+template<typename T>
+void WindowCreate( T* buf, Int numEntries, Comm comm, Window& window )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::WindowCreate"))
+#ifdef EL_HAVE_MPI3_RMA
+    SafeMpi
+    ( MPI_Win_create
+      ( buf, numEntries*sizeof(T), sizeof(T), MPI_INFO_NULL, comm.comm,
+        &window ) );
+    SafeMpi( MPI_Win_lock_all( 0, window ) );
+#else
+    LogicError("MPI-3 one-sided communication is not available");
+#endif
+}
+
+template<typename T>
+void Accumulate
+( const T* buf, Int height, Int width,
+  int target, Int targetOffset, Int targetLDim, Window window )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::Accumulate"))
+#ifdef EL_HAVE_MPI3_RMA
+    if( height == 0 || width == 0 )
+        return;
+    const int numReals = RmaEntry<T>::numReals;
+    Datatype targetType = SubmatrixType<T>( height, width, targetLDim );
+    SafeMpi
+    ( MPI_Accumulate
+      ( const_cast<T*>(buf), numReals*height*width, RmaEntry<T>::Type(),
+        target, targetOffset, 1, targetType, MPI_SUM, window ) );
+    SafeMpi( MPI_Type_free( &targetType ) );
+#else
+    LogicError("MPI-3 one-sided communication is not available");
+#endif
+}
+
+template<typename T>
+void Get
+( T* buf, Int height, Int width,
+  int target, Int targetOffset, Int targetLDim, Window window )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::Get"))
+#ifdef EL_HAVE_MPI3_RMA
+    if( height == 0 || width == 0 )
+        return;
+    const int numReals = RmaEntry<T>::numReals;
+    Datatype targetType = SubmatrixType<T>( height, width, targetLDim );
+    SafeMpi
+    ( MPI_Get
+      ( buf, numReals*height*width, RmaEntry<T>::Type(),
+        target, targetOffset, 1, targetType, window ) );
+    SafeMpi( MPI_Type_free( &targetType ) );
+#else
+    LogicError("MPI-3 one-sided communication is not available");
+#endif
+}
+
+void WindowFlush( Window window )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::WindowFlush"))
+#ifdef EL_HAVE_MPI3_RMA
+    SafeMpi( MPI_Win_flush_all( window ) );
+#endif
+}
+
+void WindowFlushLocal( Window window )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::WindowFlushLocal"))
+#ifdef EL_HAVE_MPI3_RMA
+    SafeMpi( MPI_Win_flush_local_all( window ) );
+#endif
+}
+
+template void WindowCreate( byte* buf, Int numEntries, Comm comm, Window& window );
+template void WindowCreate( int* buf, Int numEntries, Comm comm, Window& window );
+template void WindowCreate( unsigned* buf, Int numEntries, Comm comm, Window& window );
+template void WindowCreate( long int* buf, Int numEntries, Comm comm, Window& window );
+template void WindowCreate( unsigned long* buf, Int numEntries, Comm comm, Window& window );
+#ifdef EL_HAVE_MPI_LONG_LONG
+template void WindowCreate( long long int* buf, Int numEntries, Comm comm, Window& window );
+template void WindowCreate( unsigned long long* buf, Int numEntries, Comm comm, Window& window );
+#endif
+template void WindowCreate( float* buf, Int numEntries, Comm comm, Window& window );
+template void WindowCreate( double* buf, Int numEntries, Comm comm, Window& window );
+template void WindowCreate( Complex<float>* buf, Int numEntries, Comm comm, Window& window );
+template void WindowCreate( Complex<double>* buf, Int numEntries, Comm comm, Window& window );
+template void Accumulate( const byte* buf, Int height, Int width, int target, Int targetOffset, Int targetLDim, Window window );
+template void Accumulate( const int* buf, Int height, Int width, int target, Int targetOffset, Int targetLDim, Window window );
+template void Accumulate( const unsigned* buf, Int height, Int width, int target, Int targetOffset, Int targetLDim, Window window );
+template void Accumulate( const long int* buf, Int height, Int width, int target, Int targetOffset, Int targetLDim, Window window );
+template void Accumulate( const unsigned long* buf, Int height, Int width, int target, Int targetOffset, Int targetLDim, Window window );
+#ifdef EL_HAVE_MPI_LONG_LONG
+template void Accumulate( const long long int* buf, Int height, Int width, int target, Int targetOffset, Int targetLDim, Window window );
+template void Accumulate( const unsigned long long* buf, Int height, Int width, int target, Int targetOffset, Int targetLDim, Window window );
+#endif
+template void Accumulate( const float* buf, Int height, Int width, int target, Int targetOffset, Int targetLDim, Window window );
+template void Accumulate( const double* buf, Int height, Int width, int target, Int targetOffset, Int targetLDim, Window window );
+template void Accumulate( const Complex<float>* buf, Int height, Int width, int target, Int targetOffset, Int targetLDim, Window window );
+template void Accumulate( const Complex<double>* buf, Int height, Int width, int target, Int targetOffset, Int targetLDim, Window window );
+template void Get( byte* buf, Int height, Int width, int target, Int targetOffset, Int targetLDim, Window window );
+template void Get( int* buf, Int height, Int width, int target, Int targetOffset, Int targetLDim, Window window );
+template void Get( unsigned* buf, Int height, Int width, int target, Int targetOffset, Int targetLDim, Window window );
+template void Get( long int* buf, Int height, Int width, int target, Int targetOffset, Int targetLDim, Window window );
+template void Get( unsigned long* buf, Int height, Int width, int target, Int targetOffset, Int targetLDim, Window window );
+#ifdef EL_HAVE_MPI_LONG_LONG
+template void Get( long long int* buf, Int height, Int width, int target, Int targetOffset, Int targetLDim, Window window );
+template void Get( unsigned long long* buf, Int height, Int width, int target, Int targetOffset, Int targetLDim, Window window );
+#endif
+template void Get( float* buf, Int height, Int width, int target, Int targetOffset, Int targetLDim, Window window );
+template void Get( double* buf, Int height, Int width, int target, Int targetOffset, Int targetLDim, Window window );
+template void Get( Complex<float>* buf, Int height, Int width, int target, Int targetOffset, Int targetLDim, Window window );
+template void Get( Complex<double>* buf, Int height, Int width, int target, Int targetOffset, Int targetLDim, Window window );
+
 // Cartesian communicator routines 
 // ===============================
 
@@ -386,6 +655,17 @@ bool Test( Request& request )
     return flag;
 }
 
+// Nonblocking test for the completion of several requests
+bool TestAll( int numRequests, Request* requests )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::TestAll"))
+    std::vector<Status> statuses( numRequests );
+    int flag;
+    SafeMpi
+    ( MPI_Testall( numRequests, requests, &flag, statuses.data() ) );
+    return flag;
+}
+
 // Ensure that the request finishes before continuing
 void Wait( Request& request )
 {
@@ -427,6 +707,569 @@ bool IProbe( int source, int tag, Comm comm, Status& status )
 bool IProbe( int source, Comm comm, Status& status )
 { return IProbe( source, 0, comm, status ); }
 
+// Parallel file I/O
+// =================
+
+namespace {
+
+// Large transfers are expressed in terms of a contiguous datatype of this many
+// bytes followed by a (small) remainder so that the counts always fit in an int
+const Offset FILE_CHUNK_BYTES = Offset(1) << 20;
+
+inline void
+SafeMpiFile( int mpiError, std::string msg )
+{
+    if( mpiError != MPI_SUCCESS )
+    {
+        char errorString[MPI_MAX_ERROR_STRING];
+        int lengthOfErrorString;
+        MPI_Error_string( mpiError, errorString, &lengthOfErrorString );
+        RuntimeError( msg, ": ", std::string(errorString) );
+    }
+}
+
+template<typename Function>
+void ChunkedFileTransfer( Offset numBytes, Function transfer )
+{
+    const Offset numChunks = numBytes / FILE_CHUNK_BYTES;
+    const Offset remainder = numBytes - numChunks*FILE_CHUNK_BYTES;
+    Datatype chunkType;
+    SafeMpi( MPI_Type_contiguous( FILE_CHUNK_BYTES, MPI_BYTE, &chunkType ) );
+    SafeMpi( MPI_Type_commit( &chunkType ) );
+    transfer( 0, int(numChunks), chunkType );
+    transfer( numChunks*FILE_CHUNK_BYTES, int(remainder), MPI_BYTE );
+    SafeMpi( MPI_Type_free( &chunkType ) );
+}
+
+} // anonymous namespace
+
+void FileOpen( Comm comm, const std::string filename, int mode, File& file )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::FileOpen"))
+    SafeMpiFile
+    ( MPI_File_open
+      ( comm.comm, const_cast<char*>(filename.c_str()), mode, MPI_INFO_NULL, 
+        &file ), "Could not open "+filename );
+}
+
+void FileClose( File& file )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::FileClose"))
+    SafeMpi( MPI_File_close( &file ) );
+}
+
+Offset FileSize( File file )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::FileSize"))
+    Offset size;
+    SafeMpi( MPI_File_get_size( file, &size ) );
+    return size;
+}
+
+void FileSetSize( File file, Offset size )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::FileSetSize"))
+    SafeMpi( MPI_File_set_size( file, size ) );
+}
+
+void FileReadAt( File file, Offset offset, byte* buf, Offset numBytes )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::FileReadAt"))
+    ChunkedFileTransfer
+    ( numBytes, 
+      [&]( Offset shift, int count, Datatype type )
+      {
+          Status status;
+          SafeMpiFile
+          ( MPI_File_read_at
+            ( file, offset+shift, &buf[shift], count, type, &status ),
+            "Could not read from file" );
+      } );
+}
+
+void FileReadAtAll( File file, Offset offset, byte* buf, Offset numBytes )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::FileReadAtAll"))
+    ChunkedFileTransfer
+    ( numBytes, 
+      [&]( Offset shift, int count, Datatype type )
+      {
+          Status status;
+          SafeMpiFile
+          ( MPI_File_read_at_all
+            ( file, offset+shift, &buf[shift], count, type, &status ),
+            "Could not read from file" );
+      } );
+}
+
+void FileWriteAt( File file, Offset offset, const byte* buf, Offset numBytes )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::FileWriteAt"))
+    ChunkedFileTransfer
+    ( numBytes, 
+      [&]( Offset shift, int count, Datatype type )
+      {
+          Status status;
+          SafeMpiFile
+          ( MPI_File_write_at
+            ( file, offset+shift, const_cast<byte*>(&buf[shift]), count, type,
+              &status ), "Could not write to file" );
+      } );
+}
+
+void FileWriteAtAll
+( File file, Offset offset, const byte* buf, Offset numBytes )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::FileWriteAtAll"))
+    ChunkedFileTransfer
+    ( numBytes, 
+      [&]( Offset shift, int count, Datatype type )
+      {
+          Status status;
+          SafeMpiFile
+          ( MPI_File_write_at_all
+            ( file, offset+shift, const_cast<byte*>(&buf[shift]), count, type,
+              &status ), "Could not write to file" );
+      } );
+}
+
+void FileIReadAt
+( File file, Offset offset, byte* buf, Offset numBytes,
+  std::vector<Request>& requests )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::FileIReadAt"))
+    ChunkedFileTransfer
+    ( numBytes, 
+      [&]( Offset shift, int count, Datatype type )
+      {
+          if( count == 0 )
+              return;
+          requests.push_back( REQUEST_NULL );
+          SafeMpiFile
+          ( MPI_File_iread_at
+            ( file, offset+shift, &buf[shift], count, type, &requests.back() ),
+            "Could not start reading from file" );
+      } );
+}
+
+void FileIWriteAt
+( File file, Offset offset, const byte* buf, Offset numBytes,
+  std::vector<Request>& requests )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::FileIWriteAt"))
+    ChunkedFileTransfer
+    ( numBytes, 
+      [&]( Offset shift, int count, Datatype type )
+      {
+          if( count == 0 )
+              return;
+          requests.push_back( REQUEST_NULL );
+          SafeMpiFile
+          ( MPI_File_iwrite_at
+            ( file, offset+shift, const_cast<byte*>(&buf[shift]), count, type,
+              &requests.back() ), "Could not start writing to file" );
+      } );
+}
+
+void FileSetView
+( File file, Offset disp, 
+  const std::vector<Offset>& runOffsets, const std::vector<Offset>& runLengths,
+  const std::vector<Offset>& blockOffsets )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("mpi::FileSetView");
+        if( runOffsets.size() != runLengths.size() )
+            LogicError("Run offsets and lengths were of different sizes");
+    )
+    // Split the runs into pieces whose lengths fit in an int
+    const Offset maxPiece = MaxMessageCount();
+    const Int numRuns = runOffsets.size();
+    std::vector<int> pieceLengths;
+    std::vector<MPI_Aint> pieceDispls;
+    for( Int k=0; k<numRuns; ++k )
+    {
+        for( Offset shift=0; shift<runLengths[k]; shift+=maxPiece )
+        {
+            pieceDispls.push_back( runOffsets[k]+shift );
+            pieceLengths.push_back( int(Min(maxPiece,runLengths[k]-shift)) );
+        }
+    }
+    const int numPieces = pieceLengths.size();
+    const int numBlocks = blockOffsets.size();
+    std::vector<MPI_Aint> blockDispls(numBlocks);
+    for( int j=0; j<numBlocks; ++j )
+        blockDispls[j] = blockOffsets[j];
+    std::vector<int> blockLengths( numBlocks, 1 );
+
+    Datatype blockType, fileType;
+    SafeMpi
+    ( MPI_Type_create_hindexed
+      ( numPieces, pieceLengths.data(), pieceDispls.data(), MPI_BYTE,
+        &blockType ) );
+    SafeMpi
+    ( MPI_Type_create_hindexed
+      ( numBlocks, blockLengths.data(), blockDispls.data(), blockType, 
+        &fileType ) );
+    SafeMpi( MPI_Type_commit( &fileType ) );
+    SafeMpiFile
+    ( MPI_File_set_view
+      ( file, disp, MPI_BYTE, fileType, const_cast<char*>("native"), 
+        MPI_INFO_NULL ), "Could not set file view" );
+    SafeMpi( MPI_Type_free( &fileType ) );
+    SafeMpi( MPI_Type_free( &blockType ) );
+}
+
+void FileResetView( File file )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::FileResetView"))
+    SafeMpiFile
+    ( MPI_File_set_view
+      ( file, 0, MPI_BYTE, MPI_BYTE, const_cast<char*>("native"), 
+        MPI_INFO_NULL ), "Could not reset file view" );
+}
+
+void FileReadAll( File file, byte* buf, Offset numBytes )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::FileReadAll"))
+    ChunkedFileTransfer
+    ( numBytes, 
+      [&]( Offset shift, int count, Datatype type )
+      {
+          Status status;
+          SafeMpiFile
+          ( MPI_File_read_all( file, &buf[shift], count, type, &status ),
+            "Could not read from file" );
+      } );
+}
+
+void FileWriteAll( File file, const byte* buf, Offset numBytes )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::FileWriteAll"))
+    ChunkedFileTransfer
+    ( numBytes, 
+      [&]( Offset shift, int count, Datatype type )
+      {
+          Status status;
+          SafeMpiFile
+          ( MPI_File_write_all
+            ( file, const_cast<byte*>(&buf[shift]), count, type, &status ),
+            "Could not write to file" );
+      } );
+}
+
+// Large messages
+// ==============
+
+namespace {
+
+Int maxMessageCount = std::numeric_limits<int>::max();
+
+// A (count,datatype) pair which describes 'count' contiguous entries of the
+// given type with an int count. Longer messages are described by a single
+// entry of a derived datatype built from contiguous chunks of maxMessageCount
+// entries and a remainder, with its extent set to that of the full message so
+// that it can also be used for the blocks of (uniform) collectives. The
+// derived datatype is freed upon destruction, which MPI allows even while
+// nonblocking communication which uses it is still pending.
+class MessageType
+{
+public:
+    int count;
+    Datatype type;
+
+    MessageType( Int numEntries, Datatype entryType )
+    : count(0), type(entryType), derived_(false)
+    {
+        if( numEntries <= maxMessageCount )
+        {
+            count = numEntries;
+            return;
+        }
+
+        const Int numChunks = numEntries / maxMessageCount;
+        const Int remainder = numEntries - numChunks*maxMessageCount;
+        if( numChunks > Int(std::numeric_limits<int>::max()) )
+            LogicError("Message of ",numEntries," entries is too large");
+        Aint lowerBound, extent;
+        SafeMpi( MPI_Type_get_extent( entryType, &lowerBound, &extent ) );
+
+        Datatype chunkType, chunksType, messageType;
+        SafeMpi
+        ( MPI_Type_contiguous( maxMessageCount, entryType, &chunkType ) );
+        SafeMpi( MPI_Type_contiguous( numChunks, chunkType, &chunksType ) );
+        if( remainder != 0 )
+        {
+            int blockLengths[2] = { 1, int(remainder) };
+            Aint displs[2] = { 0, numChunks*maxMessageCount*extent };
+            Datatype types[2] = { chunksType, entryType };
+            Datatype structType;
+            SafeMpi
+            ( MPI_Type_create_struct
+              ( 2, blockLengths, displs, types, &structType ) );
+            SafeMpi
+            ( MPI_Type_create_resized
+              ( structType, 0, numEntries*extent, &messageType ) );
+            SafeMpi( MPI_Type_free( &structType ) );
+        }
+        else
+            SafeMpi
+            ( MPI_Type_create_resized
+              ( chunksType, 0, numEntries*extent, &messageType ) );
+        SafeMpi( MPI_Type_free( &chunksType ) );
+        SafeMpi( MPI_Type_free( &chunkType ) );
+        SafeMpi( MPI_Type_commit( &messageType ) );
+
+        count = 1;
+        type = messageType;
+        derived_ = true;
+    }
+
+    ~MessageType()
+    {
+        if( derived_ && !Finalized() )
+            MPI_Type_free( &type );
+    }
+
+private:
+    bool derived_;
+
+    MessageType( const MessageType& );
+    const MessageType& operator=( const MessageType& );
+};
+
+// Since MPI's predefined reduction operations cannot be applied to derived
+// datatypes, long reductions are split into consecutive pieces of at most
+// 'maxCount' entries
+template<typename Function>
+void ChunkedReduction( Int count, Int maxCount, Function reduce )
+{
+    for( Int offset=0; offset<count; offset+=maxCount )
+        reduce( offset, int(std::min(count-offset,maxCount)) );
+}
+
+// The maximum number of complex entries per reduction, since they are
+// sometimes reduced as twice as many real entries
+inline Int MaxComplexReduction()
+{
+#ifdef EL_AVOID_COMPLEX_MPI
+    return std::max(maxMessageCount/2,Int(1));
+#else
+    return maxMessageCount;
+#endif
+}
+
+// Since the blocks of a ReduceScatter must be reduced in pieces, the
+// corresponding pieces of each block are packed into a contiguous buffer
+// (the source and destination buffers are allowed to coincide)
+template<typename T>
+void ChunkedReduceScatter
+( const T* sbuf, T* rbuf, Int rc, Int maxCount, Op op, Comm comm )
+{
+    const int commSize = Size( comm );
+    std::vector<T> sendBuf;
+    ChunkedReduction
+    ( rc, maxCount,
+      [&]( Int offset, int pieceCount )
+      {
+          sendBuf.resize( Int(pieceCount)*commSize );
+          for( int q=0; q<commSize; ++q )
+              MemCopy
+              ( &sendBuf[Int(q)*pieceCount], &sbuf[q*rc+offset], pieceCount );
+          ReduceScatter( sendBuf.data(), &rbuf[offset], pieceCount, op, comm );
+      } );
+}
+
+// The counts and displacements of MPI's variable-length collectives are
+// int's, so they are converted (after scaling by the number of MPI entries
+// per El entry) when they are all at most maxMessageCount. Returns false if
+// any of them are too large.
+bool ScaledInts( const Int* values, int n, Int scale, std::vector<int>& ints )
+{
+    bool fits = true;
+    ints.resize( n );
+    for( int q=0; q<n; ++q )
+    {
+        const Int value = scale*values[q];
+        if( value > maxMessageCount )
+            fits = false;
+        ints[q] = ( value <= maxMessageCount ? int(value) : 0 );
+    }
+    return fits;
+}
+
+// Otherwise, the exchange is performed by MPI_Alltoallw with a separate
+// derived datatype for each peer. Each is built from the absolute address of
+// its portion of the buffer (and a MessageType for its length), so that
+// neither the counts nor the displacements are limited to an int.
+void LargeAllToAll
+( const void* sbuf, const Int* scs, const Int* sds,
+        void* rbuf, const Int* rcs, const Int* rds,
+  Int scale, Datatype entryType, Comm comm )
+{
+    const int commSize = Size( comm );
+    Aint lowerBound, extent;
+    SafeMpi( MPI_Type_get_extent( entryType, &lowerBound, &extent ) );
+
+    std::vector<int> sendCounts(commSize,0), recvCounts(commSize,0),
+                     displs(commSize,0);
+    std::vector<Datatype> sendTypes(commSize,entryType),
+                          recvTypes(commSize,entryType);
+    auto peerType =
+      [&]( const void* buf, Int offset, Int numEntries, Datatype& type )
+      {
+          Aint address;
+          SafeMpi
+          ( MPI_Get_address
+            ( const_cast<byte*>(static_cast<const byte*>(buf))+
+              scale*offset*extent, &address ) );
+          MessageType message( scale*numEntries, entryType );
+          SafeMpi
+          ( MPI_Type_create_struct
+            ( 1, &message.count, &address, &message.type, &type ) );
+          SafeMpi( MPI_Type_commit( &type ) );
+      };
+    for( int q=0; q<commSize; ++q )
+    {
+        if( scs[q] > 0 )
+        {
+            peerType( sbuf, sds[q], scs[q], sendTypes[q] );
+            sendCounts[q] = 1;
+        }
+        if( rcs[q] > 0 )
+        {
+            peerType( rbuf, rds[q], rcs[q], recvTypes[q] );
+            recvCounts[q] = 1;
+        }
+    }
+
+    SafeMpi
+    ( MPI_Alltoallw
+      ( MPI_BOTTOM, sendCounts.data(), displs.data(), sendTypes.data(),
+        MPI_BOTTOM, recvCounts.data(), displs.data(), recvTypes.data(),
+        comm.comm ) );
+
+    for( int q=0; q<commSize; ++q )
+    {
+        if( sendCounts[q] != 0 )
+            SafeMpi( MPI_Type_free( &sendTypes[q] ) );
+        if( recvCounts[q] != 0 )
+            SafeMpi( MPI_Type_free( &recvTypes[q] ) );
+    }
+}
+
+void GatherV
+( const void* sbuf, Int sc,
+        void* rbuf, const Int* rcs, const Int* rds, int root,
+  Int scale, Datatype entryType, Comm comm )
+{
+    const int commRank = Rank( comm );
+    const int commSize = Size( comm );
+
+    // Only the root knows all of the counts, so it decides for everyone
+    std::vector<int> recvCounts, recvDispls;
+    int large = 0;
+    if( commRank == root )
+    {
+        const bool countsFit = ScaledInts( rcs, commSize, scale, recvCounts );
+        const bool displsFit = ScaledInts( rds, commSize, scale, recvDispls );
+        large = !(countsFit && displsFit);
+    }
+    SafeMpi( MPI_Bcast( &large, 1, MPI_INT, root, comm.comm ) );
+
+    if( !large )
+    {
+        SafeMpi
+        ( MPI_Gatherv
+          ( const_cast<void*>(sbuf), int(scale*sc), entryType,
+            rbuf, recvCounts.data(), recvDispls.data(), entryType,
+            root, comm.comm ) );
+    }
+    else
+    {
+        std::vector<Int> sendCounts(commSize,0), sendDispls(commSize,0),
+                         largeCounts(commSize,0), largeDispls(commSize,0);
+        sendCounts[root] = sc;
+        if( commRank == root )
+        {
+            largeCounts.assign( rcs, rcs+commSize );
+            largeDispls.assign( rds, rds+commSize );
+        }
+        LargeAllToAll
+        ( sbuf, sendCounts.data(), sendDispls.data(),
+          rbuf, largeCounts.data(), largeDispls.data(),
+          scale, entryType, comm );
+    }
+}
+
+void AllGatherV
+( const void* sbuf, Int sc,
+        void* rbuf, const Int* rcs, const Int* rds,
+  Int scale, Datatype entryType, Comm comm )
+{
+    // Every process knows all of the counts, so they all agree on the path
+    const int commSize = Size( comm );
+    std::vector<int> recvCounts, recvDispls;
+    const bool countsFit = ScaledInts( rcs, commSize, scale, recvCounts );
+    const bool displsFit = ScaledInts( rds, commSize, scale, recvDispls );
+    if( countsFit && displsFit )
+    {
+        SafeMpi
+        ( MPI_Allgatherv
+          ( const_cast<void*>(sbuf), int(scale*sc), entryType,
+            rbuf, recvCounts.data(), recvDispls.data(), entryType,
+            comm.comm ) );
+    }
+    else
+    {
+        std::vector<Int> sendCounts(commSize,sc), sendDispls(commSize,0);
+        LargeAllToAll
+        ( sbuf, sendCounts.data(), sendDispls.data(), rbuf, rcs, rds,
+          scale, entryType, comm );
+    }
+}
+
+void AllToAllV
+( const void* sbuf, const Int* scs, const Int* sds,
+        void* rbuf, const Int* rcs, const Int* rds,
+  Int scale, Datatype entryType, Comm comm )
+{
+    const int commSize = Size( comm );
+    std::vector<int> sendCounts, sendDispls, recvCounts, recvDispls;
+    bool fits = ScaledInts( scs, commSize, scale, sendCounts );
+    fits = ScaledInts( sds, commSize, scale, sendDispls ) && fits;
+    fits = ScaledInts( rcs, commSize, scale, recvCounts ) && fits;
+    fits = ScaledInts( rds, commSize, scale, recvDispls ) && fits;
+
+    // Each process only knows its own counts and displacements
+    int large = !fits, anyLarge;
+    SafeMpi
+    ( MPI_Allreduce( &large, &anyLarge, 1, MPI_INT, MPI_LOR, comm.comm ) );
+    if( !anyLarge )
+    {
+        SafeMpi
+        ( MPI_Alltoallv
+          ( const_cast<void*>(sbuf),
+            sendCounts.data(), sendDispls.data(), entryType,
+            rbuf, recvCounts.data(), recvDispls.data(), entryType,
+            comm.comm ) );
+    }
+    else
+        LargeAllToAll
+        ( sbuf, scs, sds, rbuf, rcs, rds, scale, entryType, comm );
+}
+
+} // anonymous namespace
+
+void SetMaxMessageCount( Int maxCount )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::SetMaxMessageCount"))
+    if( maxCount < 1 || maxCount > Int(std::numeric_limits<int>::max()) )
+        LogicError("Invalid maximum message count: ",maxCount);
+    maxMessageCount = maxCount;
+}
+
+Int MaxMessageCount() { return maxMessageCount; }
+
 template<typename T>
 int GetCount( Status& status )
 {
@@ -450,62 +1293,65 @@ template int GetCount<Complex<float>>( Status& status );
 template int GetCount<Complex<double>>( Status& status );
 
 template<typename R>
-void TaggedSend( const R* buf, int count, int to, int tag, Comm comm )
+void TaggedSend( const R* buf, Int count, int to, int tag, Comm comm )
 { 
     DEBUG_ONLY(CallStackEntry cse("mpi::Send"))
+    MessageType msg( count, TypeMap<R>() );
     SafeMpi( 
-        MPI_Send( const_cast<R*>(buf), count, TypeMap<R>(), to, tag, comm.comm )
+        MPI_Send( const_cast<R*>(buf), msg.count, msg.type, to, tag, comm.comm )
     );
 }
 
 template<typename R>
-void TaggedSend( const Complex<R>* buf, int count, int to, int tag, Comm comm )
+void TaggedSend( const Complex<R>* buf, Int count, int to, int tag, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Send"))
 #ifdef EL_AVOID_COMPLEX_MPI
+    MessageType msg( 2*count, TypeMap<R>() );
     SafeMpi
     ( MPI_Send
-      ( const_cast<Complex<R>*>(buf), 2*count, TypeMap<R>(), to, 
+      ( const_cast<Complex<R>*>(buf), msg.count, msg.type, to, 
         tag, comm.comm ) );
 #else
+    MessageType msg( count, TypeMap<Complex<R>>() );
     SafeMpi
     ( MPI_Send
-      ( const_cast<Complex<R>*>(buf), count, 
-        TypeMap<Complex<R>>(), to, tag, comm.comm ) );
+      ( const_cast<Complex<R>*>(buf), msg.count, 
+        msg.type, to, tag, comm.comm ) );
 #endif
 }
 
-template void TaggedSend( const byte* buf, int count, int to, int tag, Comm comm );
-template void TaggedSend( const int* buf, int count, int to, int tag, Comm comm );
-template void TaggedSend( const unsigned* buf, int count, int to, int tag, Comm comm  );
-template void TaggedSend( const long int* buf, int count, int to, int tag, Comm comm );
-template void TaggedSend( const unsigned long* buf, int count, int to, int tag, Comm comm  );
+template void TaggedSend( const byte* buf, Int count, int to, int tag, Comm comm );
+template void TaggedSend( const int* buf, Int count, int to, int tag, Comm comm );
+template void TaggedSend( const unsigned* buf, Int count, int to, int tag, Comm comm  );
+template void TaggedSend( const long int* buf, Int count, int to, int tag, Comm comm );
+template void TaggedSend( const unsigned long* buf, Int count, int to, int tag, Comm comm  );
 #ifdef EL_HAVE_MPI_LONG_LONG
-template void TaggedSend( const long long int* buf, int count, int to, int tag, Comm comm );
-template void TaggedSend( const unsigned long long* buf, int count, int to, int tag, Comm comm  );
+template void TaggedSend( const long long int* buf, Int count, int to, int tag, Comm comm );
+template void TaggedSend( const unsigned long long* buf, Int count, int to, int tag, Comm comm  );
 #endif
-template void TaggedSend( const float* buf, int count, int to, int tag, Comm comm );
-template void TaggedSend( const double* buf, int count, int to, int tag, Comm comm );
-template void TaggedSend( const Complex<float>* buf, int count, int to, int tag, Comm comm );
-template void TaggedSend( const Complex<double>* buf, int count, int to, int tag, Comm comm );
+template void TaggedSend( const float* buf, Int count, int to, int tag, Comm comm );
+template void TaggedSend( const double* buf, Int count, int to, int tag, Comm comm );
+template void TaggedSend( const Complex<float>* buf, Int count, int to, int tag, Comm comm );
+template void TaggedSend( const Complex<double>* buf, Int count, int to, int tag, Comm comm );
 
 template<typename T>
-void Send( const T* buf, int count, int to, Comm comm )
+void Send( const T* buf, Int count, int to, Comm comm )
 { TaggedSend( buf, count, to, 0, comm ); }
 
-template void Send( const byte* buf, int count, int to, Comm comm );
-template void Send( const int* buf, int count, int to, Comm comm );
-template void Send( const unsigned* buf, int count, int to, Comm comm );
-template void Send( const long int* buf, int count, int to, Comm comm );
-template void Send( const unsigned long* buf, int count, int to, Comm comm );
+template void Send( const byte* buf, Int count, int to, Comm comm );
+template void Send( const int* buf, Int count, int to, Comm comm );
+template void Send( const unsigned* buf, Int count, int to, Comm comm );
+template void Send( const long int* buf, Int count, int to, Comm comm );
+template void Send( const unsigned long* buf, Int count, int to, Comm comm );
 #ifdef EL_HAVE_MPI_LONG_LONG
-template void Send( const long long int* buf, int count, int to, Comm comm );
-template void Send( const unsigned long long* buf, int count, int to, Comm comm );
+template void Send( const long long int* buf, Int count, int to, Comm comm );
+template void Send( const unsigned long long* buf, Int count, int to, Comm comm );
 #endif
-template void Send( const float* buf, int count, int to, Comm comm );
-template void Send( const double* buf, int count, int to, Comm comm );
-template void Send( const Complex<float>* buf, int count, int to, Comm comm );
-template void Send( const Complex<double>* buf, int count, int to, Comm comm );
+template void Send( const float* buf, Int count, int to, Comm comm );
+template void Send( const double* buf, Int count, int to, Comm comm );
+template void Send( const Complex<float>* buf, Int count, int to, Comm comm );
+template void Send( const Complex<double>* buf, Int count, int to, Comm comm );
 
 template<typename T>
 void TaggedSend( T b, int to, int tag, Comm comm )
@@ -545,66 +1391,69 @@ template void Send( Complex<double> b, int to, Comm comm );
 
 template<typename R>
 void TaggedISend
-( const R* buf, int count, int to, int tag, Comm comm, Request& request )
+( const R* buf, Int count, int to, int tag, Comm comm, Request& request )
 { 
     DEBUG_ONLY(CallStackEntry cse("mpi::ISend"))
+    MessageType msg( count, TypeMap<R>() );
     SafeMpi
     ( MPI_Isend
-      ( const_cast<R*>(buf), count, TypeMap<R>(), to, 
+      ( const_cast<R*>(buf), msg.count, msg.type, to, 
         tag, comm.comm, &request ) );
 }
 
 template<typename R>
 void TaggedISend
-( const Complex<R>* buf, int count, int to, int tag, Comm comm, 
+( const Complex<R>* buf, Int count, int to, int tag, Comm comm, 
   Request& request )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::ISend"))
 #ifdef EL_AVOID_COMPLEX_MPI
+    MessageType msg( 2*count, TypeMap<R>() );
     SafeMpi
     ( MPI_Isend
-      ( const_cast<Complex<R>*>(buf), 2*count, TypeMap<R>(), to, tag, comm.comm,
+      ( const_cast<Complex<R>*>(buf), msg.count, msg.type, to, tag, comm.comm,
         &request ) );
 #else
+    MessageType msg( count, TypeMap<Complex<R>>() );
     SafeMpi
     ( MPI_Isend
-      ( const_cast<Complex<R>*>(buf), count, 
-        TypeMap<Complex<R>>(), to, tag, comm.comm, &request ) );
+      ( const_cast<Complex<R>*>(buf), msg.count, 
+        msg.type, to, tag, comm.comm, &request ) );
 #endif
 }
 
-template void TaggedISend( const byte* buf, int count, int to, int tag, Comm comm, Request& request );
-template void TaggedISend( const int* buf, int count, int to, int tag, Comm comm, Request& request );
-template void TaggedISend( const unsigned* buf, int count, int to, int tag, Comm comm, Request& request );
-template void TaggedISend( const long int* buf, int count, int to, int tag, Comm comm, Request& request );
-template void TaggedISend( const unsigned long* buf, int count, int to, int tag, Comm comm, Request& request );
+template void TaggedISend( const byte* buf, Int count, int to, int tag, Comm comm, Request& request );
+template void TaggedISend( const int* buf, Int count, int to, int tag, Comm comm, Request& request );
+template void TaggedISend( const unsigned* buf, Int count, int to, int tag, Comm comm, Request& request );
+template void TaggedISend( const long int* buf, Int count, int to, int tag, Comm comm, Request& request );
+template void TaggedISend( const unsigned long* buf, Int count, int to, int tag, Comm comm, Request& request );
 #ifdef EL_HAVE_MPI_LONG_LONG
-template void TaggedISend( const long long int* buf, int count, int to, int tag, Comm comm, Request& request );
-template void TaggedISend( const unsigned long long* buf, int count, int to, int tag, Comm comm, Request& request );
+template void TaggedISend( const long long int* buf, Int count, int to, int tag, Comm comm, Request& request );
+template void TaggedISend( const unsigned long long* buf, Int count, int to, int tag, Comm comm, Request& request );
 #endif
-template void TaggedISend( const float* buf, int count, int to, int tag, Comm comm, Request& request );
-template void TaggedISend( const double* buf, int count, int to, int tag, Comm comm, Request& request );
-template void TaggedISend( const Complex<float>* buf, int count, int to, int tag, Comm comm, Request& request );
-template void TaggedISend( const Complex<double>* buf, int count, int to, int tag, Comm comm, Request& request );
+template void TaggedISend( const float* buf, Int count, int to, int tag, Comm comm, Request& request );
+template void TaggedISend( const double* buf, Int count, int to, int tag, Comm comm, Request& request );
+template void TaggedISend( const Complex<float>* buf, Int count, int to, int tag, Comm comm, Request& request );
+template void TaggedISend( const Complex<double>* buf, Int count, int to, int tag, Comm comm, Request& request );
 
 template<typename T>
 void ISend
-( const T* buf, int count, int to, Comm comm, Request& request )
+( const T* buf, Int count, int to, Comm comm, Request& request )
 { TaggedISend( buf, count, to, 0, comm, request ); } 
 
-template void ISend( const byte* buf, int count, int to, Comm comm, Request& request );
-template void ISend( const int* buf, int count, int to, Comm comm, Request& request );
-template void ISend( const unsigned* buf, int count, int to, Comm comm, Request& request );
-template void ISend( const long int* buf, int count, int to, Comm comm, Request& request );
-template void ISend( const unsigned long* buf, int count, int to, Comm comm, Request& request );
+template void ISend( const byte* buf, Int count, int to, Comm comm, Request& request );
+template void ISend( const int* buf, Int count, int to, Comm comm, Request& request );
+template void ISend( const unsigned* buf, Int count, int to, Comm comm, Request& request );
+template void ISend( const long int* buf, Int count, int to, Comm comm, Request& request );
+template void ISend( const unsigned long* buf, Int count, int to, Comm comm, Request& request );
 #ifdef EL_HAVE_MPI_LONG_LONG
-template void ISend( const long long int* buf, int count, int to, Comm comm, Request& request );
-template void ISend( const unsigned long long* buf, int count, int to, Comm comm, Request& request );
+template void ISend( const long long int* buf, Int count, int to, Comm comm, Request& request );
+template void ISend( const unsigned long long* buf, Int count, int to, Comm comm, Request& request );
 #endif
-template void ISend( const float* buf, int count, int to, Comm comm, Request& request );
-template void ISend( const double* buf, int count, int to, Comm comm, Request& request );
-template void ISend( const Complex<float>* buf, int count, int to, Comm comm, Request& request );
-template void ISend( const Complex<double>* buf, int count, int to, Comm comm, Request& request );
+template void ISend( const float* buf, Int count, int to, Comm comm, Request& request );
+template void ISend( const double* buf, Int count, int to, Comm comm, Request& request );
+template void ISend( const Complex<float>* buf, Int count, int to, Comm comm, Request& request );
+template void ISend( const Complex<double>* buf, Int count, int to, Comm comm, Request& request );
 
 template<typename T>
 void TaggedISend( T b, int to, int tag, Comm comm, Request& request )
@@ -644,65 +1493,68 @@ template void ISend( Complex<double> buf, int to, Comm comm, Request& request );
 
 template<typename R>
 void TaggedISSend
-( const R* buf, int count, int to, int tag, Comm comm, Request& request )
+( const R* buf, Int count, int to, int tag, Comm comm, Request& request )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::ISSend"))
+    MessageType msg( count, TypeMap<R>() );
     SafeMpi
     ( MPI_Issend
-      ( const_cast<R*>(buf), count, TypeMap<R>(), to, 
+      ( const_cast<R*>(buf), msg.count, msg.type, to, 
         tag, comm.comm, &request ) );
 }
 
 template<typename R>
 void TaggedISSend
-( const Complex<R>* buf, int count, int to, int tag, Comm comm, 
+( const Complex<R>* buf, Int count, int to, int tag, Comm comm, 
   Request& request )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::ISSend"))
 #ifdef EL_AVOID_COMPLEX_MPI
+    MessageType msg( 2*count, TypeMap<R>() );
     SafeMpi
     ( MPI_Issend
-      ( const_cast<Complex<R>*>(buf), 2*count, TypeMap<R>(), to, tag, comm.comm,
+      ( const_cast<Complex<R>*>(buf), msg.count, msg.type, to, tag, comm.comm,
         &request ) );
 #else
+    MessageType msg( count, TypeMap<Complex<R>>() );
     SafeMpi
     ( MPI_Issend
-      ( const_cast<Complex<R>*>(buf), count, 
-        TypeMap<Complex<R>>(), to, tag, comm.comm, &request ) );
+      ( const_cast<Complex<R>*>(buf), msg.count, 
+        msg.type, to, tag, comm.comm, &request ) );
 #endif
 }
 
-template void TaggedISSend( const byte* buf, int count, int to, int tag, Comm comm, Request& request );
-template void TaggedISSend( const int* buf, int count, int to, int tag, Comm comm, Request& request );
-template void TaggedISSend( const unsigned* buf, int count, int to, int tag, Comm comm, Request& request );
-template void TaggedISSend( const long int* buf, int count, int to, int tag, Comm comm, Request& request );
-template void TaggedISSend( const unsigned long* buf, int count, int to, int tag, Comm comm, Request& request );
+template void TaggedISSend( const byte* buf, Int count, int to, int tag, Comm comm, Request& request );
+template void TaggedISSend( const int* buf, Int count, int to, int tag, Comm comm, Request& request );
+template void TaggedISSend( const unsigned* buf, Int count, int to, int tag, Comm comm, Request& request );
+template void TaggedISSend( const long int* buf, Int count, int to, int tag, Comm comm, Request& request );
+template void TaggedISSend( const unsigned long* buf, Int count, int to, int tag, Comm comm, Request& request );
 #ifdef EL_HAVE_MPI_LONG_LONG
-template void TaggedISSend( const long long int* buf, int count, int to, int tag, Comm comm, Request& request );
-template void TaggedISSend( const unsigned long long* buf, int count, int to, int tag, Comm comm, Request& request );
+template void TaggedISSend( const long long int* buf, Int count, int to, int tag, Comm comm, Request& request );
+template void TaggedISSend( const unsigned long long* buf, Int count, int to, int tag, Comm comm, Request& request );
 #endif
-template void TaggedISSend( const float* buf, int count, int to, int tag, Comm comm, Request& request );
-template void TaggedISSend( const double* buf, int count, int to, int tag, Comm comm, Request& request );
-template void TaggedISSend( const Complex<float>* buf, int count, int to, int tag, Comm comm, Request& request );
-template void TaggedISSend( const Complex<double>* buf, int count, int to, int tag, Comm comm, Request& request );
+template void TaggedISSend( const float* buf, Int count, int to, int tag, Comm comm, Request& request );
+template void TaggedISSend( const double* buf, Int count, int to, int tag, Comm comm, Request& request );
+template void TaggedISSend( const Complex<float>* buf, Int count, int to, int tag, Comm comm, Request& request );
+template void TaggedISSend( const Complex<double>* buf, Int count, int to, int tag, Comm comm, Request& request );
 
 template<typename T>
-void ISSend( const T* buf, int count, int to, Comm comm, Request& request )
+void ISSend( const T* buf, Int count, int to, Comm comm, Request& request )
 { TaggedISSend( buf, count, to, 0, comm, request ); }
 
-template void ISSend( const byte* buf, int count, int to, Comm comm, Request& request );
-template void ISSend( const int* buf, int count, int to, Comm comm, Request& request );
-template void ISSend( const unsigned* buf, int count, int to, Comm comm, Request& request );
-template void ISSend( const long int* buf, int count, int to, Comm comm, Request& request );
-template void ISSend( const unsigned long* buf, int count, int to, Comm comm, Request& request );
+template void ISSend( const byte* buf, Int count, int to, Comm comm, Request& request );
+template void ISSend( const int* buf, Int count, int to, Comm comm, Request& request );
+template void ISSend( const unsigned* buf, Int count, int to, Comm comm, Request& request );
+template void ISSend( const long int* buf, Int count, int to, Comm comm, Request& request );
+template void ISSend( const unsigned long* buf, Int count, int to, Comm comm, Request& request );
 #ifdef EL_HAVE_MPI_LONG_LONG
-template void ISSend( const long long int* buf, int count, int to, Comm comm, Request& request );
-template void ISSend( const unsigned long long* buf, int count, int to, Comm comm, Request& request );
+template void ISSend( const long long int* buf, Int count, int to, Comm comm, Request& request );
+template void ISSend( const unsigned long long* buf, Int count, int to, Comm comm, Request& request );
 #endif
-template void ISSend( const float* buf, int count, int to, Comm comm, Request& request );
-template void ISSend( const double* buf, int count, int to, Comm comm, Request& request );
-template void ISSend( const Complex<float>* buf, int count, int to, Comm comm, Request& request );
-template void ISSend( const Complex<double>* buf, int count, int to, Comm comm, Request& request );
+template void ISSend( const float* buf, Int count, int to, Comm comm, Request& request );
+template void ISSend( const double* buf, Int count, int to, Comm comm, Request& request );
+template void ISSend( const Complex<float>* buf, Int count, int to, Comm comm, Request& request );
+template void ISSend( const Complex<double>* buf, Int count, int to, Comm comm, Request& request );
 
 template<typename T>
 void TaggedISSend( T b, int to, int tag, Comm comm, Request& request )
@@ -723,60 +1575,63 @@ template void TaggedISSend( Complex<float> b, int to, int tag, Comm comm, Reques
 template void TaggedISSend( Complex<double> b, int to, int tag, Comm comm, Request& request );
 
 template<typename R>
-void TaggedRecv( R* buf, int count, int from, int tag, Comm comm )
+void TaggedRecv( R* buf, Int count, int from, int tag, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Recv"))
     Status status;
+    MessageType msg( count, TypeMap<R>() );
     SafeMpi
-    ( MPI_Recv( buf, count, TypeMap<R>(), from, tag, comm.comm, &status ) );
+    ( MPI_Recv( buf, msg.count, msg.type, from, tag, comm.comm, &status ) );
 }
 
 template<typename R>
-void TaggedRecv( Complex<R>* buf, int count, int from, int tag, Comm comm )
+void TaggedRecv( Complex<R>* buf, Int count, int from, int tag, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Recv"))
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
+    MessageType msg( 2*count, TypeMap<R>() );
     SafeMpi
-    ( MPI_Recv( buf, 2*count, TypeMap<R>(), from, tag, comm.comm, &status ) );
+    ( MPI_Recv( buf, msg.count, msg.type, from, tag, comm.comm, &status ) );
 #else
+    MessageType msg( count, TypeMap<Complex<R>>() );
     SafeMpi
     ( MPI_Recv
-      ( buf, count, TypeMap<Complex<R>>(), from, tag, comm.comm, &status ) );
+      ( buf, msg.count, msg.type, from, tag, comm.comm, &status ) );
 #endif
 }
 
-template void TaggedRecv( byte* buf, int count, int from, int tag, Comm comm );
-template void TaggedRecv( int* buf, int count, int from, int tag, Comm comm );
-template void TaggedRecv( unsigned* buf, int count, int from, int tag, Comm comm );
-template void TaggedRecv( long int* buf, int count, int from, int tag, Comm comm );
-template void TaggedRecv( unsigned long* buf, int count, int from, int tag, Comm comm );
+template void TaggedRecv( byte* buf, Int count, int from, int tag, Comm comm );
+template void TaggedRecv( int* buf, Int count, int from, int tag, Comm comm );
+template void TaggedRecv( unsigned* buf, Int count, int from, int tag, Comm comm );
+template void TaggedRecv( long int* buf, Int count, int from, int tag, Comm comm );
+template void TaggedRecv( unsigned long* buf, Int count, int from, int tag, Comm comm );
 #ifdef EL_HAVE_MPI_LONG_LONG
-template void TaggedRecv( long long int* buf, int count, int from, int tag, Comm comm );
-template void TaggedRecv( unsigned long long* buf, int count, int from, int tag, Comm comm );
+template void TaggedRecv( long long int* buf, Int count, int from, int tag, Comm comm );
+template void TaggedRecv( unsigned long long* buf, Int count, int from, int tag, Comm comm );
 #endif
-template void TaggedRecv( float* buf, int count, int from, int tag, Comm comm );
-template void TaggedRecv( double* buf, int count, int from, int tag, Comm comm );
-template void TaggedRecv( Complex<float>* buf, int count, int from, int tag, Comm comm );
-template void TaggedRecv( Complex<double>* buf, int count, int from, int tag, Comm comm );
+template void TaggedRecv( float* buf, Int count, int from, int tag, Comm comm );
+template void TaggedRecv( double* buf, Int count, int from, int tag, Comm comm );
+template void TaggedRecv( Complex<float>* buf, Int count, int from, int tag, Comm comm );
+template void TaggedRecv( Complex<double>* buf, Int count, int from, int tag, Comm comm );
 
 template<typename T>
-void Recv( T* buf, int count, int from, Comm comm )
+void Recv( T* buf, Int count, int from, Comm comm )
 { TaggedRecv( buf, count, from, mpi::ANY_TAG, comm ); }
 
-template void Recv( byte* buf, int count, int from, Comm comm );
-template void Recv( int* buf, int count, int from, Comm comm );
-template void Recv( unsigned* buf, int count, int from, Comm comm );
-template void Recv( long int* buf, int count, int from, Comm comm );
-template void Recv( unsigned long* buf, int count, int from, Comm comm );
+template void Recv( byte* buf, Int count, int from, Comm comm );
+template void Recv( int* buf, Int count, int from, Comm comm );
+template void Recv( unsigned* buf, Int count, int from, Comm comm );
+template void Recv( long int* buf, Int count, int from, Comm comm );
+template void Recv( unsigned long* buf, Int count, int from, Comm comm );
 #ifdef EL_HAVE_MPI_LONG_LONG
-template void Recv( long long int* buf, int count, int from, Comm comm );
-template void Recv( unsigned long long* buf, int count, int from, Comm comm );
+template void Recv( long long int* buf, Int count, int from, Comm comm );
+template void Recv( unsigned long long* buf, Int count, int from, Comm comm );
 #endif
-template void Recv( float* buf, int count, int from, Comm comm );
-template void Recv( double* buf, int count, int from, Comm comm );
-template void Recv( Complex<float>* buf, int count, int from, Comm comm );
-template void Recv( Complex<double>* buf, int count, int from, Comm comm );
+template void Recv( float* buf, Int count, int from, Comm comm );
+template void Recv( double* buf, Int count, int from, Comm comm );
+template void Recv( Complex<float>* buf, Int count, int from, Comm comm );
+template void Recv( Complex<double>* buf, Int count, int from, Comm comm );
 
 template<typename T>
 T TaggedRecv( int from, int tag, Comm comm )
@@ -816,59 +1671,62 @@ template Complex<double> Recv( int from, Comm comm );
 
 template<typename R>
 void TaggedIRecv
-( R* buf, int count, int from, int tag, Comm comm, Request& request )
+( R* buf, Int count, int from, int tag, Comm comm, Request& request )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::IRecv"))
+    MessageType msg( count, TypeMap<R>() );
     SafeMpi
-    ( MPI_Irecv( buf, count, TypeMap<R>(), from, tag, comm.comm, &request ) );
+    ( MPI_Irecv( buf, msg.count, msg.type, from, tag, comm.comm, &request ) );
 }
 
 template<typename R>
 void TaggedIRecv
-( Complex<R>* buf, int count, int from, int tag, Comm comm, Request& request )
+( Complex<R>* buf, Int count, int from, int tag, Comm comm, Request& request )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::IRecv"))
 #ifdef EL_AVOID_COMPLEX_MPI
+    MessageType msg( 2*count, TypeMap<R>() );
     SafeMpi
-    ( MPI_Irecv( buf, 2*count, TypeMap<R>(), from, tag, comm.comm, &request ) );
+    ( MPI_Irecv( buf, msg.count, msg.type, from, tag, comm.comm, &request ) );
 #else
+    MessageType msg( count, TypeMap<Complex<R>>() );
     SafeMpi
     ( MPI_Irecv
-      ( buf, count, TypeMap<Complex<R>>(), from, tag, comm.comm, &request ) );
+      ( buf, msg.count, msg.type, from, tag, comm.comm, &request ) );
 #endif
 }
 
-template void TaggedIRecv( byte* buf, int count, int from, int tag, Comm comm, Request& request );
-template void TaggedIRecv( int* buf, int count, int from, int tag, Comm comm, Request& request );
-template void TaggedIRecv( unsigned* buf, int count, int from, int tag, Comm comm, Request& request );
-template void TaggedIRecv( long int* buf, int count, int from, int tag, Comm comm, Request& request );
-template void TaggedIRecv( unsigned long* buf, int count, int from, int tag, Comm comm, Request& request );
+template void TaggedIRecv( byte* buf, Int count, int from, int tag, Comm comm, Request& request );
+template void TaggedIRecv( int* buf, Int count, int from, int tag, Comm comm, Request& request );
+template void TaggedIRecv( unsigned* buf, Int count, int from, int tag, Comm comm, Request& request );
+template void TaggedIRecv( long int* buf, Int count, int from, int tag, Comm comm, Request& request );
+template void TaggedIRecv( unsigned long* buf, Int count, int from, int tag, Comm comm, Request& request );
 #ifdef EL_HAVE_MPI_LONG_LONG
-template void TaggedIRecv( long long int* buf, int count, int from, int tag, Comm comm, Request& request );
-template void TaggedIRecv( unsigned long long* buf, int count, int from, int tag, Comm comm, Request& request );
+template void TaggedIRecv( long long int* buf, Int count, int from, int tag, Comm comm, Request& request );
+template void TaggedIRecv( unsigned long long* buf, Int count, int from, int tag, Comm comm, Request& request );
 #endif
-template void TaggedIRecv( float* buf, int count, int from, int tag, Comm comm, Request& request );
-template void TaggedIRecv( double* buf, int count, int from, int tag, Comm comm, Request& request );
-template void TaggedIRecv( Complex<float>* buf, int count, int from, int tag, Comm comm, Request& request );
-template void TaggedIRecv( Complex<double>* buf, int count, int from, int tag, Comm comm, Request& request );
+template void TaggedIRecv( float* buf, Int count, int from, int tag, Comm comm, Request& request );
+template void TaggedIRecv( double* buf, Int count, int from, int tag, Comm comm, Request& request );
+template void TaggedIRecv( Complex<float>* buf, Int count, int from, int tag, Comm comm, Request& request );
+template void TaggedIRecv( Complex<double>* buf, Int count, int from, int tag, Comm comm, Request& request );
 
 template<typename T>
-void IRecv( T* buf, int count, int from, Comm comm, Request& request )
+void IRecv( T* buf, Int count, int from, Comm comm, Request& request )
 { TaggedIRecv( buf, count, from, mpi::ANY_TAG, comm, request ); }
 
-template void IRecv( byte* buf, int count, int from, Comm comm, Request& request );
-template void IRecv( int* buf, int count, int from, Comm comm, Request& request );
-template void IRecv( unsigned* buf, int count, int from, Comm comm, Request& request );
-template void IRecv( long int* buf, int count, int from, Comm comm, Request& request );
-template void IRecv( unsigned long* buf, int count, int from, Comm comm, Request& request );
+template void IRecv( byte* buf, Int count, int from, Comm comm, Request& request );
+template void IRecv( int* buf, Int count, int from, Comm comm, Request& request );
+template void IRecv( unsigned* buf, Int count, int from, Comm comm, Request& request );
+template void IRecv( long int* buf, Int count, int from, Comm comm, Request& request );
+template void IRecv( unsigned long* buf, Int count, int from, Comm comm, Request& request );
 #ifdef EL_HAVE_MPI_LONG_LONG
-template void IRecv( long long int* buf, int count, int from, Comm comm, Request& request );
-template void IRecv( unsigned long long* buf, int count, int from, Comm comm, Request& request );
+template void IRecv( long long int* buf, Int count, int from, Comm comm, Request& request );
+template void IRecv( unsigned long long* buf, Int count, int from, Comm comm, Request& request );
 #endif
-template void IRecv( float* buf, int count, int from, Comm comm, Request& request );
-template void IRecv( double* buf, int count, int from, Comm comm, Request& request );
-template void IRecv( Complex<float>* buf, int count, int from, Comm comm, Request& request );
-template void IRecv( Complex<double>* buf, int count, int from, Comm comm, Request& request );
+template void IRecv( float* buf, Int count, int from, Comm comm, Request& request );
+template void IRecv( double* buf, Int count, int from, Comm comm, Request& request );
+template void IRecv( Complex<float>* buf, Int count, int from, Comm comm, Request& request );
+template void IRecv( Complex<double>* buf, Int count, int from, Comm comm, Request& request );
 
 template<typename T>
 T TaggedIRecv( int from, int tag, Comm comm, Request& request )
@@ -908,118 +1766,124 @@ template Complex<double> IRecv( int from, Comm comm, Request& request );
 
 template<typename R>
 void TaggedSendRecv
-( const R* sbuf, int sc, int to,   int stag,
-        R* rbuf, int rc, int from, int rtag, Comm comm )
+( const R* sbuf, Int sc, int to,   int stag,
+        R* rbuf, Int rc, int from, int rtag, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::SendRecv"))
     Status status;
+    MessageType send( sc, TypeMap<R>() );
+    MessageType recv( rc, TypeMap<R>() );
     SafeMpi
     ( MPI_Sendrecv
-      ( const_cast<R*>(sbuf), sc, TypeMap<R>(), to,   stag,
-        rbuf,                 rc, TypeMap<R>(), from, rtag, 
+      ( const_cast<R*>(sbuf), send.count, send.type, to,   stag,
+        rbuf,                 recv.count, recv.type, from, rtag, 
         comm.comm, &status ) );
 }
 
 template<typename R>
 void TaggedSendRecv
-( const Complex<R>* sbuf, int sc, int to,   int stag,
-        Complex<R>* rbuf, int rc, int from, int rtag, Comm comm )
+( const Complex<R>* sbuf, Int sc, int to,   int stag,
+        Complex<R>* rbuf, Int rc, int from, int rtag, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::SendRecv"))
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
+    MessageType send( 2*sc, TypeMap<R>() );
+    MessageType recv( 2*rc, TypeMap<R>() );
     SafeMpi
     ( MPI_Sendrecv
-      ( const_cast<Complex<R>*>(sbuf), 2*sc, TypeMap<R>(), to,   stag,
-        rbuf,                          2*rc, TypeMap<R>(), from, rtag, 
+      ( const_cast<Complex<R>*>(sbuf), send.count, send.type, to,   stag,
+        rbuf,                          recv.count, recv.type, from, rtag, 
         comm.comm, &status ) );
 #else
+    MessageType send( sc, TypeMap<Complex<R>>() );
+    MessageType recv( rc, TypeMap<Complex<R>>() );
     SafeMpi
     ( MPI_Sendrecv
       ( const_cast<Complex<R>*>(sbuf), 
-        sc, TypeMap<Complex<R>>(), to,   stag,
+        send.count, send.type, to,   stag,
         rbuf,                          
-        rc, TypeMap<Complex<R>>(), from, rtag, comm.comm, &status ) );
+        recv.count, recv.type, from, rtag, comm.comm, &status ) );
 #endif
 }
 
 template void TaggedSendRecv
-( const byte* sbuf, int sc, int to, int stag, 
-        byte* rbuf, int rc, int from, int rtag, Comm comm );
+( const byte* sbuf, Int sc, int to, int stag, 
+        byte* rbuf, Int rc, int from, int rtag, Comm comm );
 template void TaggedSendRecv
-( const int* sbuf, int sc, int to, int stag, 
-        int* rbuf, int rc, int from, int rtag, Comm comm );
+( const int* sbuf, Int sc, int to, int stag, 
+        int* rbuf, Int rc, int from, int rtag, Comm comm );
 template void TaggedSendRecv
-( const unsigned* sbuf, int sc, int to, int stag, 
-        unsigned* rbuf, int rc, int from, int rtag, Comm comm );
+( const unsigned* sbuf, Int sc, int to, int stag, 
+        unsigned* rbuf, Int rc, int from, int rtag, Comm comm );
 template void TaggedSendRecv
-( const long int* sbuf, int sc, int to, int stag, 
-        long int* rbuf, int rc, int from, int rtag, Comm comm );
+( const long int* sbuf, Int sc, int to, int stag, 
+        long int* rbuf, Int rc, int from, int rtag, Comm comm );
 template void TaggedSendRecv
-( const unsigned long* sbuf, int sc, int to, int stag, 
-        unsigned long* rbuf, int rc, int from, int rtag, Comm comm );
+( const unsigned long* sbuf, Int sc, int to, int stag, 
+        unsigned long* rbuf, Int rc, int from, int rtag, Comm comm );
 #ifdef EL_HAVE_MPI_LONG_LONG
 template void TaggedSendRecv
-( const long long int* sbuf, int sc, int to, int stag, 
-        long long int* rbuf, int rc, int from, int rtag, Comm comm );
+( const long long int* sbuf, Int sc, int to, int stag, 
+        long long int* rbuf, Int rc, int from, int rtag, Comm comm );
 template void TaggedSendRecv
-( const unsigned long long* sbuf, int sc, int to, int stag, 
-        unsigned long long* rbuf, int rc, int from, int rtag, Comm comm );
+( const unsigned long long* sbuf, Int sc, int to, int stag, 
+        unsigned long long* rbuf, Int rc, int from, int rtag, Comm comm );
 #endif
 template void TaggedSendRecv
-( const float* sbuf, int sc, int to, int stag, 
-        float* rbuf, int rc, int from, int rtag, Comm comm );
+( const float* sbuf, Int sc, int to, int stag, 
+        float* rbuf, Int rc, int from, int rtag, Comm comm );
 template void TaggedSendRecv
-( const double* sbuf, int sc, int to, int stag, 
-        double* rbuf, int rc, int from, int rtag, Comm comm );
+( const double* sbuf, Int sc, int to, int stag, 
+        double* rbuf, Int rc, int from, int rtag, Comm comm );
 template void TaggedSendRecv
-( const Complex<float>* sbuf, int sc, int to, int stag, 
-        Complex<float>* rbuf, int rc, int from, int rtag, Comm comm );
+( const Complex<float>* sbuf, Int sc, int to, int stag, 
+        Complex<float>* rbuf, Int rc, int from, int rtag, Comm comm );
 template void TaggedSendRecv
-( const Complex<double>* sbuf, int sc, int to, int stag, 
-        Complex<double>* rbuf, int rc, int from, int rtag, Comm comm );
+( const Complex<double>* sbuf, Int sc, int to, int stag, 
+        Complex<double>* rbuf, Int rc, int from, int rtag, Comm comm );
 
 template<typename T>
 void SendRecv
-( const T* sbuf, int sc, int to, 
-        T* rbuf, int rc, int from, Comm comm )
+( const T* sbuf, Int sc, int to, 
+        T* rbuf, Int rc, int from, Comm comm )
 { TaggedSendRecv( sbuf, sc, to, 0, rbuf, rc, from, mpi::ANY_TAG, comm ); }
 
 template void SendRecv
-( const byte* sbuf, int sc, int to, 
-        byte* rbuf, int rc, int from, Comm comm );
+( const byte* sbuf, Int sc, int to, 
+        byte* rbuf, Int rc, int from, Comm comm );
 template void SendRecv
-( const int* sbuf, int sc, int to, 
-        int* rbuf, int rc, int from, Comm comm );
+( const int* sbuf, Int sc, int to, 
+        int* rbuf, Int rc, int from, Comm comm );
 template void SendRecv
-( const unsigned* sbuf, int sc, int to, 
-        unsigned* rbuf, int rc, int from, Comm comm );
+( const unsigned* sbuf, Int sc, int to, 
+        unsigned* rbuf, Int rc, int from, Comm comm );
 template void SendRecv
-( const long int* sbuf, int sc, int to, 
-        long int* rbuf, int rc, int from, Comm comm );
+( const long int* sbuf, Int sc, int to, 
+        long int* rbuf, Int rc, int from, Comm comm );
 template void SendRecv
-( const unsigned long* sbuf, int sc, int to, 
-        unsigned long* rbuf, int rc, int from, Comm comm );
+( const unsigned long* sbuf, Int sc, int to, 
+        unsigned long* rbuf, Int rc, int from, Comm comm );
 #ifdef EL_HAVE_MPI_LONG_LONG
 template void SendRecv
-( const long long int* sbuf, int sc, int to, 
-        long long int* rbuf, int rc, int from, Comm comm );
+( const long long int* sbuf, Int sc, int to, 
+        long long int* rbuf, Int rc, int from, Comm comm );
 template void SendRecv
-( const unsigned long long* sbuf, int sc, int to, 
-        unsigned long long* rbuf, int rc, int from, Comm comm );
+( const unsigned long long* sbuf, Int sc, int to, 
+        unsigned long long* rbuf, Int rc, int from, Comm comm );
 #endif
 template void SendRecv
-( const float* sbuf, int sc, int to,
-        float* rbuf, int rc, int from, Comm comm );
+( const float* sbuf, Int sc, int to,
+        float* rbuf, Int rc, int from, Comm comm );
 template void SendRecv
-( const double* sbuf, int sc, int to,
-        double* rbuf, int rc, int from, Comm comm );
+( const double* sbuf, Int sc, int to,
+        double* rbuf, Int rc, int from, Comm comm );
 template void SendRecv
-( const Complex<float>* sbuf, int sc, int to, 
-        Complex<float>* rbuf, int rc, int from, Comm comm );
+( const Complex<float>* sbuf, Int sc, int to, 
+        Complex<float>* rbuf, Int rc, int from, Comm comm );
 template void SendRecv
-( const Complex<double>* sbuf, int sc, int to, 
-        Complex<double>* rbuf, int rc, int from, Comm comm );
+( const Complex<double>* sbuf, Int sc, int to, 
+        Complex<double>* rbuf, Int rc, int from, Comm comm );
 
 template<typename T>
 T TaggedSendRecv( T sb, int to, int stag, int from, int rtag, Comm comm )
@@ -1076,121 +1940,127 @@ template Complex<double> SendRecv
 
 template<typename R>
 void TaggedSendRecv
-( R* buf, int count, int to, int stag, int from, int rtag, Comm comm )
+( R* buf, Int count, int to, int stag, int from, int rtag, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::SendRecv"))
     Status status;
+    MessageType msg( count, TypeMap<R>() );
     SafeMpi
     ( MPI_Sendrecv_replace
-      ( buf, count, TypeMap<R>(), to, stag, from, rtag, comm.comm, &status ) );
+      ( buf, msg.count, msg.type, to, stag, from, rtag, comm.comm, &status ) );
 }
 
 template<typename R>
 void TaggedSendRecv
-( Complex<R>* buf, int count, int to, int stag, int from, int rtag, Comm comm )
+( Complex<R>* buf, Int count, int to, int stag, int from, int rtag, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::SendRecv"))
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
+    MessageType msg( 2*count, TypeMap<R>() );
     SafeMpi
     ( MPI_Sendrecv_replace
-      ( buf, 2*count, TypeMap<R>(), to, stag, from, rtag, comm.comm, 
+      ( buf, msg.count, msg.type, to, stag, from, rtag, comm.comm, 
         &status ) );
 #else
+    MessageType msg( count, TypeMap<Complex<R>>() );
     SafeMpi
     ( MPI_Sendrecv_replace
-      ( buf, count, TypeMap<Complex<R>>(), 
+      ( buf, msg.count, msg.type, 
         to, stag, from, rtag, comm.comm, &status ) );
 #endif
 }
 
 template void TaggedSendRecv
-( byte* buf, int count, int to, int stag, int from, int rtag, Comm comm );
+( byte* buf, Int count, int to, int stag, int from, int rtag, Comm comm );
 template void TaggedSendRecv
-( int* buf, int count, int to, int stag, int from, int rtag, Comm comm );
+( int* buf, Int count, int to, int stag, int from, int rtag, Comm comm );
 template void TaggedSendRecv
-( unsigned* buf, int count, int to, int stag, int from, int rtag, Comm comm );
+( unsigned* buf, Int count, int to, int stag, int from, int rtag, Comm comm );
 template void TaggedSendRecv
-( long int* buf, int count, int to, int stag, int from, int rtag, Comm comm );
+( long int* buf, Int count, int to, int stag, int from, int rtag, Comm comm );
 template void TaggedSendRecv
-( unsigned long* buf, int count, int to, int stag, int from, int rtag, Comm comm );
+( unsigned long* buf, Int count, int to, int stag, int from, int rtag, Comm comm );
 #ifdef EL_HAVE_MPI_LONG_LONG
 template void TaggedSendRecv
-( long long int* buf, int count, int to, int stag, int from, int rtag, Comm comm );
+( long long int* buf, Int count, int to, int stag, int from, int rtag, Comm comm );
 template void TaggedSendRecv
-( unsigned long long* buf, int count, int to, int stag, int from, int rtag, Comm comm );
+( unsigned long long* buf, Int count, int to, int stag, int from, int rtag, Comm comm );
 #endif
 template void TaggedSendRecv
-( float* buf, int count, int to, int stag, int from, int rtag, Comm comm );
+( float* buf, Int count, int to, int stag, int from, int rtag, Comm comm );
 template void TaggedSendRecv
-( double* buf, int count, int to, int stag, int from, int rtag, Comm comm );
+( double* buf, Int count, int to, int stag, int from, int rtag, Comm comm );
 template void TaggedSendRecv
-( Complex<float>* buf, int count, int to, int stag, 
+( Complex<float>* buf, Int count, int to, int stag, 
   int from, int rtag, Comm comm );
 template void TaggedSendRecv
-( Complex<double>* buf, int count, int to, int stag, 
+( Complex<double>* buf, Int count, int to, int stag, 
   int from, int rtag, Comm comm );
 
 template<typename T>
-void SendRecv( T* buf, int count, int to, int from, Comm comm )
+void SendRecv( T* buf, Int count, int to, int from, Comm comm )
 { TaggedSendRecv( buf, count, to, 0, from, mpi::ANY_TAG, comm ); }
 
 template void SendRecv
-( byte* buf, int count, int to, int from, Comm comm );
+( byte* buf, Int count, int to, int from, Comm comm );
 template void SendRecv
-( int* buf, int count, int to, int from, Comm comm );
+( int* buf, Int count, int to, int from, Comm comm );
 template void SendRecv
-( unsigned* buf, int count, int to, int from, Comm comm );
+( unsigned* buf, Int count, int to, int from, Comm comm );
 template void SendRecv
-( long int* buf, int count, int to, int from, Comm comm );
+( long int* buf, Int count, int to, int from, Comm comm );
 template void SendRecv
-( unsigned long* buf, int count, int to, int from, Comm comm );
+( unsigned long* buf, Int count, int to, int from, Comm comm );
 #ifdef EL_HAVE_MPI_LONG_LONG
 template void SendRecv
-( long long int* buf, int count, int to, int from, Comm comm );
+( long long int* buf, Int count, int to, int from, Comm comm );
 template void SendRecv
-( unsigned long long* buf, int count, int to, int from, Comm comm );
+( unsigned long long* buf, Int count, int to, int from, Comm comm );
 #endif
 template void SendRecv
-( float* buf, int count, int to, int from, Comm comm );
+( float* buf, Int count, int to, int from, Comm comm );
 template void SendRecv
-( double* buf, int count, int to, int from, Comm comm );
+( double* buf, Int count, int to, int from, Comm comm );
 template void SendRecv
-( Complex<float>* buf, int count, int to, int from, Comm comm );
+( Complex<float>* buf, Int count, int to, int from, Comm comm );
 template void SendRecv
-( Complex<double>* buf, int count, int to, int from, Comm comm );
+( Complex<double>* buf, Int count, int to, int from, Comm comm );
 
 template<typename R>
-void Broadcast( R* buf, int count, int root, Comm comm )
+void Broadcast( R* buf, Int count, int root, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Broadcast"))
-    SafeMpi( MPI_Bcast( buf, count, TypeMap<R>(), root, comm.comm ) );
+    MessageType msg( count, TypeMap<R>() );
+    SafeMpi( MPI_Bcast( buf, msg.count, msg.type, root, comm.comm ) );
 }
 
 template<typename R>
-void Broadcast( Complex<R>* buf, int count, int root, Comm comm )
+void Broadcast( Complex<R>* buf, Int count, int root, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Broadcast"))
 #ifdef EL_AVOID_COMPLEX_MPI
-    SafeMpi( MPI_Bcast( buf, 2*count, TypeMap<R>(), root, comm.comm ) );
+    MessageType msg( 2*count, TypeMap<R>() );
+    SafeMpi( MPI_Bcast( buf, msg.count, msg.type, root, comm.comm ) );
 #else
-    SafeMpi( MPI_Bcast( buf, count, TypeMap<Complex<R>>(), root, comm.comm ) );
+    MessageType msg( count, TypeMap<Complex<R>>() );
+    SafeMpi( MPI_Bcast( buf, msg.count, msg.type, root, comm.comm ) );
 #endif
 }
 
-template void Broadcast( byte* buf, int count, int root, Comm comm );
-template void Broadcast( int* buf, int count, int root, Comm comm );
-template void Broadcast( unsigned* buf, int count, int root, Comm comm );
-template void Broadcast( long int* buf, int count, int root, Comm comm );
-template void Broadcast( unsigned long* buf, int count, int root, Comm comm );
+template void Broadcast( byte* buf, Int count, int root, Comm comm );
+template void Broadcast( int* buf, Int count, int root, Comm comm );
+template void Broadcast( unsigned* buf, Int count, int root, Comm comm );
+template void Broadcast( long int* buf, Int count, int root, Comm comm );
+template void Broadcast( unsigned long* buf, Int count, int root, Comm comm );
 #ifdef EL_HAVE_MPI_LONG_LONG
-template void Broadcast( long long int* buf, int count, int root, Comm comm );
-template void Broadcast( unsigned long long* buf, int count, int root, Comm comm );
+template void Broadcast( long long int* buf, Int count, int root, Comm comm );
+template void Broadcast( unsigned long long* buf, Int count, int root, Comm comm );
 #endif
-template void Broadcast( float* buf, int count, int root, Comm comm );
-template void Broadcast( double* buf, int count, int root, Comm comm );
-template void Broadcast( Complex<float>* buf, int count, int root, Comm comm );
-template void Broadcast( Complex<double>* buf, int count, int root, Comm comm );
+template void Broadcast( float* buf, Int count, int root, Comm comm );
+template void Broadcast( double* buf, Int count, int root, Comm comm );
+template void Broadcast( Complex<float>* buf, Int count, int root, Comm comm );
+template void Broadcast( Complex<double>* buf, Int count, int root, Comm comm );
 
 template<typename T>
 void Broadcast( T& b, int root, Comm comm )
@@ -1212,41 +2082,44 @@ template void Broadcast( Complex<double>& b, int root, Comm comm );
 
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
 template<typename R>
-void IBroadcast( R* buf, int count, int root, Comm comm, Request& request )
+void IBroadcast( R* buf, Int count, int root, Comm comm, Request& request )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::IBroadcast"))
+    MessageType msg( count, TypeMap<R>() );
     SafeMpi
-    ( MPI_Ibcast( buf, count, TypeMap<R>(), root, comm.comm, &request ) );
+    ( EL_NONBLOCKING_COLL(Ibcast)( buf, msg.count, msg.type, root, comm.comm, &request ) );
 }
 
 template<typename R>
 void IBroadcast
-( Complex<R>* buf, int count, int root, Comm comm, Request& request )
+( Complex<R>* buf, Int count, int root, Comm comm, Request& request )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::IBroadcast"))
 #ifdef EL_AVOID_COMPLEX_MPI
+    MessageType msg( 2*count, TypeMap<R>() );
     SafeMpi
-    ( MPI_Ibcast( buf, 2*count, TypeMap<R>(), root, comm.comm, &request ) );
+    ( EL_NONBLOCKING_COLL(Ibcast)( buf, msg.count, msg.type, root, comm.comm, &request ) );
 #else
+    MessageType msg( count, TypeMap<Complex<R>>() );
     SafeMpi
-    ( MPI_Ibcast
-      ( buf, count, TypeMap<Complex<R>>(), root, comm.comm, &request ) );
+    ( EL_NONBLOCKING_COLL(Ibcast)
+      ( buf, msg.count, msg.type, root, comm.comm, &request ) );
 #endif
 }
 
-template void IBroadcast( byte* buf, int count, int root, Comm comm, Request& request );
-template void IBroadcast( int* buf, int count, int root, Comm comm, Request& request );
-template void IBroadcast( unsigned* buf, int count, int root, Comm comm, Request& request );
-template void IBroadcast( long int* buf, int count, int root, Comm comm, Request& request );
-template void IBroadcast( unsigned long* buf, int count, int root, Comm comm, Request& request );
+template void IBroadcast( byte* buf, Int count, int root, Comm comm, Request& request );
+template void IBroadcast( int* buf, Int count, int root, Comm comm, Request& request );
+template void IBroadcast( unsigned* buf, Int count, int root, Comm comm, Request& request );
+template void IBroadcast( long int* buf, Int count, int root, Comm comm, Request& request );
+template void IBroadcast( unsigned long* buf, Int count, int root, Comm comm, Request& request );
 #ifdef EL_HAVE_MPI_LONG_LONG
-template void IBroadcast( long long int* buf, int count, int root, Comm comm, Request& request );
-template void IBroadcast( unsigned long long* buf, int count, int root, Comm comm, Request& request );
+template void IBroadcast( long long int* buf, Int count, int root, Comm comm, Request& request );
+template void IBroadcast( unsigned long long* buf, Int count, int root, Comm comm, Request& request );
 #endif
-template void IBroadcast( float* buf, int count, int root, Comm comm, Request& request );
-template void IBroadcast( double* buf, int count, int root, Comm comm, Request& request );
-template void IBroadcast( Complex<float>* buf, int count, int root, Comm comm, Request& request );
-template void IBroadcast( Complex<double>* buf, int count, int root, Comm comm, Request& request );
+template void IBroadcast( float* buf, Int count, int root, Comm comm, Request& request );
+template void IBroadcast( double* buf, Int count, int root, Comm comm, Request& request );
+template void IBroadcast( Complex<float>* buf, Int count, int root, Comm comm, Request& request );
+template void IBroadcast( Complex<double>* buf, Int count, int root, Comm comm, Request& request );
 
 template<typename T>
 void IBroadcast( T& b, int root, Comm comm, Request& request )
@@ -1269,496 +2142,517 @@ template void IBroadcast( Complex<double>& b, int root, Comm comm, Request& requ
 
 template<typename R>
 void Gather
-( const R* sbuf, int sc,
-        R* rbuf, int rc, int root, Comm comm )
+( const R* sbuf, Int sc,
+        R* rbuf, Int rc, int root, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Gather"))
+    MessageType send( sc, TypeMap<R>() );
+    MessageType recv( rc, TypeMap<R>() );
     SafeMpi
     ( MPI_Gather
-      ( const_cast<R*>(sbuf), sc, TypeMap<R>(),
-        rbuf,                 rc, TypeMap<R>(), root, comm.comm ) );
+      ( const_cast<R*>(sbuf), send.count, send.type,
+        rbuf,                 recv.count, recv.type, root, comm.comm ) );
 }
 
 template<typename R>
 void Gather
-( const Complex<R>* sbuf, int sc,
-        Complex<R>* rbuf, int rc, int root, Comm comm )
+( const Complex<R>* sbuf, Int sc,
+        Complex<R>* rbuf, Int rc, int root, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Gather"))
 #ifdef EL_AVOID_COMPLEX_MPI
+    MessageType send( 2*sc, TypeMap<R>() );
+    MessageType recv( 2*rc, TypeMap<R>() );
     SafeMpi
     ( MPI_Gather
-      ( const_cast<Complex<R>*>(sbuf), 2*sc, TypeMap<R>(),
-        rbuf,                          2*rc, TypeMap<R>(), root, comm.comm ) );
+      ( const_cast<Complex<R>*>(sbuf), send.count, send.type,
+        rbuf,                          recv.count, recv.type,
+        root, comm.comm ) );
 #else
+    MessageType send( sc, TypeMap<Complex<R>>() );
+    MessageType recv( rc, TypeMap<Complex<R>>() );
     SafeMpi
     ( MPI_Gather
-      ( const_cast<Complex<R>*>(sbuf), sc, TypeMap<Complex<R>>(),
-        rbuf,                          rc, TypeMap<Complex<R>>(), 
+      ( const_cast<Complex<R>*>(sbuf), send.count, send.type,
+        rbuf,                          recv.count, recv.type, 
         root, comm.comm ) );
 #endif
 }
 
-template void Gather( const byte* sbuf, int sc, byte* rbuf, int rc, int root, Comm comm );
-template void Gather( const int* sbuf, int sc, int* rbuf, int rc, int root, Comm comm );
-template void Gather( const unsigned* sbuf, int sc, unsigned* rbuf, int rc, int root, Comm comm );
-template void Gather( const long int* sbuf, int sc, long int* rbuf, int rc, int root, Comm comm );
-template void Gather( const unsigned long* sbuf, int sc, unsigned long* rbuf, int rc, int root, Comm comm );
+template void Gather( const byte* sbuf, Int sc, byte* rbuf, Int rc, int root, Comm comm );
+template void Gather( const int* sbuf, Int sc, int* rbuf, Int rc, int root, Comm comm );
+template void Gather( const unsigned* sbuf, Int sc, unsigned* rbuf, Int rc, int root, Comm comm );
+template void Gather( const long int* sbuf, Int sc, long int* rbuf, Int rc, int root, Comm comm );
+template void Gather( const unsigned long* sbuf, Int sc, unsigned long* rbuf, Int rc, int root, Comm comm );
 #ifdef EL_HAVE_MPI_LONG_LONG
-template void Gather( const long long int* sbuf, int sc, long long int* rbuf, int rc, int root, Comm comm );
-template void Gather( const unsigned long long* sbuf, int sc, unsigned long long* rbuf, int rc, int root, Comm comm );
+template void Gather( const long long int* sbuf, Int sc, long long int* rbuf, Int rc, int root, Comm comm );
+template void Gather( const unsigned long long* sbuf, Int sc, unsigned long long* rbuf, Int rc, int root, Comm comm );
 #endif
-template void Gather( const float* sbuf, int sc, float* rbuf, int rc, int root, Comm comm );
-template void Gather( const double* sbuf, int sc, double* rbuf, int rc, int root, Comm comm );
-template void Gather( const Complex<float>* sbuf, int sc, Complex<float>* rbuf, int rc, int root, Comm comm );
-template void Gather( const Complex<double>* sbuf, int sc, Complex<double>* rbuf, int rc, int root, Comm comm );
+template void Gather( const float* sbuf, Int sc, float* rbuf, Int rc, int root, Comm comm );
+template void Gather( const double* sbuf, Int sc, double* rbuf, Int rc, int root, Comm comm );
+template void Gather( const Complex<float>* sbuf, Int sc, Complex<float>* rbuf, Int rc, int root, Comm comm );
+template void Gather( const Complex<double>* sbuf, Int sc, Complex<double>* rbuf, Int rc, int root, Comm comm );
 
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
 template<typename R>
 void IGather
-( const R* sbuf, int sc,
-        R* rbuf, int rc, int root, Comm comm, Request& request )
+( const R* sbuf, Int sc,
+        R* rbuf, Int rc, int root, Comm comm, Request& request )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::IGather"))
+    MessageType send( sc, TypeMap<R>() );
+    MessageType recv( rc, TypeMap<R>() );
     SafeMpi
-    ( MPI_Igather
-      ( const_cast<R*>(sbuf), sc, TypeMap<R>(),
-        rbuf,                 rc, TypeMap<R>(), root, comm.comm, &request ) );
+    ( EL_NONBLOCKING_COLL(Igather)
+      ( const_cast<R*>(sbuf), send.count, send.type,
+        rbuf,                 recv.count, recv.type,
+        root, comm.comm, &request ) );
 }
 
 template<typename R>
 void IGather
-( const Complex<R>* sbuf, int sc,
-        Complex<R>* rbuf, int rc, int root, Comm comm, Request& request )
+( const Complex<R>* sbuf, Int sc,
+        Complex<R>* rbuf, Int rc, int root, Comm comm, Request& request )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::IGather"))
 #ifdef EL_AVOID_COMPLEX_MPI
+    MessageType send( 2*sc, TypeMap<R>() );
+    MessageType recv( 2*rc, TypeMap<R>() );
     SafeMpi
-    ( MPI_Igather
-      ( const_cast<Complex<R>*>(sbuf), 2*sc, TypeMap<R>(),
-        rbuf,                          2*rc, TypeMap<R>(), 
+    ( EL_NONBLOCKING_COLL(Igather)
+      ( const_cast<Complex<R>*>(sbuf), send.count, send.type,
+        rbuf,                          recv.count, recv.type, 
         root, comm.comm, &request ) );
 #else
+    MessageType send( sc, TypeMap<Complex<R>>() );
+    MessageType recv( rc, TypeMap<Complex<R>>() );
     SafeMpi
-    ( MPI_Igather
-      ( const_cast<Complex<R>*>(sbuf), sc, TypeMap<Complex<R>>(),
-        rbuf,                          rc, TypeMap<Complex<R>>(), 
+    ( EL_NONBLOCKING_COLL(Igather)
+      ( const_cast<Complex<R>*>(sbuf), send.count, send.type,
+        rbuf,                          recv.count, recv.type, 
         root, comm.comm, &request ) );
 #endif
 }
 
 template void IGather
-( const byte* sbuf, int sc, 
-        byte* rbuf, int rc, int root, Comm comm, Request& request );
+( const byte* sbuf, Int sc, 
+        byte* rbuf, Int rc, int root, Comm comm, Request& request );
 template void IGather
-( const int* sbuf, int sc, 
-        int* rbuf, int rc, int root, Comm comm, Request& request );
+( const int* sbuf, Int sc, 
+        int* rbuf, Int rc, int root, Comm comm, Request& request );
 template void IGather
-( const unsigned* sbuf, int sc, 
-        unsigned* rbuf, int rc, int root, Comm comm, Request& request );
+( const unsigned* sbuf, Int sc, 
+        unsigned* rbuf, Int rc, int root, Comm comm, Request& request );
 template void IGather
-( const long int* sbuf, int sc, 
-        long int* rbuf, int rc, int root, Comm comm, Request& request );
+( const long int* sbuf, Int sc, 
+        long int* rbuf, Int rc, int root, Comm comm, Request& request );
 template void IGather
-( const unsigned long* sbuf, int sc, 
-        unsigned long* rbuf, int rc, int root, Comm comm, Request& request );
+( const unsigned long* sbuf, Int sc, 
+        unsigned long* rbuf, Int rc, int root, Comm comm, Request& request );
 #ifdef EL_HAVE_MPI_LONG_LONG
 template void IGather
-( const long long int* sbuf, int sc,
-        long long int* rbuf, int rc, int root, Comm comm, Request& request );
+( const long long int* sbuf, Int sc,
+        long long int* rbuf, Int rc, int root, Comm comm, Request& request );
 template void IGather
-( const unsigned long long* sbuf, int sc,
-        unsigned long long* rbuf, int rc, int root, Comm comm, Request& request );
+( const unsigned long long* sbuf, Int sc,
+        unsigned long long* rbuf, Int rc, int root, Comm comm, Request& request );
 #endif
 template void IGather
-( const float* sbuf, int sc, 
-        float* rbuf, int rc, int root, Comm comm, Request& request );
+( const float* sbuf, Int sc, 
+        float* rbuf, Int rc, int root, Comm comm, Request& request );
 template void IGather
-( const double* sbuf, int sc, 
-        double* rbuf, int rc, int root, Comm comm, Request& request );
+( const double* sbuf, Int sc, 
+        double* rbuf, Int rc, int root, Comm comm, Request& request );
 template void IGather
-( const Complex<float>* sbuf, int sc, 
-        Complex<float>* rbuf, int rc, int root, Comm comm, Request& request );
+( const Complex<float>* sbuf, Int sc, 
+        Complex<float>* rbuf, Int rc, int root, Comm comm, Request& request );
 template void IGather
-( const Complex<double>* sbuf, int sc, 
-        Complex<double>* rbuf, int rc, int root, Comm comm, Request& request );
+( const Complex<double>* sbuf, Int sc, 
+        Complex<double>* rbuf, Int rc, int root, Comm comm, Request& request );
 #endif // ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
 
 template<typename R>
 void Gather
-( const R* sbuf, int sc,
-        R* rbuf, const int* rcs, const int* rds, int root, Comm comm )
+( const R* sbuf, Int sc,
+        R* rbuf, const Int* rcs, const Int* rds, int root, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Gather"))
-    SafeMpi
-    ( MPI_Gatherv
-      ( const_cast<R*>(sbuf), 
-        sc,       
-        TypeMap<R>(),
-        rbuf,                    
-        const_cast<int*>(rcs), 
-        const_cast<int*>(rds), 
-        TypeMap<R>(),
-        root, 
-        comm.comm ) );
+    GatherV( sbuf, sc, rbuf, rcs, rds, root, 1, TypeMap<R>(), comm );
 }
 
 template<typename R>
 void Gather
-( const Complex<R>* sbuf, int sc,
-        Complex<R>* rbuf, const int* rcs, const int* rds, int root, Comm comm )
+( const Complex<R>* sbuf, Int sc,
+        Complex<R>* rbuf, const Int* rcs, const Int* rds, int root, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Gather"))
 #ifdef EL_AVOID_COMPLEX_MPI
-    const int commRank = Rank( comm );
-    const int commSize = Size( comm );
-    std::vector<int> rcsDouble, rdsDouble;
-    if( commRank == root )
-    {
-        rcsDouble.resize( commSize );
-        rdsDouble.resize( commSize );
-        for( int i=0; i<commSize; ++i )
-        {
-            rcsDouble[i] = 2*rcs[i];
-            rdsDouble[i] = 2*rds[i];
-        }
-    }
-    SafeMpi
-    ( MPI_Gatherv
-      ( const_cast<Complex<R>*>(sbuf), 2*sc, TypeMap<R>(),
-        rbuf, rcsDouble.data(), rdsDouble.data(), TypeMap<R>(),
-        root, comm.comm ) );
+    GatherV( sbuf, sc, rbuf, rcs, rds, root, 2, TypeMap<R>(), comm );
 #else
-    SafeMpi
-    ( MPI_Gatherv
-      ( const_cast<Complex<R>*>(sbuf), 
-        sc,       
-        TypeMap<Complex<R>>(),
-        rbuf,  
-        const_cast<int*>(rcs), 
-        const_cast<int*>(rds), 
-        TypeMap<Complex<R>>(),
-        root, 
-        comm.comm ) );
+    GatherV( sbuf, sc, rbuf, rcs, rds, root, 1, TypeMap<Complex<R>>(), comm );
 #endif
 }
 
 template void Gather
-( const byte* sbuf, int sc, 
-        byte* rbuf, const int* rcs, const int* rds, int root, Comm comm );
+( const byte* sbuf, Int sc, 
+        byte* rbuf, const Int* rcs, const Int* rds, int root, Comm comm );
 template void Gather
-( const int* sbuf, int sc, 
-        int* rbuf, const int* rcs, const int* rds, int root, Comm comm );
+( const int* sbuf, Int sc, 
+        int* rbuf, const Int* rcs, const Int* rds, int root, Comm comm );
 template void Gather
-( const unsigned* sbuf, int sc, 
-        unsigned* rbuf, const int* rcs, const int* rds, int root, Comm comm );
+( const unsigned* sbuf, Int sc, 
+        unsigned* rbuf, const Int* rcs, const Int* rds, int root, Comm comm );
 template void Gather
-( const long int* sbuf, int sc, 
-        long int* rbuf, const int* rcs, const int* rds, int root, Comm comm );
+( const long int* sbuf, Int sc, 
+        long int* rbuf, const Int* rcs, const Int* rds, int root, Comm comm );
 template void Gather
-( const unsigned long* sbuf, int sc, 
-        unsigned long* rbuf, const int* rcs, const int* rds, int root, Comm comm );
+( const unsigned long* sbuf, Int sc, 
+        unsigned long* rbuf, const Int* rcs, const Int* rds, int root, Comm comm );
 #ifdef EL_HAVE_MPI_LONG_LONG
 template void Gather
-( const long long int* sbuf, int sc, 
-        long long int* rbuf, const int* rcs, const int* rds, int root, Comm comm );
+( const long long int* sbuf, Int sc, 
+        long long int* rbuf, const Int* rcs, const Int* rds, int root, Comm comm );
 template void Gather
-( const unsigned long long* sbuf, int sc, 
-        unsigned long long* rbuf, const int* rcs, const int* rds, int root, Comm comm );
+( const unsigned long long* sbuf, Int sc, 
+        unsigned long long* rbuf, const Int* rcs, const Int* rds, int root, Comm comm );
 #endif
 template void Gather
-( const float* sbuf, int sc, 
-        float* rbuf, const int* rcs, const int* rds, int root, Comm comm );
+( const float* sbuf, Int sc, 
+        float* rbuf, const Int* rcs, const Int* rds, int root, Comm comm );
 template void Gather
-( const double* sbuf, int sc, 
-        double* rbuf, const int* rcs, const int* rds, int root, Comm comm );
+( const double* sbuf, Int sc, 
+        double* rbuf, const Int* rcs, const Int* rds, int root, Comm comm );
 template void Gather
-( const Complex<float>* sbuf, int sc, 
-        Complex<float>* rbuf, const int* rcs, const int* rds, 
+( const Complex<float>* sbuf, Int sc, 
+        Complex<float>* rbuf, const Int* rcs, const Int* rds, 
   int root, Comm comm );
 template void Gather
-( const Complex<double>* sbuf, int sc, 
-        Complex<double>* rbuf, const int* rcs, const int* rds, 
+( const Complex<double>* sbuf, Int sc, 
+        Complex<double>* rbuf, const Int* rcs, const Int* rds, 
   int root, Comm comm );
 
 template<typename R>
 void AllGather
-( const R* sbuf, int sc,
-        R* rbuf, int rc, Comm comm )
+( const R* sbuf, Int sc,
+        R* rbuf, Int rc, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::AllGather"))
 #ifdef EL_USE_BYTE_ALLGATHERS
+    MessageType send( sizeof(R)*sc, MPI_UNSIGNED_CHAR );
+    MessageType recv( sizeof(R)*rc, MPI_UNSIGNED_CHAR );
     SafeMpi
     ( MPI_Allgather
-      ( (UCP)const_cast<R*>(sbuf), sizeof(R)*sc, MPI_UNSIGNED_CHAR, 
-        (UCP)rbuf,                 sizeof(R)*rc, MPI_UNSIGNED_CHAR, 
+      ( (UCP)const_cast<R*>(sbuf), send.count, send.type, 
+        (UCP)rbuf,                 recv.count, recv.type, 
         comm.comm ) );
 #else
+    MessageType send( sc, TypeMap<R>() );
+    MessageType recv( rc, TypeMap<R>() );
     SafeMpi
     ( MPI_Allgather
-      ( const_cast<R*>(sbuf), sc, TypeMap<R>(), 
-        rbuf,                 rc, TypeMap<R>(), comm.comm ) );
+      ( const_cast<R*>(sbuf), send.count, send.type, 
+        rbuf,                 recv.count, recv.type, comm.comm ) );
 #endif
 }
 
 template<typename R>
 void AllGather
-( const Complex<R>* sbuf, int sc,
-        Complex<R>* rbuf, int rc, Comm comm )
+( const Complex<R>* sbuf, Int sc,
+        Complex<R>* rbuf, Int rc, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::AllGather"))
 #ifdef EL_USE_BYTE_ALLGATHERS
+    MessageType send( 2*sizeof(R)*sc, MPI_UNSIGNED_CHAR );
+    MessageType recv( 2*sizeof(R)*rc, MPI_UNSIGNED_CHAR );
     SafeMpi
     ( MPI_Allgather
-      ( (UCP)const_cast<Complex<R>*>(sbuf), 2*sizeof(R)*sc, MPI_UNSIGNED_CHAR, 
-        (UCP)rbuf,                          2*sizeof(R)*rc, MPI_UNSIGNED_CHAR, 
+      ( (UCP)const_cast<Complex<R>*>(sbuf), send.count, send.type, 
+        (UCP)rbuf,                          recv.count, recv.type, 
         comm.comm ) );
 #else
  #ifdef EL_AVOID_COMPLEX_MPI
+    MessageType send( 2*sc, TypeMap<R>() );
+    MessageType recv( 2*rc, TypeMap<R>() );
     SafeMpi
     ( MPI_Allgather
-      ( const_cast<Complex<R>*>(sbuf), 2*sc, TypeMap<R>(),
-        rbuf,                          2*rc, TypeMap<R>(), comm.comm ) );
+      ( const_cast<Complex<R>*>(sbuf), send.count, send.type,
+        rbuf,                          recv.count, recv.type, comm.comm ) );
  #else
+    MessageType send( sc, TypeMap<Complex<R>>() );
+    MessageType recv( rc, TypeMap<Complex<R>>() );
     SafeMpi
     ( MPI_Allgather
-      ( const_cast<Complex<R>*>(sbuf), sc, TypeMap<Complex<R>>(),
-        rbuf,                          rc, TypeMap<Complex<R>>(), comm.comm ) );
+      ( const_cast<Complex<R>*>(sbuf), send.count, send.type,
+        rbuf,                          recv.count, recv.type, comm.comm ) );
  #endif
 #endif
 }
 
-template void AllGather( const byte* sbuf, int sc, byte* rbuf, int rc, Comm comm );
-template void AllGather( const int* sbuf, int sc, int* rbuf, int rc, Comm comm );
-template void AllGather( const unsigned* sbuf, int sc, unsigned* rbuf, int rc, Comm comm );
-template void AllGather( const long int* sbuf, int sc, long int* rbuf, int rc, Comm comm );
-template void AllGather( const unsigned long* sbuf, int sc, unsigned long* rbuf, int rc, Comm comm );
+template void AllGather( const byte* sbuf, Int sc, byte* rbuf, Int rc, Comm comm );
+template void AllGather( const int* sbuf, Int sc, int* rbuf, Int rc, Comm comm );
+template void AllGather( const unsigned* sbuf, Int sc, unsigned* rbuf, Int rc, Comm comm );
+template void AllGather( const long int* sbuf, Int sc, long int* rbuf, Int rc, Comm comm );
+template void AllGather( const unsigned long* sbuf, Int sc, unsigned long* rbuf, Int rc, Comm comm );
 #ifdef EL_HAVE_MPI_LONG_LONG
-template void AllGather( const long long int* sbuf, int sc, long long int* rbuf, int rc, Comm comm );
-template void AllGather( const unsigned long long* sbuf, int sc, unsigned long long* rbuf, int rc, Comm comm );
+template void AllGather( const long long int* sbuf, Int sc, long long int* rbuf, Int rc, Comm comm );
+template void AllGather( const unsigned long long* sbuf, Int sc, unsigned long long* rbuf, Int rc, Comm comm );
 #endif
-template void AllGather( const float* sbuf, int sc, float* rbuf, int rc, Comm comm );
-template void AllGather( const double* sbuf, int sc, double* rbuf, int rc, Comm comm );
-template void AllGather( const Complex<float>* sbuf, int sc, Complex<float>* rbuf, int rc, Comm comm );
-template void AllGather( const Complex<double>* sbuf, int sc, Complex<double>* rbuf, int rc, Comm comm );
+template void AllGather( const float* sbuf, Int sc, float* rbuf, Int rc, Comm comm );
+template void AllGather( const double* sbuf, Int sc, double* rbuf, Int rc, Comm comm );
+template void AllGather( const Complex<float>* sbuf, Int sc, Complex<float>* rbuf, Int rc, Comm comm );
+template void AllGather( const Complex<double>* sbuf, Int sc, Complex<double>* rbuf, Int rc, Comm comm );
 
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
 template<typename R>
-void AllGather
-( const R* sbuf, int sc,
-        R* rbuf, const int* rcs, const int* rds, Comm comm )
+void IAllGather
+( const R* sbuf, Int sc,
+        R* rbuf, Int rc, Comm comm, Request& request )
 {
-    DEBUG_ONLY(CallStackEntry cse("mpi::AllGather"))
+    DEBUG_ONLY(CallStackEntry cse("mpi::IAllGather"))
 #ifdef EL_USE_BYTE_ALLGATHERS
-    const int commSize = Size( comm );
-    std::vector<int> byteRcs( commSize ), byteRds( commSize );
-    for( int i=0; i<commSize; ++i )
-    {
-        byteRcs[i] = sizeof(R)*rcs[i];
-        byteRds[i] = sizeof(R)*rds[i];
-    }
+    MessageType send( sizeof(R)*sc, MPI_UNSIGNED_CHAR );
+    MessageType recv( sizeof(R)*rc, MPI_UNSIGNED_CHAR );
     SafeMpi
-    ( MPI_Allgatherv
-      ( (UCP)const_cast<R*>(sbuf), sizeof(R)*sc,   MPI_UNSIGNED_CHAR, 
-        (UCP)rbuf, byteRcs.data(), byteRds.data(), MPI_UNSIGNED_CHAR, 
-        comm.comm ) );
+    ( EL_NONBLOCKING_COLL(Iallgather)
+      ( (UCP)const_cast<R*>(sbuf), send.count, send.type,
+        (UCP)rbuf,                 recv.count, recv.type,
+        comm.comm, &request ) );
 #else
+    MessageType send( sc, TypeMap<R>() );
+    MessageType recv( rc, TypeMap<R>() );
     SafeMpi
-    ( MPI_Allgatherv
-      ( const_cast<R*>(sbuf), 
-        sc, 
-        TypeMap<R>(), 
-        rbuf,   
-        const_cast<int*>(rcs), 
-        const_cast<int*>(rds), 
-        TypeMap<R>(), 
-        comm.comm ) );
+    ( EL_NONBLOCKING_COLL(Iallgather)
+      ( const_cast<R*>(sbuf), send.count, send.type,
+        rbuf,                 recv.count, recv.type, comm.comm, &request ) );
 #endif
 }
 
 template<typename R>
-void AllGather
-( const Complex<R>* sbuf, int sc,
-        Complex<R>* rbuf, const int* rcs, const int* rds, Comm comm )
+void IAllGather
+( const Complex<R>* sbuf, Int sc,
+        Complex<R>* rbuf, Int rc, Comm comm, Request& request )
 {
-    DEBUG_ONLY(CallStackEntry cse("mpi::AllGather"))
+    DEBUG_ONLY(CallStackEntry cse("mpi::IAllGather"))
 #ifdef EL_USE_BYTE_ALLGATHERS
-    const int commSize = Size( comm );
-    std::vector<int> byteRcs( commSize ), byteRds( commSize );
-    for( int i=0; i<commSize; ++i )
-    {
-        byteRcs[i] = 2*sizeof(R)*rcs[i];
-        byteRds[i] = 2*sizeof(R)*rds[i];
-    }
+    MessageType send( 2*sizeof(R)*sc, MPI_UNSIGNED_CHAR );
+    MessageType recv( 2*sizeof(R)*rc, MPI_UNSIGNED_CHAR );
     SafeMpi
-    ( MPI_Allgatherv
-      ( (UCP)const_cast<Complex<R>*>(sbuf), 2*sizeof(R)*sc, MPI_UNSIGNED_CHAR, 
-        (UCP)rbuf, byteRcs.data(), byteRds.data(),          MPI_UNSIGNED_CHAR, 
-        comm.comm ) );
+    ( EL_NONBLOCKING_COLL(Iallgather)
+      ( (UCP)const_cast<Complex<R>*>(sbuf), send.count, send.type,
+        (UCP)rbuf,                          recv.count, recv.type,
+        comm.comm, &request ) );
 #else
  #ifdef EL_AVOID_COMPLEX_MPI
-    const int commSize = Size( comm );
-    std::vector<int> realRcs( commSize ), realRds( commSize );
-    for( int i=0; i<commSize; ++i )
-    {
-        realRcs[i] = 2*rcs[i];
-        realRds[i] = 2*rds[i];
-    }
-    SafeMpi
-    ( MPI_Allgatherv
-      ( const_cast<Complex<R>*>(sbuf), 2*sc, TypeMap<R>(),
-        rbuf, realRcs.data(), realRds.data(), TypeMap<R>(), comm.comm ) );
+    MessageType send( 2*sc, TypeMap<R>() );
+    MessageType recv( 2*rc, TypeMap<R>() );
  #else
+    MessageType send( sc, TypeMap<Complex<R>>() );
+    MessageType recv( rc, TypeMap<Complex<R>>() );
+ #endif
     SafeMpi
-    ( MPI_Allgatherv
-      ( const_cast<Complex<R>*>(sbuf), 
-        sc, 
-        TypeMap<Complex<R>>(),
-        rbuf, 
-        const_cast<int*>(rcs), 
-        const_cast<int*>(rds), 
-        TypeMap<Complex<R>>(),
-        comm.comm ) );
+    ( EL_NONBLOCKING_COLL(Iallgather)
+      ( const_cast<Complex<R>*>(sbuf), send.count, send.type,
+        rbuf,                          recv.count, recv.type,
+        comm.comm, &request ) );
+#endif
+}
+
+template void IAllGather( const byte* sbuf, Int sc, byte* rbuf, Int rc, Comm comm, Request& request );
+template void IAllGather( const int* sbuf, Int sc, int* rbuf, Int rc, Comm comm, Request& request );
+template void IAllGather( const unsigned* sbuf, Int sc, unsigned* rbuf, Int rc, Comm comm, Request& request );
+template void IAllGather( const long int* sbuf, Int sc, long int* rbuf, Int rc, Comm comm, Request& request );
+template void IAllGather( const unsigned long* sbuf, Int sc, unsigned long* rbuf, Int rc, Comm comm, Request& request );
+#ifdef EL_HAVE_MPI_LONG_LONG
+template void IAllGather( const long long int* sbuf, Int sc, long long int* rbuf, Int rc, Comm comm, Request& request );
+template void IAllGather( const unsigned long long* sbuf, Int sc, unsigned long long* rbuf, Int rc, Comm comm, Request& request );
+#endif
+template void IAllGather( const float* sbuf, Int sc, float* rbuf, Int rc, Comm comm, Request& request );
+template void IAllGather( const double* sbuf, Int sc, double* rbuf, Int rc, Comm comm, Request& request );
+template void IAllGather( const Complex<float>* sbuf, Int sc, Complex<float>* rbuf, Int rc, Comm comm, Request& request );
+template void IAllGather( const Complex<double>* sbuf, Int sc, Complex<double>* rbuf, Int rc, Comm comm, Request& request );
+#endif // ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+
+template<typename R>
+void AllGather
+( const R* sbuf, Int sc,
+        R* rbuf, const Int* rcs, const Int* rds, Comm comm )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::AllGather"))
+#ifdef EL_USE_BYTE_ALLGATHERS
+    AllGatherV( sbuf, sc, rbuf, rcs, rds, sizeof(R), MPI_UNSIGNED_CHAR, comm );
+#else
+    AllGatherV( sbuf, sc, rbuf, rcs, rds, 1, TypeMap<R>(), comm );
+#endif
+}
+
+template<typename R>
+void AllGather
+( const Complex<R>* sbuf, Int sc,
+        Complex<R>* rbuf, const Int* rcs, const Int* rds, Comm comm )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::AllGather"))
+#ifdef EL_USE_BYTE_ALLGATHERS
+    AllGatherV
+    ( sbuf, sc, rbuf, rcs, rds, 2*sizeof(R), MPI_UNSIGNED_CHAR, comm );
+#else
+ #ifdef EL_AVOID_COMPLEX_MPI
+    AllGatherV( sbuf, sc, rbuf, rcs, rds, 2, TypeMap<R>(), comm );
+ #else
+    AllGatherV( sbuf, sc, rbuf, rcs, rds, 1, TypeMap<Complex<R>>(), comm );
  #endif
 #endif
 }
 
 template void AllGather
-( const byte* sbuf, int sc, 
-        byte* rbuf, const int* rcs, const int* rds, Comm comm );
+( const byte* sbuf, Int sc, 
+        byte* rbuf, const Int* rcs, const Int* rds, Comm comm );
 template void AllGather
-( const int* sbuf, int sc, 
-        int* rbuf, const int* rcs, const int* rds, Comm comm );
+( const int* sbuf, Int sc, 
+        int* rbuf, const Int* rcs, const Int* rds, Comm comm );
 template void AllGather
-( const unsigned* sbuf, int sc, 
-        unsigned* rbuf, const int* rcs, const int* rds, Comm comm );
+( const unsigned* sbuf, Int sc, 
+        unsigned* rbuf, const Int* rcs, const Int* rds, Comm comm );
 template void AllGather
-( const long int* sbuf, int sc, 
-        long int* rbuf, const int* rcs, const int* rds, Comm comm );
+( const long int* sbuf, Int sc, 
+        long int* rbuf, const Int* rcs, const Int* rds, Comm comm );
 template void AllGather
-( const unsigned long* sbuf, int sc, 
-        unsigned long* rbuf, const int* rcs, const int* rds, Comm comm );
+( const unsigned long* sbuf, Int sc, 
+        unsigned long* rbuf, const Int* rcs, const Int* rds, Comm comm );
 #ifdef EL_HAVE_MPI_LONG_LONG
 template void AllGather
-( const long long int* sbuf, int sc, 
-        long long int* rbuf, const int* rcs, const int* rds, Comm comm );
+( const long long int* sbuf, Int sc, 
+        long long int* rbuf, const Int* rcs, const Int* rds, Comm comm );
 template void AllGather
-( const unsigned long long* sbuf, int sc, 
-        unsigned long long* rbuf, const int* rcs, const int* rds, Comm comm );
+( const unsigned long long* sbuf, Int sc, 
+        unsigned long long* rbuf, const Int* rcs, const Int* rds, Comm comm );
 #endif
 template void AllGather
-( const float* sbuf, int sc, 
-        float* rbuf, const int* rcs, const int* rds, Comm comm );
+( const float* sbuf, Int sc, 
+        float* rbuf, const Int* rcs, const Int* rds, Comm comm );
 template void AllGather
-( const double* sbuf, int sc, 
-        double* rbuf, const int* rcs, const int* rds, Comm comm );
+( const double* sbuf, Int sc, 
+        double* rbuf, const Int* rcs, const Int* rds, Comm comm );
 template void AllGather
-( const Complex<float>* sbuf, int sc, 
-        Complex<float>* rbuf, const int* rcs, const int* rds, Comm comm );
+( const Complex<float>* sbuf, Int sc, 
+        Complex<float>* rbuf, const Int* rcs, const Int* rds, Comm comm );
 template void AllGather
-( const Complex<double>* sbuf, int sc, 
-        Complex<double>* rbuf, const int* rcs, const int* rds, Comm comm );
+( const Complex<double>* sbuf, Int sc, 
+        Complex<double>* rbuf, const Int* rcs, const Int* rds, Comm comm );
 
 template<typename R>
 void Scatter
-( const R* sbuf, int sc,
-        R* rbuf, int rc, int root, Comm comm )
+( const R* sbuf, Int sc,
+        R* rbuf, Int rc, int root, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Scatter"))
+    MessageType send( sc, TypeMap<R>() );
+    MessageType recv( rc, TypeMap<R>() );
     SafeMpi
     ( MPI_Scatter
-      ( const_cast<R*>(sbuf), sc, TypeMap<R>(),
-        rbuf,                 rc, TypeMap<R>(), root, comm.comm ) );
+      ( const_cast<R*>(sbuf), send.count, send.type,
+        rbuf,                 recv.count, recv.type, root, comm.comm ) );
 }
 
 template<typename R>
 void Scatter
-( const Complex<R>* sbuf, int sc,
-        Complex<R>* rbuf, int rc, int root, Comm comm )
+( const Complex<R>* sbuf, Int sc,
+        Complex<R>* rbuf, Int rc, int root, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Scatter"))
 #ifdef EL_AVOID_COMPLEX_MPI
+    MessageType send( 2*sc, TypeMap<R>() );
+    MessageType recv( 2*rc, TypeMap<R>() );
     SafeMpi
     ( MPI_Scatter
-      ( const_cast<Complex<R>*>(sbuf), 2*sc, TypeMap<R>(),
-        rbuf,                          2*rc, TypeMap<R>(), root, comm.comm ) );
+      ( const_cast<Complex<R>*>(sbuf), send.count, send.type,
+        rbuf,                          recv.count, recv.type,
+        root, comm.comm ) );
 #else
+    MessageType send( sc, TypeMap<Complex<R>>() );
+    MessageType recv( rc, TypeMap<Complex<R>>() );
     SafeMpi
     ( MPI_Scatter
-      ( const_cast<Complex<R>*>(sbuf), sc, TypeMap<Complex<R>>(),
-        rbuf,                          rc, TypeMap<Complex<R>>(), 
+      ( const_cast<Complex<R>*>(sbuf), send.count, send.type,
+        rbuf,                          recv.count, recv.type, 
         root, comm.comm ) );
 #endif
 }
 
 template void Scatter
-( const byte* sbuf, int sc, 
-        byte* rbuf, int rc, int root, Comm comm );
+( const byte* sbuf, Int sc, 
+        byte* rbuf, Int rc, int root, Comm comm );
 template void Scatter
-( const int* sbuf, int sc, 
-        int* rbuf, int rc, int root, Comm comm );
+( const int* sbuf, Int sc, 
+        int* rbuf, Int rc, int root, Comm comm );
 template void Scatter
-( const unsigned* sbuf, int sc, 
-        unsigned* rbuf, int rc, int root, Comm comm );
+( const unsigned* sbuf, Int sc, 
+        unsigned* rbuf, Int rc, int root, Comm comm );
 template void Scatter
-( const long int* sbuf, int sc, 
-        long int* rbuf, int rc, int root, Comm comm );
+( const long int* sbuf, Int sc, 
+        long int* rbuf, Int rc, int root, Comm comm );
 template void Scatter
-( const unsigned long* sbuf, int sc, 
-        unsigned long* rbuf, int rc, int root, Comm comm );
+( const unsigned long* sbuf, Int sc, 
+        unsigned long* rbuf, Int rc, int root, Comm comm );
 #ifdef EL_HAVE_MPI_LONG_LONG
 template void Scatter
-( const long long int* sbuf, int sc, 
-        long long int* rbuf, int rc, int root, Comm comm );
+( const long long int* sbuf, Int sc, 
+        long long int* rbuf, Int rc, int root, Comm comm );
 template void Scatter
-( const unsigned long long* sbuf, int sc, 
-        unsigned long long* rbuf, int rc, int root, Comm comm );
+( const unsigned long long* sbuf, Int sc, 
+        unsigned long long* rbuf, Int rc, int root, Comm comm );
 #endif
 template void Scatter
-( const float* sbuf, int sc, 
-        float* rbuf, int rc, int root, Comm comm );
+( const float* sbuf, Int sc, 
+        float* rbuf, Int rc, int root, Comm comm );
 template void Scatter
-( const double* sbuf, int sc, 
-        double* rbuf, int rc, int root, Comm comm );
+( const double* sbuf, Int sc, 
+        double* rbuf, Int rc, int root, Comm comm );
 template void Scatter
-( const Complex<float>* sbuf, int sc, 
-        Complex<float>* rbuf, int rc, int root, Comm comm );
+( const Complex<float>* sbuf, Int sc, 
+        Complex<float>* rbuf, Int rc, int root, Comm comm );
 template void Scatter
-( const Complex<double>* sbuf, int sc, 
-        Complex<double>* rbuf, int rc, int root, Comm comm );
+( const Complex<double>* sbuf, Int sc, 
+        Complex<double>* rbuf, Int rc, int root, Comm comm );
 
 template<typename R>
-void Scatter( R* buf, int sc, int rc, int root, Comm comm )
+void Scatter( R* buf, Int sc, Int rc, int root, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Scatter"))
     const int commRank = Rank( comm );
     if( commRank == root )
     {
 #ifdef EL_HAVE_MPI_IN_PLACE
+        MessageType send( sc, TypeMap<R>() );
+        MessageType recv( rc, TypeMap<R>() );
         SafeMpi
         ( MPI_Scatter
-          ( buf,          sc, TypeMap<R>(), 
-            MPI_IN_PLACE, rc, TypeMap<R>(), root, comm.comm ) );
+          ( buf,          send.count, send.type, 
+            MPI_IN_PLACE, recv.count, recv.type, root, comm.comm ) );
 #else
         const int commSize = Size( comm );
         std::vector<R> sendBuf( sc*commSize );
         MemCopy( sendBuf.data(), buf, sc*commSize );
+        MessageType send( sc, TypeMap<R>() );
+        MessageType recv( rc, TypeMap<R>() );
         SafeMpi
         ( MPI_Scatter
-          ( sendBuf.data(), sc, TypeMap<R>(), 
-            buf,            rc, TypeMap<R>(), root, comm.comm ) );
+          ( sendBuf.data(), send.count, send.type, 
+            buf,            recv.count, recv.type, root, comm.comm ) );
 #endif
     }
     else
     {
+        MessageType send( sc, TypeMap<R>() );
+        MessageType recv( rc, TypeMap<R>() );
         SafeMpi
         ( MPI_Scatter
-          ( 0,   sc, TypeMap<R>(), 
-            buf, rc, TypeMap<R>(), root, comm.comm ) );
+          ( 0,   send.count, send.type, 
+            buf, recv.count, recv.type, root, comm.comm ) );
     }
 }
 
 template<typename R>
-void Scatter( Complex<R>* buf, int sc, int rc, int root, Comm comm )
+void Scatter( Complex<R>* buf, Int sc, Int rc, int root, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Scatter"))
     const int commRank = Rank( comm );
@@ -1766,234 +2660,276 @@ void Scatter( Complex<R>* buf, int sc, int rc, int root, Comm comm )
     {
 #ifdef EL_AVOID_COMPLEX_MPI
 # ifdef EL_HAVE_MPI_IN_PLACE
+        MessageType send( 2*sc, TypeMap<R>() );
+        MessageType recv( 2*rc, TypeMap<R>() );
         SafeMpi
         ( MPI_Scatter
-          ( buf,          2*sc, TypeMap<R>(), 
-            MPI_IN_PLACE, 2*rc, TypeMap<R>(), root, comm.comm ) );
+          ( buf,          send.count, send.type, 
+            MPI_IN_PLACE, recv.count, recv.type, root, comm.comm ) );
 # else
         const int commSize = Size( comm );
         std::vector<Complex<R>> sendBuf( sc*commSize );
         MemCopy( sendBuf.data(), buf, sc*commSize );
+        MessageType send( 2*sc, TypeMap<R>() );
+        MessageType recv( 2*rc, TypeMap<R>() );
         SafeMpi
         ( MPI_Scatter
-          ( sendBuf.data(), 2*sc, TypeMap<R>(),          
-            buf,            2*rc, TypeMap<R>(), root, comm.comm ) );
+          ( sendBuf.data(), send.count, send.type,          
+            buf,            recv.count, recv.type, root, comm.comm ) );
 # endif
 #else
 # ifdef EL_HAVE_MPI_IN_PLACE
+        MessageType send( sc, TypeMap<Complex<R>>() );
+        MessageType recv( rc, TypeMap<Complex<R>>() );
         SafeMpi
         ( MPI_Scatter
-          ( buf,          sc, TypeMap<Complex<R>>(), 
-            MPI_IN_PLACE, rc, TypeMap<Complex<R>>(), root, comm.comm ) );
+          ( buf,          send.count, send.type, 
+            MPI_IN_PLACE, recv.count, recv.type, root, comm.comm ) );
 # else
         const int commSize = Size( comm );
         std::vector<Complex<R>> sendBuf( sc*commSize );
         MemCopy( sendBuf.data(), buf, sc*commSize );
+        MessageType send( sc, TypeMap<Complex<R>>() );
+        MessageType recv( rc, TypeMap<Complex<R>>() );
         SafeMpi
         ( MPI_Scatter
-          ( sendBuf.data(), sc, TypeMap<Complex<R>>(),
-            buf,            rc, TypeMap<Complex<R>>(), root, comm.comm ) );
+          ( sendBuf.data(), send.count, send.type,
+            buf,            recv.count, recv.type, root, comm.comm ) );
 # endif
 #endif
     }
     else
     {
 #ifdef EL_AVOID_COMPLEX_MPI
+        MessageType send( 2*sc, TypeMap<R>() );
+        MessageType recv( 2*rc, TypeMap<R>() );
         SafeMpi
         ( MPI_Scatter
-          ( 0,   2*sc, TypeMap<R>(), 
-            buf, 2*rc, TypeMap<R>(), root, comm.comm ) );
+          ( 0,   send.count, send.type, 
+            buf, recv.count, recv.type, root, comm.comm ) );
 #else
+        MessageType send( sc, TypeMap<Complex<R>>() );
+        MessageType recv( rc, TypeMap<Complex<R>>() );
         SafeMpi
         ( MPI_Scatter
-          ( 0,   sc, TypeMap<Complex<R>>(), 
-            buf, rc, TypeMap<Complex<R>>(), root, comm.comm ) );
+          ( 0,   send.count, send.type, 
+            buf, recv.count, recv.type, root, comm.comm ) );
 #endif
     }
 }
 
-template void Scatter( byte* buf, int sc, int rc, int root, Comm comm );
-template void Scatter( int* buf, int sc, int rc, int root, Comm comm );
-template void Scatter( unsigned* buf, int sc, int rc, int root, Comm comm );
-template void Scatter( long int* buf, int sc, int rc, int root, Comm comm );
-template void Scatter( unsigned long* buf, int sc, int rc, int root, Comm comm );
+template void Scatter( byte* buf, Int sc, Int rc, int root, Comm comm );
+template void Scatter( int* buf, Int sc, Int rc, int root, Comm comm );
+template void Scatter( unsigned* buf, Int sc, Int rc, int root, Comm comm );
+template void Scatter( long int* buf, Int sc, Int rc, int root, Comm comm );
+template void Scatter( unsigned long* buf, Int sc, Int rc, int root, Comm comm );
 #ifdef EL_HAVE_MPI_LONG_LONG
-template void Scatter( long long int* buf, int sc, int rc, int root, Comm comm );
-template void Scatter( unsigned long long* buf, int sc, int rc, int root, Comm comm );
+template void Scatter( long long int* buf, Int sc, Int rc, int root, Comm comm );
+template void Scatter( unsigned long long* buf, Int sc, Int rc, int root, Comm comm );
 #endif
-template void Scatter( float* buf, int sc, int rc, int root, Comm comm );
-template void Scatter( double* buf, int sc, int rc, int root, Comm comm );
-template void Scatter( Complex<float>* buf, int sc, int rc, int root, Comm comm );
-template void Scatter( Complex<double>* buf, int sc, int rc, int root, Comm comm );
+template void Scatter( float* buf, Int sc, Int rc, int root, Comm comm );
+template void Scatter( double* buf, Int sc, Int rc, int root, Comm comm );
+template void Scatter( Complex<float>* buf, Int sc, Int rc, int root, Comm comm );
+template void Scatter( Complex<double>* buf, Int sc, Int rc, int root, Comm comm );
 
 template<typename R>
 void AllToAll
-( const R* sbuf, int sc,
-        R* rbuf, int rc, Comm comm )
+( const R* sbuf, Int sc,
+        R* rbuf, Int rc, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::AllToAll"))
+    MessageType send( sc, TypeMap<R>() );
+    MessageType recv( rc, TypeMap<R>() );
     SafeMpi
     ( MPI_Alltoall
-      ( const_cast<R*>(sbuf), sc, TypeMap<R>(),
-        rbuf,                 rc, TypeMap<R>(), comm.comm ) );
+      ( const_cast<R*>(sbuf), send.count, send.type,
+        rbuf,                 recv.count, recv.type, comm.comm ) );
 }
 
 template<typename R>
 void AllToAll
-( const Complex<R>* sbuf, int sc,
-        Complex<R>* rbuf, int rc, Comm comm )
+( const Complex<R>* sbuf, Int sc,
+        Complex<R>* rbuf, Int rc, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::AllToAll"))
 #ifdef EL_AVOID_COMPLEX_MPI
+    MessageType send( 2*sc, TypeMap<R>() );
+    MessageType recv( 2*rc, TypeMap<R>() );
     SafeMpi
     ( MPI_Alltoall
-      ( const_cast<Complex<R>*>(sbuf), 2*sc, TypeMap<R>(),
-        rbuf,                          2*rc, TypeMap<R>(), comm.comm ) );
+      ( const_cast<Complex<R>*>(sbuf), send.count, send.type,
+        rbuf,                          recv.count, recv.type, comm.comm ) );
 #else
+    MessageType send( sc, TypeMap<Complex<R>>() );
+    MessageType recv( rc, TypeMap<Complex<R>>() );
     SafeMpi
     ( MPI_Alltoall
-      ( const_cast<Complex<R>*>(sbuf), sc, TypeMap<Complex<R>>(),
-        rbuf,                          rc, TypeMap<Complex<R>>(), comm.comm ) );
+      ( const_cast<Complex<R>*>(sbuf), send.count, send.type,
+        rbuf,                          recv.count, recv.type, comm.comm ) );
 #endif
 }
 
 template void AllToAll
-( const byte* sbuf, int sc, 
-        byte* rbuf, int rc, Comm comm );
+( const byte* sbuf, Int sc, 
+        byte* rbuf, Int rc, Comm comm );
 template void AllToAll
-( const int* sbuf, int sc, 
-        int* rbuf, int rc, Comm comm );
+( const int* sbuf, Int sc, 
+        int* rbuf, Int rc, Comm comm );
 template void AllToAll
-( const unsigned* sbuf, int sc, 
-        unsigned* rbuf, int rc, Comm comm );
+( const unsigned* sbuf, Int sc, 
+        unsigned* rbuf, Int rc, Comm comm );
 template void AllToAll
-( const long int* sbuf, int sc, 
-        long int* rbuf, int rc, Comm comm );
+( const long int* sbuf, Int sc, 
+        long int* rbuf, Int rc, Comm comm );
 template void AllToAll
-( const unsigned long* sbuf, int sc, 
-        unsigned long* rbuf, int rc, Comm comm );
+( const unsigned long* sbuf, Int sc, 
+        unsigned long* rbuf, Int rc, Comm comm );
 #ifdef EL_HAVE_MPI_LONG_LONG
 template void AllToAll
-( const long long int* sbuf, int sc, 
-        long long int* rbuf, int rc, Comm comm );
+( const long long int* sbuf, Int sc, 
+        long long int* rbuf, Int rc, Comm comm );
 template void AllToAll
-( const unsigned long long* sbuf, int sc, 
-        unsigned long long* rbuf, int rc, Comm comm );
+( const unsigned long long* sbuf, Int sc, 
+        unsigned long long* rbuf, Int rc, Comm comm );
 #endif
 template void AllToAll
-( const float* sbuf, int sc, 
-        float* rbuf, int rc, Comm comm );
+( const float* sbuf, Int sc, 
+        float* rbuf, Int rc, Comm comm );
 template void AllToAll
-( const double* sbuf, int sc, 
-        double* rbuf, int rc, Comm comm );
+( const double* sbuf, Int sc, 
+        double* rbuf, Int rc, Comm comm );
 template void AllToAll
-( const Complex<float>* sbuf, int sc, 
-        Complex<float>* rbuf, int rc, Comm comm );
+( const Complex<float>* sbuf, Int sc, 
+        Complex<float>* rbuf, Int rc, Comm comm );
 template void AllToAll
-( const Complex<double>* sbuf, int sc, 
-        Complex<double>* rbuf, int rc, Comm comm );
+( const Complex<double>* sbuf, Int sc, 
+        Complex<double>* rbuf, Int rc, Comm comm );
 
 template<typename R>
 void AllToAll
-( const R* sbuf, const int* scs, const int* sds, 
-        R* rbuf, const int* rcs, const int* rds, Comm comm )
+( const R* sbuf, const Int* scs, const Int* sds, 
+        R* rbuf, const Int* rcs, const Int* rds, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::AllToAll"))
-    SafeMpi
-    ( MPI_Alltoallv
-      ( const_cast<R*>(sbuf), 
-        const_cast<int*>(scs), 
-        const_cast<int*>(sds), 
-        TypeMap<R>(),
-        rbuf, 
-        const_cast<int*>(rcs), 
-        const_cast<int*>(rds), 
-        TypeMap<R>(),
-        comm.comm ) );
+    AllToAllV( sbuf, scs, sds, rbuf, rcs, rds, 1, TypeMap<R>(), comm );
 }
 
 template<typename R>
 void AllToAll
-( const Complex<R>* sbuf, const int* scs, const int* sds,
-        Complex<R>* rbuf, const int* rcs, const int* rds, Comm comm )
+( const Complex<R>* sbuf, const Int* scs, const Int* sds,
+        Complex<R>* rbuf, const Int* rcs, const Int* rds, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::AllToAll"))
 #ifdef EL_AVOID_COMPLEX_MPI
-    int p;
-    MPI_Comm_size( comm.comm, &p );
-    std::vector<int> scsDoubled(p);
-    std::vector<int> sdsDoubled(p);
-    std::vector<int> rcsDoubled(p);
-    std::vector<int> rdsDoubled(p);
-    for( int i=0; i<p; ++i )
-        scsDoubled[i] = 2*scs[i];
-    for( int i=0; i<p; ++i )
-        sdsDoubled[i] = 2*sds[i];
-    for( int i=0; i<p; ++i )
-        rcsDoubled[i] = 2*rcs[i];
-    for( int i=0; i<p; ++i )
-        rdsDoubled[i] = 2*rds[i];
-    SafeMpi
-    ( MPI_Alltoallv
-      ( const_cast<Complex<R>*>(sbuf),
-              scsDoubled.data(), sdsDoubled.data(), TypeMap<R>(),
-        rbuf, rcsDoubled.data(), rdsDoubled.data(), TypeMap<R>(), comm.comm ) );
+    AllToAllV( sbuf, scs, sds, rbuf, rcs, rds, 2, TypeMap<R>(), comm );
 #else
-    SafeMpi
-    ( MPI_Alltoallv
-      ( const_cast<Complex<R>*>(sbuf), 
-        const_cast<int*>(scs), 
-        const_cast<int*>(sds), 
-        TypeMap<Complex<R>>(),
-        rbuf, 
-        const_cast<int*>(rcs), 
-        const_cast<int*>(rds), 
-        TypeMap<Complex<R>>(),
-        comm.comm ) );
+    AllToAllV
+    ( sbuf, scs, sds, rbuf, rcs, rds, 1, TypeMap<Complex<R>>(), comm );
 #endif
 }
 
 template void AllToAll
-( const byte* sbuf, const int* scs, const int* sds,
-        byte* rbuf, const int* rcs, const int* rds, Comm comm );
+( const byte* sbuf, const Int* scs, const Int* sds,
+        byte* rbuf, const Int* rcs, const Int* rds, Comm comm );
 template void AllToAll
-( const int* sbuf, const int* scs, const int* sds,
-        int* rbuf, const int* rcs, const int* rds, Comm comm );
+( const int* sbuf, const Int* scs, const Int* sds,
+        int* rbuf, const Int* rcs, const Int* rds, Comm comm );
 template void AllToAll
-( const unsigned* sbuf, const int* scs, const int* sds,
-        unsigned* rbuf, const int* rcs, const int* rds, Comm comm );
+( const unsigned* sbuf, const Int* scs, const Int* sds,
+        unsigned* rbuf, const Int* rcs, const Int* rds, Comm comm );
 template void AllToAll
-( const long int* sbuf, const int* scs, const int* sds,
-        long int* rbuf, const int* rcs, const int* rds, Comm comm );
+( const long int* sbuf, const Int* scs, const Int* sds,
+        long int* rbuf, const Int* rcs, const Int* rds, Comm comm );
 template void AllToAll
-( const unsigned long* sbuf, const int* scs, const int* sds,
-        unsigned long* rbuf, const int* rcs, const int* rds, Comm comm );
+( const unsigned long* sbuf, const Int* scs, const Int* sds,
+        unsigned long* rbuf, const Int* rcs, const Int* rds, Comm comm );
 #ifdef EL_HAVE_MPI_LONG_LONG
 template void AllToAll
-( const long long int* sbuf, const int* scs, const int* sds,
-        long long int* rbuf, const int* rcs, const int* rds, Comm comm );
+( const long long int* sbuf, const Int* scs, const Int* sds,
+        long long int* rbuf, const Int* rcs, const Int* rds, Comm comm );
 template void AllToAll
-( const unsigned long long* sbuf, const int* scs, const int* sds,
-        unsigned long long* rbuf, const int* rcs, const int* rds, Comm comm );
+( const unsigned long long* sbuf, const Int* scs, const Int* sds,
+        unsigned long long* rbuf, const Int* rcs, const Int* rds, Comm comm );
 #endif
 template void AllToAll
-( const float* sbuf, const int* scs, const int* sds,
-        float* rbuf, const int* rcs, const int* rds, Comm comm );
+( const float* sbuf, const Int* scs, const Int* sds,
+        float* rbuf, const Int* rcs, const Int* rds, Comm comm );
 template void AllToAll
-( const double* sbuf, const int* scs, const int* sds,
-        double* rbuf, const int* rcs, const int* rds, Comm comm );
+( const double* sbuf, const Int* scs, const Int* sds,
+        double* rbuf, const Int* rcs, const Int* rds, Comm comm );
 template void AllToAll
-( const Complex<float>* sbuf, const int* scs, const int* sds,
-        Complex<float>* rbuf, const int* rcs, const int* rds, Comm comm );
+( const Complex<float>* sbuf, const Int* scs, const Int* sds,
+        Complex<float>* rbuf, const Int* rcs, const Int* rds, Comm comm );
 template void AllToAll
-( const Complex<double>* sbuf, const int* scs, const int* sds,
-        Complex<double>* rbuf, const int* rcs, const int* rds, Comm comm );
+( const Complex<double>* sbuf, const Int* scs, const Int* sds,
+        Complex<double>* rbuf, const Int* rcs, const Int* rds, Comm comm );
+
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+template<typename R>
+void IAllToAll
+( const R* sbuf, Int sc,
+        R* rbuf, Int rc, Comm comm, Request& request )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::IAllToAll"))
+    MessageType send( sc, TypeMap<R>() );
+    MessageType recv( rc, TypeMap<R>() );
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Ialltoall)
+      ( const_cast<R*>(sbuf), send.count, send.type,
+        rbuf,                 recv.count, recv.type, comm.comm, &request ) );
+}
+
+template<typename R>
+void IAllToAll
+( const Complex<R>* sbuf, Int sc,
+        Complex<R>* rbuf, Int rc, Comm comm, Request& request )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::IAllToAll"))
+#ifdef EL_AVOID_COMPLEX_MPI
+    MessageType send( 2*sc, TypeMap<R>() );
+    MessageType recv( 2*rc, TypeMap<R>() );
+#else
+    MessageType send( sc, TypeMap<Complex<R>>() );
+    MessageType recv( rc, TypeMap<Complex<R>>() );
+#endif
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Ialltoall)
+      ( const_cast<Complex<R>*>(sbuf), send.count, send.type,
+        rbuf,                          recv.count, recv.type,
+        comm.comm, &request ) );
+}
+
+template void IAllToAll( const byte* sbuf, Int sc, byte* rbuf, Int rc, Comm comm, Request& request );
+template void IAllToAll( const int* sbuf, Int sc, int* rbuf, Int rc, Comm comm, Request& request );
+template void IAllToAll( const unsigned* sbuf, Int sc, unsigned* rbuf, Int rc, Comm comm, Request& request );
+template void IAllToAll( const long int* sbuf, Int sc, long int* rbuf, Int rc, Comm comm, Request& request );
+template void IAllToAll( const unsigned long* sbuf, Int sc, unsigned long* rbuf, Int rc, Comm comm, Request& request );
+#ifdef EL_HAVE_MPI_LONG_LONG
+template void IAllToAll( const long long int* sbuf, Int sc, long long int* rbuf, Int rc, Comm comm, Request& request );
+template void IAllToAll( const unsigned long long* sbuf, Int sc, unsigned long long* rbuf, Int rc, Comm comm, Request& request );
+#endif
+template void IAllToAll( const float* sbuf, Int sc, float* rbuf, Int rc, Comm comm, Request& request );
+template void IAllToAll( const double* sbuf, Int sc, double* rbuf, Int rc, Comm comm, Request& request );
+template void IAllToAll( const Complex<float>* sbuf, Int sc, Complex<float>* rbuf, Int rc, Comm comm, Request& request );
+template void IAllToAll( const Complex<double>* sbuf, Int sc, Complex<double>* rbuf, Int rc, Comm comm, Request& request );
+#endif // ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
 
 template<typename T>
 void Reduce
-( const T* sbuf, T* rbuf, int count, Op op, int root, Comm comm )
+( const T* sbuf, T* rbuf, Int count, Op op, int root, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Reduce"))
+    if( count > maxMessageCount )
+    {
+        ChunkedReduction
+        ( count, maxMessageCount,
+          [&]( Int offset, int pieceCount )
+          {
+              Reduce
+              ( &sbuf[offset], &rbuf[offset], pieceCount, op, root, comm );
+          } );
+        return;
+    }
     if( count != 0 )
     {
         SafeMpi
@@ -2006,9 +2942,20 @@ void Reduce
 template<typename R>
 void Reduce
 ( const Complex<R>* sbuf, 
-        Complex<R>* rbuf, int count, Op op, int root, Comm comm )
+        Complex<R>* rbuf, Int count, Op op, int root, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Reduce"))
+    if( count > MaxComplexReduction() )
+    {
+        ChunkedReduction
+        ( count, MaxComplexReduction(),
+          [&]( Int offset, int pieceCount )
+          {
+              Reduce
+              ( &sbuf[offset], &rbuf[offset], pieceCount, op, root, comm );
+          } );
+        return;
+    }
     if( count != 0 )
     {
 #ifdef EL_AVOID_COMPLEX_MPI
@@ -2035,49 +2982,49 @@ void Reduce
     }
 }
 
-template void Reduce( const byte* sbuf, byte* rbuf, int count, Op op, int root, Comm comm );
-template void Reduce( const int* sbuf, int* rbuf, int count, Op op, int root, Comm comm );
-template void Reduce( const unsigned* sbuf, unsigned* rbuf, int count, Op op, int root, Comm comm );
-template void Reduce( const long int* sbuf, long int* rbuf, int count, Op op, int root, Comm comm );
-template void Reduce( const unsigned long* sbuf, unsigned long* rbuf, int count, Op op, int root, Comm comm );
+template void Reduce( const byte* sbuf, byte* rbuf, Int count, Op op, int root, Comm comm );
+template void Reduce( const int* sbuf, int* rbuf, Int count, Op op, int root, Comm comm );
+template void Reduce( const unsigned* sbuf, unsigned* rbuf, Int count, Op op, int root, Comm comm );
+template void Reduce( const long int* sbuf, long int* rbuf, Int count, Op op, int root, Comm comm );
+template void Reduce( const unsigned long* sbuf, unsigned long* rbuf, Int count, Op op, int root, Comm comm );
 #ifdef EL_HAVE_MPI_LONG_LONG
-template void Reduce( const long long int* sbuf, long long int* rbuf, int count, Op op, int root, Comm comm );
-template void Reduce( const unsigned long long* sbuf, unsigned long long* rbuf, int count, Op op, int root, Comm comm );
+template void Reduce( const long long int* sbuf, long long int* rbuf, Int count, Op op, int root, Comm comm );
+template void Reduce( const unsigned long long* sbuf, unsigned long long* rbuf, Int count, Op op, int root, Comm comm );
 #endif
-template void Reduce( const float* sbuf, float* rbuf, int count, Op op, int root, Comm comm );
-template void Reduce( const double* sbuf, double* rbuf, int count, Op op, int root, Comm comm );
-template void Reduce( const Complex<float>* sbuf, Complex<float>* rbuf, int count, Op op, int root, Comm comm );
-template void Reduce( const Complex<double>* sbuf, Complex<double>* rbuf, int count, Op op, int root, Comm comm );
-template void Reduce( const ValueInt<Int>* sbuf, ValueInt<Int>* rbuf, int count, Op op, int root, Comm comm );
-template void Reduce( const ValueInt<float>* sbuf, ValueInt<float>* rbuf, int count, Op op, int root, Comm comm );
-template void Reduce( const ValueInt<double>* sbuf, ValueInt<double>* rbuf, int count, Op op, int root, Comm comm );
-template void Reduce( const ValueIntPair<Int>* sbuf, ValueIntPair<Int>* rbuf, int count, Op op, int root, Comm comm );
-template void Reduce( const ValueIntPair<float>* sbuf, ValueIntPair<float>* rbuf, int count, Op op, int root, Comm comm );
-template void Reduce( const ValueIntPair<double>* sbuf, ValueIntPair<double>* rbuf, int count, Op op, int root, Comm comm );
+template void Reduce( const float* sbuf, float* rbuf, Int count, Op op, int root, Comm comm );
+template void Reduce( const double* sbuf, double* rbuf, Int count, Op op, int root, Comm comm );
+template void Reduce( const Complex<float>* sbuf, Complex<float>* rbuf, Int count, Op op, int root, Comm comm );
+template void Reduce( const Complex<double>* sbuf, Complex<double>* rbuf, Int count, Op op, int root, Comm comm );
+template void Reduce( const ValueInt<Int>* sbuf, ValueInt<Int>* rbuf, Int count, Op op, int root, Comm comm );
+template void Reduce( const ValueInt<float>* sbuf, ValueInt<float>* rbuf, Int count, Op op, int root, Comm comm );
+template void Reduce( const ValueInt<double>* sbuf, ValueInt<double>* rbuf, Int count, Op op, int root, Comm comm );
+template void Reduce( const ValueIntPair<Int>* sbuf, ValueIntPair<Int>* rbuf, Int count, Op op, int root, Comm comm );
+template void Reduce( const ValueIntPair<float>* sbuf, ValueIntPair<float>* rbuf, Int count, Op op, int root, Comm comm );
+template void Reduce( const ValueIntPair<double>* sbuf, ValueIntPair<double>* rbuf, Int count, Op op, int root, Comm comm );
 
 template<typename T>
-void Reduce( const T* sbuf, T* rbuf, int count, int root, Comm comm )
+void Reduce( const T* sbuf, T* rbuf, Int count, int root, Comm comm )
 { Reduce( sbuf, rbuf, count, mpi::SUM, root, comm ); }
 
-template void Reduce( const byte* sbuf, byte* rbuf, int count, int root, Comm comm );
-template void Reduce( const int* sbuf, int* rbuf, int count, int root, Comm comm );
-template void Reduce( const unsigned* sbuf, unsigned* rbuf, int count, int root, Comm comm );
-template void Reduce( const long int* sbuf, long int* rbuf, int count, int root, Comm comm );
-template void Reduce( const unsigned long* sbuf, unsigned long* rbuf, int count, int root, Comm comm );
-#ifdef EL_HAVE_MPI_LONG_LONG
-template void Reduce( const long long int* sbuf, long long int* rbuf, int count, int root, Comm comm );
-template void Reduce( const unsigned long long* sbuf, unsigned long long* rbuf, int count, int root, Comm comm );
-#endif
-template void Reduce( const float* sbuf, float* rbuf, int count, int root, Comm comm );
-template void Reduce( const double* sbuf, double* rbuf, int count, int root, Comm comm );
-template void Reduce( const Complex<float>* sbuf, Complex<float>* rbuf, int count, int root, Comm comm );
-template void Reduce( const Complex<double>* sbuf, Complex<double>* rbuf, int count, int root, Comm comm );
-template void Reduce( const ValueInt<Int>* sbuf, ValueInt<Int>* rbuf, int count, int root, Comm comm );
-template void Reduce( const ValueInt<float>* sbuf, ValueInt<float>* rbuf, int count, int root, Comm comm );
-template void Reduce( const ValueInt<double>* sbuf, ValueInt<double>* rbuf, int count, int root, Comm comm );
-template void Reduce( const ValueIntPair<Int>* sbuf, ValueIntPair<Int>* rbuf, int count, int root, Comm comm );
-template void Reduce( const ValueIntPair<float>* sbuf, ValueIntPair<float>* rbuf, int count, int root, Comm comm );
-template void Reduce( const ValueIntPair<double>* sbuf, ValueIntPair<double>* rbuf, int count, int root, Comm comm );
+template void Reduce( const byte* sbuf, byte* rbuf, Int count, int root, Comm comm );
+template void Reduce( const int* sbuf, int* rbuf, Int count, int root, Comm comm );
+template void Reduce( const unsigned* sbuf, unsigned* rbuf, Int count, int root, Comm comm );
+template void Reduce( const long int* sbuf, long int* rbuf, Int count, int root, Comm comm );
+template void Reduce( const unsigned long* sbuf, unsigned long* rbuf, Int count, int root, Comm comm );
+#ifdef EL_HAVE_MPI_LONG_LONG
+template void Reduce( const long long int* sbuf, long long int* rbuf, Int count, int root, Comm comm );
+template void Reduce( const unsigned long long* sbuf, unsigned long long* rbuf, Int count, int root, Comm comm );
+#endif
+template void Reduce( const float* sbuf, float* rbuf, Int count, int root, Comm comm );
+template void Reduce( const double* sbuf, double* rbuf, Int count, int root, Comm comm );
+template void Reduce( const Complex<float>* sbuf, Complex<float>* rbuf, Int count, int root, Comm comm );
+template void Reduce( const Complex<double>* sbuf, Complex<double>* rbuf, Int count, int root, Comm comm );
+template void Reduce( const ValueInt<Int>* sbuf, ValueInt<Int>* rbuf, Int count, int root, Comm comm );
+template void Reduce( const ValueInt<float>* sbuf, ValueInt<float>* rbuf, Int count, int root, Comm comm );
+template void Reduce( const ValueInt<double>* sbuf, ValueInt<double>* rbuf, Int count, int root, Comm comm );
+template void Reduce( const ValueIntPair<Int>* sbuf, ValueIntPair<Int>* rbuf, Int count, int root, Comm comm );
+template void Reduce( const ValueIntPair<float>* sbuf, ValueIntPair<float>* rbuf, Int count, int root, Comm comm );
+template void Reduce( const ValueIntPair<double>* sbuf, ValueIntPair<double>* rbuf, Int count, int root, Comm comm );
 
 template<typename T>
 T Reduce( T sb, Op op, int root, Comm comm )
@@ -2136,9 +3083,17 @@ template ValueIntPair<float> Reduce( ValueIntPair<float> sb, int root, Comm comm
 template ValueIntPair<double> Reduce( ValueIntPair<double> sb, int root, Comm comm );
 
 template<typename T>
-void Reduce( T* buf, int count, Op op, int root, Comm comm )
+void Reduce( T* buf, Int count, Op op, int root, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Reduce"))
+    if( count > maxMessageCount )
+    {
+        ChunkedReduction
+        ( count, maxMessageCount,
+          [&]( Int offset, int pieceCount )
+          { Reduce( &buf[offset], pieceCount, op, root, comm ); } );
+        return;
+    }
     if( count != 0 )
     {
         const int commRank = Rank( comm );
@@ -2166,9 +3121,17 @@ void Reduce( T* buf, int count, Op op, int root, Comm comm )
 }
 
 template<typename R>
-void Reduce( Complex<R>* buf, int count, Op op, int root, Comm comm )
+void Reduce( Complex<R>* buf, Int count, Op op, int root, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Reduce"))
+    if( count > MaxComplexReduction() )
+    {
+        ChunkedReduction
+        ( count, MaxComplexReduction(),
+          [&]( Int offset, int pieceCount )
+          { Reduce( &buf[offset], pieceCount, op, root, comm ); } );
+        return;
+    }
     if( count != 0 )
     {
         const int commRank = Rank( comm );
@@ -2246,54 +3209,65 @@ void Reduce( Complex<R>* buf, int count, Op op, int root, Comm comm )
     }
 }
 
-template void Reduce( byte* buf, int count, Op op, int root, Comm comm );
-template void Reduce( int* buf, int count, Op op, int root, Comm comm );
-template void Reduce( unsigned* buf, int count, Op op, int root, Comm comm );
-template void Reduce( long int* buf, int count, Op op, int root, Comm comm );
-template void Reduce( unsigned long* buf, int count, Op op, int root, Comm comm );
+template void Reduce( byte* buf, Int count, Op op, int root, Comm comm );
+template void Reduce( int* buf, Int count, Op op, int root, Comm comm );
+template void Reduce( unsigned* buf, Int count, Op op, int root, Comm comm );
+template void Reduce( long int* buf, Int count, Op op, int root, Comm comm );
+template void Reduce( unsigned long* buf, Int count, Op op, int root, Comm comm );
 #ifdef EL_HAVE_MPI_LONG_LONG
-template void Reduce( long long int* buf, int count, Op op, int root, Comm comm );
-template void Reduce( unsigned long long* buf, int count, Op op, int root, Comm comm );
+template void Reduce( long long int* buf, Int count, Op op, int root, Comm comm );
+template void Reduce( unsigned long long* buf, Int count, Op op, int root, Comm comm );
 #endif
-template void Reduce( float* buf, int count, Op op, int root, Comm comm );
-template void Reduce( double* buf, int count, Op op, int root, Comm comm );
-template void Reduce( Complex<float>* buf, int count, Op op, int root, Comm comm );
-template void Reduce( Complex<double>* buf, int count, Op op, int root, Comm comm );
-template void Reduce( ValueInt<Int>* buf, int count, Op op, int root, Comm comm );
-template void Reduce( ValueInt<float>* buf, int count, Op op, int root, Comm comm );
-template void Reduce( ValueInt<double>* buf, int count, Op op, int root, Comm comm );
-template void Reduce( ValueIntPair<Int>* buf, int count, Op op, int root, Comm comm );
-template void Reduce( ValueIntPair<float>* buf, int count, Op op, int root, Comm comm );
-template void Reduce( ValueIntPair<double>* buf, int count, Op op, int root, Comm comm );
+template void Reduce( float* buf, Int count, Op op, int root, Comm comm );
+template void Reduce( double* buf, Int count, Op op, int root, Comm comm );
+template void Reduce( Complex<float>* buf, Int count, Op op, int root, Comm comm );
+template void Reduce( Complex<double>* buf, Int count, Op op, int root, Comm comm );
+template void Reduce( ValueInt<Int>* buf, Int count, Op op, int root, Comm comm );
+template void Reduce( ValueInt<float>* buf, Int count, Op op, int root, Comm comm );
+template void Reduce( ValueInt<double>* buf, Int count, Op op, int root, Comm comm );
+template void Reduce( ValueIntPair<Int>* buf, Int count, Op op, int root, Comm comm );
+template void Reduce( ValueIntPair<float>* buf, Int count, Op op, int root, Comm comm );
+template void Reduce( ValueIntPair<double>* buf, Int count, Op op, int root, Comm comm );
 
 template<typename T>
-void Reduce( T* buf, int count, int root, Comm comm )
+void Reduce( T* buf, Int count, int root, Comm comm )
 { Reduce( buf, count, mpi::SUM, root, comm ); }
 
-template void Reduce( byte* buf, int count, int root, Comm comm );
-template void Reduce( int* buf, int count, int root, Comm comm );
-template void Reduce( unsigned* buf, int count, int root, Comm comm );
-template void Reduce( long int* buf, int count, int root, Comm comm );
-template void Reduce( unsigned long* buf, int count, int root, Comm comm );
-#ifdef EL_HAVE_MPI_LONG_LONG
-template void Reduce( long long int* buf, int count, int root, Comm comm );
-template void Reduce( unsigned long long* buf, int count, int root, Comm comm );
-#endif
-template void Reduce( float* buf, int count, int root, Comm comm );
-template void Reduce( double* buf, int count, int root, Comm comm );
-template void Reduce( Complex<float>* buf, int count, int root, Comm comm );
-template void Reduce( Complex<double>* buf, int count, int root, Comm comm );
-template void Reduce( ValueInt<Int>* buf, int count, int root, Comm comm );
-template void Reduce( ValueInt<float>* buf, int count, int root, Comm comm );
-template void Reduce( ValueInt<double>* buf, int count, int root, Comm comm );
-template void Reduce( ValueIntPair<Int>* buf, int count, int root, Comm comm );
-template void Reduce( ValueIntPair<float>* buf, int count, int root, Comm comm );
-template void Reduce( ValueIntPair<double>* buf, int count, int root, Comm comm );
+template void Reduce( byte* buf, Int count, int root, Comm comm );
+template void Reduce( int* buf, Int count, int root, Comm comm );
+template void Reduce( unsigned* buf, Int count, int root, Comm comm );
+template void Reduce( long int* buf, Int count, int root, Comm comm );
+template void Reduce( unsigned long* buf, Int count, int root, Comm comm );
+#ifdef EL_HAVE_MPI_LONG_LONG
+template void Reduce( long long int* buf, Int count, int root, Comm comm );
+template void Reduce( unsigned long long* buf, Int count, int root, Comm comm );
+#endif
+template void Reduce( float* buf, Int count, int root, Comm comm );
+template void Reduce( double* buf, Int count, int root, Comm comm );
+template void Reduce( Complex<float>* buf, Int count, int root, Comm comm );
+template void Reduce( Complex<double>* buf, Int count, int root, Comm comm );
+template void Reduce( ValueInt<Int>* buf, Int count, int root, Comm comm );
+template void Reduce( ValueInt<float>* buf, Int count, int root, Comm comm );
+template void Reduce( ValueInt<double>* buf, Int count, int root, Comm comm );
+template void Reduce( ValueIntPair<Int>* buf, Int count, int root, Comm comm );
+template void Reduce( ValueIntPair<float>* buf, Int count, int root, Comm comm );
+template void Reduce( ValueIntPair<double>* buf, Int count, int root, Comm comm );
 
 template<typename T>
-void AllReduce( const T* sbuf, T* rbuf, int count, Op op, Comm comm )
+void AllReduce( const T* sbuf, T* rbuf, Int count, Op op, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::AllReduce"))
+    if( count > maxMessageCount )
+    {
+        ChunkedReduction
+        ( count, maxMessageCount,
+          [&]( Int offset, int pieceCount )
+          {
+              AllReduce
+              ( &sbuf[offset], &rbuf[offset], pieceCount, op, comm );
+          } );
+        return;
+    }
     if( count != 0 )
     {
         SafeMpi
@@ -2305,9 +3279,20 @@ void AllReduce( const T* sbuf, T* rbuf, int count, Op op, Comm comm )
 
 template<typename R>
 void AllReduce
-( const Complex<R>* sbuf, Complex<R>* rbuf, int count, Op op, Comm comm )
+( const Complex<R>* sbuf, Complex<R>* rbuf, Int count, Op op, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::AllReduce"))
+    if( count > MaxComplexReduction() )
+    {
+        ChunkedReduction
+        ( count, MaxComplexReduction(),
+          [&]( Int offset, int pieceCount )
+          {
+              AllReduce
+              ( &sbuf[offset], &rbuf[offset], pieceCount, op, comm );
+          } );
+        return;
+    }
     if( count != 0 )
     {
 #ifdef EL_AVOID_COMPLEX_MPI
@@ -2334,49 +3319,102 @@ void AllReduce
     }
 }
 
-template void AllReduce( const byte* sbuf, byte* rbuf, int count, Op op, Comm comm );
-template void AllReduce( const int* sbuf, int* rbuf, int count, Op op, Comm comm );
-template void AllReduce( const unsigned* sbuf, unsigned* rbuf, int count, Op op, Comm comm );
-template void AllReduce( const long int* sbuf, long int* rbuf, int count, Op op, Comm comm );
-template void AllReduce( const unsigned long* sbuf, unsigned long* rbuf, int count, Op op, Comm comm );
+template void AllReduce( const byte* sbuf, byte* rbuf, Int count, Op op, Comm comm );
+template void AllReduce( const int* sbuf, int* rbuf, Int count, Op op, Comm comm );
+template void AllReduce( const unsigned* sbuf, unsigned* rbuf, Int count, Op op, Comm comm );
+template void AllReduce( const long int* sbuf, long int* rbuf, Int count, Op op, Comm comm );
+template void AllReduce( const unsigned long* sbuf, unsigned long* rbuf, Int count, Op op, Comm comm );
 #ifdef EL_HAVE_MPI_LONG_LONG
-template void AllReduce( const long long int* sbuf, long long int* rbuf, int count, Op op, Comm comm );
-template void AllReduce( const unsigned long long* sbuf, unsigned long long* rbuf, int count, Op op, Comm comm );
+template void AllReduce( const long long int* sbuf, long long int* rbuf, Int count, Op op, Comm comm );
+template void AllReduce( const unsigned long long* sbuf, unsigned long long* rbuf, Int count, Op op, Comm comm );
 #endif
-template void AllReduce( const float* sbuf, float* rbuf, int count, Op op, Comm comm );
-template void AllReduce( const double* sbuf, double* rbuf, int count, Op op, Comm comm );
-template void AllReduce( const Complex<float>* sbuf, Complex<float>* rbuf, int count, Op op, Comm comm );
-template void AllReduce( const Complex<double>* sbuf, Complex<double>* rbuf, int count, Op op, Comm comm );
-template void AllReduce( const ValueInt<Int>* sbuf, ValueInt<Int>* rbuf, int count, Op op, Comm comm );
-template void AllReduce( const ValueInt<float>* sbuf, ValueInt<float>* rbuf, int count, Op op, Comm comm );
-template void AllReduce( const ValueInt<double>* sbuf, ValueInt<double>* rbuf, int count, Op op, Comm comm );
-template void AllReduce( const ValueIntPair<Int>* sbuf, ValueIntPair<Int>* rbuf, int count, Op op, Comm comm );
-template void AllReduce( const ValueIntPair<float>* sbuf, ValueIntPair<float>* rbuf, int count, Op op, Comm comm );
-template void AllReduce( const ValueIntPair<double>* sbuf, ValueIntPair<double>* rbuf, int count, Op op, Comm comm );
+template void AllReduce( const float* sbuf, float* rbuf, Int count, Op op, Comm comm );
+template void AllReduce( const double* sbuf, double* rbuf, Int count, Op op, Comm comm );
+template void AllReduce( const Complex<float>* sbuf, Complex<float>* rbuf, Int count, Op op, Comm comm );
+template void AllReduce( const Complex<double>* sbuf, Complex<double>* rbuf, Int count, Op op, Comm comm );
+template void AllReduce( const ValueInt<Int>* sbuf, ValueInt<Int>* rbuf, Int count, Op op, Comm comm );
+template void AllReduce( const ValueInt<float>* sbuf, ValueInt<float>* rbuf, Int count, Op op, Comm comm );
+template void AllReduce( const ValueInt<double>* sbuf, ValueInt<double>* rbuf, Int count, Op op, Comm comm );
+template void AllReduce( const ValueIntPair<Int>* sbuf, ValueIntPair<Int>* rbuf, Int count, Op op, Comm comm );
+template void AllReduce( const ValueIntPair<float>* sbuf, ValueIntPair<float>* rbuf, Int count, Op op, Comm comm );
+template void AllReduce( const ValueIntPair<double>* sbuf, ValueIntPair<double>* rbuf, Int count, Op op, Comm comm );
 
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
 template<typename T>
-void AllReduce( const T* sbuf, T* rbuf, int count, Comm comm )
+void IAllReduce
+( const T* sbuf, T* rbuf, Int count, Op op, Comm comm, Request& request )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::IAllReduce"))
+    if( count > maxMessageCount )
+        LogicError("Nonblocking reductions cannot be split into pieces");
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Iallreduce)
+      ( const_cast<T*>(sbuf), rbuf, count, TypeMap<T>(), op.op, comm.comm,
+        &request ) );
+}
+
+template<typename R>
+void IAllReduce
+( const Complex<R>* sbuf, Complex<R>* rbuf, Int count, Op op, Comm comm,
+  Request& request )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::IAllReduce"))
+    if( count > MaxComplexReduction() )
+        LogicError("Nonblocking reductions cannot be split into pieces");
+#ifdef EL_AVOID_COMPLEX_MPI
+    if( op == SUM )
+    {
+        SafeMpi
+        ( EL_NONBLOCKING_COLL(Iallreduce)
+          ( const_cast<Complex<R>*>(sbuf), rbuf, 2*count, TypeMap<R>(),
+            op.op, comm.comm, &request ) );
+        return;
+    }
+#endif
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Iallreduce)
+      ( const_cast<Complex<R>*>(sbuf), rbuf, count, TypeMap<Complex<R>>(),
+        op.op, comm.comm, &request ) );
+}
+
+template void IAllReduce( const byte* sbuf, byte* rbuf, Int count, Op op, Comm comm, Request& request );
+template void IAllReduce( const int* sbuf, int* rbuf, Int count, Op op, Comm comm, Request& request );
+template void IAllReduce( const unsigned* sbuf, unsigned* rbuf, Int count, Op op, Comm comm, Request& request );
+template void IAllReduce( const long int* sbuf, long int* rbuf, Int count, Op op, Comm comm, Request& request );
+template void IAllReduce( const unsigned long* sbuf, unsigned long* rbuf, Int count, Op op, Comm comm, Request& request );
+#ifdef EL_HAVE_MPI_LONG_LONG
+template void IAllReduce( const long long int* sbuf, long long int* rbuf, Int count, Op op, Comm comm, Request& request );
+template void IAllReduce( const unsigned long long* sbuf, unsigned long long* rbuf, Int count, Op op, Comm comm, Request& request );
+#endif
+template void IAllReduce( const float* sbuf, float* rbuf, Int count, Op op, Comm comm, Request& request );
+template void IAllReduce( const double* sbuf, double* rbuf, Int count, Op op, Comm comm, Request& request );
+template void IAllReduce( const Complex<float>* sbuf, Complex<float>* rbuf, Int count, Op op, Comm comm, Request& request );
+template void IAllReduce( const Complex<double>* sbuf, Complex<double>* rbuf, Int count, Op op, Comm comm, Request& request );
+#endif // ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+
+template<typename T>
+void AllReduce( const T* sbuf, T* rbuf, Int count, Comm comm )
 { AllReduce( sbuf, rbuf, count, mpi::SUM, comm ); }
 
-template void AllReduce( const byte* sbuf, byte* rbuf, int count, Comm comm );
-template void AllReduce( const int* sbuf, int* rbuf, int count, Comm comm );
-template void AllReduce( const unsigned* sbuf, unsigned* rbuf, int count, Comm comm );
-template void AllReduce( const long int* sbuf, long int* rbuf, int count, Comm comm );
-template void AllReduce( const unsigned long* sbuf, unsigned long* rbuf, int count, Comm comm );
-#ifdef EL_HAVE_MPI_LONG_LONG
-template void AllReduce( const long long int* sbuf, long long int* rbuf, int count, Comm comm );
-template void AllReduce( const unsigned long long* sbuf, unsigned long long* rbuf, int count, Comm comm );
-#endif
-template void AllReduce( const float* sbuf, float* rbuf, int count, Comm comm );
-template void AllReduce( const double* sbuf, double* rbuf, int count, Comm comm );
-template void AllReduce( const Complex<float>* sbuf, Complex<float>* rbuf, int count, Comm comm );
-template void AllReduce( const Complex<double>* sbuf, Complex<double>* rbuf, int count, Comm comm );
-template void AllReduce( const ValueInt<Int>* sbuf, ValueInt<Int>* rbuf, int count, Comm comm );
-template void AllReduce( const ValueInt<float>* sbuf, ValueInt<float>* rbuf, int count, Comm comm );
-template void AllReduce( const ValueInt<double>* sbuf, ValueInt<double>* rbuf, int count, Comm comm );
-template void AllReduce( const ValueIntPair<Int>* sbuf, ValueIntPair<Int>* rbuf, int count, Comm comm );
-template void AllReduce( const ValueIntPair<float>* sbuf, ValueIntPair<float>* rbuf, int count, Comm comm );
-template void AllReduce( const ValueIntPair<double>* sbuf, ValueIntPair<double>* rbuf, int count, Comm comm );
+template void AllReduce( const byte* sbuf, byte* rbuf, Int count, Comm comm );
+template void AllReduce( const int* sbuf, int* rbuf, Int count, Comm comm );
+template void AllReduce( const unsigned* sbuf, unsigned* rbuf, Int count, Comm comm );
+template void AllReduce( const long int* sbuf, long int* rbuf, Int count, Comm comm );
+template void AllReduce( const unsigned long* sbuf, unsigned long* rbuf, Int count, Comm comm );
+#ifdef EL_HAVE_MPI_LONG_LONG
+template void AllReduce( const long long int* sbuf, long long int* rbuf, Int count, Comm comm );
+template void AllReduce( const unsigned long long* sbuf, unsigned long long* rbuf, Int count, Comm comm );
+#endif
+template void AllReduce( const float* sbuf, float* rbuf, Int count, Comm comm );
+template void AllReduce( const double* sbuf, double* rbuf, Int count, Comm comm );
+template void AllReduce( const Complex<float>* sbuf, Complex<float>* rbuf, Int count, Comm comm );
+template void AllReduce( const Complex<double>* sbuf, Complex<double>* rbuf, Int count, Comm comm );
+template void AllReduce( const ValueInt<Int>* sbuf, ValueInt<Int>* rbuf, Int count, Comm comm );
+template void AllReduce( const ValueInt<float>* sbuf, ValueInt<float>* rbuf, Int count, Comm comm );
+template void AllReduce( const ValueInt<double>* sbuf, ValueInt<double>* rbuf, Int count, Comm comm );
+template void AllReduce( const ValueIntPair<Int>* sbuf, ValueIntPair<Int>* rbuf, Int count, Comm comm );
+template void AllReduce( const ValueIntPair<float>* sbuf, ValueIntPair<float>* rbuf, Int count, Comm comm );
+template void AllReduce( const ValueIntPair<double>* sbuf, ValueIntPair<double>* rbuf, Int count, Comm comm );
 
 template<typename T>
 T AllReduce( T sb, Op op, Comm comm )
@@ -2427,9 +3465,17 @@ template ValueIntPair<float> AllReduce( ValueIntPair<float> sb, Comm comm );
 template ValueIntPair<double> AllReduce( ValueIntPair<double> sb, Comm comm );
 
 template<typename T>
-void AllReduce( T* buf, int count, Op op, Comm comm )
+void AllReduce( T* buf, Int count, Op op, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::AllReduce"))
+    if( count > maxMessageCount )
+    {
+        ChunkedReduction
+        ( count, maxMessageCount,
+          [&]( Int offset, int pieceCount )
+          { AllReduce( &buf[offset], pieceCount, op, comm ); } );
+        return;
+    }
     if( count != 0 )
     {
 #ifdef EL_HAVE_MPI_IN_PLACE
@@ -2447,9 +3493,17 @@ void AllReduce( T* buf, int count, Op op, Comm comm )
 }
 
 template<typename R>
-void AllReduce( Complex<R>* buf, int count, Op op, Comm comm )
+void AllReduce( Complex<R>* buf, Int count, Op op, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::AllReduce"))
+    if( count > MaxComplexReduction() )
+    {
+        ChunkedReduction
+        ( count, MaxComplexReduction(),
+          [&]( Int offset, int pieceCount )
+          { AllReduce( &buf[offset], pieceCount, op, comm ); } );
+        return;
+    }
     if( count != 0 )
     {
 #ifdef EL_AVOID_COMPLEX_MPI
@@ -2502,54 +3556,59 @@ void AllReduce( Complex<R>* buf, int count, Op op, Comm comm )
     }
 }
 
-template void AllReduce( byte* buf, int count, Op op, Comm comm );
-template void AllReduce( int* buf, int count, Op op, Comm comm );
-template void AllReduce( unsigned* buf, int count, Op op, Comm comm );
-template void AllReduce( long int* buf, int count, Op op, Comm comm );
-template void AllReduce( unsigned long* buf, int count, Op op, Comm comm );
+template void AllReduce( byte* buf, Int count, Op op, Comm comm );
+template void AllReduce( int* buf, Int count, Op op, Comm comm );
+template void AllReduce( unsigned* buf, Int count, Op op, Comm comm );
+template void AllReduce( long int* buf, Int count, Op op, Comm comm );
+template void AllReduce( unsigned long* buf, Int count, Op op, Comm comm );
 #ifdef EL_HAVE_MPI_LONG_LONG
-template void AllReduce( long long int* buf, int count, Op op, Comm comm );
-template void AllReduce( unsigned long long* buf, int count, Op op, Comm comm );
+template void AllReduce( long long int* buf, Int count, Op op, Comm comm );
+template void AllReduce( unsigned long long* buf, Int count, Op op, Comm comm );
 #endif
-template void AllReduce( float* buf, int count, Op op, Comm comm );
-template void AllReduce( double* buf, int count, Op op, Comm comm );
-template void AllReduce( Complex<float>* buf, int count, Op op, Comm comm );
-template void AllReduce( Complex<double>* buf, int count, Op op, Comm comm );
-template void AllReduce( ValueInt<Int>* buf, int count, Op op, Comm comm );
-template void AllReduce( ValueInt<float>* buf, int count, Op op, Comm comm );
-template void AllReduce( ValueInt<double>* buf, int count, Op op, Comm comm );
-template void AllReduce( ValueIntPair<Int>* buf, int count, Op op, Comm comm );
-template void AllReduce( ValueIntPair<float>* buf, int count, Op op, Comm comm );
-template void AllReduce( ValueIntPair<double>* buf, int count, Op op, Comm comm );
+template void AllReduce( float* buf, Int count, Op op, Comm comm );
+template void AllReduce( double* buf, Int count, Op op, Comm comm );
+template void AllReduce( Complex<float>* buf, Int count, Op op, Comm comm );
+template void AllReduce( Complex<double>* buf, Int count, Op op, Comm comm );
+template void AllReduce( ValueInt<Int>* buf, Int count, Op op, Comm comm );
+template void AllReduce( ValueInt<float>* buf, Int count, Op op, Comm comm );
+template void AllReduce( ValueInt<double>* buf, Int count, Op op, Comm comm );
+template void AllReduce( ValueIntPair<Int>* buf, Int count, Op op, Comm comm );
+template void AllReduce( ValueIntPair<float>* buf, Int count, Op op, Comm comm );
+template void AllReduce( ValueIntPair<double>* buf, Int count, Op op, Comm comm );
 
 template<typename T>
-void AllReduce( T* buf, int count, Comm comm )
+void AllReduce( T* buf, Int count, Comm comm )
 { AllReduce( buf, count, mpi::SUM, comm ); }
 
-template void AllReduce( byte* buf, int count, Comm comm );
-template void AllReduce( int* buf, int count, Comm comm );
-template void AllReduce( unsigned* buf, int count, Comm comm );
-template void AllReduce( long int* buf, int count, Comm comm );
-template void AllReduce( unsigned long* buf, int count, Comm comm );
-#ifdef EL_HAVE_MPI_LONG_LONG
-template void AllReduce( long long int* buf, int count, Comm comm );
-template void AllReduce( unsigned long long* buf, int count, Comm comm );
-#endif
-template void AllReduce( float* buf, int count, Comm comm );
-template void AllReduce( double* buf, int count, Comm comm );
-template void AllReduce( Complex<float>* buf, int count, Comm comm );
-template void AllReduce( Complex<double>* buf, int count, Comm comm );
-template void AllReduce( ValueInt<Int>* buf, int count, Comm comm );
-template void AllReduce( ValueInt<float>* buf, int count, Comm comm );
-template void AllReduce( ValueInt<double>* buf, int count, Comm comm );
-template void AllReduce( ValueIntPair<Int>* buf, int count, Comm comm );
-template void AllReduce( ValueIntPair<float>* buf, int count, Comm comm );
-template void AllReduce( ValueIntPair<double>* buf, int count, Comm comm );
+template void AllReduce( byte* buf, Int count, Comm comm );
+template void AllReduce( int* buf, Int count, Comm comm );
+template void AllReduce( unsigned* buf, Int count, Comm comm );
+template void AllReduce( long int* buf, Int count, Comm comm );
+template void AllReduce( unsigned long* buf, Int count, Comm comm );
+#ifdef EL_HAVE_MPI_LONG_LONG
+template void AllReduce( long long int* buf, Int count, Comm comm );
+template void AllReduce( unsigned long long* buf, Int count, Comm comm );
+#endif
+template void AllReduce( float* buf, Int count, Comm comm );
+template void AllReduce( double* buf, Int count, Comm comm );
+template void AllReduce( Complex<float>* buf, Int count, Comm comm );
+template void AllReduce( Complex<double>* buf, Int count, Comm comm );
+template void AllReduce( ValueInt<Int>* buf, Int count, Comm comm );
+template void AllReduce( ValueInt<float>* buf, Int count, Comm comm );
+template void AllReduce( ValueInt<double>* buf, Int count, Comm comm );
+template void AllReduce( ValueIntPair<Int>* buf, Int count, Comm comm );
+template void AllReduce( ValueIntPair<float>* buf, Int count, Comm comm );
+template void AllReduce( ValueIntPair<double>* buf, Int count, Comm comm );
 
 template<typename R>
-void ReduceScatter( R* sbuf, R* rbuf, int rc, Op op, Comm comm )
+void ReduceScatter( R* sbuf, R* rbuf, Int rc, Op op, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::ReduceScatter"))
+    if( rc > maxMessageCount )
+    {
+        ChunkedReduceScatter( sbuf, rbuf, rc, maxMessageCount, op, comm );
+        return;
+    }
 #ifdef EL_REDUCE_SCATTER_BLOCK_VIA_ALLREDUCE
     const int commSize = Size( comm );
     const int commRank = Rank( comm );
@@ -2568,9 +3627,14 @@ void ReduceScatter( R* sbuf, R* rbuf, int rc, Op op, Comm comm )
 
 template<typename R>
 void ReduceScatter
-( Complex<R>* sbuf, Complex<R>* rbuf, int rc, Op op, Comm comm )
+( Complex<R>* sbuf, Complex<R>* rbuf, Int rc, Op op, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::ReduceScatter"))
+    if( rc > MaxComplexReduction() )
+    {
+        ChunkedReduceScatter( sbuf, rbuf, rc, MaxComplexReduction(), op, comm );
+        return;
+    }
 #ifdef EL_REDUCE_SCATTER_BLOCK_VIA_ALLREDUCE
     const int commSize = Size( comm );
     const int commRank = Rank( comm );
@@ -2593,37 +3657,90 @@ void ReduceScatter
 #endif
 }
 
-template void ReduceScatter( byte* sbuf, byte* rbuf, int rc, Op op, Comm comm );
-template void ReduceScatter( int* sbuf, int* rbuf, int rc, Op op, Comm comm );
-template void ReduceScatter( unsigned* sbuf, unsigned* rbuf, int rc, Op op, Comm comm );
-template void ReduceScatter( long int* sbuf, long int* rbuf, int rc, Op op, Comm comm );
-template void ReduceScatter( unsigned long* sbuf, unsigned long* rbuf, int rc, Op op, Comm comm );
+template void ReduceScatter( byte* sbuf, byte* rbuf, Int rc, Op op, Comm comm );
+template void ReduceScatter( int* sbuf, int* rbuf, Int rc, Op op, Comm comm );
+template void ReduceScatter( unsigned* sbuf, unsigned* rbuf, Int rc, Op op, Comm comm );
+template void ReduceScatter( long int* sbuf, long int* rbuf, Int rc, Op op, Comm comm );
+template void ReduceScatter( unsigned long* sbuf, unsigned long* rbuf, Int rc, Op op, Comm comm );
 #ifdef EL_HAVE_MPI_LONG_LONG
-template void ReduceScatter( long long int* sbuf, long long int* rbuf, int rc, Op op, Comm comm );
-template void ReduceScatter( unsigned long long* sbuf, unsigned long long* rbuf, int rc, Op op, Comm comm );
+template void ReduceScatter( long long int* sbuf, long long int* rbuf, Int rc, Op op, Comm comm );
+template void ReduceScatter( unsigned long long* sbuf, unsigned long long* rbuf, Int rc, Op op, Comm comm );
 #endif
-template void ReduceScatter( float* sbuf, float* rbuf, int rc, Op op, Comm comm );
-template void ReduceScatter( double* sbuf, double* rbuf, int rc, Op op, Comm comm );
-template void ReduceScatter( Complex<float>* sbuf, Complex<float>* rbuf, int rc, Op op, Comm comm );
-template void ReduceScatter( Complex<double>* sbuf, Complex<double>* rbuf, int rc, Op op, Comm comm );
+template void ReduceScatter( float* sbuf, float* rbuf, Int rc, Op op, Comm comm );
+template void ReduceScatter( double* sbuf, double* rbuf, Int rc, Op op, Comm comm );
+template void ReduceScatter( Complex<float>* sbuf, Complex<float>* rbuf, Int rc, Op op, Comm comm );
+template void ReduceScatter( Complex<double>* sbuf, Complex<double>* rbuf, Int rc, Op op, Comm comm );
+
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+template<typename R>
+void IReduceScatter
+( const R* sbuf, R* rbuf, Int rc, Op op, Comm comm, Request& request )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::IReduceScatter"))
+    if( rc > maxMessageCount )
+        LogicError("Nonblocking reductions cannot be split into pieces");
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Ireduce_scatter_block)
+      ( const_cast<R*>(sbuf), rbuf, rc, TypeMap<R>(), op.op, comm.comm,
+        &request ) );
+}
+
+template<typename R>
+void IReduceScatter
+( const Complex<R>* sbuf, Complex<R>* rbuf, Int rc, Op op, Comm comm,
+  Request& request )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::IReduceScatter"))
+    if( rc > MaxComplexReduction() )
+        LogicError("Nonblocking reductions cannot be split into pieces");
+#ifdef EL_AVOID_COMPLEX_MPI
+    if( op == SUM )
+    {
+        SafeMpi
+        ( EL_NONBLOCKING_COLL(Ireduce_scatter_block)
+          ( const_cast<Complex<R>*>(sbuf), rbuf, 2*rc, TypeMap<R>(),
+            op.op, comm.comm, &request ) );
+        return;
+    }
+#endif
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Ireduce_scatter_block)
+      ( const_cast<Complex<R>*>(sbuf), rbuf, rc, TypeMap<Complex<R>>(),
+        op.op, comm.comm, &request ) );
+}
+
+template void IReduceScatter( const byte* sbuf, byte* rbuf, Int rc, Op op, Comm comm, Request& request );
+template void IReduceScatter( const int* sbuf, int* rbuf, Int rc, Op op, Comm comm, Request& request );
+template void IReduceScatter( const unsigned* sbuf, unsigned* rbuf, Int rc, Op op, Comm comm, Request& request );
+template void IReduceScatter( const long int* sbuf, long int* rbuf, Int rc, Op op, Comm comm, Request& request );
+template void IReduceScatter( const unsigned long* sbuf, unsigned long* rbuf, Int rc, Op op, Comm comm, Request& request );
+#ifdef EL_HAVE_MPI_LONG_LONG
+template void IReduceScatter( const long long int* sbuf, long long int* rbuf, Int rc, Op op, Comm comm, Request& request );
+template void IReduceScatter( const unsigned long long* sbuf, unsigned long long* rbuf, Int rc, Op op, Comm comm, Request& request );
+#endif
+template void IReduceScatter( const float* sbuf, float* rbuf, Int rc, Op op, Comm comm, Request& request );
+template void IReduceScatter( const double* sbuf, double* rbuf, Int rc, Op op, Comm comm, Request& request );
+template void IReduceScatter( const Complex<float>* sbuf, Complex<float>* rbuf, Int rc, Op op, Comm comm, Request& request );
+template void IReduceScatter( const Complex<double>* sbuf, Complex<double>* rbuf, Int rc, Op op, Comm comm, Request& request );
+#endif // ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
 
 template<typename T>
-void ReduceScatter( T* sbuf, T* rbuf, int rc, Comm comm )
+void ReduceScatter( T* sbuf, T* rbuf, Int rc, Comm comm )
 { ReduceScatter( sbuf, rbuf, rc, mpi::SUM, comm ); }
 
-template void ReduceScatter( byte* sbuf, byte* rbuf, int rc, Comm comm );
-template void ReduceScatter( int* sbuf, int* rbuf, int rc, Comm comm );
-template void ReduceScatter( unsigned* sbuf, unsigned* rbuf, int rc, Comm comm );
-template void ReduceScatter( long int* sbuf, long int* rbuf, int rc, Comm comm );
-template void ReduceScatter( unsigned long* sbuf, unsigned long* rbuf, int rc, Comm comm );
+template void ReduceScatter( byte* sbuf, byte* rbuf, Int rc, Comm comm );
+template void ReduceScatter( int* sbuf, int* rbuf, Int rc, Comm comm );
+template void ReduceScatter( unsigned* sbuf, unsigned* rbuf, Int rc, Comm comm );
+template void ReduceScatter( long int* sbuf, long int* rbuf, Int rc, Comm comm );
+template void ReduceScatter( unsigned long* sbuf, unsigned long* rbuf, Int rc, Comm comm );
 #ifdef EL_HAVE_MPI_LONG_LONG
-template void ReduceScatter( long long int* sbuf, long long int* rbuf, int rc, Comm comm );
-template void ReduceScatter( unsigned long long* sbuf, unsigned long long* rbuf, int rc, Comm comm );
+template void ReduceScatter( long long int* sbuf, long long int* rbuf, Int rc, Comm comm );
+template void ReduceScatter( unsigned long long* sbuf, unsigned long long* rbuf, Int rc, Comm comm );
 #endif
-template void ReduceScatter( float* sbuf, float* rbuf, int rc, Comm comm );
-template void ReduceScatter( double* sbuf, double* rbuf, int rc, Comm comm );
-template void ReduceScatter( Complex<float>* sbuf, Complex<float>* rbuf, int rc, Comm comm );
-template void ReduceScatter( Complex<double>* sbuf, Complex<double>* rbuf, int rc, Comm comm );
+template void ReduceScatter( float* sbuf, float* rbuf, Int rc, Comm comm );
+template void ReduceScatter( double* sbuf, double* rbuf, Int rc, Comm comm );
+template void ReduceScatter( Complex<float>* sbuf, Complex<float>* rbuf, Int rc, Comm comm );
+template void ReduceScatter( Complex<double>* sbuf, Complex<double>* rbuf, Int rc, Comm comm );
 
 template<typename T>
 T ReduceScatter( T sb, Op op, Comm comm )
@@ -2662,9 +3779,14 @@ template Complex<float> ReduceScatter( Complex<float> sb, Comm comm );
 template Complex<double> ReduceScatter( Complex<double> sb, Comm comm );
 
 template<typename R>
-void ReduceScatter( R* buf, int rc, Op op, Comm comm )
+void ReduceScatter( R* buf, Int rc, Op op, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::ReduceScatter"))
+    if( rc > maxMessageCount )
+    {
+        ChunkedReduceScatter( buf, buf, rc, maxMessageCount, op, comm );
+        return;
+    }
 #ifdef EL_REDUCE_SCATTER_BLOCK_VIA_ALLREDUCE
     const int commSize = Size( comm );
     const int commRank = Rank( comm );
@@ -2693,9 +3815,14 @@ void ReduceScatter( R* buf, int rc, Op op, Comm comm )
 
 // TODO: Handle case where op is not summation
 template<typename R>
-void ReduceScatter( Complex<R>* buf, int rc, Op op, Comm comm )
+void ReduceScatter( Complex<R>* buf, Int rc, Op op, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::ReduceScatter"))
+    if( rc > MaxComplexReduction() )
+    {
+        ChunkedReduceScatter( buf, buf, rc, MaxComplexReduction(), op, comm );
+        return;
+    }
 #ifdef EL_REDUCE_SCATTER_BLOCK_VIA_ALLREDUCE
     const int commSize = Size( comm );
     const int commRank = Rank( comm );
@@ -2737,37 +3864,37 @@ void ReduceScatter( Complex<R>* buf, int rc, Op op, Comm comm )
 #endif
 }
 
-template void ReduceScatter( byte* buf, int rc, Op op, Comm comm );
-template void ReduceScatter( int* buf, int rc, Op op, Comm comm );
-template void ReduceScatter( unsigned* buf, int rc, Op op, Comm comm );
-template void ReduceScatter( long int* buf, int rc, Op op, Comm comm );
-template void ReduceScatter( unsigned long* buf, int rc, Op op, Comm comm );
+template void ReduceScatter( byte* buf, Int rc, Op op, Comm comm );
+template void ReduceScatter( int* buf, Int rc, Op op, Comm comm );
+template void ReduceScatter( unsigned* buf, Int rc, Op op, Comm comm );
+template void ReduceScatter( long int* buf, Int rc, Op op, Comm comm );
+template void ReduceScatter( unsigned long* buf, Int rc, Op op, Comm comm );
 #ifdef EL_HAVE_MPI_LONG_LONG
-template void ReduceScatter( long long int* buf, int rc, Op op, Comm comm );
-template void ReduceScatter( unsigned long long* buf, int rc, Op op, Comm comm );
+template void ReduceScatter( long long int* buf, Int rc, Op op, Comm comm );
+template void ReduceScatter( unsigned long long* buf, Int rc, Op op, Comm comm );
 #endif
-template void ReduceScatter( float* buf, int rc, Op op, Comm comm );
-template void ReduceScatter( double* buf, int rc, Op op, Comm comm );
-template void ReduceScatter( Complex<float>* buf, int rc, Op op, Comm comm );
-template void ReduceScatter( Complex<double>* buf, int rc, Op op, Comm comm );
+template void ReduceScatter( float* buf, Int rc, Op op, Comm comm );
+template void ReduceScatter( double* buf, Int rc, Op op, Comm comm );
+template void ReduceScatter( Complex<float>* buf, Int rc, Op op, Comm comm );
+template void ReduceScatter( Complex<double>* buf, Int rc, Op op, Comm comm );
 
 template<typename T>
-void ReduceScatter( T* buf, int rc, Comm comm )
+void ReduceScatter( T* buf, Int rc, Comm comm )
 { ReduceScatter( buf, rc, mpi::SUM, comm ); }
 
-template void ReduceScatter( byte* buf, int rc, Comm comm );
-template void ReduceScatter( int* buf, int rc, Comm comm );
-template void ReduceScatter( unsigned* buf, int rc, Comm comm );
-template void ReduceScatter( long int* buf, int rc, Comm comm );
-template void ReduceScatter( unsigned long* buf, int rc, Comm comm );
+template void ReduceScatter( byte* buf, Int rc, Comm comm );
+template void ReduceScatter( int* buf, Int rc, Comm comm );
+template void ReduceScatter( unsigned* buf, Int rc, Comm comm );
+template void ReduceScatter( long int* buf, Int rc, Comm comm );
+template void ReduceScatter( unsigned long* buf, Int rc, Comm comm );
 #ifdef EL_HAVE_MPI_LONG_LONG
-template void ReduceScatter( long long int* buf, int rc, Comm comm );
-template void ReduceScatter( unsigned long long* buf, int rc, Comm comm );
+template void ReduceScatter( long long int* buf, Int rc, Comm comm );
+template void ReduceScatter( unsigned long long* buf, Int rc, Comm comm );
 #endif
-template void ReduceScatter( float* buf, int rc, Comm comm );
-template void ReduceScatter( double* buf, int rc, Comm comm );
-template void ReduceScatter( Complex<float>* buf, int rc, Comm comm );
-template void ReduceScatter( Complex<double>* buf, int rc, Comm comm );
+template void ReduceScatter( float* buf, Int rc, Comm comm );
+template void ReduceScatter( double* buf, Int rc, Comm comm );
+template void ReduceScatter( Complex<float>* buf, Int rc, Comm comm );
+template void ReduceScatter( Complex<double>* buf, Int rc, Comm comm );
 
 template<typename R>
 void ReduceScatter
@@ -2847,13 +3974,91 @@ template void ReduceScatter( const double* sbuf, double* rbuf, const int* rcs, C
 template void ReduceScatter( const Complex<float>* sbuf, Complex<float>* rbuf, const int* rcs, Comm comm );
 template void ReduceScatter( const Complex<double>* sbuf, Complex<double>* rbuf, const int* rcs, Comm comm );
 
+// Two-level collectives
+// =====================
+
+template<typename T>
+void HierarchicalAllReduce
+( T* buf, Int count, Op op, Comm nodeComm, Comm interNodeComm )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::HierarchicalAllReduce"))
+    Reduce( buf, count, op, 0, nodeComm );
+    if( Rank(nodeComm) == 0 )
+        AllReduce( buf, count, op, interNodeComm );
+    Broadcast( buf, count, 0, nodeComm );
+}
+
+template<typename T>
+void HierarchicalAllGather
+( const T* sbuf, Int sc,
+        T* rbuf, Int rc, Comm comm, Comm nodeComm, Comm interNodeComm,
+  bool broadcast )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("mpi::HierarchicalAllGather");
+        if( sc != rc )
+            LogicError("Send and recv counts must match");
+    )
+    const int commSize = Size( comm );
+    const int nodeSize = Size( nodeComm );
+    const int nodeRank = Rank( nodeComm );
+
+    // Gather the contributions (and ranks) from our node onto its root
+    const int rank = Rank( comm );
+    std::vector<int> nodeRanks(nodeSize);
+    std::vector<T> nodeBuf;
+    if( nodeRank == 0 )
+        nodeBuf.resize( nodeSize*sc );
+    Gather( &rank, 1, nodeRanks.data(), 1, 0, nodeComm );
+    Gather( sbuf, sc, nodeBuf.data(), sc, 0, nodeComm );
+
+    if( nodeRank == 0 )
+    {
+        // Exchange the gathered data between the node roots
+        const int numNodes = Size( interNodeComm );
+        std::vector<int> nodeSizes(numNodes);
+        std::vector<Int> rankCounts(numNodes), rankDispls(numNodes),
+                         dataCounts(numNodes), dataDispls(numNodes);
+        AllGather( &nodeSize, 1, nodeSizes.data(), 1, interNodeComm );
+        Int offset = 0;
+        for( int node=0; node<numNodes; ++node )
+        {
+            rankCounts[node] = nodeSizes[node];
+            rankDispls[node] = offset;
+            dataCounts[node] = nodeSizes[node]*sc;
+            dataDispls[node] = offset*sc;
+            offset += nodeSizes[node];
+        }
+        DEBUG_ONLY(
+            if( offset != commSize )
+                LogicError("Node communicators did not partition comm");
+        )
+        std::vector<int> allRanks(commSize);
+        std::vector<T> allBuf(commSize*sc);
+        AllGather
+        ( nodeRanks.data(), nodeSize, 
+          allRanks.data(), rankCounts.data(), rankDispls.data(), 
+          interNodeComm );
+        AllGather
+        ( nodeBuf.data(), nodeSize*sc, 
+          allBuf.data(), dataCounts.data(), dataDispls.data(), 
+          interNodeComm );
+
+        // Reorder the contributions by their rank in comm
+        for( int q=0; q<commSize; ++q )
+            MemCopy( &rbuf[allRanks[q]*rc], &allBuf[q*sc], sc );
+    }
+    if( broadcast )
+        Broadcast( rbuf, commSize*rc, 0, nodeComm );
+}
+
 void VerifySendsAndRecvs
-( const std::vector<int>& sendCounts,
-  const std::vector<int>& recvCounts, mpi::Comm comm )
+( const std::vector<Int>& sendCounts,
+  const std::vector<Int>& recvCounts, mpi::Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::VerifySendsAndRecvs"))
     const int commSize = mpi::Size( comm );
-    std::vector<int> actualRecvCounts(commSize);
+    std::vector<Int> actualRecvCounts(commSize);
     mpi::AllToAll
     ( &sendCounts[0],       1,
       &actualRecvCounts[0], 1, comm );
@@ -2867,9 +4072,9 @@ void VerifySendsAndRecvs
 template<typename T>
 void SparseAllToAll
 ( const std::vector<T>& sendBuffer,
-  const std::vector<int>& sendCounts, const std::vector<int>& sendDispls,
+  const std::vector<Int>& sendCounts, const std::vector<Int>& sendDispls,
         std::vector<T>& recvBuffer,
-  const std::vector<int>& recvCounts, const std::vector<int>& recvDispls,
+  const std::vector<Int>& recvCounts, const std::vector<Int>& recvDispls,
         mpi::Comm comm )
 {
 #ifdef EL_USE_CUSTOM_ALLTOALLV
@@ -2887,8 +4092,8 @@ void SparseAllToAll
     int rCount=0;
     for( int proc=0; proc<commSize; ++proc )
     {
-        int count = recvCounts[proc];
-        int displ = recvDispls[proc];
+        const Int count = recvCounts[proc];
+        const Int displ = recvDispls[proc];
         if( count != 0 )
             mpi::IRecv
             ( &recvBuffer[displ], count, proc, comm, requests[rCount++] );
@@ -2899,8 +4104,8 @@ void SparseAllToAll
 #endif
     for( int proc=0; proc<commSize; ++proc )
     {
-        int count = sendCounts[proc];
-        int displ = sendDispls[proc];
+        const Int count = sendCounts[proc];
+        const Int displ = sendDispls[proc];
         if( count != 0 )
             mpi::ISend
             ( &sendBuffer[displ], count, proc, comm, requests[rCount++] );
@@ -2916,10 +4121,16 @@ void SparseAllToAll
 #define PROTO(T) \
   template void SparseAllToAll \
   ( const std::vector<T>& sendBuffer, \
-    const std::vector<int>& sendCounts, const std::vector<int>& sendDispls, \
+    const std::vector<Int>& sendCounts, const std::vector<Int>& sendDispls, \
           std::vector<T>& recvBuffer, \
-    const std::vector<int>& recvCounts, const std::vector<int>& recvDispls, \
-          mpi::Comm comm );
+    const std::vector<Int>& recvCounts, const std::vector<Int>& recvDispls, \
+          mpi::Comm comm ); \
+  template void HierarchicalAllReduce \
+  ( T* buf, Int count, Op op, Comm nodeComm, Comm interNodeComm ); \
+  template void HierarchicalAllGather \
+  ( const T* sbuf, Int sc, \
+          T* rbuf, Int rc, Comm comm, Comm nodeComm, Comm interNodeComm, \
+    bool broadcast );
 #include "El/macros/Instantiate.h"
 
 } // namespace mpi
@@ -0,0 +1,31 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_IO_BINARYCSR_HPP
+#define EL_IO_BINARYCSR_HPP
+
+namespace El {
+
+// The BINARY_CSR format consists of
+//
+//   1. A header of five 64-bit integers:
+//        height, width, number of nonzeros, sizeof(T), and whether T is complex
+//   2. The height+1 row offsets as 64-bit integers
+//   3. The column indices of the nonzeros as 64-bit integers
+//   4. The values of the nonzeros
+//
+// so that the portion of the file corresponding to any contiguous set of
+// rows can be located using only the header and the row offsets.
+
+typedef long long int CSRInt;
+const Int CSR_HEADER_SIZE = 5;
+
+} // namespace El
+
+#endif // ifndef EL_IO_BINARYCSR_HPP
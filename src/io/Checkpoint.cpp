@@ -0,0 +1,621 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+#include "./Read/BinaryCSR.hpp"
+#include "./Write/BinaryCSR.hpp"
+
+// A checkpoint consists of a fixed-size header of 64-bit integers,
+//
+//    magic, kind, height, width, sizeof(T), isComplex,
+//    colDist, rowDist, colAlign, rowAlign, root,
+//    gridHeight, gridWidth, gridOrder, numProcesses, checksum
+//
+// followed by the data in a distribution-independent layout: dense matrices
+// and multivectors are stored in column-major order (each process writes
+// its local entries directly through an MPI-IO file view), and sparse
+// matrices are stored in the BINARY_CSR format. Since the layout does not
+// depend upon the distribution, a checkpoint can be restarted onto any grid;
+// the recorded distribution is reused when it is compatible.
+//
+// The checksum is the sum (modulo 2^64) of a hash of each (index,value)
+// pair, so that it can be accumulated in any distribution.
+
+namespace El {
+
+namespace {
+
+typedef long long int CkptInt;
+
+const CkptInt CHECKPOINT_MAGIC = 0x454C434B50543031LL; // "ELCKPT01"
+const Int CHECKPOINT_HEADER_SIZE = 16;
+const mpi::Offset CHECKPOINT_DATA_START =
+  CHECKPOINT_HEADER_SIZE*sizeof(CkptInt);
+const std::string CHECKPOINT_EXTENSION = "ckpt";
+
+enum CheckpointKind
+{
+    DENSE_CHECKPOINT=0,
+    SPARSE_CHECKPOINT=1,
+    MULTIVEC_CHECKPOINT=2
+};
+
+enum CheckpointField
+{
+    MAGIC_FIELD=0,
+    KIND_FIELD,
+    HEIGHT_FIELD,
+    WIDTH_FIELD,
+    SIZEOF_FIELD,
+    COMPLEX_FIELD,
+    COLDIST_FIELD,
+    ROWDIST_FIELD,
+    COLALIGN_FIELD,
+    ROWALIGN_FIELD,
+    ROOT_FIELD,
+    GRIDHEIGHT_FIELD,
+    GRIDWIDTH_FIELD,
+    GRIDORDER_FIELD,
+    NUMPROCS_FIELD,
+    CHECKSUM_FIELD
+};
+
+// FNV-1a hash of an index and a value
+template<typename T>
+inline unsigned long long EntryHash( CkptInt index, const T& value )
+{
+    unsigned long long hash = 14695981039346656037ULL;
+    const byte* indexBytes = (const byte*)&index;
+    for( std::size_t k=0; k<sizeof(CkptInt); ++k )
+    {
+        hash ^= indexBytes[k];
+        hash *= 1099511628211ULL;
+    }
+    const byte* valueBytes = (const byte*)&value;
+    for( std::size_t k=0; k<sizeof(T); ++k )
+    {
+        hash ^= valueBytes[k];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+template<typename T>
+inline void InitializeHeader( CkptInt* header, CheckpointKind kind )
+{
+    for( Int k=0; k<CHECKPOINT_HEADER_SIZE; ++k )
+        header[k] = 0;
+    header[MAGIC_FIELD] = CHECKPOINT_MAGIC;
+    header[KIND_FIELD] = kind;
+    header[SIZEOF_FIELD] = sizeof(T);
+    header[COMPLEX_FIELD] = IsComplex<T>::val;
+}
+
+template<typename T>
+inline void ReadHeader
+( mpi::File file, CkptInt* header, CheckpointKind kind,
+  const std::string filename )
+{
+    mpi::FileReadAtAll
+    ( file, 0, (byte*)header, CHECKPOINT_HEADER_SIZE*sizeof(CkptInt) );
+    if( header[MAGIC_FIELD] != CHECKPOINT_MAGIC )
+        RuntimeError(filename," is not a checkpoint");
+    if( header[KIND_FIELD] != kind )
+        RuntimeError(filename," contains a different kind of object");
+    if( header[SIZEOF_FIELD] != CkptInt(sizeof(T)) ||
+        header[COMPLEX_FIELD] != CkptInt(IsComplex<T>::val) )
+        RuntimeError
+        ("Datatype of ",filename," did not match: entries were of size ",
+         header[SIZEOF_FIELD]," and complex=",header[COMPLEX_FIELD]);
+}
+
+inline void CheckChecksum
+( unsigned long long checksum, const CkptInt* header,
+  const std::string filename )
+{
+    if( CkptInt(checksum) != header[CHECKSUM_FIELD] )
+        RuntimeError("Checksum mismatch while restarting from ",filename);
+}
+
+// Only one member of each redundant set of processes contributes
+template<typename T>
+unsigned long long LocalChecksum( const AbstractDistMatrix<T>& A )
+{
+    unsigned long long checksum = 0;
+    if( !A.Participating() || A.RedundantRank() != 0 )
+        return checksum;
+    const Int height = A.Height();
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const CkptInt j = A.GlobalCol(jLoc);
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const CkptInt i = A.GlobalRow(iLoc);
+            checksum += EntryHash( i+j*height, A.GetLocal(iLoc,jLoc) );
+        }
+    }
+    return checksum;
+}
+
+template<typename T>
+unsigned long long LocalChecksum( const DistMultiVec<T>& X )
+{
+    unsigned long long checksum = 0;
+    const Int height = X.Height();
+    const Int width = X.Width();
+    const Int firstLocalRow = X.FirstLocalRow();
+    const Int localHeight = X.LocalHeight();
+    for( Int j=0; j<width; ++j )
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            checksum +=
+              EntryHash( firstLocalRow+iLoc+CkptInt(j)*height,
+                         X.GetLocal(iLoc,j) );
+    return checksum;
+}
+
+template<typename T>
+unsigned long long LocalChecksum( const DistSparseMatrix<T>& A )
+{
+    unsigned long long checksum = 0;
+    const Int height = A.Height();
+    const Int numLocalEntries = A.NumLocalEntries();
+    for( Int k=0; k<numLocalEntries; ++k )
+        checksum +=
+          EntryHash( A.Row(k)+CkptInt(A.Col(k))*height, A.Value(k) );
+    return checksum;
+}
+
+// Transfer a multivector's local rows to/from the column-major file image
+template<typename T>
+void SetMultiVecView( mpi::File file, const DistMultiVec<T>& X )
+{
+    const Int width = X.Width();
+    std::vector<mpi::Offset> runOffsets, runLengths, colOffsets(width);
+    if( X.LocalHeight() > 0 )
+    {
+        runOffsets.push_back( mpi::Offset(X.FirstLocalRow())*sizeof(T) );
+        runLengths.push_back( mpi::Offset(X.LocalHeight())*sizeof(T) );
+    }
+    for( Int j=0; j<width; ++j )
+        colOffsets[j] = mpi::Offset(j)*X.Height()*sizeof(T);
+    mpi::FileSetView
+    ( file, CHECKPOINT_DATA_START, runOffsets, runLengths, colOffsets );
+}
+
+// Fill in the header of a dense checkpoint, then collectively create and size
+// the file and write the header from the root
+template<typename T>
+void CreateCheckpoint
+( const AbstractDistMatrix<T>& A, const std::string filename, mpi::File& file )
+{
+    const Grid& g = A.Grid();
+    mpi::Comm comm = g.ViewingComm();
+
+    CkptInt header[CHECKPOINT_HEADER_SIZE];
+    InitializeHeader<T>( header, DENSE_CHECKPOINT );
+    header[HEIGHT_FIELD] = A.Height();
+    header[WIDTH_FIELD] = A.Width();
+    header[COLDIST_FIELD] = A.ColDist();
+    header[ROWDIST_FIELD] = A.RowDist();
+    header[COLALIGN_FIELD] = A.ColAlign();
+    header[ROWALIGN_FIELD] = A.RowAlign();
+    header[ROOT_FIELD] = A.Root();
+    header[GRIDHEIGHT_FIELD] = g.Height();
+    header[GRIDWIDTH_FIELD] = g.Width();
+    header[GRIDORDER_FIELD] = g.Order();
+    header[NUMPROCS_FIELD] = g.Size();
+    header[CHECKSUM_FIELD] = mpi::AllReduce( LocalChecksum( A ), comm );
+
+    mpi::FileOpen( comm, filename, mpi::MODE_CREATE|mpi::MODE_WRONLY, file );
+    mpi::FileSetSize
+    ( file, CHECKPOINT_DATA_START +
+            mpi::Offset(A.Height())*A.Width()*sizeof(T) );
+    if( mpi::Rank(comm) == 0 )
+        mpi::FileWriteAt
+        ( file, 0, (const byte*)header,
+          CHECKPOINT_HEADER_SIZE*sizeof(CkptInt) );
+}
+
+template<typename T>
+void CreateCheckpoint
+( const DistMultiVec<T>& X, const std::string filename, mpi::File& file )
+{
+    mpi::Comm comm = X.Comm();
+
+    CkptInt header[CHECKPOINT_HEADER_SIZE];
+    InitializeHeader<T>( header, MULTIVEC_CHECKPOINT );
+    header[HEIGHT_FIELD] = X.Height();
+    header[WIDTH_FIELD] = X.Width();
+    header[NUMPROCS_FIELD] = mpi::Size( comm );
+    header[CHECKSUM_FIELD] = mpi::AllReduce( LocalChecksum( X ), comm );
+
+    mpi::FileOpen( comm, filename, mpi::MODE_CREATE|mpi::MODE_WRONLY, file );
+    mpi::FileSetSize
+    ( file, CHECKPOINT_DATA_START +
+            mpi::Offset(X.Height())*X.Width()*sizeof(T) );
+    if( mpi::Rank(comm) == 0 )
+        mpi::FileWriteAt
+        ( file, 0, (const byte*)header,
+          CHECKPOINT_HEADER_SIZE*sizeof(CkptInt) );
+}
+
+// Collectively open a checkpoint, read its header, and resize (and, when the
+// recorded distribution is compatible, realign) the target
+template<typename T>
+void OpenRestart
+( AbstractDistMatrix<T>& A, const std::string filename, mpi::File& file,
+  CkptInt* header )
+{
+    const Grid& g = A.Grid();
+    mpi::FileOpen( g.ViewingComm(), filename, mpi::MODE_RDONLY, file );
+    ReadHeader<T>( file, header, DENSE_CHECKPOINT, filename );
+
+    if( header[COLDIST_FIELD] == A.ColDist() &&
+        header[ROWDIST_FIELD] == A.RowDist() &&
+        header[GRIDHEIGHT_FIELD] == g.Height() &&
+        header[GRIDWIDTH_FIELD] == g.Width() )
+    {
+        if( !A.ColConstrained() && !A.RowConstrained() )
+            A.Align( header[COLALIGN_FIELD], header[ROWALIGN_FIELD], false );
+        if( !A.RootConstrained() )
+            A.SetRoot( header[ROOT_FIELD], false );
+    }
+    A.Resize( header[HEIGHT_FIELD], header[WIDTH_FIELD] );
+}
+
+template<typename T>
+void OpenRestart
+( DistMultiVec<T>& X, const std::string filename, mpi::File& file,
+  CkptInt* header )
+{
+    mpi::FileOpen( X.Comm(), filename, mpi::MODE_RDONLY, file );
+    ReadHeader<T>( file, header, MULTIVEC_CHECKPOINT, filename );
+    X.Resize( header[HEIGHT_FIELD], header[WIDTH_FIELD] );
+}
+
+// Set the file view of the local data and pack it in column-major order
+template<typename T>
+void ViewAndPack
+( mpi::File file, const AbstractDistMatrix<T>& A, std::vector<T>& buffer )
+{
+    const bool participating =
+      SetFileView( file, A, CHECKPOINT_DATA_START, true );
+    const Int localHeight = ( participating ? A.LocalHeight() : 0 );
+    const Int localWidth = ( participating ? A.LocalWidth() : 0 );
+    buffer.resize( localHeight*localWidth );
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        MemCopy
+        ( &buffer[jLoc*localHeight], A.LockedBuffer(0,jLoc), localHeight );
+}
+
+template<typename T>
+void ViewAndPack
+( mpi::File file, const DistMultiVec<T>& X, std::vector<T>& buffer )
+{
+    SetMultiVecView( file, X );
+    const Int localHeight = X.LocalHeight();
+    const Int width = X.Width();
+    const El::Matrix<T>& XLoc = X.LockedMatrix();
+    buffer.resize( localHeight*width );
+    for( Int j=0; j<width; ++j )
+        MemCopy( &buffer[j*localHeight], XLoc.LockedBuffer(0,j), localHeight );
+}
+
+// Set the file view of the local data and size the receive buffer
+template<typename T>
+void ViewForUnpack
+( mpi::File file, const AbstractDistMatrix<T>& A, std::vector<T>& buffer )
+{
+    const bool participating = SetFileView( file, A, CHECKPOINT_DATA_START );
+    if( participating )
+        buffer.resize( A.LocalHeight()*A.LocalWidth() );
+}
+
+template<typename T>
+void ViewForUnpack
+( mpi::File file, const DistMultiVec<T>& X, std::vector<T>& buffer )
+{
+    SetMultiVecView( file, X );
+    buffer.resize( X.LocalHeight()*X.Width() );
+}
+
+// Unpack the local data and verify the checksum
+template<typename T>
+void UnpackAndCheck
+( const std::vector<T>& buffer, AbstractDistMatrix<T>& A,
+  const CkptInt* header, const std::string filename )
+{
+    if( !buffer.empty() )
+    {
+        const Int localHeight = A.LocalHeight();
+        const Int localWidth = A.LocalWidth();
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+            MemCopy
+            ( A.Buffer(0,jLoc), &buffer[jLoc*localHeight], localHeight );
+    }
+    CheckChecksum
+    ( mpi::AllReduce( LocalChecksum( A ), A.Grid().ViewingComm() ), header,
+      filename );
+}
+
+template<typename T>
+void UnpackAndCheck
+( const std::vector<T>& buffer, DistMultiVec<T>& X,
+  const CkptInt* header, const std::string filename )
+{
+    const Int localHeight = X.LocalHeight();
+    const Int width = X.Width();
+    El::Matrix<T>& XLoc = X.Matrix();
+    for( Int j=0; j<width; ++j )
+        MemCopy( XLoc.Buffer(0,j), &buffer[j*localHeight], localHeight );
+    CheckChecksum
+    ( mpi::AllReduce( LocalChecksum( X ), X.Comm() ), header, filename );
+}
+
+template<typename T,typename DistType>
+void CheckpointHelper( const DistType& A, std::string basename )
+{
+    const std::string filename = basename + "." + CHECKPOINT_EXTENSION;
+    mpi::File file;
+    CreateCheckpoint( A, filename, file );
+    std::vector<T> buffer;
+    ViewAndPack( file, A, buffer );
+    mpi::FileWriteAll
+    ( file, (const byte*)buffer.data(), buffer.size()*sizeof(T) );
+    mpi::FileClose( file );
+}
+
+template<typename T,typename DistType>
+void RestartHelper( DistType& A, const std::string filename )
+{
+    mpi::File file;
+    CkptInt header[CHECKPOINT_HEADER_SIZE];
+    OpenRestart( A, filename, file, header );
+    std::vector<T> buffer;
+    ViewForUnpack( file, A, buffer );
+    mpi::FileReadAll( file, (byte*)buffer.data(), buffer.size()*sizeof(T) );
+    mpi::FileClose( file );
+    UnpackAndCheck( buffer, A, header, filename );
+}
+
+} // anonymous namespace
+
+// Dense matrices
+// ==============
+
+template<typename T>
+void Checkpoint( const AbstractDistMatrix<T>& A, std::string basename )
+{
+    DEBUG_ONLY(CallStackEntry cse("Checkpoint"))
+    CheckpointHelper<T>( A, basename );
+}
+
+template<typename T>
+void Restart( AbstractDistMatrix<T>& A, const std::string filename )
+{
+    DEBUG_ONLY(CallStackEntry cse("Restart"))
+    RestartHelper<T>( A, filename );
+}
+
+// Sparse matrices
+// ===============
+
+template<typename T>
+void Checkpoint( const DistSparseMatrix<T>& A, std::string basename )
+{
+    DEBUG_ONLY(CallStackEntry cse("Checkpoint"))
+    const std::string filename = basename + "." + CHECKPOINT_EXTENSION;
+    mpi::Comm comm = A.Comm();
+
+    CkptInt header[CHECKPOINT_HEADER_SIZE];
+    InitializeHeader<T>( header, SPARSE_CHECKPOINT );
+    header[HEIGHT_FIELD] = A.Height();
+    header[WIDTH_FIELD] = A.Width();
+    header[NUMPROCS_FIELD] = mpi::Size( comm );
+    header[CHECKSUM_FIELD] = mpi::AllReduce( LocalChecksum( A ), comm );
+
+    mpi::File file;
+    mpi::FileOpen( comm, filename, mpi::MODE_CREATE|mpi::MODE_WRONLY, file );
+    write::BinaryCSR( A, file, CHECKPOINT_DATA_START );
+    if( mpi::Rank(comm) == 0 )
+        mpi::FileWriteAt
+        ( file, 0, (const byte*)header,
+          CHECKPOINT_HEADER_SIZE*sizeof(CkptInt) );
+    mpi::FileClose( file );
+}
+
+template<typename T>
+void Restart( DistSparseMatrix<T>& A, const std::string filename )
+{
+    DEBUG_ONLY(CallStackEntry cse("Restart"))
+    mpi::Comm comm = A.Comm();
+    mpi::File file;
+    mpi::FileOpen( comm, filename, mpi::MODE_RDONLY, file );
+
+    CkptInt header[CHECKPOINT_HEADER_SIZE];
+    ReadHeader<T>( file, header, SPARSE_CHECKPOINT, filename );
+    read::BinaryCSR( A, file, CHECKPOINT_DATA_START, filename );
+    mpi::FileClose( file );
+
+    CheckChecksum
+    ( mpi::AllReduce( LocalChecksum( A ), comm ), header, filename );
+}
+
+// Multivectors
+// ============
+
+template<typename T>
+void Checkpoint( const DistMultiVec<T>& X, std::string basename )
+{
+    DEBUG_ONLY(CallStackEntry cse("Checkpoint"))
+    CheckpointHelper<T>( X, basename );
+}
+
+template<typename T>
+void Restart( DistMultiVec<T>& X, const std::string filename )
+{
+    DEBUG_ONLY(CallStackEntry cse("Restart"))
+    RestartHelper<T>( X, filename );
+}
+
+// Nonblocking checkpoints and restarts
+// ====================================
+
+CheckpointRequest::CheckpointRequest()
+: pending_(false), file_(MPI_FILE_NULL)
+{ }
+
+CheckpointRequest::CheckpointRequest( CheckpointRequest&& req )
+: pending_(req.pending_), file_(req.file_),
+  requests_(std::move(req.requests_)), finish_(std::move(req.finish_))
+{ req.pending_ = false; }
+
+CheckpointRequest::~CheckpointRequest()
+{
+    if( pending_ && !mpi::Finalized() )
+    {
+        try { Wait(); }
+        catch( std::exception& e ) { ReportException(e); }
+    }
+}
+
+CheckpointRequest& CheckpointRequest::operator=( CheckpointRequest&& req )
+{
+    if( this != &req )
+    {
+        if( pending_ )
+            Wait();
+        pending_ = req.pending_;
+        file_ = req.file_;
+        requests_ = std::move(req.requests_);
+        finish_ = std::move(req.finish_);
+        req.pending_ = false;
+    }
+    return *this;
+}
+
+void CheckpointRequest::Wait()
+{
+    DEBUG_ONLY(CallStackEntry cse("CheckpointRequest::Wait"))
+    if( !pending_ )
+        return;
+    mpi::WaitAll( requests_.size(), requests_.data() );
+    std::vector<mpi::Request>().swap( requests_ );
+    mpi::FileClose( file_ );
+    pending_ = false;
+    std::function<void()> finish;
+    std::swap( finish, finish_ );
+    finish();
+}
+
+bool CheckpointRequest::Test()
+{
+    DEBUG_ONLY(CallStackEntry cse("CheckpointRequest::Test"))
+    if( !pending_ )
+        return true;
+    return mpi::TestAll( requests_.size(), requests_.data() );
+}
+
+template<typename T,typename DistType>
+void CheckpointRequest::StartCheckpoint
+( const DistType& A, std::string basename )
+{
+    const std::string filename = basename + "." + CHECKPOINT_EXTENSION;
+    CreateCheckpoint( A, filename, file_ );
+    auto buffer = std::make_shared<std::vector<T>>();
+    ViewAndPack( file_, A, *buffer );
+    mpi::FileIWriteAt
+    ( file_, 0, (const byte*)buffer->data(), buffer->size()*sizeof(T),
+      requests_ );
+    // The buffer is kept alive by the closure until the writes complete
+    finish_ = [=]() { buffer->clear(); };
+    pending_ = true;
+}
+
+template<typename T,typename DistType>
+void CheckpointRequest::StartRestart( DistType& A, const std::string filename )
+{
+    auto header = std::make_shared<std::vector<CkptInt>>
+      ( CHECKPOINT_HEADER_SIZE );
+    OpenRestart( A, filename, file_, header->data() );
+    auto buffer = std::make_shared<std::vector<T>>();
+    ViewForUnpack( file_, A, *buffer );
+    mpi::FileIReadAt
+    ( file_, 0, (byte*)buffer->data(), buffer->size()*sizeof(T), requests_ );
+    DistType* APtr = &A;
+    finish_ =
+      [=]() { UnpackAndCheck( *buffer, *APtr, header->data(), filename ); };
+    pending_ = true;
+}
+
+template<typename T>
+CheckpointRequest ICheckpoint
+( const AbstractDistMatrix<T>& A, std::string basename )
+{
+    DEBUG_ONLY(CallStackEntry cse("ICheckpoint"))
+    CheckpointRequest req;
+    req.StartCheckpoint<T>( A, basename );
+    return req;
+}
+
+template<typename T>
+CheckpointRequest ICheckpoint( const DistMultiVec<T>& X, std::string basename )
+{
+    DEBUG_ONLY(CallStackEntry cse("ICheckpoint"))
+    CheckpointRequest req;
+    req.StartCheckpoint<T>( X, basename );
+    return req;
+}
+
+template<typename T>
+CheckpointRequest IRestart
+( AbstractDistMatrix<T>& A, const std::string filename )
+{
+    DEBUG_ONLY(CallStackEntry cse("IRestart"))
+    CheckpointRequest req;
+    req.StartRestart<T>( A, filename );
+    return req;
+}
+
+template<typename T>
+CheckpointRequest IRestart( DistMultiVec<T>& X, const std::string filename )
+{
+    DEBUG_ONLY(CallStackEntry cse("IRestart"))
+    CheckpointRequest req;
+    req.StartRestart<T>( X, filename );
+    return req;
+}
+
+#define PROTO(T) \
+  template void Checkpoint \
+  ( const AbstractDistMatrix<T>& A, std::string basename ); \
+  template void Checkpoint \
+  ( const DistSparseMatrix<T>& A, std::string basename ); \
+  template void Checkpoint \
+  ( const DistMultiVec<T>& X, std::string basename ); \
+  template void Restart \
+  ( AbstractDistMatrix<T>& A, const std::string filename ); \
+  template void Restart \
+  ( DistSparseMatrix<T>& A, const std::string filename ); \
+  template void Restart \
+  ( DistMultiVec<T>& X, const std::string filename ); \
+  template CheckpointRequest ICheckpoint \
+  ( const AbstractDistMatrix<T>& A, std::string basename ); \
+  template CheckpointRequest ICheckpoint \
+  ( const DistMultiVec<T>& X, std::string basename ); \
+  template CheckpointRequest IRestart \
+  ( AbstractDistMatrix<T>& A, const std::string filename ); \
+  template CheckpointRequest IRestart \
+  ( DistMultiVec<T>& X, const std::string filename );
+
+#include "El/macros/Instantiate.h"
+
+} // namespace El
@@ -41,6 +41,7 @@ std::string FileExtension( FileFormat format )
     case PPM:              return "ppm";  break;
     case XBM:              return "xbm";  break;
     case XPM:              return "xpm";  break;
+    case BINARY_CSR:       return "csr";  break;
     default: LogicError("Format not found"); return "N/A"; break;
     }
 }
@@ -78,4 +79,57 @@ std::ifstream::pos_type FileSize( std::ifstream& file )
     return numBytes;
 }
 
+template<typename T,class DistMatrixType>
+bool SetFileViewHelper
+( mpi::File file, const DistMatrixType& A, mpi::Offset metaBytes, bool unique )
+{
+    DEBUG_ONLY(CallStackEntry cse("SetFileView"))
+    const bool participating = 
+      A.Participating() && ( !unique || A.RedundantRank() == 0 );
+    const Int localHeight = ( participating ? A.LocalHeight() : 0 );
+    const Int localWidth = ( participating ? A.LocalWidth() : 0 );
+
+    // Each local column is a union of runs of contiguous rows
+    std::vector<mpi::Offset> runOffsets, runLengths;
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = A.GlobalRow(iLoc);
+        if( iLoc > 0 && A.GlobalRow(iLoc-1) == i-1 )
+            runLengths.back() += sizeof(T);
+        else
+        {
+            runOffsets.push_back( mpi::Offset(i)*sizeof(T) );
+            runLengths.push_back( sizeof(T) );
+        }
+    }
+    std::vector<mpi::Offset> colOffsets( localWidth );
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        colOffsets[jLoc] = mpi::Offset(A.GlobalCol(jLoc))*A.Height()*sizeof(T);
+
+    mpi::FileSetView( file, metaBytes, runOffsets, runLengths, colOffsets );
+    return participating;
+}
+
+template<typename T>
+bool SetFileView
+( mpi::File file, const AbstractDistMatrix<T>& A, mpi::Offset metaBytes,
+  bool unique )
+{ return SetFileViewHelper<T>( file, A, metaBytes, unique ); }
+
+template<typename T>
+bool SetFileView
+( mpi::File file, const AbstractBlockDistMatrix<T>& A, mpi::Offset metaBytes,
+  bool unique )
+{ return SetFileViewHelper<T>( file, A, metaBytes, unique ); }
+
+#define PROTO(T) \
+  template bool SetFileView \
+  ( mpi::File file, const AbstractDistMatrix<T>& A, \
+    mpi::Offset metaBytes, bool unique ); \
+  template bool SetFileView \
+  ( mpi::File file, const AbstractBlockDistMatrix<T>& A, \
+    mpi::Offset metaBytes, bool unique );
+
+#include "El/macros/Instantiate.h"
+
 } // namespace El
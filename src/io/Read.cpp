@@ -12,7 +12,9 @@
 #include "./Read/AsciiMatlab.hpp"
 #include "./Read/Binary.hpp"
 #include "./Read/BinaryFlat.hpp"
+#include "./Read/BinaryCSR.hpp"
 #include "./Read/MatrixMarket.hpp"
+#include "./Read/Mapped.hpp"
 
 namespace El {
 
@@ -54,25 +56,20 @@ void Read
     if( format == AUTO )
         format = DetectFormat( filename ); 
 
-    if( A.ColStride() == 1 && A.RowStride() == 1 )
-    {
-        if( A.CrossRank() == A.Root() && A.RedundantRank() == 0 )
-        {
-            Read( A.Matrix(), filename, format );
-            A.Resize( A.Matrix().Height(), A.Matrix().Width() );
-        }
-        A.MakeSizeConsistent();
-    }
-    else if( sequential )
+    if( sequential || (A.ColStride() == 1 && A.RowStride() == 1) )
     {
+        // Since the local matrix of a distributed matrix cannot be resized,
+        // the root reads into a separate matrix and the result is then
+        // redistributed (which also fills any redundant copies)
         DistMatrix<T,CIRC,CIRC> A_CIRC_CIRC( A.Grid() );
-        if( format == BINARY_FLAT )
-            A_CIRC_CIRC.Resize( A.Height(), A.Width() );
         if( A_CIRC_CIRC.CrossRank() == A_CIRC_CIRC.Root() )
         {
-            Read( A_CIRC_CIRC.Matrix(), filename, format );
-            A_CIRC_CIRC.Resize
-            ( A_CIRC_CIRC.Matrix().Height(), A_CIRC_CIRC.Matrix().Width() );
+            Matrix<T> B;
+            if( format == BINARY_FLAT )
+                B.Resize( A.Height(), A.Width() );
+            Read( B, filename, format );
+            A_CIRC_CIRC.Resize( B.Height(), B.Width() );
+            A_CIRC_CIRC.Matrix() = B;
         }
         A_CIRC_CIRC.MakeSizeConsistent();
         Copy( A_CIRC_CIRC, A );
@@ -111,25 +108,20 @@ void Read
     if( format == AUTO )
         format = DetectFormat( filename ); 
 
-    if( A.ColStride() == 1 && A.RowStride() == 1 )
-    {
-        if( A.CrossRank() == A.Root() && A.RedundantRank() == 0 )
-        {
-            Read( A.Matrix(), filename, format );
-            A.Resize( A.Matrix().Height(), A.Matrix().Width() );
-        }
-        A.MakeSizeConsistent();
-    }
-    else if( sequential )
+    if( sequential || (A.ColStride() == 1 && A.RowStride() == 1) )
     {
+        // Since the local matrix of a distributed matrix cannot be resized,
+        // the root reads into a separate matrix and the result is then
+        // redistributed (which also fills any redundant copies)
         BlockDistMatrix<T,CIRC,CIRC> A_CIRC_CIRC( A.Grid() );
-        if( format == BINARY_FLAT )
-            A_CIRC_CIRC.Resize( A.Height(), A.Width() );
         if( A_CIRC_CIRC.CrossRank() == A_CIRC_CIRC.Root() )
         {
-            Read( A_CIRC_CIRC.Matrix(), filename, format );
-            A_CIRC_CIRC.Resize
-            ( A_CIRC_CIRC.Matrix().Height(), A_CIRC_CIRC.Matrix().Width() );
+            Matrix<T> B;
+            if( format == BINARY_FLAT )
+                B.Resize( A.Height(), A.Width() );
+            Read( B, filename, format );
+            A_CIRC_CIRC.Resize( B.Height(), B.Width() );
+            A_CIRC_CIRC.Matrix() = B;
         }
         A_CIRC_CIRC.MakeSizeConsistent();
         Copy( A_CIRC_CIRC, A );
@@ -159,6 +151,70 @@ void Read
     }
 }
 
+template<typename T>
+void ReadMapped
+( Matrix<T>& A, const std::string filename, FileFormat format, 
+  bool copyOnWrite )
+{
+    DEBUG_ONLY(CallStackEntry cse("ReadMapped"))
+    if( format == AUTO )
+        format = DetectFormat( filename );
+
+    switch( format )
+    {
+    case BINARY:
+        read::MappedBinary( A, filename, copyOnWrite );
+        break;
+    case BINARY_FLAT:
+        read::MappedBinaryFlat
+        ( A, A.Height(), A.Width(), filename, copyOnWrite );
+        break;
+    default:
+        LogicError("Format unsupported for memory-mapped reads");
+    }
+}
+
+template<typename T>
+void Read( SparseMatrix<T>& A, const std::string filename, FileFormat format )
+{
+    DEBUG_ONLY(CallStackEntry cse("Read"))
+    if( format == AUTO )
+        format = DetectFormat( filename );
+
+    switch( format )
+    {
+    case BINARY_CSR:
+        read::BinaryCSR( A, filename );
+        break;
+    case MATRIX_MARKET:
+        read::MatrixMarket( A, filename );
+        break;
+    default:
+        LogicError("Format unsupported for reading sparse matrices");
+    }
+}
+
+template<typename T>
+void Read
+( DistSparseMatrix<T>& A, const std::string filename, FileFormat format )
+{
+    DEBUG_ONLY(CallStackEntry cse("Read"))
+    if( format == AUTO )
+        format = DetectFormat( filename );
+
+    switch( format )
+    {
+    case BINARY_CSR:
+        read::BinaryCSR( A, filename );
+        break;
+    case MATRIX_MARKET:
+        read::MatrixMarket( A, filename );
+        break;
+    default:
+        LogicError("Format unsupported for reading sparse matrices");
+    }
+}
+
 #define PROTO(T) \
   template void Read \
   ( Matrix<T>& A, const std::string filename, FileFormat format ); \
@@ -167,7 +223,14 @@ void Read
     FileFormat format, bool sequential ); \
   template void Read \
   ( AbstractBlockDistMatrix<T>& A, const std::string filename, \
-    FileFormat format, bool sequential );
+    FileFormat format, bool sequential ); \
+  template void ReadMapped \
+  ( Matrix<T>& A, const std::string filename, FileFormat format, \
+    bool copyOnWrite ); \
+  template void Read \
+  ( SparseMatrix<T>& A, const std::string filename, FileFormat format ); \
+  template void Read \
+  ( DistSparseMatrix<T>& A, const std::string filename, FileFormat format );
 
 #include "El/macros/Instantiate.h"
 
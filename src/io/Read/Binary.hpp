@@ -41,130 +41,66 @@ Binary( Matrix<T>& A, const std::string filename )
             file.read( (char*)A.Buffer(0,j), height*sizeof(T) );
 }
 
-template<typename T>
+// Collectively read the local entries of A from a file storing a column-major
+// matrix after 'metaBytes' bytes of metadata
+template<typename T,class DistMatrixType>
 inline void
-Binary( AbstractDistMatrix<T>& A, const std::string filename )
+CollectiveRead( mpi::File file, DistMatrixType& A, mpi::Offset metaBytes )
 {
-    DEBUG_ONLY(CallStackEntry cse("read::Binary"))
-    std::ifstream file( filename.c_str(), std::ios::binary );
-    if( !file.is_open() )
-        RuntimeError("Could not open ",filename);
-
-    Int height, width;
-    file.read( (char*)&height, sizeof(Int) );
-    file.read( (char*)&width,  sizeof(Int) );
-    const Int numBytes = FileSize( file );
-    const Int metaBytes = 2*sizeof(Int);
-    const Int dataBytes = height*width*sizeof(T);
-    const Int numBytesExp = metaBytes + dataBytes;
-    if( numBytes != numBytesExp )
-        RuntimeError
-        ("Expected file to be ",numBytesExp," bytes but found ",numBytes);
-
-    A.Resize( height, width );
-    if( A.CrossRank() != A.Root() )
-        return;
-    if( A.ColStride() == 1 && A.RowStride() == 1 )
+    DEBUG_ONLY(CallStackEntry cse("read::CollectiveRead"))
+    const bool participating = SetFileView( file, A, metaBytes );
+    const Int localHeight = ( participating ? A.LocalHeight() : 0 );
+    const Int localWidth = ( participating ? A.LocalWidth() : 0 );
+    const mpi::Offset numBytes = mpi::Offset(localHeight)*localWidth*sizeof(T);
+    if( localHeight == A.LDim() || localWidth == 0 )
     {
-        if( A.Height() == A.LDim() )
-            file.read( (char*)A.Buffer(), height*width*sizeof(T) );
-        else
-            for( Int j=0; j<width; ++j )
-                file.read( (char*)A.Buffer(0,j), height*sizeof(T) );
-    }
-    else if( A.ColStride() == 1 )
-    {
-        const Int localWidth = A.LocalWidth();
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            const Int j = A.GlobalCol(jLoc);
-            const Int localIndex = j*height;
-            const std::streamoff pos = metaBytes + localIndex*sizeof(T);
-            file.seekg( pos );
-            file.read( (char*)A.Buffer(0,jLoc), height*sizeof(T) );
-        }
+        mpi::FileReadAll( file, (byte*)A.Buffer(), numBytes );
     }
     else
     {
-        const Int localHeight = A.LocalHeight();
-        const Int localWidth = A.LocalWidth();
+        std::vector<T> buffer( localHeight*localWidth );
+        mpi::FileReadAll( file, (byte*)buffer.data(), numBytes );
         for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            const Int j = A.GlobalCol(jLoc);
-            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-            {
-                const Int i = A.GlobalRow(iLoc);
-                const Int localIndex = i+j*height;
-                const std::streamoff pos = metaBytes + localIndex*sizeof(T);
-                file.seekg( pos );
-                file.read( (char*)A.Buffer(iLoc,jLoc), sizeof(T) );
-            }
-        }
+            MemCopy
+            ( A.Buffer(0,jLoc), &buffer[jLoc*localHeight], localHeight );
     }
 }
 
-template<typename T>
+template<typename T,class DistMatrixType>
 inline void
-Binary( AbstractBlockDistMatrix<T>& A, const std::string filename )
+BinaryHelper( DistMatrixType& A, const std::string filename )
 {
     DEBUG_ONLY(CallStackEntry cse("read::Binary"))
-    std::ifstream file( filename.c_str(), std::ios::binary );
-    if( !file.is_open() )
-        RuntimeError("Could not open ",filename);
+    mpi::File file;
+    mpi::FileOpen( A.Grid().ViewingComm(), filename, mpi::MODE_RDONLY, file );
 
-    Int height, width;
-    file.read( (char*)&height, sizeof(Int) );
-    file.read( (char*)&width,  sizeof(Int) );
-    const Int numBytes = FileSize( file );
-    const Int metaBytes = 2*sizeof(Int);
-    const Int dataBytes = height*width*sizeof(T);
-    const Int numBytesExp = metaBytes + dataBytes;
+    Int dims[2];
+    mpi::FileReadAtAll( file, 0, (byte*)dims, 2*sizeof(Int) );
+    const Int height = dims[0];
+    const Int width = dims[1];
+    const mpi::Offset numBytes = mpi::FileSize( file );
+    const mpi::Offset metaBytes = 2*sizeof(Int);
+    const mpi::Offset dataBytes = mpi::Offset(height)*width*sizeof(T);
+    const mpi::Offset numBytesExp = metaBytes + dataBytes;
     if( numBytes != numBytesExp )
         RuntimeError
         ("Expected file to be ",numBytesExp," bytes but found ",numBytes);
 
     A.Resize( height, width );
-    if( A.CrossRank() != A.Root() )
-        return;
-    if( A.ColStride() == 1 && A.RowStride() == 1 )
-    {
-        if( A.Height() == A.LDim() )
-            file.read( (char*)A.Buffer(), height*width*sizeof(T) );
-        else
-            for( Int j=0; j<width; ++j )
-                file.read( (char*)A.Buffer(0,j), height*sizeof(T) );
-    }
-    else if( A.ColStride() == 1 )
-    {
-        const Int localWidth = A.LocalWidth();
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            const Int j = A.GlobalCol(jLoc);
-            const Int localIndex = j*height;
-            const std::streamoff pos = metaBytes + localIndex*sizeof(T);
-            file.seekg( pos );
-            file.read( (char*)A.Buffer(0,jLoc), height*sizeof(T) );
-        }
-    }
-    else
-    {
-        const Int localHeight = A.LocalHeight();
-        const Int localWidth = A.LocalWidth();
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            const Int j = A.GlobalCol(jLoc);
-            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-            {
-                const Int i = A.GlobalRow(iLoc);
-                const Int localIndex = i+j*height;
-                const std::streamoff pos = metaBytes + localIndex*sizeof(T);
-                file.seekg( pos );
-                file.read( (char*)A.Buffer(iLoc,jLoc), sizeof(T) );
-            }
-        }
-    }
+    CollectiveRead<T>( file, A, metaBytes );
+    mpi::FileClose( file );
 }
 
+template<typename T>
+inline void
+Binary( AbstractDistMatrix<T>& A, const std::string filename )
+{ BinaryHelper<T>( A, filename ); }
+
+template<typename T>
+inline void
+Binary( AbstractBlockDistMatrix<T>& A, const std::string filename )
+{ BinaryHelper<T>( A, filename ); }
+
 } // namespace read
 } // namespace El
 
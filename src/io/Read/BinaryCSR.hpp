@@ -0,0 +1,132 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_READ_BINARYCSR_HPP
+#define EL_READ_BINARYCSR_HPP
+
+#include "../BinaryCSR.hpp"
+
+namespace El {
+namespace read {
+
+template<typename T>
+inline void
+CheckCSRHeader( const CSRInt* header, const std::string filename )
+{
+    DEBUG_ONLY(CallStackEntry cse("read::CheckCSRHeader"))
+    if( header[0] < 0 || header[1] < 0 || header[2] < 0 )
+        RuntimeError("Invalid BINARY_CSR header in ",filename);
+    // The dimensions and number of nonzeros are narrowed to Int
+    const CSRInt maxInt = std::numeric_limits<Int>::max();
+    if( header[0] >= maxInt || header[1] > maxInt || header[2] > maxInt )
+        RuntimeError
+        (filename," is ",header[0]," x ",header[1]," with ",header[2],
+         " nonzeros, which cannot be indexed with Int");
+    if( header[3] != CSRInt(sizeof(T)) ||
+        header[4] != CSRInt(IsComplex<T>::val) )
+        RuntimeError
+        ("Datatype of ",filename," did not match: entries were of size ",
+         header[3]," and complex=",header[4]);
+}
+
+template<typename T>
+inline void
+BinaryCSR( SparseMatrix<T>& A, const std::string filename )
+{
+    DEBUG_ONLY(CallStackEntry cse("read::BinaryCSR"))
+    std::ifstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+
+    CSRInt header[CSR_HEADER_SIZE];
+    file.read( (char*)header, CSR_HEADER_SIZE*sizeof(CSRInt) );
+    CheckCSRHeader<T>( header, filename );
+    const Int m = header[0];
+    const Int n = header[1];
+    const Int numNonzeros = header[2];
+
+    std::vector<CSRInt> rowOffsets(m+1), colInds(numNonzeros);
+    std::vector<T> values(numNonzeros);
+    file.read( (char*)rowOffsets.data(), (m+1)*sizeof(CSRInt) );
+    file.read( (char*)colInds.data(), numNonzeros*sizeof(CSRInt) );
+    file.read( (char*)values.data(), numNonzeros*sizeof(T) );
+    if( !file )
+        RuntimeError("Could not read the contents of ",filename);
+
+    A.Resize( m, n );
+    A.Reserve( numNonzeros );
+    for( Int i=0; i<m; ++i )
+        for( CSRInt k=rowOffsets[i]; k<rowOffsets[i+1]; ++k )
+            A.QueueUpdate( i, colInds[k], values[k] );
+    A.MakeConsistent();
+}
+
+// Each process directly reads the portion of the file corresponding to its
+// block of rows using collective MPI-IO. The matrix is assumed to begin
+// 'start' bytes into the (already opened) file.
+template<typename T>
+inline void
+BinaryCSR
+( DistSparseMatrix<T>& A, mpi::File file, mpi::Offset start, 
+  const std::string filename )
+{
+    DEBUG_ONLY(CallStackEntry cse("read::BinaryCSR"))
+    CSRInt header[CSR_HEADER_SIZE];
+    mpi::FileReadAtAll
+    ( file, start, (byte*)header, CSR_HEADER_SIZE*sizeof(CSRInt) );
+    CheckCSRHeader<T>( header, filename );
+    const Int m = header[0];
+    const Int n = header[1];
+    const Int numNonzeros = header[2];
+    A.Resize( m, n );
+
+    const Int firstLocalRow = A.FirstLocalRow();
+    const Int localHeight = A.LocalHeight();
+    const mpi::Offset offsetsStart = start + CSR_HEADER_SIZE*sizeof(CSRInt);
+    const mpi::Offset colIndsStart = offsetsStart + (m+1)*sizeof(CSRInt);
+    const mpi::Offset valuesStart = colIndsStart + numNonzeros*sizeof(CSRInt);
+
+    std::vector<CSRInt> rowOffsets(localHeight+1);
+    mpi::FileReadAtAll
+    ( file, offsetsStart+firstLocalRow*sizeof(CSRInt),
+      (byte*)rowOffsets.data(), (localHeight+1)*sizeof(CSRInt) );
+    const CSRInt entryBeg = rowOffsets[0];
+    const Int numLocalEntries = rowOffsets[localHeight] - entryBeg;
+
+    std::vector<CSRInt> colInds(numLocalEntries);
+    std::vector<T> values(numLocalEntries);
+    mpi::FileReadAtAll
+    ( file, colIndsStart+entryBeg*sizeof(CSRInt),
+      (byte*)colInds.data(), numLocalEntries*sizeof(CSRInt) );
+    mpi::FileReadAtAll
+    ( file, valuesStart+entryBeg*sizeof(T),
+      (byte*)values.data(), numLocalEntries*sizeof(T) );
+
+    A.Reserve( numLocalEntries );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        for( CSRInt k=rowOffsets[iLoc]; k<rowOffsets[iLoc+1]; ++k )
+            A.QueueLocalUpdate( iLoc, colInds[k-entryBeg], values[k-entryBeg] );
+    A.MakeConsistent();
+}
+
+template<typename T>
+inline void
+BinaryCSR( DistSparseMatrix<T>& A, const std::string filename )
+{
+    DEBUG_ONLY(CallStackEntry cse("read::BinaryCSR"))
+    mpi::File file;
+    mpi::FileOpen( A.Comm(), filename, mpi::MODE_RDONLY, file );
+    BinaryCSR( A, file, 0, filename );
+    mpi::FileClose( file );
+}
+
+} // namespace read
+} // namespace El
+
+#endif // ifndef EL_READ_BINARYCSR_HPP
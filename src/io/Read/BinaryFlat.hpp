@@ -36,124 +36,39 @@ BinaryFlat( Matrix<T>& A, Int height, Int width, const std::string filename )
             file.read( (char*)A.Buffer(0,j), height*sizeof(T) );
 }
 
-template<typename T>
+// NOTE: This relies upon read::CollectiveRead from Read/Binary.hpp
+template<typename T,class DistMatrixType>
 inline void
-BinaryFlat
-( AbstractDistMatrix<T>& A, Int height, Int width, const std::string filename )
+BinaryFlatHelper
+( DistMatrixType& A, Int height, Int width, const std::string filename )
 {
     DEBUG_ONLY(CallStackEntry cse("read::BinaryFlat"))
-    std::ifstream file( filename.c_str(), std::ios::binary );
-    if( !file.is_open() )
-        RuntimeError("Could not open ",filename);
+    mpi::File file;
+    mpi::FileOpen( A.Grid().ViewingComm(), filename, mpi::MODE_RDONLY, file );
 
-    const Int numBytes = FileSize( file );
-    const Int numBytesExp = height*width*sizeof(T);
+    const mpi::Offset numBytes = mpi::FileSize( file );
+    const mpi::Offset numBytesExp = mpi::Offset(height)*width*sizeof(T);
     if( numBytes != numBytesExp )
         RuntimeError
         ("Expected file to be ",numBytesExp," bytes but found ",numBytes);
 
     A.Resize( height, width );
-    if( A.ColStride() == 1 && A.RowStride() == 1 )
-    {
-        if( A.CrossRank() == A.Root() )
-        {
-            if( A.Height() == A.LDim() )
-                file.read( (char*)A.Buffer(), height*width*sizeof(T) );
-            else
-                for( Int j=0; j<width; ++j )
-                    file.read( (char*)A.Buffer(0,j), height*sizeof(T) );
-        }
-    }
-    else if( A.ColStride() == 1 )
-    {
-        const Int localWidth = A.LocalWidth();
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            const Int j = A.GlobalCol(jLoc);
-            const Int localIndex = j*height;
-            const std::streamoff pos = localIndex*sizeof(T);
-            file.seekg( pos );
-            file.read( (char*)A.Buffer(0,jLoc), height*sizeof(T) );
-        }
-    }
-    else
-    {
-        const Int localHeight = A.LocalHeight();
-        const Int localWidth = A.LocalWidth();
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            const Int j = A.GlobalCol(jLoc);
-            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-            {
-                const Int i = A.GlobalRow(iLoc);
-                const Int localIndex = i+j*height;
-                const std::streamoff pos = localIndex*sizeof(T);
-                file.seekg( pos );
-                file.read( (char*)A.Buffer(iLoc,jLoc), sizeof(T) );
-            }
-        }
-    }
+    CollectiveRead<T>( file, A, 0 );
+    mpi::FileClose( file );
 }
 
+template<typename T>
+inline void
+BinaryFlat
+( AbstractDistMatrix<T>& A, Int height, Int width, const std::string filename )
+{ BinaryFlatHelper<T>( A, height, width, filename ); }
+
 template<typename T>
 inline void
 BinaryFlat
 ( AbstractBlockDistMatrix<T>& A, Int height, Int width, 
   const std::string filename )
-{
-    DEBUG_ONLY(CallStackEntry cse("read::BinaryFlat"))
-    std::ifstream file( filename.c_str(), std::ios::binary );
-    if( !file.is_open() )
-        RuntimeError("Could not open ",filename);
-
-    const Int numBytes = FileSize( file );
-    const Int numBytesExp = height*width*sizeof(T);
-    if( numBytes != numBytesExp )
-        RuntimeError
-        ("Expected file to be ",numBytesExp," bytes but found ",numBytes);
-
-    A.Resize( height, width );
-    if( A.ColStride() == 1 && A.RowStride() == 1 )
-    {
-        if( A.CrossRank() == A.Root() )
-        {
-            if( A.Height() == A.LDim() )
-                file.read( (char*)A.Buffer(), height*width*sizeof(T) );
-            else
-                for( Int j=0; j<width; ++j )
-                    file.read( (char*)A.Buffer(0,j), height*sizeof(T) );
-        }
-    }
-    else if( A.ColStride() == 1 )
-    {
-        const Int localWidth = A.LocalWidth();
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            const Int j = A.GlobalCol(jLoc);
-            const Int localIndex = j*height;
-            const std::streamoff pos = localIndex*sizeof(T);
-            file.seekg( pos );
-            file.read( (char*)A.Buffer(0,jLoc), height*sizeof(T) );
-        }
-    }
-    else
-    {
-        const Int localHeight = A.LocalHeight();
-        const Int localWidth = A.LocalWidth();
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            const Int j = A.GlobalCol(jLoc);
-            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-            {
-                const Int i = A.GlobalRow(iLoc);
-                const Int localIndex = i+j*height;
-                const std::streamoff pos = localIndex*sizeof(T);
-                file.seekg( pos );
-                file.read( (char*)A.Buffer(iLoc,jLoc), sizeof(T) );
-            }
-        }
-    }
-}
+{ BinaryFlatHelper<T>( A, height, width, filename ); }
 
 } // namespace read
 } // namespace El
@@ -0,0 +1,109 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_READ_MAPPED_HPP
+#define EL_READ_MAPPED_HPP
+
+#ifdef EL_HAVE_MMAP
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <fcntl.h>
+# include <unistd.h>
+#endif
+
+namespace El {
+namespace read {
+
+// Memory-map the column-major matrix stored after 'metaBytes' bytes of 
+// metadata and hand the mapping over to A, which unmaps it once it is no
+// longer needed. Unless 'copyOnWrite' is true, the mapping is shared with
+// all other readers of the file (through the page cache) and A is locked.
+template<typename T>
+inline void
+MapColumnMajor
+( Matrix<T>& A, Int height, Int width, std::size_t metaBytes, 
+  const std::string filename, bool copyOnWrite )
+{
+    DEBUG_ONLY(CallStackEntry cse("read::MapColumnMajor"))
+#ifdef EL_HAVE_MMAP
+    const int fd = open( filename.c_str(), O_RDONLY );
+    if( fd == -1 )
+        RuntimeError("Could not open ",filename);
+    struct stat fileStat;
+    if( fstat( fd, &fileStat ) == -1 )
+    {
+        close( fd );
+        RuntimeError("Could not query the size of ",filename);
+    }
+    const std::size_t numBytes = fileStat.st_size;
+    const std::size_t numBytesExp =
+        metaBytes + std::size_t(height)*std::size_t(width)*sizeof(T);
+    if( numBytes != numBytesExp )
+    {
+        close( fd );
+        RuntimeError
+        ("Expected file to be ",numBytesExp," bytes but found ",numBytes);
+    }
+    if( height == 0 || width == 0 )
+    {
+        close( fd );
+        A.Empty();
+        A.Resize( height, width );
+        return;
+    }
+
+    const int prot = ( copyOnWrite ? PROT_READ|PROT_WRITE : PROT_READ );
+    const int flags = ( copyOnWrite ? MAP_PRIVATE : MAP_SHARED );
+    void* map = mmap( 0, numBytes, prot, flags, fd, 0 );
+    // The mapping remains valid after the file descriptor is closed
+    close( fd );
+    if( map == MAP_FAILED )
+        RuntimeError("Could not memory-map ",filename);
+
+    T* buffer = (T*)((byte*)map + metaBytes);
+    auto unmap = [=]( T* ) { munmap( map, numBytes ); };
+    if( copyOnWrite )
+        A.Control( height, width, buffer, Max(height,1), unmap );
+    else
+        A.LockedControl( height, width, buffer, Max(height,1), unmap );
+#else
+    LogicError("Memory-mapped reads are not supported on this platform");
+#endif
+}
+
+template<typename T>
+inline void
+MappedBinary( Matrix<T>& A, const std::string filename, bool copyOnWrite )
+{
+    DEBUG_ONLY(CallStackEntry cse("read::MappedBinary"))
+    std::ifstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    Int height, width;
+    file.read( (char*)&height, sizeof(Int) );
+    file.read( (char*)&width,  sizeof(Int) );
+    file.close();
+
+    MapColumnMajor( A, height, width, 2*sizeof(Int), filename, copyOnWrite );
+}
+
+template<typename T>
+inline void
+MappedBinaryFlat
+( Matrix<T>& A, Int height, Int width, const std::string filename, 
+  bool copyOnWrite )
+{
+    DEBUG_ONLY(CallStackEntry cse("read::MappedBinaryFlat"))
+    MapColumnMajor( A, height, width, 0, filename, copyOnWrite );
+}
+
+} // namespace read
+} // namespace El
+
+#endif // ifndef EL_READ_MAPPED_HPP
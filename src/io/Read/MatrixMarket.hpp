@@ -250,6 +250,265 @@ MatrixMarket( AbstractBlockDistMatrix<T>& A, const std::string filename )
     Copy( A_CIRC_CIRC, A );
 }
 
+// Sparse matrices
+// ===============
+// NOTE: Only the coordinate format is supported for sparse matrices
+
+struct MatrixMarketInfo
+{
+    bool isMatrix, isComplex, isPattern;
+    bool isSymmetric, isSkewSymmetric, isHermitian;
+    Int height, width, numNonzero;
+    // The position of the first nonzero entry within the file
+    std::streampos dataStart;
+};
+
+inline MatrixMarketInfo
+SparseMatrixMarketHeader( std::ifstream& file )
+{
+    DEBUG_ONLY(CallStackEntry cse("read::SparseMatrixMarketHeader"))
+    std::string line, stamp, object, format, field, symmetry;
+    if( !std::getline( file, line ) )
+        RuntimeError("Could not extract header line");
+    {
+        std::stringstream lineStream( line );
+        lineStream >> stamp; 
+        if( stamp != std::string("%%MatrixMarket") )
+            RuntimeError("Invalid Matrix Market stamp: ",stamp);
+        if( !(lineStream >> object) ) 
+            RuntimeError("Missing Matrix Market object");
+        if( !(lineStream >> format) )
+            RuntimeError("Missing Matrix Market format");
+        if( !(lineStream >> field) )
+            RuntimeError("Missing Matrix Market field");
+        if( !(lineStream >> symmetry) )
+            RuntimeError("Missing Matrix Market symmetry");
+    }
+    MatrixMarketInfo info;
+    info.isMatrix = ( object == std::string("matrix") );
+    info.isComplex = ( field == std::string("complex") );
+    info.isPattern = ( field == std::string("pattern") );
+    info.isSymmetric = ( symmetry == std::string("symmetric") );
+    info.isSkewSymmetric = ( symmetry == std::string("skew-symmetric") );
+    info.isHermitian = ( symmetry == std::string("hermitian") );
+    if( !info.isMatrix && object != std::string("vector") )
+        RuntimeError("Invalid Matrix Market object: ",object);
+    if( format != std::string("coordinate") )
+        RuntimeError("Sparse matrices require the coordinate format");
+    if( !info.isComplex && !info.isPattern && 
+        field != std::string("real") && 
+        field != std::string("double") &&
+        field != std::string("integer") )
+        RuntimeError("Invalid Matrix Market field: ",field);
+    if( symmetry != std::string("general") && !info.isSymmetric && 
+        !info.isSkewSymmetric && !info.isHermitian )
+        RuntimeError("Invalid Matrix Market symmetry: ",symmetry);
+    if( info.isSkewSymmetric && info.isPattern )
+        RuntimeError("Pattern field incompatible with skew-symmetry");
+    if( info.isHermitian && !info.isComplex )
+        RuntimeError("Hermitian symmetry requires complex data");
+
+    // Skip the comment lines
+    while( file.peek() == '%' ) 
+        std::getline( file, line );
+
+    if( !std::getline( file, line ) )
+        RuntimeError("Could not extract the size line");
+    std::stringstream lineStream( line );
+    if( !(lineStream >> info.height) )
+        RuntimeError("Missing matrix height: ",line);
+    if( info.isMatrix )
+    {
+        if( !(lineStream >> info.width) )
+            RuntimeError("Missing matrix width: ",line);
+    }
+    else
+        info.width = 1;
+    if( !(lineStream >> info.numNonzero) )
+        RuntimeError("Missing nonzeros entry: ",line);
+    info.dataStart = file.tellg();
+    return info;
+}
+
+// Convert a line of a coordinate-format file into the (at most two) entries
+// of the full matrix that it represents. The number of entries is returned.
+template<typename T>
+inline Int
+SparseMatrixMarketEntries
+( const std::string& line, const MatrixMarketInfo& info, Entry<T>* entries )
+{
+    typedef Base<T> Real;
+    Int i, j;
+    std::stringstream lineStream( line );
+    if( !(lineStream >> i) )
+        RuntimeError("Could not extract row coordinate: ",line);
+    --i; // convert from Fortran to C indexing
+    if( info.isMatrix )
+    {
+        if( !(lineStream >> j) )
+            RuntimeError("Could not extract col coordinate: ",line);
+        --j;
+    }
+    else
+        j = 0;
+
+    T value(1);
+    if( !info.isPattern )
+    {
+        Real realPart, imagPart;
+        if( !(lineStream >> realPart) )
+            RuntimeError("Could not extract real part: ",line);
+        SetRealPart( value, realPart );
+        if( info.isComplex )
+        {
+            if( !(lineStream >> imagPart) )
+                RuntimeError("Could not extract imag part: ",line);
+            SetImagPart( value, imagPart );
+        }
+    }
+    entries[0].indices[0] = i;
+    entries[0].indices[1] = j;
+    entries[0].value = value;
+    if( i == j || 
+        (!info.isSymmetric && !info.isSkewSymmetric && !info.isHermitian) )
+        return 1;
+
+    // Only one triangle is stored, so mirror the entry
+    // NOTE: As in the dense case, complex skew-symmetry is not conjugated
+    entries[1].indices[0] = j;
+    entries[1].indices[1] = i;
+    if( info.isHermitian )
+        entries[1].value = Conj(value);
+    else if( info.isSkewSymmetric )
+        entries[1].value = -value;
+    else
+        entries[1].value = value;
+    return 2;
+}
+
+template<typename T>
+inline void
+MatrixMarket( SparseMatrix<T>& A, const std::string filename )
+{
+    DEBUG_ONLY(CallStackEntry cse("read::MatrixMarket"))
+    std::ifstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    const MatrixMarketInfo info = SparseMatrixMarketHeader( file );
+
+    A.Resize( info.height, info.width );
+    const bool mirrored = 
+      info.isSymmetric || info.isSkewSymmetric || info.isHermitian;
+    A.Reserve( mirrored ? 2*info.numNonzero : info.numNonzero );
+
+    std::string line;
+    Entry<T> entries[2];
+    for( Int k=0; k<info.numNonzero; ++k )
+    {
+        if( !std::getline( file, line ) )
+            RuntimeError("Could not get nonzero ",k);
+        const Int numEntries = SparseMatrixMarketEntries( line, info, entries );
+        for( Int e=0; e<numEntries; ++e )
+            A.QueueUpdate
+            ( entries[e].indices[0], entries[e].indices[1], entries[e].value );
+    }
+    A.MakeConsistent();
+}
+
+// Each process parses a contiguous range of the bytes of the file and then 
+// routes the resulting entries to the owners of their rows
+template<typename T>
+inline void
+MatrixMarket( DistSparseMatrix<T>& A, const std::string filename )
+{
+    DEBUG_ONLY(CallStackEntry cse("read::MatrixMarket"))
+    mpi::Comm comm = A.Comm();
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+
+    std::ifstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    const MatrixMarketInfo info = SparseMatrixMarketHeader( file );
+    A.Resize( info.height, info.width );
+
+    // Determine our range of bytes
+    // ============================
+    // NOTE: The offsets (and their products with commRank) may easily exceed
+    //       the range of a 32-bit Int
+    const std::streamoff dataStart = info.dataStart;
+    const std::streamoff dataSize = std::streamoff(FileSize(file)) - dataStart;
+    const std::streamoff rangeBeg = dataStart + (dataSize*commRank)/commSize;
+    const std::streamoff rangeEnd =
+        dataStart + (dataSize*(commRank+1))/commSize;
+
+    // Move to the first line which begins within our range
+    // ====================================================
+    std::string line;
+    file.seekg( rangeBeg == dataStart ? rangeBeg : rangeBeg-1 );
+    if( rangeBeg != dataStart && file.peek() != '\n' )
+        std::getline( file, line );
+    else if( rangeBeg != dataStart )
+        file.get();
+
+    // Parse the entries in our range
+    // ==============================
+    std::vector<Entry<T>> localEntries;
+    Entry<T> entries[2];
+    while( std::streamoff(file.tellg()) >= 0 &&
+           std::streamoff(file.tellg()) < rangeEnd && 
+           std::getline( file, line ) )
+    {
+        if( line.find_first_not_of(" \t\r") == std::string::npos )
+            continue;
+        const Int numEntries = SparseMatrixMarketEntries( line, info, entries );
+        for( Int e=0; e<numEntries; ++e )
+            localEntries.push_back( entries[e] );
+    }
+    file.close();
+
+    // Route the entries to the owners of their rows
+    // =============================================
+    std::vector<Int> sendCounts(commSize,0);
+    for( const auto& entry : localEntries )
+        ++sendCounts[A.RowOwner(entry.indices[0])];
+    std::vector<Int> recvCounts(commSize);
+    mpi::AllToAll( sendCounts.data(), 1, recvCounts.data(), 1, comm );
+    std::vector<Int> sendOffsets, recvOffsets;
+    const Int totalSend = Scan( sendCounts, sendOffsets );
+    const Int totalRecv = Scan( recvCounts, recvOffsets );
+    std::vector<Int> sSendBuf(totalSend), tSendBuf(totalSend);
+    std::vector<T> vSendBuf(totalSend);
+    auto offsets = sendOffsets;
+    for( const auto& entry : localEntries )
+    {
+        const int owner = A.RowOwner(entry.indices[0]);
+        sSendBuf[offsets[owner]] = entry.indices[0];
+        tSendBuf[offsets[owner]] = entry.indices[1];
+        vSendBuf[offsets[owner]] = entry.value;
+        ++offsets[owner];
+    }
+    SwapClear( localEntries );
+    std::vector<Int> sRecvBuf(totalRecv), tRecvBuf(totalRecv);
+    std::vector<T> vRecvBuf(totalRecv);
+    mpi::AllToAll
+    ( sSendBuf.data(), sendCounts.data(), sendOffsets.data(),
+      sRecvBuf.data(), recvCounts.data(), recvOffsets.data(), comm );
+    mpi::AllToAll
+    ( tSendBuf.data(), sendCounts.data(), sendOffsets.data(),
+      tRecvBuf.data(), recvCounts.data(), recvOffsets.data(), comm );
+    mpi::AllToAll
+    ( vSendBuf.data(), sendCounts.data(), sendOffsets.data(),
+      vRecvBuf.data(), recvCounts.data(), recvOffsets.data(), comm );
+
+    const Int firstLocalRow = A.FirstLocalRow();
+    A.Reserve( totalRecv );
+    for( Int k=0; k<totalRecv; ++k )
+        A.QueueLocalUpdate
+        ( sRecvBuf[k]-firstLocalRow, tRecvBuf[k], vRecvBuf[k] );
+    A.MakeConsistent();
+}
+
 } // namespace read
 } // namespace El
 
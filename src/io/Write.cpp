@@ -12,6 +12,7 @@
 #include "./Write/AsciiMatlab.hpp"
 #include "./Write/Binary.hpp"
 #include "./Write/BinaryFlat.hpp"
+#include "./Write/BinaryCSR.hpp"
 #include "./Write/Image.hpp"
 #include "./Write/MatrixMarket.hpp"
 
@@ -49,7 +50,11 @@ void Write
   std::string basename, FileFormat format, std::string title )
 {
     DEBUG_ONLY(CallStackEntry cse("Write"))
-    if( A.ColStride() == 1 && A.RowStride() == 1 )
+    if( format == BINARY )
+        write::Binary( A, basename );
+    else if( format == BINARY_FLAT )
+        write::BinaryFlat( A, basename );
+    else if( A.ColStride() == 1 && A.RowStride() == 1 )
     {
         if( A.CrossRank() == A.Root() && A.RedundantRank() == 0 )
             Write( A.LockedMatrix(), basename, format, title );
@@ -68,7 +73,11 @@ void Write
   std::string basename, FileFormat format, std::string title )
 {
     DEBUG_ONLY(CallStackEntry cse("Write"))
-    if( A.ColStride() == 1 && A.RowStride() == 1 )
+    if( format == BINARY )
+        write::Binary( A, basename );
+    else if( format == BINARY_FLAT )
+        write::BinaryFlat( A, basename );
+    else if( A.ColStride() == 1 && A.RowStride() == 1 )
     {
         if( A.CrossRank() == A.Root() && A.RedundantRank() == 0 )
             Write( A.LockedMatrix(), basename, format, title );
@@ -81,6 +90,34 @@ void Write
     }
 }
 
+template<typename T>
+void Write
+( const SparseMatrix<T>& A, std::string basename, FileFormat format )
+{
+    DEBUG_ONLY(CallStackEntry cse("Write"))
+    switch( format )
+    {
+    case BINARY_CSR:    write::BinaryCSR( A, basename );    break;
+    case MATRIX_MARKET: write::MatrixMarket( A, basename ); break;
+    default:
+        LogicError("Format unsupported for writing sparse matrices");
+    }
+}
+
+template<typename T>
+void Write
+( const DistSparseMatrix<T>& A, std::string basename, FileFormat format )
+{
+    DEBUG_ONLY(CallStackEntry cse("Write"))
+    switch( format )
+    {
+    case BINARY_CSR:    write::BinaryCSR( A, basename );    break;
+    case MATRIX_MARKET: write::MatrixMarket( A, basename ); break;
+    default:
+        LogicError("Format unsupported for writing sparse matrices");
+    }
+}
+
 #define PROTO(T) \
   template void Write \
   ( const Matrix<T>& A, \
@@ -90,7 +127,11 @@ void Write
     std::string basename, FileFormat format, std::string title ); \
   template void Write \
   ( const AbstractBlockDistMatrix<T>& A, \
-    std::string basename, FileFormat format, std::string title );
+    std::string basename, FileFormat format, std::string title ); \
+  template void Write \
+  ( const SparseMatrix<T>& A, std::string basename, FileFormat format ); \
+  template void Write \
+  ( const DistSparseMatrix<T>& A, std::string basename, FileFormat format );
 
 #include "El/macros/Instantiate.h"
 
@@ -36,6 +36,64 @@ Binary( const Matrix<T>& A, std::string basename="matrix" )
             file.write( (char*)A.LockedBuffer(0,j), A.Height()*sizeof(T) );
 }
 
+// Collectively write the local entries of A into a file storing a column-major
+// matrix after 'metaBytes' bytes of metadata
+template<typename T,class DistMatrixType>
+inline void
+CollectiveWrite
+( mpi::File file, const DistMatrixType& A, mpi::Offset metaBytes )
+{
+    DEBUG_ONLY(CallStackEntry cse("write::CollectiveWrite"))
+    const bool participating = SetFileView( file, A, metaBytes, true );
+    const Int localHeight = ( participating ? A.LocalHeight() : 0 );
+    const Int localWidth = ( participating ? A.LocalWidth() : 0 );
+    const mpi::Offset numBytes = mpi::Offset(localHeight)*localWidth*sizeof(T);
+    if( localHeight == A.LDim() || localWidth == 0 )
+    {
+        mpi::FileWriteAll( file, (const byte*)A.LockedBuffer(), numBytes );
+    }
+    else
+    {
+        std::vector<T> buffer( localHeight*localWidth );
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+            MemCopy
+            ( &buffer[jLoc*localHeight], A.LockedBuffer(0,jLoc), localHeight );
+        mpi::FileWriteAll( file, (const byte*)buffer.data(), numBytes );
+    }
+}
+
+template<typename T,class DistMatrixType>
+inline void
+BinaryHelper( const DistMatrixType& A, std::string basename )
+{
+    DEBUG_ONLY(CallStackEntry cse("write::Binary"))
+    std::string filename = basename + "." + FileExtension(BINARY);
+    mpi::Comm comm = A.Grid().ViewingComm();
+    mpi::File file;
+    mpi::FileOpen( comm, filename, mpi::MODE_CREATE|mpi::MODE_WRONLY, file );
+
+    const mpi::Offset metaBytes = 2*sizeof(Int);
+    const mpi::Offset dataBytes = mpi::Offset(A.Height())*A.Width()*sizeof(T);
+    mpi::FileSetSize( file, metaBytes+dataBytes );
+    if( mpi::Rank(comm) == 0 )
+    {
+        const Int dims[2] = { A.Height(), A.Width() };
+        mpi::FileWriteAt( file, 0, (const byte*)dims, metaBytes );
+    }
+    CollectiveWrite<T>( file, A, metaBytes );
+    mpi::FileClose( file );
+}
+
+template<typename T>
+inline void
+Binary( const AbstractDistMatrix<T>& A, std::string basename="matrix" )
+{ BinaryHelper<T>( A, basename ); }
+
+template<typename T>
+inline void
+Binary( const AbstractBlockDistMatrix<T>& A, std::string basename="matrix" )
+{ BinaryHelper<T>( A, basename ); }
+
 } // namespace write
 } // namespace El
 
@@ -0,0 +1,120 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_WRITE_BINARYCSR_HPP
+#define EL_WRITE_BINARYCSR_HPP
+
+#include "../BinaryCSR.hpp"
+
+namespace El {
+namespace write {
+
+template<typename T>
+inline void
+BinaryCSR( const SparseMatrix<T>& A, std::string basename="matrix" )
+{
+    DEBUG_ONLY(CallStackEntry cse("write::BinaryCSR"))
+    std::string filename = basename + "." + FileExtension(BINARY_CSR);
+    std::ofstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+
+    const Int m = A.Height();
+    const Int numNonzeros = A.NumEntries();
+    const CSRInt header[CSR_HEADER_SIZE] =
+      { m, A.Width(), numNonzeros, sizeof(T), IsComplex<T>::val };
+    file.write( (char*)header, CSR_HEADER_SIZE*sizeof(CSRInt) );
+
+    std::vector<CSRInt> rowOffsets(m+1), colInds(numNonzeros);
+    for( Int i=0; i<=m; ++i )
+        rowOffsets[i] = A.EntryOffset(i);
+    for( Int k=0; k<numNonzeros; ++k )
+        colInds[k] = A.Col(k);
+    file.write( (char*)rowOffsets.data(), (m+1)*sizeof(CSRInt) );
+    file.write( (char*)colInds.data(), numNonzeros*sizeof(CSRInt) );
+    file.write( (char*)A.LockedValueBuffer(), numNonzeros*sizeof(T) );
+}
+
+// Each process directly writes the portion of the file corresponding to its
+// block of rows using collective MPI-IO. The matrix is written starting
+// 'start' bytes into the (already opened) file, which is resized to fit.
+template<typename T>
+inline void
+BinaryCSR( const DistSparseMatrix<T>& A, mpi::File file, mpi::Offset start )
+{
+    DEBUG_ONLY(CallStackEntry cse("write::BinaryCSR"))
+    mpi::Comm comm = A.Comm();
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+
+    // Compute the offset of our first nonzero
+    // =======================================
+    const CSRInt numLocalEntries = A.NumLocalEntries();
+    std::vector<CSRInt> numEntries(commSize);
+    mpi::AllGather( &numLocalEntries, 1, numEntries.data(), 1, comm );
+    CSRInt entryBeg=0, numNonzeros=0;
+    for( int q=0; q<commSize; ++q )
+    {
+        if( q < commRank )
+            entryBeg += numEntries[q];
+        numNonzeros += numEntries[q];
+    }
+
+    const Int m = A.Height();
+    const Int firstLocalRow = A.FirstLocalRow();
+    const Int localHeight = A.LocalHeight();
+    const mpi::Offset offsetsStart = start + CSR_HEADER_SIZE*sizeof(CSRInt);
+    const mpi::Offset colIndsStart = offsetsStart + (m+1)*sizeof(CSRInt);
+    const mpi::Offset valuesStart = colIndsStart + numNonzeros*sizeof(CSRInt);
+
+    mpi::FileSetSize( file, valuesStart+numNonzeros*sizeof(T) );
+    if( commRank == 0 )
+    {
+        const CSRInt header[CSR_HEADER_SIZE] =
+          { m, A.Width(), numNonzeros, sizeof(T), IsComplex<T>::val };
+        mpi::FileWriteAt
+        ( file, start, (const byte*)header, CSR_HEADER_SIZE*sizeof(CSRInt) );
+    }
+
+    // The last process is also responsible for the trailing row offset
+    const Int numLocalOffsets =
+      ( commRank==commSize-1 ? localHeight+1 : localHeight );
+    std::vector<CSRInt> rowOffsets(numLocalOffsets), colInds(numLocalEntries);
+    for( Int iLoc=0; iLoc<numLocalOffsets; ++iLoc )
+        rowOffsets[iLoc] = entryBeg + A.EntryOffset(iLoc);
+    for( Int k=0; k<numLocalEntries; ++k )
+        colInds[k] = A.Col(k);
+    mpi::FileWriteAtAll
+    ( file, offsetsStart+firstLocalRow*sizeof(CSRInt),
+      (const byte*)rowOffsets.data(), numLocalOffsets*sizeof(CSRInt) );
+    mpi::FileWriteAtAll
+    ( file, colIndsStart+entryBeg*sizeof(CSRInt),
+      (const byte*)colInds.data(), numLocalEntries*sizeof(CSRInt) );
+    mpi::FileWriteAtAll
+    ( file, valuesStart+entryBeg*sizeof(T),
+      (const byte*)A.LockedValueBuffer(), numLocalEntries*sizeof(T) );
+}
+
+template<typename T>
+inline void
+BinaryCSR( const DistSparseMatrix<T>& A, std::string basename="matrix" )
+{
+    DEBUG_ONLY(CallStackEntry cse("write::BinaryCSR"))
+    std::string filename = basename + "." + FileExtension(BINARY_CSR);
+    mpi::File file;
+    mpi::FileOpen
+    ( A.Comm(), filename, mpi::MODE_CREATE|mpi::MODE_WRONLY, file );
+    BinaryCSR( A, file, 0 );
+    mpi::FileClose( file );
+}
+
+} // namespace write
+} // namespace El
+
+#endif // ifndef EL_WRITE_BINARYCSR_HPP
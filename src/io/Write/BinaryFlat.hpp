@@ -31,6 +31,33 @@ BinaryFlat( const Matrix<T>& A, std::string basename="matrix" )
             file.write( (char*)A.LockedBuffer(0,j), A.Height()*sizeof(T) );
 }
 
+// NOTE: This relies upon write::CollectiveWrite from Write/Binary.hpp
+template<typename T,class DistMatrixType>
+inline void
+BinaryFlatHelper( const DistMatrixType& A, std::string basename )
+{
+    DEBUG_ONLY(CallStackEntry cse("write::BinaryFlat"))
+    std::string filename = basename + "." + FileExtension(BINARY_FLAT);
+    mpi::File file;
+    mpi::FileOpen
+    ( A.Grid().ViewingComm(), filename, mpi::MODE_CREATE|mpi::MODE_WRONLY, 
+      file );
+    mpi::FileSetSize( file, mpi::Offset(A.Height())*A.Width()*sizeof(T) );
+    CollectiveWrite<T>( file, A, 0 );
+    mpi::FileClose( file );
+}
+
+template<typename T>
+inline void
+BinaryFlat( const AbstractDistMatrix<T>& A, std::string basename="matrix" )
+{ BinaryFlatHelper<T>( A, basename ); }
+
+template<typename T>
+inline void
+BinaryFlat
+( const AbstractBlockDistMatrix<T>& A, std::string basename="matrix" )
+{ BinaryFlatHelper<T>( A, basename ); }
+
 } // namespace write
 } // namespace El
 
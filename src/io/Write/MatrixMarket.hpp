@@ -63,6 +63,100 @@ MatrixMarket( const Matrix<T>& A, std::string basename="matrix" )
     }
 }
 
+// Sparse matrices are written in the coordinate format
+// ====================================================
+
+template<typename T>
+inline std::string
+SparseMatrixMarketHeader( Int m, Int n, Int numNonzeros )
+{
+    std::ostringstream os;
+    os << "%%MatrixMarket matrix coordinate ";
+    if( IsComplex<T>::val )
+        os << "complex ";
+    else
+        os << "real ";
+    os << "general\n"
+       << m << " " << n << " " << numNonzeros << "\n";
+    return os.str();
+}
+
+template<typename T>
+inline void
+SparseMatrixMarketEntry( std::ostringstream& os, Int i, Int j, T value )
+{
+    os << i+1 << " " << j+1 << " " << RealPart(value);
+    if( IsComplex<T>::val )
+        os << " " << ImagPart(value);
+    os << "\n";
+}
+
+template<typename T>
+inline void
+MatrixMarket( const SparseMatrix<T>& A, std::string basename="matrix" )
+{
+    DEBUG_ONLY(CallStackEntry cse("write::MatrixMarket"))
+    
+    std::string filename = basename + "." + FileExtension(MATRIX_MARKET);
+    std::ofstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+
+    const Int numNonzeros = A.NumEntries();
+    file << SparseMatrixMarketHeader<T>( A.Height(), A.Width(), numNonzeros );
+    std::ostringstream os;
+    os.precision( std::numeric_limits<Base<T>>::digits10+2 );
+    for( Int k=0; k<numNonzeros; ++k )
+        SparseMatrixMarketEntry( os, A.Row(k), A.Col(k), A.Value(k) );
+    file << os.str();
+}
+
+// Each process formats its own entries and then writes them into its portion
+// of the file using collective MPI-IO
+template<typename T>
+inline void
+MatrixMarket( const DistSparseMatrix<T>& A, std::string basename="matrix" )
+{
+    DEBUG_ONLY(CallStackEntry cse("write::MatrixMarket"))
+    std::string filename = basename + "." + FileExtension(MATRIX_MARKET);
+    mpi::Comm comm = A.Comm();
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+
+    const Int numLocalEntries = A.NumLocalEntries();
+    const Int numNonzeros = mpi::AllReduce( numLocalEntries, comm );
+    const std::string header = 
+      SparseMatrixMarketHeader<T>( A.Height(), A.Width(), numNonzeros );
+
+    std::ostringstream os;
+    os.precision( std::numeric_limits<Base<T>>::digits10+2 );
+    if( commRank == 0 )
+        os << header;
+    for( Int k=0; k<numLocalEntries; ++k )
+        SparseMatrixMarketEntry( os, A.Row(k), A.Col(k), A.Value(k) );
+    const std::string localStr = os.str();
+
+    // Compute the offset of our portion of the file
+    // =============================================
+    const long long int localSize = localStr.size();
+    std::vector<long long int> sizes(commSize);
+    mpi::AllGather( &localSize, 1, sizes.data(), 1, comm );
+    mpi::Offset offset=0, fileSize=0;
+    for( int q=0; q<commSize; ++q )
+    {
+        if( q < commRank )
+            offset += sizes[q];
+        fileSize += sizes[q];
+    }
+
+    mpi::File file;
+    mpi::FileOpen( comm, filename, mpi::MODE_CREATE|mpi::MODE_WRONLY, file );
+    mpi::FileSetSize( file, fileSize );
+    mpi::FileWriteAtAll
+    ( file, offset, (const byte*)localStr.data(), localSize );
+    mpi::FileClose( file );
+}
+
 } // namespace write
 } // namespace El
 
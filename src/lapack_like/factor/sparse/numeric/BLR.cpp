@@ -0,0 +1,248 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson, Lexing Ying,
+   The University of Texas at Austin, Stanford University, and the
+   Georgia Insitute of Technology.
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+// The bottom-left block of a large front couples its separator to the distant
+// separators of its ancestors, and so, for discretizations of elliptic and
+// (to a lesser extent) oscillatory problems, its tiles are numerically low
+// rank. Each tile is compressed with an interpolative decomposition,
+//
+//     A P ~= A_J [I, Z],   so that   A ~= A_J ([I, Z] P^T),
+//
+// where A_J consists of the columns of the tile chosen by a column-pivoted QR.
+
+namespace El {
+
+template<typename F>
+void BLRCompress
+( const Matrix<F>& A, BLRMatrix<F>& B, Int tileSize, Base<F> tol )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("BLRCompress");
+        if( tileSize < 1 )
+            LogicError("Tile size must be positive");
+    )
+    const Int m = A.Height();
+    const Int n = A.Width();
+    B.height = m;
+    B.width = n;
+    B.tileSize = tileSize;
+    const Int numTileRows = B.NumTileRows();
+    const Int numTileCols = B.NumTileCols();
+    B.U.resize( numTileRows*numTileCols );
+    B.V.resize( numTileRows*numTileCols );
+
+    QRCtrl<Base<F>> qrCtrl;
+    qrCtrl.colPiv = true;
+    qrCtrl.adaptive = true;
+    qrCtrl.tol = tol;
+
+    Matrix<Int> p;
+    Matrix<F> Z, AP;
+    for( Int j=0; j<numTileCols; ++j )
+    {
+        const Int jBeg = j*tileSize;
+        const Int nb = Min(tileSize,n-jBeg);
+        for( Int i=0; i<numTileRows; ++i )
+        {
+            const Int iBeg = i*tileSize;
+            const Int mb = Min(tileSize,m-iBeg);
+            auto ATile = A( IR(iBeg,iBeg+mb), IR(jBeg,jBeg+nb) );
+            Matrix<F>& U = B.U[i+j*numTileRows];
+            Matrix<F>& V = B.V[i+j*numTileRows];
+
+            ID( ATile, p, Z, qrCtrl );
+            const Int rank = Z.Height();
+            if( rank*(mb+nb) >= mb*nb )
+            {
+                U = ATile;
+                V.Empty();
+                continue;
+            }
+
+            // U := A_J (copied, as moving a view into U would alias AP)
+            AP = ATile;
+            InversePermuteCols( AP, p );
+            auto AJ = AP( IR(0,mb), IR(0,rank) );
+            U = AJ;
+
+            // V := [I, Z] P^T
+            Zeros( V, rank, nb );
+            for( Int k=0; k<rank; ++k )
+                V.Set( k, k, F(1) );
+            for( Int jZ=0; jZ<nb-rank; ++jZ )
+                for( Int k=0; k<rank; ++k )
+                    V.Set( k, rank+jZ, Z.Get(k,jZ) );
+            PermuteCols( V, p );
+        }
+    }
+}
+
+template<typename F>
+void Multiply
+( Orientation orientation,
+  F alpha, const BLRMatrix<F>& A, const Matrix<F>& X,
+  F beta,                               Matrix<F>& Y )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("Multiply");
+        if( X.Width() != Y.Width() )
+            LogicError("X and Y must have the same width");
+        if( orientation == NORMAL &&
+            (A.Width() != X.Height() || A.Height() != Y.Height()) )
+            LogicError("Nonconformal multiply");
+        if( orientation != NORMAL &&
+            (A.Height() != X.Height() || A.Width() != Y.Height()) )
+            LogicError("Nonconformal multiply");
+    )
+    Scale( beta, Y );
+    const Int width = X.Width();
+    const Int numTileRows = A.NumTileRows();
+    const Int numTileCols = A.NumTileCols();
+    Matrix<F> XSub, YSub, Z;
+    for( Int j=0; j<numTileCols; ++j )
+    {
+        const Int jBeg = j*A.tileSize;
+        const Int nb = Min(A.tileSize,A.width-jBeg);
+        for( Int i=0; i<numTileRows; ++i )
+        {
+            const Int iBeg = i*A.tileSize;
+            const Int mb = Min(A.tileSize,A.height-iBeg);
+            const Matrix<F>& U = A.U[i+j*numTileRows];
+            const Matrix<F>& V = A.V[i+j*numTileRows];
+            const bool lowRank = ( V.Width() != 0 );
+            if( lowRank && V.Height() == 0 )
+                continue;
+
+            if( orientation == NORMAL )
+            {
+                LockedView( XSub, X, jBeg, 0, nb, width );
+                View( YSub, Y, iBeg, 0, mb, width );
+                if( lowRank )
+                {
+                    Gemm( NORMAL, NORMAL, F(1), V, XSub, Z );
+                    Gemm( NORMAL, NORMAL, alpha, U, Z, F(1), YSub );
+                }
+                else
+                    Gemm( NORMAL, NORMAL, alpha, U, XSub, F(1), YSub );
+            }
+            else
+            {
+                LockedView( XSub, X, iBeg, 0, mb, width );
+                View( YSub, Y, jBeg, 0, nb, width );
+                if( lowRank )
+                {
+                    Gemm( orientation, NORMAL, F(1), U, XSub, Z );
+                    Gemm( orientation, NORMAL, alpha, V, Z, F(1), YSub );
+                }
+                else
+                    Gemm( orientation, NORMAL, alpha, U, XSub, F(1), YSub );
+            }
+        }
+    }
+}
+
+template<typename F>
+void CompressFronts
+( const DistSymmInfo& info, DistSymmFrontTree<F>& L, BLRStats& stats,
+  const BLRCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CallStackEntry cse("CompressFronts"))
+    if( L.frontType != LDL_1D && L.frontType != LDL_INTRAPIV_1D &&
+        L.frontType != CHOLESKY_1D )
+        LogicError("Only non-inverted 1D fronts may be compressed");
+    if( L.compressed )
+        LogicError("The fronts were already compressed");
+
+    int numFronts = 0;
+    double numOrigEntries = 0, numEntries = 0;
+
+    const int numLocal = info.localNodes.size();
+    for( int s=0; s<numLocal; ++s )
+    {
+        const SymmNodeInfo& node = info.localNodes[s];
+        SymmFront<F>& front = L.localFronts[s];
+        if( front.blrL.Height() != 0 )
+        {
+            // This front was compressed during its factorization
+            numOrigEntries += double(front.blrL.Height())*front.blrL.Width();
+            numEntries += front.blrL.NumEntries();
+            ++numFronts;
+            continue;
+        }
+        const int height = front.frontL.Height();
+        if( height < ctrl.minHeight || height == node.size )
+            continue;
+
+        Matrix<F> FTL, FBL;
+        LockedPartitionDown( front.frontL, FTL, FBL, node.size );
+        BLRCompress( FBL, front.blrL, ctrl.tileSize, ctrl.tol );
+        numOrigEntries += double(FBL.Height())*FBL.Width();
+        numEntries += front.blrL.NumEntries();
+        ++numFronts;
+
+        Matrix<F> newFrontL( FTL );
+        front.frontL = std::move( newFrontL );
+    }
+
+    // The distributed leaf is a view of the local root, which may have moved
+    const Matrix<F>& rootFrontL = L.localFronts.back().frontL;
+    L.distFronts[0].front1dL.LockedAttach
+    ( rootFrontL.Height(), rootFrontL.Width(), *info.distNodes[0].grid, 0, 0,
+      rootFrontL );
+
+    // Since the rows of a low-rank matrix are low-rank, each process
+    // independently compresses its rows of each distributed bottom-left block
+    const int numDist = info.distNodes.size();
+    for( int s=1; s<numDist; ++s )
+    {
+        const DistSymmNodeInfo& node = info.distNodes[s];
+        DistSymmFront<F>& front = L.distFronts[s];
+        const int height = front.front1dL.Height();
+        if( height < ctrl.minHeight || height == node.size )
+            continue;
+
+        const Grid& grid = *node.grid;
+        DistMatrix<F,VC,STAR> FTL(grid), FBL(grid);
+        LockedPartitionDown( front.front1dL, FTL, FBL, node.size );
+        BLRCompress
+        ( FBL.LockedMatrix(), front.blr1dL, ctrl.tileSize, ctrl.tol );
+        numOrigEntries += double(FBL.LocalHeight())*FBL.LocalWidth();
+        numEntries += front.blr1dL.NumEntries();
+        if( grid.VCRank() == 0 )
+            ++numFronts;
+
+        DistMatrix<F,VC,STAR> newFrontL( FTL );
+        front.front1dL = std::move( newFrontL );
+    }
+    L.compressed = true;
+
+    mpi::Comm comm = info.distNodes.back().comm;
+    stats.numFronts = mpi::AllReduce( numFronts, comm );
+    stats.numOrigEntries = mpi::AllReduce( numOrigEntries, comm );
+    stats.numEntries = mpi::AllReduce( numEntries, comm );
+}
+
+#define PROTO(F) \
+  template void BLRCompress \
+  ( const Matrix<F>& A, BLRMatrix<F>& B, Int tileSize, Base<F> tol ); \
+  template void Multiply \
+  ( Orientation orientation, \
+    F alpha, const BLRMatrix<F>& A, const Matrix<F>& X, \
+    F beta,                               Matrix<F>& Y ); \
+  template void CompressFronts \
+  ( const DistSymmInfo& info, DistSymmFrontTree<F>& L, BLRStats& stats, \
+    const BLRCtrl<Base<F>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#include "El/macros/Instantiate.h"
+
+} // namespace El
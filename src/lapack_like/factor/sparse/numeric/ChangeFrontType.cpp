@@ -81,6 +81,8 @@ void ChangeFrontType( DistSymmFrontTree<F>& L, SymmFrontType frontType )
     // Check if this call can be a no-op
     if( frontType == L.frontType ) 
         return;
+    if( L.compressed )
+        LogicError("Cannot change the type of compressed fronts");
 
     if( frontType == SYMM_1D && FrontsAre1d(L.frontType) )
     {
@@ -118,6 +118,9 @@ void DiagonalSolve
   DistNodalMultiVec<F>& X )
 {
     DEBUG_ONLY(CallStackEntry cse("DiagonalSolve"))
+    // A Cholesky factorization, L L^H, has no diagonal factor
+    if( CholeskyFactorization(L.frontType) )
+        return;
     LocalDiagonalSolve( info, L, X );
     DistDiagonalSolve( info, L, X );
 }
@@ -128,6 +131,9 @@ void DiagonalSolve
   DistNodalMatrix<F>& X )
 {
     DEBUG_ONLY(CallStackEntry cse("DiagonalSolve"))
+    // A Cholesky factorization, L L^H, has no diagonal factor
+    if( CholeskyFactorization(L.frontType) )
+        return;
     LocalDiagonalSolve( info, L, X );
     DistDiagonalSolve( info, L, X );
 }
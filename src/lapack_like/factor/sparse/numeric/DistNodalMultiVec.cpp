@@ -59,14 +59,20 @@ DistNodalMultiVec<T>::operator=( const DistNodalMatrix<T>& X )
     return *this;
 }
 
-template<typename T>
-void DistNodalMultiVec<T>::Pull
-( const DistMap& inverseMap, const DistSymmInfo& info,
-  const DistMultiVec<T>& X )
+namespace {
+
+// Map the local rows of the nodal multi-vector, in the order of the local and
+// then distributed nodes, to the rows of the DistMultiVec in the original
+// ordering and exchange the requests with their owners
+void FormRedistMeta
+( const DistMap& inverseMap, const DistSymmInfo& info, int height,
+  NodalRedistMeta& meta )
 {
-    DEBUG_ONLY(CallStackEntry cse("DistNodalMultiVec::Pull"))
-    height_ = X.Height();
-    width_ = X.Width();
+    DEBUG_ONLY(CallStackEntry cse("FormRedistMeta"))
+    mpi::Comm comm = info.distNodes.back().comm;
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    const int blocksize = height/commSize;
 
     // Traverse our part of the elimination tree to see how many indices we need
     int numRecvInds=0;
@@ -76,7 +82,7 @@ void DistNodalMultiVec<T>::Pull
     const int numDist = info.distNodes.size();
     for( int s=1; s<numDist; ++s )
         numRecvInds += info.distNodes[s].multiVecMeta.localSize;
-    
+
     // Fill the set of indices that we need to map to the original ordering
     int off=0;
     std::vector<int> mappedInds( numRecvInds );
@@ -106,236 +112,376 @@ void DistNodalMultiVec<T>::Pull
     inverseMap.Translate( mappedInds );
 
     // Figure out how many entries each process owns that we need
-    mpi::Comm comm = X.Comm();
-    const int commSize = mpi::Size( comm );
-    std::vector<int> recvSizes( commSize, 0 );
+    meta.recvSizes.assign( commSize, 0 );
     for( int s=0; s<numRecvInds; ++s )
-        ++recvSizes[ X.RowOwner( mappedInds[s] ) ];
-    std::vector<int> recvOffs(commSize);
+        ++meta.recvSizes[ RowToProcess(mappedInds[s],blocksize,commSize) ];
+    meta.recvOffs.resize( commSize );
     off=0;
     for( int q=0; q<commSize; ++q )
     {
-        recvOffs[q] = off;
-        off += recvSizes[q];
+        meta.recvOffs[q] = off;
+        off += meta.recvSizes[q];
     }
     std::vector<int> recvInds( numRecvInds );
-    std::vector<int> offs = recvOffs;
+    meta.recvPos.resize( numRecvInds );
+    std::vector<Int> offs = meta.recvOffs;
     for( int s=0; s<numRecvInds; ++s )
     {
         const int i = mappedInds[s];
-        const int q = X.RowOwner(i);
+        const int q = RowToProcess( i, blocksize, commSize );
+        meta.recvPos[s] = offs[q];
         recvInds[offs[q]++] = i;
     }
 
-    // Coordinate for the coming AllToAll to exchange the indices of X
-    std::vector<int> sendSizes(commSize);
-    mpi::AllToAll( &recvSizes[0], 1, &sendSizes[0], 1, comm );
+    // Coordinate for the coming AllToAll to exchange the indices
+    meta.sendSizes.resize( commSize );
+    mpi::AllToAll( &meta.recvSizes[0], 1, &meta.sendSizes[0], 1, comm );
     int numSendInds=0;
-    std::vector<int> sendOffs(commSize);
+    meta.sendOffs.resize( commSize );
     for( int q=0; q<commSize; ++q )
     {
-        sendOffs[q] = numSendInds;
-        numSendInds += sendSizes[q];
+        meta.sendOffs[q] = numSendInds;
+        numSendInds += meta.sendSizes[q];
     }
 
     // Request the indices
-    std::vector<int> sendInds( numSendInds );
+    meta.sendInds.resize( numSendInds );
     mpi::AllToAll
-    ( &recvInds[0], &recvSizes[0], &recvOffs[0],
-      &sendInds[0], &sendSizes[0], &sendOffs[0], comm );
+    ( &recvInds[0], &meta.recvSizes[0], &meta.recvOffs[0],
+      &meta.sendInds[0], &meta.sendSizes[0], &meta.sendOffs[0], comm );
+    const int firstLocalRow = commRank*blocksize;
+    for( int s=0; s<numSendInds; ++s )
+        meta.sendInds[s] -= firstLocalRow;
+
+    meta.height = height;
+    meta.ready = true;
+}
+
+} // anonymous namespace
+
+template<typename T>
+void DistNodalMultiVec<T>::Pull
+( const DistMap& inverseMap, const DistSymmInfo& info,
+  const DistMultiVec<T>& X )
+{
+    DEBUG_ONLY(CallStackEntry cse("DistNodalMultiVec::Pull"))
+    NodalRedistMeta meta;
+    Pull( inverseMap, info, X, 0, X.Width(), meta );
+}
 
-    // Fulfill the requests
-    std::vector<T> sendVals( numSendInds*width_ );
-    const int firstLocalRow = X.FirstLocalRow();
+namespace {
+
+// Scale the counts and offsets of 'meta' by the number of columns
+void ScaleRedist
+( const std::vector<Int>& sizes, const std::vector<Int>& offs, int width,
+  std::vector<Int>& scaledSizes, std::vector<Int>& scaledOffs )
+{
+    const int commSize = sizes.size();
+    scaledSizes.resize( commSize );
+    scaledOffs.resize( commSize );
+    for( int q=0; q<commSize; ++q )
+    {
+        scaledSizes[q] = sizes[q]*width;
+        scaledOffs[q] = offs[q]*width;
+    }
+}
+
+// Fulfill the requests for the rows of columns [colOff,colOff+width) of X
+template<typename T>
+void PackPull
+( const DistMultiVec<T>& X, int colOff, int width,
+  const NodalRedistMeta& meta, std::vector<T>& sendVals )
+{
+    const int numSendInds = meta.sendInds.size();
+    sendVals.resize( numSendInds*width );
     for( int s=0; s<numSendInds; ++s )
-        for( int j=0; j<width_; ++j )
-            sendVals[s*width_+j] = X.GetLocal( sendInds[s]-firstLocalRow, j );
+        for( int j=0; j<width; ++j )
+            sendVals[s*width+j] = X.GetLocal( meta.sendInds[s], colOff+j );
+}
 
-    // Reply with the values
-    std::vector<T> recvVals( numRecvInds*width_ );
+// Store the returned rows into columns [colOff,colOff+width) of X
+template<typename T>
+void UnpackPush
+( DistMultiVec<T>& X, int colOff, int width,
+  const NodalRedistMeta& meta, const std::vector<T>& recvVals )
+{
+    const int numRecvInds = meta.sendInds.size();
+    for( int s=0; s<numRecvInds; ++s )
+    {
+        const int iLocal = meta.sendInds[s];
+        DEBUG_ONLY(
+            if( iLocal < 0 || iLocal >= X.LocalHeight() )
+                LogicError("iLocal was out of bounds");
+        )
+        for( int j=0; j<width; ++j )
+            X.SetLocal( iLocal, colOff+j, recvVals[s*width+j] );
+    }
+}
+
+// Post the messages of a redistribution whose (unscaled) counts and offsets
+// are given by 'sendSizes', 'sendOffs', etc.
+template<typename T>
+void StartExchange
+( const std::vector<T>& sendVals,
+  const std::vector<Int>& sendSizes, const std::vector<Int>& sendOffs,
+        std::vector<T>& recvVals,
+  const std::vector<Int>& recvSizes, const std::vector<Int>& recvOffs,
+  int width, int tag, mpi::Comm comm, std::vector<mpi::Request>& requests )
+{
+    DEBUG_ONLY(CallStackEntry cse("StartExchange"))
+    const int commSize = mpi::Size( comm );
+    requests.clear();
+    requests.reserve( 2*commSize );
     for( int q=0; q<commSize; ++q )
     {
-        sendSizes[q] *= width_;
-        sendOffs[q] *= width_;
-        recvSizes[q] *= width_;
-        recvOffs[q] *= width_;
+        if( recvSizes[q] == 0 )
+            continue;
+        requests.push_back( mpi::Request() );
+        mpi::TaggedIRecv
+        ( &recvVals[recvOffs[q]*width], recvSizes[q]*width, q, tag, comm,
+          requests.back() );
     }
-    mpi::AllToAll
-    ( &sendVals[0], &sendSizes[0], &sendOffs[0],
-      &recvVals[0], &recvSizes[0], &recvOffs[0], comm );
-    SwapClear( sendVals );
-    SwapClear( sendSizes );
-    SwapClear( sendOffs );
+    for( int q=0; q<commSize; ++q )
+    {
+        if( sendSizes[q] == 0 )
+            continue;
+        requests.push_back( mpi::Request() );
+        mpi::TaggedISend
+        ( &sendVals[sendOffs[q]*width], sendSizes[q]*width, q, tag, comm,
+          requests.back() );
+    }
+}
+
+} // anonymous namespace
 
-    // Unpack the values
-    off = 0;
-    offs = recvOffs;
+template<typename T>
+void DistNodalMultiVec<T>::UnpackPull
+( const DistSymmInfo& info, int height, int width,
+  const NodalRedistMeta& meta, const std::vector<T>& recvVals )
+{
+    DEBUG_ONLY(CallStackEntry cse("DistNodalMultiVec::UnpackPull"))
+    height_ = height;
+    width_ = width;
+    int off = 0;
+    const int numLocal = info.localNodes.size();
     localNodes.resize( numLocal );
     for( int s=0; s<numLocal; ++s )
     {
         const SymmNodeInfo& nodeInfo = info.localNodes[s];
-        localNodes[s].Resize( nodeInfo.size, width_ );
+        localNodes[s].Resize( nodeInfo.size, width );
         for( int t=0; t<nodeInfo.size; ++t )
         {
-            const int i = mappedInds[off++];
-            const int q = X.RowOwner(i);
-            for( int j=0; j<width_; ++j )
-                localNodes[s].Set( t, j, recvVals[offs[q]++] );
+            const int pos = meta.recvPos[off++];
+            for( int j=0; j<width; ++j )
+                localNodes[s].Set( t, j, recvVals[pos*width+j] );
         }
     }
+    const int numDist = info.distNodes.size();
     distNodes.resize( numDist-1 );
     for( int s=1; s<numDist; ++s )
     {
         const DistSymmNodeInfo& nodeInfo = info.distNodes[s];
         DistMatrix<T,VC,STAR>& XNode = distNodes[s-1];
-        XNode.SetGrid( *nodeInfo.grid );
-        XNode.Resize( nodeInfo.size, width_ );
+        if( XNode.Grid() != *nodeInfo.grid )
+            XNode.SetGrid( *nodeInfo.grid );
+        XNode.Resize( nodeInfo.size, width );
         const int localHeight = XNode.LocalHeight();
         for( int tLoc=0; tLoc<localHeight; ++tLoc )
         {
-            const int i = mappedInds[off++];
-            const int q = X.RowOwner(i);
-            for( int j=0; j<width_; ++j )
-                XNode.SetLocal( tLoc, j, recvVals[offs[q]++] );
+            const int pos = meta.recvPos[off++];
+            for( int j=0; j<width; ++j )
+                XNode.SetLocal( tLoc, j, recvVals[pos*width+j] );
         }
     }
     DEBUG_ONLY(
-        if( off != numRecvInds )
+        if( off != int(meta.recvPos.size()) )
             LogicError("Unpacked wrong number of indices");
     )
 }
 
 template<typename T>
-void DistNodalMultiVec<T>::Push
-( const DistMap& inverseMap, const DistSymmInfo& info,
-        DistMultiVec<T>& X ) const
+void DistNodalMultiVec<T>::PackPush
+( const NodalRedistMeta& meta, std::vector<T>& sendVals ) const
 {
-    DEBUG_ONLY(CallStackEntry cse("DistNodalMultiVec::Push"))
-    const DistSymmNodeInfo& rootNode = info.distNodes.back();
-    mpi::Comm comm = rootNode.comm;
-    const int height = rootNode.size + rootNode.off;
+    DEBUG_ONLY(CallStackEntry cse("DistNodalMultiVec::PackPush"))
+    // Pack the values in the order in which they were requested by Pull
     const int width = Width();
-    X.SetComm( comm );
-    X.Resize( height, width );
-
-    const int commSize = mpi::Size( comm );
-    const int firstLocalRow = X.FirstLocalRow();
-    const int numDist = info.distNodes.size();
-    const int numLocal = info.localNodes.size();
-
-    // Fill the set of indices that we need to map to the original ordering
-    const int numSendInds = LocalHeight();
-    int off=0;
-    std::vector<int> mappedInds( numSendInds );
-    for( int s=0; s<numLocal; ++s )
-    {
-        const SymmNodeInfo& nodeInfo = info.localNodes[s];
-        for( int t=0; t<nodeInfo.size; ++t )
-            mappedInds[off++] = nodeInfo.off+t;
-    }
-    for( int s=1; s<numDist; ++s )
-    {
-        const DistSymmNodeInfo& nodeInfo = info.distNodes[s];
-        const DistMatrix<T,VC,STAR>& XNode = distNodes[s-1];
-        for( int t=XNode.ColShift(); t<XNode.Height(); t+=XNode.ColStride() )
-            mappedInds[off++] = nodeInfo.off+t;
-    }
-
-    // Convert the indices to the original ordering
-    inverseMap.Translate( mappedInds );
-
-    // Figure out how many indices each process owns that we need to send
-    std::vector<int> sendSizes(commSize,0);
-    for( int s=0; s<numSendInds; ++s )
-        ++sendSizes[ X.RowOwner(mappedInds[s]) ];
-    std::vector<int> sendOffs(commSize);
-    off=0;
-    for( int q=0; q<commSize; ++q )
-    {
-        sendOffs[q] = off;
-        off += sendSizes[q];
-    }
-
-    // Pack the send indices and values
-    off=0;
-    std::vector<T> sendVals( numSendInds*width );
-    std::vector<int> sendInds( numSendInds );
-    std::vector<int> offs = sendOffs;
+    int off = 0;
+    const int numSendInds = meta.recvPos.size();
+    sendVals.resize( numSendInds*width );
+    const int numLocal = localNodes.size();
     for( int s=0; s<numLocal; ++s )
     {
-        const SymmNodeInfo& nodeInfo = info.localNodes[s];
-        for( int t=0; t<nodeInfo.size; ++t )
+        const Matrix<T>& XNode = localNodes[s];
+        const int nodeHeight = XNode.Height();
+        for( int t=0; t<nodeHeight; ++t )
         {
-            const int i = mappedInds[off++];
-            const int q = X.RowOwner(i);
+            const int pos = meta.recvPos[off++];
             for( int j=0; j<width; ++j )
-                sendVals[offs[q]*width+j] = localNodes[s].Get(t,j);    
-            sendInds[offs[q]++] = i;
+                sendVals[pos*width+j] = XNode.Get(t,j);
         }
     }
-    for( int s=1; s<numDist; ++s )
+    const int numDist = distNodes.size();
+    for( int s=0; s<numDist; ++s )
     {
-        const DistMatrix<T,VC,STAR>& XNode = distNodes[s-1];
+        const DistMatrix<T,VC,STAR>& XNode = distNodes[s];
         const int localHeight = XNode.LocalHeight();
         for( int tLoc=0; tLoc<localHeight; ++tLoc )
         {
-            const int i = mappedInds[off++];
-            const int q = X.RowOwner(i);
+            const int pos = meta.recvPos[off++];
             for( int j=0; j<width; ++j )
-                sendVals[offs[q]*width+j] = XNode.GetLocal(tLoc,j);
-            sendInds[offs[q]++] = i;
+                sendVals[pos*width+j] = XNode.GetLocal(tLoc,j);
         }
     }
+    DEBUG_ONLY(
+        if( off != numSendInds )
+            LogicError("Packed wrong number of indices");
+    )
+}
 
-    // Coordinate for the coming AllToAll to exchange the indices of x
-    std::vector<int> recvSizes(commSize);
-    mpi::AllToAll( &sendSizes[0], 1, &recvSizes[0], 1, comm );
-    int numRecvInds=0;
-    std::vector<int> recvOffs(commSize);
-    for( int q=0; q<commSize; ++q )
-    {
-        recvOffs[q] = numRecvInds;
-        numRecvInds += recvSizes[q];
-    }
+template<typename T>
+void DistNodalMultiVec<T>::Pull
+( const DistMap& inverseMap, const DistSymmInfo& info,
+  const DistMultiVec<T>& X, int colOff, int width, NodalRedistMeta& meta )
+{
     DEBUG_ONLY(
-        if( numRecvInds != X.LocalHeight() )
-            LogicError("numRecvInds was not equal to local height");
+        CallStackEntry cse("DistNodalMultiVec::Pull");
+        if( colOff < 0 || width < 0 || colOff+width > X.Width() )
+            LogicError("Invalid column range");
     )
+    if( !meta.ready || meta.height != X.Height() )
+        FormRedistMeta( inverseMap, info, X.Height(), meta );
 
-    // Send the indices
-    std::vector<int> recvInds( numRecvInds );
+    std::vector<Int> sendSizes, sendOffs, recvSizes, recvOffs;
+    ScaleRedist( meta.sendSizes, meta.sendOffs, width, sendSizes, sendOffs );
+    ScaleRedist( meta.recvSizes, meta.recvOffs, width, recvSizes, recvOffs );
+
+    // Fulfill the requests and reply with the values
+    std::vector<T> sendVals;
+    PackPull( X, colOff, width, meta, sendVals );
+    std::vector<T> recvVals( meta.recvPos.size()*width );
     mpi::AllToAll
-    ( &sendInds[0], &sendSizes[0], &sendOffs[0],
-      &recvInds[0], &recvSizes[0], &recvOffs[0], comm );
+    ( &sendVals[0], &sendSizes[0], &sendOffs[0],
+      &recvVals[0], &recvSizes[0], &recvOffs[0], X.Comm() );
+    SwapClear( sendVals );
 
-    // Send the values
-    std::vector<T> recvVals( numRecvInds*width );
-    for( int q=0; q<commSize; ++q )
-    {
-        sendSizes[q] *= width;
-        sendOffs[q] *= width;
-        recvSizes[q] *= width;
-        recvOffs[q] *= width;
-    }
+    UnpackPull( info, X.Height(), width, meta, recvVals );
+}
+
+template<typename T>
+void DistNodalMultiVec<T>::Push
+( const DistMap& inverseMap, const DistSymmInfo& info,
+        DistMultiVec<T>& X ) const
+{
+    DEBUG_ONLY(CallStackEntry cse("DistNodalMultiVec::Push"))
+    const DistSymmNodeInfo& rootNode = info.distNodes.back();
+    X.SetComm( rootNode.comm );
+    X.Resize( rootNode.size+rootNode.off, Width() );
+    NodalRedistMeta meta;
+    Push( inverseMap, info, X, 0, meta );
+}
+
+template<typename T>
+void DistNodalMultiVec<T>::Push
+( const DistMap& inverseMap, const DistSymmInfo& info,
+        DistMultiVec<T>& X, int colOff, NodalRedistMeta& meta ) const
+{
+    DEBUG_ONLY(CallStackEntry cse("DistNodalMultiVec::Push"))
+    const DistSymmNodeInfo& rootNode = info.distNodes.back();
+    const int width = Width();
+    if( X.Height() != rootNode.size+rootNode.off )
+        LogicError("X does not have the height of the elimination tree");
+    if( colOff < 0 || colOff+width > X.Width() )
+        LogicError("Invalid column range");
+    if( !meta.ready || meta.height != X.Height() )
+        FormRedistMeta( inverseMap, info, X.Height(), meta );
+
+    std::vector<Int> sendSizes, sendOffs, recvSizes, recvOffs;
+    ScaleRedist( meta.recvSizes, meta.recvOffs, width, sendSizes, sendOffs );
+    ScaleRedist( meta.sendSizes, meta.sendOffs, width, recvSizes, recvOffs );
+
+    // Send the values back to their owners
+    std::vector<T> sendVals;
+    PackPush( meta, sendVals );
+    std::vector<T> recvVals( meta.sendInds.size()*width );
     mpi::AllToAll
     ( &sendVals[0], &sendSizes[0], &sendOffs[0],
-      &recvVals[0], &recvSizes[0], &recvOffs[0], comm );
+      &recvVals[0], &recvSizes[0], &recvOffs[0], X.Comm() );
     SwapClear( sendVals );
-    SwapClear( sendSizes );
-    SwapClear( sendOffs );
 
-    // Unpack the values
-    for( int s=0; s<numRecvInds; ++s )
-    {
-        const int i = recvInds[s];
-        const int iLocal = i - firstLocalRow;
-        DEBUG_ONLY(
-            if( iLocal < 0 || iLocal >= X.LocalHeight() )
-                LogicError("iLocal was out of bounds");
-        )
-        for( int j=0; j<width; ++j )
-            X.SetLocal( iLocal, j, recvVals[s*width+j] );
-    }
+    UnpackPush( X, colOff, width, meta, recvVals );
+}
+
+template<typename T>
+void DistNodalMultiVec<T>::StartPull
+( const DistMap& inverseMap, const DistSymmInfo& info,
+  const DistMultiVec<T>& X, int colOff, int width,
+  NodalRedistMeta& meta, NodalRedistRequest<T>& req, int tag ) const
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("DistNodalMultiVec::StartPull");
+        if( colOff < 0 || width < 0 || colOff+width > X.Width() )
+            LogicError("Invalid column range");
+    )
+    if( !meta.ready || meta.height != X.Height() )
+        FormRedistMeta( inverseMap, info, X.Height(), meta );
+    req.colOff = colOff;
+    req.width = width;
+    PackPull( X, colOff, width, meta, req.sendVals );
+    req.recvVals.resize( meta.recvPos.size()*width );
+    StartExchange
+    ( req.sendVals, meta.sendSizes, meta.sendOffs,
+      req.recvVals, meta.recvSizes, meta.recvOffs,
+      width, tag, X.Comm(), req.requests );
+}
+
+template<typename T>
+void DistNodalMultiVec<T>::FinishPull
+( const DistSymmInfo& info, const NodalRedistMeta& meta,
+  NodalRedistRequest<T>& req )
+{
+    DEBUG_ONLY(CallStackEntry cse("DistNodalMultiVec::FinishPull"))
+    mpi::WaitAll( req.requests.size(), req.requests.data() );
+    SwapClear( req.sendVals );
+    UnpackPull( info, meta.height, req.width, meta, req.recvVals );
+    SwapClear( req.recvVals );
+}
+
+template<typename T>
+void DistNodalMultiVec<T>::StartPush
+( const DistMap& inverseMap, const DistSymmInfo& info,
+  const DistMultiVec<T>& X, int colOff,
+  NodalRedistMeta& meta, NodalRedistRequest<T>& req, int tag ) const
+{
+    DEBUG_ONLY(CallStackEntry cse("DistNodalMultiVec::StartPush"))
+    const DistSymmNodeInfo& rootNode = info.distNodes.back();
+    const int width = Width();
+    if( X.Height() != rootNode.size+rootNode.off )
+        LogicError("X does not have the height of the elimination tree");
+    if( colOff < 0 || colOff+width > X.Width() )
+        LogicError("Invalid column range");
+    if( !meta.ready || meta.height != X.Height() )
+        FormRedistMeta( inverseMap, info, X.Height(), meta );
+    req.colOff = colOff;
+    req.width = width;
+    PackPush( meta, req.sendVals );
+    req.recvVals.resize( meta.sendInds.size()*width );
+    StartExchange
+    ( req.sendVals, meta.recvSizes, meta.recvOffs,
+      req.recvVals, meta.sendSizes, meta.sendOffs,
+      width, tag, X.Comm(), req.requests );
+}
+
+template<typename T>
+void DistNodalMultiVec<T>::FinishPush
+( DistMultiVec<T>& X, const NodalRedistMeta& meta,
+  NodalRedistRequest<T>& req ) const
+{
+    DEBUG_ONLY(CallStackEntry cse("DistNodalMultiVec::FinishPush"))
+    mpi::WaitAll( req.requests.size(), req.requests.data() );
+    SwapClear( req.sendVals );
+    UnpackPush( X, req.colOff, req.width, meta, req.recvVals );
+    SwapClear( req.recvVals );
 }
 
 template<typename T>
@@ -14,6 +14,7 @@ namespace El {
 
 template<typename T>
 DistSymmFrontTree<T>::DistSymmFrontTree()
+: compressed(false)
 { }
 
 template<typename T>
@@ -31,6 +32,8 @@ void DistSymmFrontTree<T>::Initialize
     )
     frontType = SYMM_2D;
     isHermitian = conjugate;
+    compressed = false;
+    loadMeta.Clear();
     
     mpi::Comm comm = A.Comm();
     const DistGraph& graph = A.LockedDistGraph();
@@ -48,7 +51,7 @@ void DistSymmFrontTree<T>::Initialize
     reordering.Translate( mappedTargets );
 
     // Set up the indices for the rows we need from each process
-    std::vector<int> recvRowSizes( commSize, 0 );
+    std::vector<Int> recvRowSizes( commSize, 0 );
     for( int s=0; s<numLocal; ++s )
     {
         const SepOrLeaf& sepOrLeaf = *sepTree.localSepsAndLeaves[s];
@@ -83,15 +86,15 @@ void DistSymmFrontTree<T>::Initialize
             ++recvRowSizes[q];
         }
     }
-    int numRecvRows=0;
-    std::vector<int> recvRowOffs( commSize );
+    Int numRecvRows=0;
+    std::vector<Int> recvRowOffs( commSize );
     for( int q=0; q<commSize; ++q )
     {
         recvRowOffs[q] = numRecvRows;
         numRecvRows += recvRowSizes[q];
     }
     std::vector<int> recvRows( numRecvRows );
-    std::vector<int> offs = recvRowOffs;
+    std::vector<Int> offs = recvRowOffs;
     for( int s=0; s<numLocal; ++s )
     {
         const SepOrLeaf& sepOrLeaf = *sepTree.localSepsAndLeaves[s];
@@ -136,10 +139,10 @@ void DistSymmFrontTree<T>::Initialize
     }
 
     // Retreive the list of rows that we must send to each process
-    std::vector<int> sendRowSizes( commSize );
+    std::vector<Int> sendRowSizes( commSize );
     mpi::AllToAll( &recvRowSizes[0], 1, &sendRowSizes[0], 1, comm );
-    int numSendRows=0;
-    std::vector<int> sendRowOffs( commSize );
+    Int numSendRows=0;
+    std::vector<Int> sendRowOffs( commSize );
     for( int q=0; q<commSize; ++q )
     {
         sendRowOffs[q] = numSendRows;
@@ -152,10 +155,10 @@ void DistSymmFrontTree<T>::Initialize
 
     // Pack the number of nonzeros per row (and the nonzeros themselves)
     // TODO: Avoid sending upper-triangular data
-    int numSendEntries=0;
+    Int numSendEntries=0;
     const int firstLocalRow = A.FirstLocalRow();
-    std::vector<int> sendRowLengths( numSendRows ),
-                     sendEntriesSizes( commSize, 0 ),
+    std::vector<int> sendRowLengths( numSendRows );
+    std::vector<Int> sendEntriesSizes( commSize, 0 ),
                      sendEntriesOffs( commSize );
     for( int q=0; q<commSize; ++q )
     {
@@ -174,6 +177,7 @@ void DistSymmFrontTree<T>::Initialize
     }
     std::vector<T> sendEntries( numSendEntries );
     std::vector<int> sendTargets( numSendEntries );
+    loadMeta.sendInds.resize( numSendEntries );
     for( int q=0; q<commSize; ++q )
     {
         int index = sendEntriesOffs[q];
@@ -197,6 +201,7 @@ void DistSymmFrontTree<T>::Initialize
                 )
                 sendEntries[index] = (conjugate ? Conj(value) : value);
                 sendTargets[index] = mappedTarget;
+                loadMeta.sendInds[index] = localEntryOff+t;
                 ++index;
             }
         }
@@ -211,8 +216,8 @@ void DistSymmFrontTree<T>::Initialize
     mpi::AllToAll
     ( &sendRowLengths[0], &sendRowSizes[0], &sendRowOffs[0],
       &recvRowLengths[0], &recvRowSizes[0], &recvRowOffs[0], comm );
-    int numRecvEntries=0;
-    std::vector<int> recvEntriesSizes( commSize, 0 ),
+    Int numRecvEntries=0;
+    std::vector<Int> recvEntriesSizes( commSize, 0 ),
                      recvEntriesOffs( commSize );
     for( int q=0; q<commSize; ++q )
     {
@@ -233,9 +238,12 @@ void DistSymmFrontTree<T>::Initialize
     ( &sendTargets[0], &sendEntriesSizes[0], &sendEntriesOffs[0],
       &recvTargets[0], &recvEntriesSizes[0], &recvEntriesOffs[0], comm );
 
-    // Unpack the received entries
+    // Unpack the received entries (and record where each of them was placed)
+    loadMeta.recvFronts.resize( numRecvEntries, -1 );
+    loadMeta.recvRows.resize( numRecvEntries, -1 );
+    loadMeta.recvCols.resize( numRecvEntries, -1 );
     offs = recvRowOffs;
-    std::vector<int> entryOffs = recvEntriesOffs;
+    std::vector<Int> entryOffs = recvEntriesOffs;
     localFronts.resize( numLocal );
     for( int s=0; s<numLocal; ++s )
     {
@@ -248,6 +256,7 @@ void DistSymmFrontTree<T>::Initialize
         const int off = node.off;
         const int lowerSize = node.lowerStruct.size();
         Zeros( front.frontL, size+lowerSize, size );
+        front.blrL.Empty();
         DEBUG_ONLY(
             if( size != (int)sepOrLeaf.inds.size() )
                 LogicError("Mismatch between separator and node size");
@@ -267,11 +276,12 @@ void DistSymmFrontTree<T>::Initialize
                 const int target = recvTargets[entryOff];
                 ++entryOff;
 
+                int row;
                 if( target < off+t )
                     continue;
                 else if( target < off+size )
                 {
-                    front.frontL.Set( target-off, t, value );
+                    row = target-off;
                 }
                 else
                 {
@@ -280,13 +290,16 @@ void DistSymmFrontTree<T>::Initialize
                         if( origOff >= (int)node.origLowerRelInds.size() )
                             LogicError("origLowerRelInds too small");
                     )
-                    const int row = node.origLowerRelInds[origOff];
+                    row = node.origLowerRelInds[origOff];
                     DEBUG_ONLY(
                         if( row < t )
                             LogicError("Tried to touch upper triangle");
                     )
-                    front.frontL.Set( row, t, value );
                 }
+                front.frontL.Set( row, t, value );
+                loadMeta.recvFronts[entryOff-1] = s;
+                loadMeta.recvRows[entryOff-1] = row;
+                loadMeta.recvCols[entryOff-1] = t;
             }
         }
     }
@@ -310,6 +323,7 @@ void DistSymmFrontTree<T>::Initialize
         const int lowerSize = node.lowerStruct.size();
         front.front2dL.SetGrid( grid );
         Zeros( front.front2dL, size+lowerSize, size );
+        front.blr1dL.Empty();
         DEBUG_ONLY(
             if( size != (int)sep.inds.size() )
                 LogicError("Mismatch in separator and node sizes");
@@ -330,16 +344,12 @@ void DistSymmFrontTree<T>::Initialize
                 const int target = recvTargets[entryOff];
                 ++entryOff;
 
+                int row;
                 if( target < off+t )
                     continue;
                 else if( target < off+size )
                 {
-                    if( (target-off) % colStride == colShift )
-                    {
-                        const int row = target-off;
-                        const int localRow = (row-colShift) / colStride;
-                        front.front2dL.SetLocal( localRow, localCol, value );
-                    }
+                    row = target-off;
                 }
                 else 
                 {
@@ -348,16 +358,19 @@ void DistSymmFrontTree<T>::Initialize
                         if( origOff >= (int)node.origLowerRelInds.size() )
                             LogicError("origLowerRelInds too small");
                     )
-                    const int row = node.origLowerRelInds[origOff];
+                    row = node.origLowerRelInds[origOff];
                     DEBUG_ONLY(
                         if( row < t )
                             LogicError("Tried to touch upper triangle");
                     )
-                    if( row % colStride == colShift )
-                    {
-                        const int localRow = (row-colShift) / colStride;
-                        front.front2dL.SetLocal( localRow, localCol, value );
-                    }
+                }
+                if( row % colStride == colShift )
+                {
+                    const int localRow = (row-colShift) / colStride;
+                    front.front2dL.SetLocal( localRow, localCol, value );
+                    loadMeta.recvFronts[entryOff-1] = numLocal+s;
+                    loadMeta.recvRows[entryOff-1] = localRow;
+                    loadMeta.recvCols[entryOff-1] = localCol;
                 }
             }
         }
@@ -376,6 +389,104 @@ void DistSymmFrontTree<T>::Initialize
         bottomDist.LockedAttach
         ( topLocal.Height(), topLocal.Width(), *node.grid, 0, 0, topLocal );
     }
+
+    loadMeta.numLocalEntries = A.NumLocalEntries();
+    loadMeta.sendSizes.swap( sendEntriesSizes );
+    loadMeta.sendOffs.swap( sendEntriesOffs );
+    loadMeta.recvSizes.swap( recvEntriesSizes );
+    loadMeta.recvOffs.swap( recvEntriesOffs );
+    loadMeta.ready = true;
+}
+
+template<typename T>
+void DistSymmFrontTree<T>::Refactor( const DistSparseMatrix<T>& A )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("DistSymmFrontTree::Refactor");
+        if( loadMeta.ready && A.NumLocalEntries() != loadMeta.numLocalEntries )
+            LogicError("Sparsity pattern differs from that of Initialize");
+    )
+    if( !loadMeta.ready )
+        LogicError("Front tree must be initialized before refactoring");
+    if( compressed )
+        LogicError("Compressed fronts cannot be refactored");
+    mpi::Comm comm = A.Comm();
+    const int numLocal = localFronts.size();
+    const int numDist = distFronts.size()-1;
+
+    // Exchange the new values in the same order as during initialization
+    const Int numSendEntries = loadMeta.sendInds.size();
+    const Int numRecvEntries = loadMeta.recvFronts.size();
+    std::vector<T> sendEntries( numSendEntries );
+    for( int k=0; k<numSendEntries; ++k )
+    {
+        const T value = A.Value( loadMeta.sendInds[k] );
+        sendEntries[k] = (isHermitian ? Conj(value) : value);
+    }
+    std::vector<T> recvEntries( numRecvEntries );
+    mpi::AllToAll
+    ( sendEntries.data(), loadMeta.sendSizes.data(), loadMeta.sendOffs.data(),
+      recvEntries.data(), loadMeta.recvSizes.data(), loadMeta.recvOffs.data(),
+      comm );
+    SwapClear( sendEntries );
+
+    // Return the fronts to their unfactored 2D form. Since the front sizes are
+    // unchanged, the local fronts (and the 2D distributed fronts) are zeroed
+    // in place rather than reallocated.
+    for( int s=0; s<numLocal; ++s )
+    {
+        Matrix<T>& frontL = localFronts[s].frontL;
+        Zeros( frontL, frontL.Height(), frontL.Width() );
+    }
+    const bool frontsAre1d = FrontsAre1d( frontType );
+    for( int s=1; s<=numDist; ++s )
+    {
+        DistSymmFront<T>& front = distFronts[s];
+        if( frontsAre1d )
+        {
+            front.front2dL.SetGrid( front.front1dL.Grid() );
+            Zeros
+            ( front.front2dL, front.front1dL.Height(), front.front1dL.Width() );
+            front.front1dL.Empty();
+        }
+        else
+        {
+            DEBUG_ONLY(
+                if( front.front2dL.ColAlign() != 0 ||
+                    front.front2dL.RowAlign() != 0 )
+                    LogicError("Distributed front was not aligned at 0");
+            )
+            Zeros
+            ( front.front2dL, front.front2dL.Height(), front.front2dL.Width() );
+        }
+    }
+
+    // Scatter the values into their saved destinations
+    for( int k=0; k<numRecvEntries; ++k )
+    {
+        const int s = loadMeta.recvFronts[k];
+        if( s < 0 )
+            continue;
+        const int row = loadMeta.recvRows[k];
+        const int col = loadMeta.recvCols[k];
+        if( s < numLocal )
+            localFronts[s].frontL.Set( row, col, recvEntries[k] );
+        else
+            distFronts[s-numLocal+1].front2dL.SetLocal
+            ( row, col, recvEntries[k] );
+    }
+
+    // Copy information from the local root to the dist leaf
+    {
+        DistSymmFront<T>& leafFront = distFronts[0];
+        const Grid& grid = ( frontsAre1d ? leafFront.front1dL.Grid()
+                                         : leafFront.front2dL.Grid() );
+        Matrix<T>& topLocal = localFronts.back().frontL;
+        leafFront.front1dL.Empty();
+        leafFront.front2dL.LockedAttach
+        ( topLocal.Height(), topLocal.Width(), grid, 0, 0, topLocal );
+    }
+    frontType = SYMM_2D;
 }
 
 template<typename T>
@@ -412,6 +523,7 @@ void DistSymmFrontTree<T>::MemoryInfo
         numLocalEntries += front.subdiag.MemorySize();
         numLocalEntries += front.piv.MemorySize();
         numLocalEntries += front.work.MemorySize();
+        numLocalEntries += front.blrL.NumEntries();
     }
     for( int s=1; s<numDistFronts; ++s )
     {
@@ -423,6 +535,7 @@ void DistSymmFrontTree<T>::MemoryInfo
         numLocalEntries += front.piv.AllocatedMemory();
         numLocalEntries += front.work1d.AllocatedMemory();
         numLocalEntries += front.work2d.AllocatedMemory();
+        numLocalEntries += front.blr1dL.NumEntries();
     }
 
     minLocalEntries = mpi::AllReduce( numLocalEntries, mpi::MIN, comm );
@@ -501,6 +614,7 @@ void DistSymmFrontTree<T>::BottomLeftMemoryInfo
         Matrix<T> FTL, FBL;
         LockedPartitionDown( front.frontL, FTL, FBL, front.frontL.Width() );
         numLocalEntries += FBL.Height()*FBL.Width();
+        numLocalEntries += front.blrL.NumEntries();
     }
     for( int s=1; s<numDistFronts; ++s )
     {
@@ -511,6 +625,7 @@ void DistSymmFrontTree<T>::BottomLeftMemoryInfo
             LockedPartitionDown
             ( front.front1dL, FTL, FBL, front.front1dL.Width() );
             numLocalEntries += FBL.LocalHeight()*FBL.LocalWidth();
+            numLocalEntries += front.blr1dL.NumEntries();
         }
         else
         {
@@ -12,6 +12,8 @@
 
 #include "./LDL/Front.hpp"
 #include "./LDL/FrontBlock.hpp"
+#include "./LDL/FrontCholesky.hpp"
+#include "./LDL/FrontBLR.hpp"
 
 #include "./LDL/Local.hpp"
 #include "./LDL/Dist.hpp"
@@ -39,6 +41,9 @@ LDL( DistSymmInfo& info, DistSymmFrontTree<F>& L, SymmFrontType newFrontType )
     DEBUG_ONLY(CallStackEntry cse("LDL"))
     if( !Unfactored(L.frontType) )
         LogicError("Matrix is already factored");
+    if( CholeskyFactorization(newFrontType) && IsComplex<F>::val &&
+        !L.isHermitian )
+        LogicError("Cholesky factorizations require Hermitian fronts");
 
     // Convert from 1D to 2D if necessary
     ChangeFrontType( L, SYMM_2D );
@@ -52,6 +57,32 @@ LDL( DistSymmInfo& info, DistSymmFrontTree<F>& L, SymmFrontType newFrontType )
     ChangeFrontType( L, newFrontType );
 }
 
+template<typename F>
+void LDL
+( DistSymmInfo& info, DistSymmFrontTree<F>& L,
+  const BLRCtrl<Base<F>>& ctrl, BLRStats& stats, SymmFrontType newFrontType )
+{
+    DEBUG_ONLY(CallStackEntry cse("LDL"))
+    if( newFrontType != LDL_1D && newFrontType != LDL_INTRAPIV_1D &&
+        newFrontType != CHOLESKY_1D )
+        LogicError("BLR factorizations require non-inverted 1D fronts");
+    if( !Unfactored(L.frontType) )
+        LogicError("Matrix is already factored");
+    if( CholeskyFactorization(newFrontType) && IsComplex<F>::val &&
+        !L.isHermitian )
+        LogicError("Cholesky factorizations require Hermitian fronts");
+
+    ChangeFrontType( L, SYMM_2D );
+
+    // The local fronts are compressed as they are factored, while the
+    // distributed fronts are compressed after their (dense) factorizations
+    L.frontType = InitialFactorType(newFrontType);
+    LocalLDL( info, L, &ctrl );
+    DistLDL( info, L );
+    ChangeFrontType( L, newFrontType );
+    CompressFronts( info, L, stats, ctrl );
+}
+
 #define PROTO_INT(T) \
   template void InitializeDistLeaf \
   ( const DistSymmInfo& info, DistSymmFrontTree<T>& L );
@@ -59,7 +90,11 @@ LDL( DistSymmInfo& info, DistSymmFrontTree<F>& L, SymmFrontType newFrontType )
 #define PROTO(F) \
   PROTO_INT(F) \
   template void LDL \
-  ( DistSymmInfo& info, DistSymmFrontTree<F>& L, SymmFrontType newFrontType );
+  ( DistSymmInfo& info, DistSymmFrontTree<F>& L, SymmFrontType newFrontType ); \
+  template void LDL \
+  ( DistSymmInfo& info, DistSymmFrontTree<F>& L, \
+    const BLRCtrl<Base<F>>& ctrl, BLRStats& stats, \
+    SymmFrontType newFrontType );
 
 #include "El/macros/Instantiate.h"
 
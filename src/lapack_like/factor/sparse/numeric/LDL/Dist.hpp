@@ -22,6 +22,7 @@ DistLDL( DistSymmInfo& info, DistSymmFrontTree<F>& L )
     const SymmFrontType type = L.frontType;
     const bool blocked = BlockFactorization(type);
     const bool pivoted = PivotedFactorization(type);
+    const bool cholesky = CholeskyFactorization(type);
 
     // The bottom front is already computed, so just view it
     SymmFront<F>& topLocFront = L.localFronts.back();
@@ -33,7 +34,7 @@ DistLDL( DistSymmInfo& info, DistSymmFrontTree<F>& L )
     botDistFront.work2d.LockedAttach
     ( topLocFront.work.Height(), topLocFront.work.Width(), botGrid, 0, 0, 
       topLocFront.work );
-    if( !blocked )
+    if( !blocked && !cholesky )
     {
         botDistFront.diag1d.LockedAttach
         ( topLocFront.diag.Height(), topLocFront.diag.Width(), botGrid, 0, 0, 
@@ -81,7 +82,7 @@ DistLDL( DistSymmInfo& info, DistSymmFrontTree<F>& L )
         const FactorCommMeta& commMeta = node.factorMeta;
         const DistMatrix<F>& childUpdate = childFront.work2d;
         const bool onLeft = childNode.onLeft;
-        std::vector<int> sendCounts(commSize), sendDispls(commSize);
+        std::vector<Int> sendCounts(commSize), sendDispls(commSize);
         Int sendBufferSize = 0;
         for( Unsigned proc=0; proc<commSize; ++proc )
         {
@@ -98,7 +99,7 @@ DistLDL( DistSymmInfo& info, DistSymmFrontTree<F>& L )
         const Int updateRowShift = childUpdate.RowShift();
         const Int updateLocHeight = childUpdate.LocalHeight();
         const Int updateLocWidth = childUpdate.LocalWidth();
-        std::vector<int> packOffs = sendDispls;
+        std::vector<Int> packOffs = sendDispls;
         for( Int jChildLoc=0; jChildLoc<updateLocWidth; ++jChildLoc )
         {
             const Int jChild = updateRowShift + jChildLoc*childGridWidth;
@@ -140,7 +141,7 @@ DistLDL( DistSymmInfo& info, DistSymmFrontTree<F>& L )
         const bool computeFactRecvInds = ( commMeta.childRecvInds.size() == 0 );
         if( computeFactRecvInds )
             ComputeFactRecvInds( node, childNode );
-        std::vector<int> recvCounts(commSize), recvDispls(commSize);
+        std::vector<Int> recvCounts(commSize), recvDispls(commSize);
         Int recvBufferSize=0;
         for( unsigned proc=0; proc<commSize; ++proc )
         {
@@ -196,7 +197,11 @@ DistLDL( DistSymmInfo& info, DistSymmFrontTree<F>& L )
             commMeta.EmptyChildRecvIndices();
 
         // Now that the frontal matrix is set up, perform the factorization
-        if( blocked )
+        if( cholesky )
+        {
+            FrontCholesky( front.front2dL, front.work2d, L.isHermitian );
+        }
+        else if( blocked )
         {
             FrontBlockLDL
             ( front.front2dL, front.work2d, L.isHermitian, pivoted );
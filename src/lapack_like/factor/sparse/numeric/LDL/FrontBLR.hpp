@@ -0,0 +1,166 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson, Lexing Ying,
+   The University of Texas at Austin, Stanford University, and the
+   Georgia Insitute of Technology.
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_SPARSEDIRECT_NUMERIC_LDL_FRONTBLR_HPP
+#define EL_SPARSEDIRECT_NUMERIC_LDL_FRONTBLR_HPP
+
+// Partial factorizations which compress the bottom-left block of the front,
+// LBL, as soon as it is formed and then compute the Schur complement from the
+// BLR approximation. With LBL = [U_ik V_ik] and S = LBL D, tile (i,j) of the
+// update is the sum over k of
+//
+//     U_ik (V_ik S_jk^T),                if only tile (i,k) is low rank, or
+//     U_ik ((V_ik D_k V_jk^T) U_jk^T),   if tiles (i,k) and (j,k) both are,
+//
+// which, for tiles of rank r and size b, requires O(r b^2) rather than O(b^3)
+// work. The latter form is only used when D is diagonal.
+
+namespace El {
+
+template<typename F>
+inline void BLRTileUpdate
+( bool diagonal, Orientation orientation,
+  const Matrix<F>& A, const Matrix<F>& B, Matrix<F>& C )
+{
+    if( diagonal )
+        Trrk( LOWER, NORMAL, orientation, F(-1), A, B, F(1), C );
+    else
+        Gemm( NORMAL, orientation, F(-1), A, B, F(1), C );
+}
+
+// Update the lower triangle of ABR with -B S^T, where B approximates LBL and
+// S = LBL D. If d is nonempty, then D = diag(d).
+template<typename F>
+inline void BLRSchurUpdate
+( Orientation orientation, const BLRMatrix<F>& B, const Matrix<F>& S,
+  const Matrix<F>& d, Matrix<F>& ABR )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("BLRSchurUpdate");
+        if( S.Height() != B.Height() || S.Width() != B.Width() )
+            LogicError("S and B must be the same size");
+        if( ABR.Height() != B.Height() || ABR.Width() != B.Height() )
+            LogicError("ABR must be square and conformal with B");
+    )
+    const bool diagonalD = ( d.Height() != 0 );
+    const Int tileSize = B.tileSize;
+    const Int numTileRows = B.NumTileRows();
+    const Int numTileCols = B.NumTileCols();
+
+    Matrix<F> W, Z;
+    for( Int j=0; j<numTileRows; ++j )
+    {
+        const Int jBeg = j*tileSize;
+        const Int mj = Min(tileSize,B.height-jBeg);
+        for( Int i=j; i<numTileRows; ++i )
+        {
+            const Int iBeg = i*tileSize;
+            const Int mi = Min(tileSize,B.height-iBeg);
+            auto ABRij = ABR( IR(iBeg,iBeg+mi), IR(jBeg,jBeg+mj) );
+            for( Int k=0; k<numTileCols; ++k )
+            {
+                const Int kBeg = k*tileSize;
+                const Int nk = Min(tileSize,B.width-kBeg);
+                const Matrix<F>& Ui = B.U[i+k*numTileRows];
+                const Matrix<F>& Vi = B.V[i+k*numTileRows];
+                const Matrix<F>& Uj = B.U[j+k*numTileRows];
+                const Matrix<F>& Vj = B.V[j+k*numTileRows];
+                const bool iLowRank = ( Vi.Width() != 0 );
+                const bool jLowRank = ( Vj.Width() != 0 );
+                if( (iLowRank && Vi.Height() == 0) ||
+                    (jLowRank && Vj.Height() == 0) )
+                    continue;
+
+                if( iLowRank && jLowRank && diagonalD )
+                {
+                    // Z := V_ik D_k V_jk^T
+                    W = Vi;
+                    auto dk = d( IR(kBeg,kBeg+nk), IR(0,1) );
+                    DiagonalScale( RIGHT, NORMAL, dk, W );
+                    Gemm( NORMAL, orientation, F(1), W, Vj, Z );
+                    // W := U_ik Z
+                    Gemm( NORMAL, NORMAL, F(1), Ui, Z, W );
+                    BLRTileUpdate( i==j, orientation, W, Uj, ABRij );
+                }
+                else if( iLowRank )
+                {
+                    // Z := V_ik S_jk^T
+                    auto Sjk = S( IR(jBeg,jBeg+mj), IR(kBeg,kBeg+nk) );
+                    Gemm( NORMAL, orientation, F(1), Vi, Sjk, Z );
+                    BLRTileUpdate( i==j, NORMAL, Ui, Z, ABRij );
+                }
+                else
+                {
+                    auto Sjk = S( IR(jBeg,jBeg+mj), IR(kBeg,kBeg+nk) );
+                    BLRTileUpdate( i==j, orientation, Ui, Sjk, ABRij );
+                }
+            }
+        }
+    }
+}
+
+// The analogues of FrontLDL, FrontLDLIntraPiv, and FrontCholesky which leave
+// front.frontL holding only its top-left block and front.blrL holding a BLR
+// approximation of its bottom-left block
+template<typename F>
+inline void FrontBLRLDL
+( SymmFront<F>& front, Matrix<F>& ABR, bool conjugate, bool intraPiv,
+  bool cholesky, const BLRCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("FrontBLRLDL");
+        if( ABR.Height() != ABR.Width() )
+            LogicError("ABR must be square");
+        if( front.frontL.Height() != front.frontL.Width() + ABR.Width() )
+            LogicError("AL and ABR don't have conformal dimensions");
+    )
+    const Int n = front.frontL.Width();
+    const Orientation orientation = ( conjugate ? ADJOINT : TRANSPOSE );
+
+    Matrix<F> ATL, ABL;
+    PartitionDown( front.frontL, ATL, ABL, n );
+
+    Matrix<F> S, d;
+    if( cholesky )
+    {
+        Cholesky( LOWER, ATL );
+        Trsm( RIGHT, LOWER, orientation, NON_UNIT, F(1), ATL, ABL );
+        Ones( d, n, 1 );
+    }
+    else if( intraPiv )
+    {
+        LDL( ATL, front.subdiag, front.piv, conjugate );
+        auto diag = ATL.GetDiagonal();
+        PermuteCols( ABL, front.piv );
+        Trsm( RIGHT, LOWER, orientation, UNIT, F(1), ATL, ABL );
+        S = ABL;
+        QuasiDiagonalSolve
+        ( RIGHT, LOWER, diag, front.subdiag, ABL, conjugate );
+    }
+    else
+    {
+        LDL( ATL, conjugate );
+        ATL.GetDiagonal( d );
+        Trsm( RIGHT, LOWER, orientation, UNIT, F(1), ATL, ABL );
+        S = ABL;
+        DiagonalSolve( RIGHT, NORMAL, d, ABL );
+    }
+
+    BLRCompress( ABL, front.blrL, ctrl.tileSize, ctrl.tol );
+    BLRSchurUpdate( orientation, front.blrL, cholesky ? ABL : S, d, ABR );
+
+    Matrix<F> newFrontL( ATL );
+    front.frontL = std::move( newFrontL );
+}
+
+} // namespace El
+
+#endif // ifndef EL_SPARSEDIRECT_NUMERIC_LDL_FRONTBLR_HPP
@@ -0,0 +1,75 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson, Lexing Ying,
+   The University of Texas at Austin, Stanford University, and the
+   Georgia Insitute of Technology.
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_SPARSEDIRECT_NUMERIC_LDL_FRONTCHOLESKY_HPP
+#define EL_SPARSEDIRECT_NUMERIC_LDL_FRONTCHOLESKY_HPP
+
+namespace El {
+
+// Overwrite AL = [ATL; ABL] with [LTL; LBL], where ATL = LTL LTL^H and
+// LBL = ABL inv(LTL)^H, and ABR with its Schur complement, ABR - LBL LBL^H
+template<typename F>
+inline void FrontCholesky( Matrix<F>& AL, Matrix<F>& ABR, bool conjugate )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("FrontCholesky");
+        if( ABR.Height() != ABR.Width() )
+            LogicError("ABR must be square");
+        if( AL.Height() != AL.Width() + ABR.Width() )
+            LogicError("AL and ABR don't have conformal dimensions");
+    )
+    const Int n = AL.Width();
+    const Orientation orientation = ( conjugate ? ADJOINT : TRANSPOSE );
+
+    Matrix<F> ATL, ABL;
+    PartitionDown( AL, ATL, ABL, n );
+
+    Cholesky( LOWER, ATL );
+    Trsm( RIGHT, LOWER, orientation, NON_UNIT, F(1), ATL, ABL );
+    Trrk( LOWER, NORMAL, orientation, F(-1), ABL, ABL, F(1), ABR );
+}
+
+template<typename F>
+inline void FrontCholesky
+( DistMatrix<F>& AL, DistMatrix<F>& ABR, bool conjugate )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("FrontCholesky");
+        if( ABR.Height() != ABR.Width() )
+            LogicError("ABR must be square");
+        if( AL.Height() != AL.Width()+ABR.Height() )
+            LogicError("AL and ABR must have compatible dimensions");
+        if( AL.Grid() != ABR.Grid() )
+            LogicError("AL and ABR must use the same grid");
+    )
+    const Grid& g = AL.Grid();
+    const Int n = AL.Width();
+    const Orientation orientation = ( conjugate ? ADJOINT : TRANSPOSE );
+
+    DistMatrix<F> ATL(g), ABL(g);
+    PartitionDown( AL, ATL, ABL, n );
+
+    Cholesky( LOWER, ATL );
+    Trsm( RIGHT, LOWER, orientation, NON_UNIT, F(1), ATL, ABL );
+
+    DistMatrix<F,MC,STAR> ABL_MC_STAR(g);
+    DistMatrix<F,MR,STAR> ABL_MR_STAR(g);
+    ABL_MC_STAR.AlignWith( ABR );
+    ABL_MR_STAR.AlignWith( ABR );
+    ABL_MC_STAR = ABL;
+    ABL_MR_STAR = ABL;
+    LocalTrrk
+    ( LOWER, orientation, F(-1), ABL_MC_STAR, ABL_MR_STAR, F(1), ABR );
+}
+
+} // namespace El
+
+#endif // ifndef EL_SPARSEDIRECT_NUMERIC_LDL_FRONTCHOLESKY_HPP
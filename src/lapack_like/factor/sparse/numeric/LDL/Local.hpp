@@ -14,19 +14,32 @@
 
 namespace El {
 
+// If blrCtrl is not null, then the bottom-left blocks of the fronts with at
+// least blrCtrl->minHeight rows (other than the root, whose front is shared
+// with the distributed leaf) are compressed during their factorizations
 template<typename F> 
 inline void 
-LocalLDL( DistSymmInfo& info, DistSymmFrontTree<F>& L )
+LocalLDL
+( DistSymmInfo& info, DistSymmFrontTree<F>& L,
+  const BLRCtrl<Base<F>>* blrCtrl=nullptr )
 {
     DEBUG_ONLY(CallStackEntry cse("LocalLDL"))
     const bool blockLDL = ( L.frontType == BLOCK_LDL_2D ||
                             L.frontType == BLOCK_LDL_INTRAPIV_2D );
     const bool intraPiv = ( L.frontType == LDL_INTRAPIV_2D || 
                             L.frontType == BLOCK_LDL_INTRAPIV_2D );
+    const bool cholesky = ( L.frontType == CHOLESKY_2D );
 
+    // Any postorder is valid, as each front only depends upon its children
     const int numLocalNodes = info.localNodes.size();
-    for( int s=0; s<numLocalNodes; ++s )
+    const bool reordered = !info.localFactorOrder.empty();
+    DEBUG_ONLY(
+        if( reordered && int(info.localFactorOrder.size()) != numLocalNodes )
+            LogicError("Factorization order was the wrong size");
+    )
+    for( int t=0; t<numLocalNodes; ++t )
     {
+        const int s = ( reordered ? info.localFactorOrder[t] : t );
         SymmNodeInfo& node = info.localNodes[s];
         const int updateSize = node.lowerStruct.size();
         SymmFront<F>& front = L.localFronts[s];
@@ -95,7 +108,22 @@ LocalLDL( DistSymmInfo& info, DistSymmFrontTree<F>& L )
         }
 
         // Call the custom partial LDL
-        if( blockLDL )
+        const bool compress =
+            ( blrCtrl != nullptr && s != numLocalNodes-1 && updateSize > 0 &&
+              frontL.Height() >= blrCtrl->minHeight );
+        if( compress )
+        {
+            FrontBLRLDL
+            ( front, frontBR, L.isHermitian, intraPiv, cholesky, *blrCtrl );
+            if( !cholesky )
+            {
+                frontL.GetDiagonal( front.diag );
+                SetDiagonal( frontL, F(1) );
+            }
+        }
+        else if( cholesky )
+            FrontCholesky( frontL, frontBR, L.isHermitian );
+        else if( blockLDL )
             FrontBlockLDL( frontL, frontBR, L.isHermitian, intraPiv );
         else if( intraPiv )
         {
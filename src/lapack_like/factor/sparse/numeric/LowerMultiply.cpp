@@ -24,6 +24,8 @@ void LowerMultiply
   DistNodalMultiVec<T>& X )
 {
     DEBUG_ONLY(CallStackEntry cse("LowerMultiply"))
+    if( L.compressed )
+        LogicError("Multiplication by compressed fronts is not supported");
     if( orientation == NORMAL )
     {
         LocalLowerMultiplyNormal( diagOffset, info, L, X );
@@ -22,7 +22,8 @@ inline void DistLowerMultiplyNormal
     DEBUG_ONLY(CallStackEntry cse("DistLowerMultiplyNormal"))
     const int numDistNodes = info.distNodes.size();
     const int width = X.Width();
-    if( L.frontType != SYMM_1D && L.frontType != LDL_1D )
+    if( L.frontType != SYMM_1D && L.frontType != LDL_1D &&
+        L.frontType != CHOLESKY_1D )
         LogicError("This multiply mode is not yet implemented");
 
     // Copy the information from the local portion into the distributed leaf
@@ -65,8 +66,8 @@ inline void DistLowerMultiplyNormal
         const int updateSize = childW.Height()-childNode.size;
         auto childUpdate = 
             LockedView( childW, childNode.size, 0, updateSize, width );
-        int sendBufferSize = 0;
-        std::vector<int> sendCounts(commSize), sendDispls(commSize);
+        Int sendBufferSize = 0;
+        std::vector<Int> sendCounts(commSize), sendDispls(commSize);
         for( int proc=0; proc<commSize; ++proc )
         {
             const int sendSize = commMeta.numChildSendInds[proc]*width;
@@ -80,7 +81,7 @@ inline void DistLowerMultiplyNormal
             ( childNode.onLeft ? node.leftRelInds : node.rightRelInds );
         const int colShift = childUpdate.ColShift();
         const int localHeight = childUpdate.LocalHeight();
-        std::vector<int> packOffs = sendDispls;
+        std::vector<Int> packOffs = sendDispls;
         for( int iChildLoc=0; iChildLoc<localHeight; ++iChildLoc )
         {
             const int iChild = colShift + iChildLoc*childCommSize;
@@ -95,8 +96,8 @@ inline void DistLowerMultiplyNormal
             L.localFronts.back().work.Empty();
 
         // Set up the receive buffer
-        int recvBufferSize = 0;
-        std::vector<int> recvCounts(commSize), recvDispls(commSize);
+        Int recvBufferSize = 0;
+        std::vector<Int> recvCounts(commSize), recvDispls(commSize);
         for( int proc=0; proc<commSize; ++proc )
         {
             const int recvSize = commMeta.childRecvInds[proc].size()*width;
@@ -152,7 +153,8 @@ inline void DistLowerMultiplyTranspose
     const int numDistNodes = info.distNodes.size();
     const int width = X.Width();
     const Orientation orientation = ( conjugate ? ADJOINT : TRANSPOSE );
-    if( L.frontType != SYMM_1D && L.frontType != LDL_1D )
+    if( L.frontType != SYMM_1D && L.frontType != LDL_1D &&
+        L.frontType != CHOLESKY_1D )
         LogicError("This multiply mode is not yet implemented");
 
     // Directly operate on the root separator's portion of the right-hand sides
@@ -202,8 +204,8 @@ inline void DistLowerMultiplyTranspose
         // Pack the relevant portions of the parent's RHS's
         // (which are stored in 'work1d')
         const MultiVecCommMeta& commMeta = parentNode.multiVecMeta;
-        int sendBufferSize = 0;
-        std::vector<int> sendCounts(parentCommSize), sendDispls(parentCommSize);
+        Int sendBufferSize = 0;
+        std::vector<Int> sendCounts(parentCommSize), sendDispls(parentCommSize);
         for( int proc=0; proc<parentCommSize; ++proc )
         {
             const int sendSize = commMeta.childRecvInds[proc].size()*width;
@@ -232,8 +234,8 @@ inline void DistLowerMultiplyTranspose
         parentWork.Empty();
 
         // Set up the receive buffer
-        int recvBufferSize = 0;
-        std::vector<int> recvCounts(parentCommSize), recvDispls(parentCommSize);
+        Int recvBufferSize = 0;
+        std::vector<Int> recvCounts(parentCommSize), recvDispls(parentCommSize);
         for( int proc=0; proc<parentCommSize; ++proc )
         {
             const int recvSize = commMeta.numChildSendInds[proc]*width;
@@ -12,6 +12,7 @@
 
 #include "./LowerSolve/Front.hpp"
 #include "./LowerSolve/FrontBlock.hpp"
+#include "./LowerSolve/FrontBLR.hpp"
 
 #include "./LowerSolve/Local.hpp"
 #include "./LowerSolve/Dist.hpp"
@@ -26,11 +26,13 @@ inline void DistLowerForwardSolve
     const bool frontsAre1d = FrontsAre1d( frontType );
     if( Unfactored(frontType) )
         LogicError("Nonsensical front type for solve");
-    if( frontType == LDL_2D || frontType == LDL_INTRAPIV_2D )
+    if( frontType == LDL_2D || frontType == LDL_INTRAPIV_2D ||
+        frontType == CHOLESKY_2D )
         LogicError("2D non-inverted solves supported by this routine");
     if( frontType == BLOCK_LDL_1D || frontType == BLOCK_LDL_INTRAPIV_1D )
         LogicError("1D block solves not yet supported by this routine");
     const bool blocked = BlockFactorization( frontType );
+    const bool pivoted = PivotedFactorization( frontType );
 
     // Copy the information from the local portion into the distributed leaf
     const SymmFront<F>& localRootFront = L.localFronts.back();
@@ -58,9 +60,8 @@ inline void DistLowerForwardSolve
         mpi::Comm childComm = childGrid.VCComm();
         const int childCommSize = mpi::Size( childComm );
 
-        // Set up a workspace
-        const int frontHeight = ( frontsAre1d ? front.front1dL.Height()
-                                              : front.front2dL.Height() );
+        // Set up a workspace (the front may have been compressed)
+        const int frontHeight = node.size + node.lowerStruct.size();
         DistMatrix<F,VC,STAR>& W = front.work1d;
         W.SetGrid( grid );
         W.Resize( frontHeight, width );
@@ -75,8 +76,8 @@ inline void DistLowerForwardSolve
         const int updateSize = childW.Height()-childNode.size;
         DistMatrix<F,VC,STAR> childUpdate( childW.Grid() );
         LockedView( childUpdate, childW, childNode.size, 0, updateSize, width );
-        int sendBufferSize = 0;
-        std::vector<int> sendCounts(commSize), sendDispls(commSize);
+        Int sendBufferSize = 0;
+        std::vector<Int> sendCounts(commSize), sendDispls(commSize);
         for( int proc=0; proc<commSize; ++proc )
         {
             const int sendSize = commMeta.numChildSendInds[proc]*width;
@@ -91,7 +92,7 @@ inline void DistLowerForwardSolve
             ( onLeft ? node.leftRelInds : node.rightRelInds );
         const int colShift = childUpdate.ColShift();
         const int localHeight = childUpdate.LocalHeight();
-        std::vector<int> packOffs = sendDispls;
+        std::vector<Int> packOffs = sendDispls;
         for( int iChildLoc=0; iChildLoc<localHeight; ++iChildLoc )
         {
             const int iChild = colShift + iChildLoc*childCommSize;
@@ -106,8 +107,8 @@ inline void DistLowerForwardSolve
             L.localFronts.back().work.Empty();
 
         // Set up the receive buffer
-        int recvBufferSize = 0;
-        std::vector<int> recvCounts(commSize), recvDispls(commSize);
+        Int recvBufferSize = 0;
+        std::vector<Int> recvCounts(commSize), recvDispls(commSize);
         for( int proc=0; proc<commSize; ++proc )
         {
             const int recvSize = commMeta.childRecvInds[proc].size()*width;
@@ -146,7 +147,11 @@ inline void DistLowerForwardSolve
         SwapClear( recvDispls );
 
         // Now that the RHS is set up, perform this node's solve
-        if( frontType == LDL_1D )
+        const bool compressed =
+            ( L.compressed && front.front1dL.Height() != frontHeight );
+        if( compressed )
+            FrontBLRLowerForwardSolve( front, W, pivoted );
+        else if( frontType == LDL_1D || frontType == CHOLESKY_1D )
             FrontLowerForwardSolve( front.front1dL, W );
         else if( frontType == LDL_SELINV_1D )
             FrontFastLowerForwardSolve( front.front1dL, W );
@@ -230,8 +235,8 @@ inline void DistLowerForwardSolve
         const int updateSize = childW.Height()-childNode.size;
         DistMatrix<F> childUpdate( childW.Grid() );
         LockedView( childUpdate, childW, childNode.size, 0, updateSize, width );
-        int sendBufferSize = 0;
-        std::vector<int> sendCounts(commSize), sendDispls(commSize);
+        Int sendBufferSize = 0;
+        std::vector<Int> sendCounts(commSize), sendDispls(commSize);
         for( int proc=0; proc<commSize; ++proc )
         {
             const int sendSize = commMeta.numChildSendInds[proc];
@@ -249,7 +254,7 @@ inline void DistLowerForwardSolve
         const int rowShift = childUpdate.RowShift();
         const int localWidth = childUpdate.LocalWidth();
         const int localHeight = childUpdate.LocalHeight();
-        std::vector<int> packOffs = sendDispls;
+        std::vector<Int> packOffs = sendDispls;
         for( int iChildLoc=0; iChildLoc<localHeight; ++iChildLoc )
         {
             const int iChild = colShift + iChildLoc*childGridHeight;
@@ -269,8 +274,8 @@ inline void DistLowerForwardSolve
             L.localFronts.back().work.Empty();
 
         // Set up the receive buffer
-        int recvBufferSize = 0;
-        std::vector<int> recvCounts(commSize), recvDispls(commSize);
+        Int recvBufferSize = 0;
+        std::vector<Int> recvCounts(commSize), recvDispls(commSize);
         for( int proc=0; proc<commSize; ++proc )
         {
             const int recvSize = commMeta.childRecvInds[proc].size()/2;
@@ -306,7 +311,7 @@ inline void DistLowerForwardSolve
         SwapClear( recvDispls );
 
         // Now that the RHS is set up, perform this node's solve
-        if( frontType == LDL_2D )
+        if( frontType == LDL_2D || frontType == CHOLESKY_2D )
             FrontLowerForwardSolve( front.front2dL, W );
         else if( frontType == LDL_SELINV_2D )
             FrontFastLowerForwardSolve( front.front2dL, W );
@@ -337,7 +342,8 @@ inline void DistLowerBackwardSolve
     const SymmFrontType frontType = L.frontType;
     if( Unfactored(frontType) )
         LogicError("Nonsensical front type for solve");
-    if( frontType == LDL_2D || frontType == LDL_INTRAPIV_2D )
+    if( frontType == LDL_2D || frontType == LDL_INTRAPIV_2D ||
+        frontType == CHOLESKY_2D )
         LogicError("2D non-inverted solves supported by this routine");
     if( frontType == BLOCK_LDL_1D || frontType == BLOCK_LDL_INTRAPIV_1D )
         LogicError("1D block solves not yet supported by this routine");
@@ -366,7 +372,7 @@ inline void DistLowerBackwardSolve
         const DistSymmFront<F>& rootFront = L.distFronts.back();
         View( rootFront.work1d, X.distNodes.back() );
         auto& W = rootFront.work1d;
-        if( frontType == LDL_1D )
+        if( frontType == LDL_1D || frontType == CHOLESKY_1D )
             FrontLowerBackwardSolve( rootFront.front1dL, W, conjugate );
         else if( frontType == LDL_SELINV_1D )
             FrontFastLowerBackwardSolve( rootFront.front1dL, W, conjugate );
@@ -401,10 +407,9 @@ inline void DistLowerBackwardSolve
         mpi::Comm parentComm = parentGrid.VCComm();
         const int commSize = mpi::Size( comm );
         const int parentCommSize = mpi::Size( parentComm );
-        const int frontHeight = ( frontsAre1d ? front.front1dL.Height()
-                                              : front.front2dL.Height() );
+        const int frontHeight = node.size + node.lowerStruct.size();
 
-        // Set up a workspace
+        // Set up a workspace (the front may have been compressed)
         DistMatrix<F,VC,STAR>& W = front.work1d;
         W.SetGrid( grid );
         W.Resize( frontHeight, width );
@@ -420,8 +425,8 @@ inline void DistLowerBackwardSolve
 
         // Pack the updates using the recv approach from the forward solve
         const MultiVecCommMeta& commMeta = parentNode.multiVecMeta;
-        int sendBufferSize = 0;
-        std::vector<int> sendCounts(parentCommSize), sendDispls(parentCommSize);
+        Int sendBufferSize = 0;
+        std::vector<Int> sendCounts(parentCommSize), sendDispls(parentCommSize);
         for( int proc=0; proc<parentCommSize; ++proc )
         {
             const int sendSize = commMeta.childRecvInds[proc].size()*width;
@@ -449,8 +454,8 @@ inline void DistLowerBackwardSolve
         parentWork.Empty();
 
         // Set up the receive buffer
-        int recvBufferSize = 0;
-        std::vector<int> recvCounts(parentCommSize), recvDispls(parentCommSize);
+        Int recvBufferSize = 0;
+        std::vector<Int> recvCounts(parentCommSize), recvDispls(parentCommSize);
         for( int proc=0; proc<parentCommSize; ++proc )
         {
             const int recvSize = commMeta.numChildSendInds[proc]*width;
@@ -491,7 +496,11 @@ inline void DistLowerBackwardSolve
         // Call the custom node backward solve
         if( s > 0 )
         {
-            if( frontType == LDL_1D )
+            const bool compressed =
+                ( L.compressed && front.front1dL.Height() != frontHeight );
+            if( compressed )
+                FrontBLRLowerBackwardSolve( front, W, pivoted, conjugate );
+            else if( frontType == LDL_1D || frontType == CHOLESKY_1D )
                 FrontLowerBackwardSolve( front.front1dL, W, conjugate );
             else if( frontType == LDL_SELINV_1D )
                 FrontFastLowerBackwardSolve( front.front1dL, W, conjugate );
@@ -514,7 +523,10 @@ inline void DistLowerBackwardSolve
         else
         {
             View( localRootFront.work, W.Matrix() );
-            if( blocked )
+            if( localRootFront.frontL.Height() != frontHeight )
+                FrontBLRLowerBackwardSolve
+                ( localRootFront, localRootFront.work, pivoted, conjugate );
+            else if( blocked )
                 FrontBlockLowerBackwardSolve
                 ( localRootFront.frontL, localRootFront.work, conjugate );
             else if( pivoted )
@@ -571,7 +583,7 @@ inline void DistLowerBackwardSolve
         auto& frontL = rootFront.front2dL;
         auto& piv = rootFront.piv;
         auto& W = rootFront.work2d;
-        if( frontType == LDL_2D )
+        if( frontType == LDL_2D || frontType == CHOLESKY_2D )
             FrontLowerBackwardSolve( frontL, W, conjugate );
         else if( frontType == LDL_SELINV_2D )
             FrontFastLowerBackwardSolve( frontL, W, conjugate );
@@ -617,8 +629,8 @@ inline void DistLowerBackwardSolve
 
         // Pack the updates using the recv approach from the forward solve
         const MatrixCommMeta& commMeta = X.commMetas[s];
-        int sendBufferSize = 0;
-        std::vector<int> sendCounts(parentCommSize), sendDispls(parentCommSize);
+        Int sendBufferSize = 0;
+        std::vector<Int> sendCounts(parentCommSize), sendDispls(parentCommSize);
         for( int proc=0; proc<parentCommSize; ++proc )
         {
             // childRecvInds contains pairs of indices, but we will send one
@@ -645,8 +657,8 @@ inline void DistLowerBackwardSolve
         parentWork.Empty();
 
         // Set up the receive buffer
-        int recvBufferSize = 0;
-        std::vector<int> recvCounts(parentCommSize), recvDispls(parentCommSize);
+        Int recvBufferSize = 0;
+        std::vector<Int> recvCounts(parentCommSize), recvDispls(parentCommSize);
         for( int proc=0; proc<parentCommSize; ++proc )
         {
             const int recvSize = commMeta.numChildSendInds[proc];
@@ -695,7 +707,7 @@ inline void DistLowerBackwardSolve
         {
             auto& frontL = front.front2dL;
             auto& piv = front.piv;
-            if( frontType == LDL_2D )
+            if( frontType == LDL_2D || frontType == CHOLESKY_2D )
                 FrontLowerBackwardSolve( frontL, W, conjugate );
             else if( frontType == LDL_SELINV_2D )
                 FrontFastLowerBackwardSolve( frontL, W, conjugate );
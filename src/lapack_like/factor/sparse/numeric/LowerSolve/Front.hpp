@@ -364,7 +364,8 @@ void BackwardSingle
 
         // X1 := L11^-1 X1
         LocalTrsm
-        ( LEFT, UPPER, NORMAL, UNIT, F(1), L11Trans_STAR_STAR, Z1_STAR_STAR );
+        ( LEFT, UPPER, NORMAL, NON_UNIT,
+          F(1), L11Trans_STAR_STAR, Z1_STAR_STAR );
         X1 = Z1_STAR_STAR;
         //--------------------------------------------------------------------//
 
@@ -0,0 +1,109 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson, Lexing Ying,
+   The University of Texas at Austin, Stanford University, and the
+   Georgia Insitute of Technology.
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_SPARSEDIRECT_NUMERIC_LOWERSOLVE_FRONTBLR_HPP
+#define EL_SPARSEDIRECT_NUMERIC_LOWERSOLVE_FRONTBLR_HPP
+
+// Solves against fronts whose bottom-left blocks were replaced by BLR
+// approximations by CompressFronts: the (square) top-left blocks are handled
+// by the dense routines and the BLR blocks are applied tile by tile.
+
+namespace El {
+
+template<typename F>
+inline void FrontBLRLowerForwardSolve
+( const SymmFront<F>& front, Matrix<F>& X, bool pivoted )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("FrontBLRLowerForwardSolve");
+        if( front.frontL.Height()+front.blrL.Height() != X.Height() )
+            LogicError("Nonconformal solve");
+    )
+    Matrix<F> XT, XB;
+    PartitionDown( X, XT, XB, front.frontL.Width() );
+
+    if( pivoted )
+        FrontIntraPivLowerForwardSolve( front.frontL, front.piv, XT );
+    else
+        FrontLowerForwardSolve( front.frontL, XT );
+    Multiply( NORMAL, F(-1), front.blrL, XT, F(1), XB );
+}
+
+template<typename F>
+inline void FrontBLRLowerForwardSolve
+( const DistSymmFront<F>& front, DistMatrix<F,VC,STAR>& X, bool pivoted )
+{
+    DEBUG_ONLY(CallStackEntry cse("FrontBLRLowerForwardSolve"))
+    const Grid& g = front.front1dL.Grid();
+    DistMatrix<F,VC,STAR> XT(g), XB(g);
+    PartitionDown( X, XT, XB, front.front1dL.Width() );
+
+    if( pivoted )
+        FrontIntraPivLowerForwardSolve( front.front1dL, front.piv, XT );
+    else
+        FrontLowerForwardSolve( front.front1dL, XT );
+
+    // Each process owns a set of rows of XB and of the BLR block
+    DistMatrix<F,STAR,STAR> XT_STAR_STAR( XT );
+    Multiply
+    ( NORMAL, F(-1), front.blr1dL, XT_STAR_STAR.LockedMatrix(),
+      F(1), XB.Matrix() );
+}
+
+template<typename F>
+inline void FrontBLRLowerBackwardSolve
+( const SymmFront<F>& front, Matrix<F>& X, bool pivoted, bool conjugate )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("FrontBLRLowerBackwardSolve");
+        if( front.frontL.Height()+front.blrL.Height() != X.Height() )
+            LogicError("Nonconformal solve");
+    )
+    Matrix<F> XT, XB;
+    PartitionDown( X, XT, XB, front.frontL.Width() );
+
+    const Orientation orientation = ( conjugate ? ADJOINT : TRANSPOSE );
+    Multiply( orientation, F(-1), front.blrL, XB, F(1), XT );
+    if( pivoted )
+        FrontIntraPivLowerBackwardSolve
+        ( front.frontL, front.piv, XT, conjugate );
+    else
+        FrontLowerBackwardSolve( front.frontL, XT, conjugate );
+}
+
+template<typename F>
+inline void FrontBLRLowerBackwardSolve
+( const DistSymmFront<F>& front, DistMatrix<F,VC,STAR>& X,
+  bool pivoted, bool conjugate )
+{
+    DEBUG_ONLY(CallStackEntry cse("FrontBLRLowerBackwardSolve"))
+    const Grid& g = front.front1dL.Grid();
+    DistMatrix<F,VC,STAR> XT(g), XB(g);
+    PartitionDown( X, XT, XB, front.front1dL.Width() );
+
+    // Subtract off the parent updates
+    DistMatrix<F,STAR,STAR> Z(g);
+    Zeros( Z, XT.Height(), XT.Width() );
+    const Orientation orientation = ( conjugate ? ADJOINT : TRANSPOSE );
+    Multiply
+    ( orientation, F(-1), front.blr1dL, XB.LockedMatrix(), F(0), Z.Matrix() );
+    XT.SumScatterUpdate( F(1), Z );
+
+    if( pivoted )
+        FrontIntraPivLowerBackwardSolve
+        ( front.front1dL, front.piv, XT, conjugate );
+    else
+        FrontLowerBackwardSolve( front.front1dL, XT, conjugate );
+}
+
+} // namespace El
+
+#endif // ifndef EL_SPARSEDIRECT_NUMERIC_LOWERSOLVE_FRONTBLR_HPP
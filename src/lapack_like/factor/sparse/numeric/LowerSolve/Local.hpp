@@ -36,8 +36,8 @@ inline void LocalLowerForwardSolve
         const Matrix<F>& frontL = front.frontL;
         Matrix<F>& W = front.work;
 
-        // Set up a workspace
-        W.Resize( frontL.Height(), width );
+        // Set up a workspace (the front may have been compressed)
+        W.Resize( node.size+node.lowerStruct.size(), width );
         Matrix<F> WT, WB;
         PartitionDown( W, WT, WB, node.size );
         WT = X.localNodes[s];
@@ -82,7 +82,9 @@ inline void LocalLowerForwardSolve
         // else numChildren == 0
 
         // Solve against this front
-        if( blocked )
+        if( frontL.Height() != W.Height() )
+            FrontBLRLowerForwardSolve( front, W, pivoted );
+        else if( blocked )
             FrontBlockLowerForwardSolve( frontL, W );
         else if( pivoted )
             FrontIntraPivLowerForwardSolve( frontL, front.piv, W );
@@ -198,8 +200,8 @@ inline void LocalLowerBackwardSolve
         const Matrix<F>& frontL = front.frontL;
         Matrix<F>& W = front.work;
 
-        // Set up a workspace
-        W.Resize( frontL.Height(), width );
+        // Set up a workspace (the front may have been compressed)
+        W.Resize( node.size+node.lowerStruct.size(), width );
         Matrix<F> WT, WB;
         PartitionDown( W, WT, WB, node.size );
         WT = X.localNodes[s];
@@ -235,7 +237,9 @@ inline void LocalLowerBackwardSolve
         }
 
         // Solve against this front
-        if( blocked )
+        if( frontL.Height() != W.Height() )
+            FrontBLRLowerBackwardSolve( front, W, pivoted, conjugate );
+        else if( blocked )
             FrontBlockLowerBackwardSolve( frontL, W, conjugate );
         else if( pivoted )
             FrontIntraPivLowerBackwardSolve( frontL, front.piv, W, conjugate );
@@ -0,0 +1,113 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson, Lexing Ying,
+   The University of Texas at Austin, Stanford University, and the
+   Georgia Insitute of Technology.
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+namespace El {
+
+// The prediction mirrors the allocations of DistSymmFrontTree::Initialize,
+// LocalLDL, DistLDL, and ChangeFrontType:
+//  1) every front is allocated (in a 2D distribution) before factoring,
+//  2) the update matrix of each local front is a full square which is held
+//     until its parent has been assembled,
+//  3) each distributed update matrix is freed before that of its parent is
+//     allocated, and
+//  4) a conversion to 1D fronts briefly holds both copies of one front.
+
+void PredictFactorMemory
+( const DistSymmInfo& info,
+  double& numLocalFactorEntries, double& maxLocalFactorEntries,
+  double& numLocalPeakEntries, double& maxLocalPeakEntries,
+  SymmFrontType frontType )
+{
+    DEBUG_ONLY(CallStackEntry cse("PredictFactorMemory"))
+    const bool blocked = BlockFactorization( frontType );
+    const bool pivoted = PivotedFactorization( frontType );
+    const bool cholesky = CholeskyFactorization( frontType );
+    const bool frontsAre1d = FrontsAre1d( frontType );
+    // The diagonal (and, with pivoting, the subdiagonal and the pivots)
+    const int numDiagVecs = ( blocked || cholesky ? 0 : (pivoted ? 3 : 1) );
+
+    // The local fronts and the stack of their update matrices
+    const int numLocal = info.localNodes.size();
+    const bool reordered = !info.localFactorOrder.empty();
+    double localEntries = 0, stack = 0, stackPeak = 0;
+    for( int t=0; t<numLocal; ++t )
+    {
+        const int s = ( reordered ? info.localFactorOrder[t] : t );
+        const SymmNodeInfo& node = info.localNodes[s];
+        const double size = node.size;
+        const double updateSize = node.lowerStruct.size();
+        localEntries += (size+updateSize)*size + numDiagVecs*size;
+
+        stack += updateSize*updateSize;
+        stackPeak = Max( stackPeak, stack );
+        const int numChildren = node.children.size();
+        for( int c=0; c<numChildren; ++c )
+        {
+            const double childUpdateSize =
+                info.localNodes[node.children[c]].lowerStruct.size();
+            stack -= childUpdateSize*childUpdateSize;
+        }
+    }
+
+    // The distributed fronts and their update matrices (the update matrix of
+    // the local root is what remains on the stack)
+    const int numDist = info.distNodes.size();
+    std::vector<double> entries2d( numDist, 0 ), entries1d( numDist, 0 );
+    double dist2dEntries = 0, dist1dEntries = 0, workPeak = stack;
+    for( int s=1; s<numDist; ++s )
+    {
+        const DistSymmNodeInfo& node = info.distNodes[s];
+        const Grid& grid = *node.grid;
+        const int gridHeight = grid.Height();
+        const int gridWidth = grid.Width();
+        const int size = node.size;
+        const int updateSize = node.lowerStruct.size();
+        const double diagEntries =
+            numDiagVecs*double(Length(size,grid.VCRank(),grid.Size()));
+
+        entries2d[s] =
+            double(Length(size+updateSize,grid.Row(),gridHeight))*
+            double(Length(size,grid.Col(),gridWidth)) + diagEntries;
+        entries1d[s] =
+            double(Length(size+updateSize,grid.VCRank(),grid.Size()))*size +
+            diagEntries;
+        dist2dEntries += entries2d[s];
+        dist1dEntries += entries1d[s];
+
+        const double workEntries =
+          double(Length(updateSize,grid.Row(),size%gridHeight,gridHeight))*
+          double(Length(updateSize,grid.Col(),size%gridWidth,gridWidth));
+        workPeak = Max( workPeak, workEntries );
+    }
+
+    numLocalFactorEntries =
+        localEntries + ( frontsAre1d ? dist1dEntries : dist2dEntries );
+    numLocalPeakEntries =
+        localEntries + dist2dEntries + Max( stackPeak, workPeak );
+    if( frontsAre1d )
+    {
+        double convertEntries = localEntries + dist2dEntries;
+        for( int s=1; s<numDist; ++s )
+        {
+            convertEntries += entries1d[s];
+            numLocalPeakEntries = Max( numLocalPeakEntries, convertEntries );
+            convertEntries -= entries2d[s];
+        }
+    }
+
+    mpi::Comm comm = info.distNodes.back().comm;
+    maxLocalFactorEntries =
+        mpi::AllReduce( numLocalFactorEntries, mpi::MAX, comm );
+    maxLocalPeakEntries = mpi::AllReduce( numLocalPeakEntries, mpi::MAX, comm );
+}
+
+} // namespace El
@@ -0,0 +1,164 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson, Lexing Ying,
+   The University of Texas at Austin, Stanford University, and the
+   Georgia Insitute of Technology.
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+// Iterative refinement with a factorization of A computed in a (possibly)
+// lower precision,
+//
+//     R := B - A X,   X := X + inv(L D L^T) R,
+//
+// where the residual and the update are computed in the precision of A. If the
+// refinement stalls (as it does once A is too ill-conditioned relative to the
+// precision of the factorization), the correction equation A D = R is instead
+// solved with flexible GMRES preconditioned by the factorization (GMRES-IR),
+// which converges whenever the preconditioned matrix is well-conditioned.
+
+namespace El {
+
+namespace {
+
+// D := inv(L D L^T) R, where the solve is performed in the precision of L
+template<typename F,typename FLow>
+void ApplyFactorization
+( const DistMap& inverseMap, const DistSymmInfo& info,
+  const DistSymmFrontTree<FLow>& L,
+  const DistMultiVec<F>& R, DistMultiVec<F>& D )
+{
+    DEBUG_ONLY(CallStackEntry cse("ApplyFactorization"))
+    DistMultiVec<FLow> RLow;
+    Copy( R, RLow );
+    Solve( inverseMap, info, L, RLow, Max(RLow.Width(),1) );
+    Copy( RLow, D );
+}
+
+// R := B - A X
+template<typename F>
+void Residual
+( const DistSparseMatrix<F>& A, const DistMultiVec<F>& B,
+  const DistMultiVec<F>& X, DistMultiVec<F>& R )
+{
+    DEBUG_ONLY(CallStackEntry cse("Residual"))
+    R = B;
+    Multiply( NORMAL, F(-1), A, X, F(1), R );
+}
+
+// The largest residual norm relative to the norm of its right-hand side
+template<typename Real>
+Real MaxRelative( const Matrix<Real>& rNorms, const Matrix<Real>& bNorms )
+{
+    Real maxRel = 0;
+    const Int width = rNorms.Height();
+    for( Int j=0; j<width; ++j )
+    {
+        const Real bNorm = bNorms.Get(j,0);
+        const Real rNorm = rNorms.Get(j,0);
+        maxRel = Max( maxRel, ( bNorm == Real(0) ? rNorm : rNorm/bNorm ) );
+    }
+    return maxRel;
+}
+
+} // anonymous namespace
+
+template<typename F,typename FLow>
+void RefinedSolve
+( const DistSparseMatrix<F>& A,
+  const DistMap& inverseMap, const DistSymmInfo& info,
+  const DistSymmFrontTree<FLow>& L,
+  DistMultiVec<F>& B, RefineStats& stats, const RefineCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CallStackEntry cse("RefinedSolve"))
+    typedef Base<F> Real;
+    mpi::Comm comm = B.Comm();
+    const int commRank = mpi::Rank( comm );
+
+    DistMultiVec<F> X(comm), R(comm), D(comm);
+    Matrix<Real> bNorms, rNorms;
+    ColumnNorms( B, bNorms );
+
+    ApplyFactorization( inverseMap, info, L, B, X );
+    Residual( A, B, X, R );
+    ColumnNorms( R, rNorms );
+    Real relResid = MaxRelative( rNorms, bNorms );
+    if( ctrl.progress && commRank == 0 )
+        std::cout << "Initial solve: max relative residual " << relResid
+                  << std::endl;
+
+    Int numRefineIts = 0;
+    while( relResid > ctrl.relTol && numRefineIts < ctrl.maxRefineIts )
+    {
+        ApplyFactorization( inverseMap, info, L, R, D );
+        Axpy( F(1), D, X );
+        Residual( A, B, X, R );
+        ColumnNorms( R, rNorms );
+        const Real newRelResid = MaxRelative( rNorms, bNorms );
+        ++numRefineIts;
+        if( ctrl.progress && commRank == 0 )
+            std::cout << "Refinement iteration " << numRefineIts
+                      << ": max relative residual " << newRelResid
+                      << std::endl;
+        if( newRelResid > ctrl.stallRatio*relResid )
+        {
+            // Discard an update which increased the residual
+            if( newRelResid > relResid )
+                Axpy( F(-1), D, X );
+            else
+                relResid = newRelResid;
+            break;
+        }
+        relResid = newRelResid;
+    }
+    stats.numRefineIts = numRefineIts;
+
+    stats.numGMRESIts = 0;
+    if( relResid > ctrl.relTol && ctrl.gmresFallback )
+    {
+        if( ctrl.progress && commRank == 0 )
+            std::cout << "Switching to GMRES-IR" << std::endl;
+        KrylovCtrl<Real> krylovCtrl;
+        krylovCtrl.relTol = ctrl.relTol;
+        krylovCtrl.maxIts = ctrl.maxGMRESIts;
+        krylovCtrl.restart = ctrl.restart;
+        krylovCtrl.progress = ctrl.progress;
+        KrylovStats krylovStats;
+        GMRES
+        ( A, LDLPreconditioner<F>( inverseMap, info, L ), B, X,
+          krylovStats, krylovCtrl );
+        stats.numGMRESIts = krylovStats.numIts;
+        Residual( A, B, X, R );
+        ColumnNorms( R, rNorms );
+        relResid = MaxRelative( rNorms, bNorms );
+    }
+    stats.relResidual = relResid;
+    stats.converged = ( relResid <= ctrl.relTol );
+
+    B = X;
+}
+
+#define PROTO_TYPES(F,FLow) \
+  template void RefinedSolve \
+  ( const DistSparseMatrix<F>& A, \
+    const DistMap& inverseMap, const DistSymmInfo& info, \
+    const DistSymmFrontTree<FLow>& L, \
+    DistMultiVec<F>& B, RefineStats& stats, \
+    const RefineCtrl<Base<F>>& ctrl );
+
+#define PROTO(F) PROTO_TYPES(F,F)
+#define PROTO_DOUBLE \
+  PROTO_TYPES(double,double) \
+  PROTO_TYPES(double,float)
+#define PROTO_COMPLEX_DOUBLE \
+  PROTO_TYPES(Complex<double>,Complex<double>) \
+  PROTO_TYPES(Complex<double>,Complex<float>)
+
+#define EL_NO_INT_PROTO
+#include "El/macros/Instantiate.h"
+
+} // namespace El
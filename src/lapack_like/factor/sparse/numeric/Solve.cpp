@@ -29,6 +29,13 @@ void Solve
         // Solve against the (conjugate-)transpose of the block unit diagonal L
         LowerSolve( orientation, info, L, X );
     }
+    else if( CholeskyFactorization(L.frontType) )
+    {
+        // Solve against the Cholesky factor, L
+        LowerSolve( NORMAL, info, L, X );
+        // Solve against its (conjugate-)transpose
+        LowerSolve( orientation, info, L, X );
+    }
     else
     {
         // Solve against unit diagonal L
@@ -56,6 +63,13 @@ void Solve
         // Solve against the (conjugate-)transpose of the block unit diagonal L
         LowerSolve( orientation, info, L, X );
     }
+    else if( CholeskyFactorization(L.frontType) )
+    {
+        // Solve against the Cholesky factor, L
+        LowerSolve( NORMAL, info, L, X );
+        // Solve against its (conjugate-)transpose
+        LowerSolve( orientation, info, L, X );
+    }
     else
     {
         // Solve against unit diagonal L
@@ -67,6 +81,139 @@ void Solve
     }
 }
 
+namespace {
+
+// Tags which distinguish the two redistributions that are in flight at once
+const int PULL_TAG = 0;
+const int PUSH_TAG = 1;
+
+// Stream the blocks of right-hand sides through the elimination tree with a
+// three-stage software pipeline: while block k is being solved, block k+1 is
+// being pulled into the tree and block k-1 pushed back out. 'source' returns
+// the multi-vector holding a block (and the offset of the block within it),
+// 'target' returns the multi-vector which its solution should be written into,
+// and 'done' is called once the solution has been written.
+template<typename F>
+void PipelinedSolve
+( const DistMap& inverseMap, const DistSymmInfo& info,
+  const DistSymmFrontTree<F>& L, Int width, Int blockSize,
+  std::function<const DistMultiVec<F>&(Int colOff,Int nb,Int& off)> source,
+  std::function<DistMultiVec<F>&(Int colOff,Int nb,Int& off)> target,
+  std::function<void(Int colOff)> done )
+{
+    DEBUG_ONLY(CallStackEntry cse("PipelinedSolve"))
+    if( blockSize < 1 )
+        LogicError("Block size must be positive");
+    const bool frontsAre1d = FrontsAre1d( L.frontType );
+
+    NodalRedistMeta meta;
+    DistNodalMultiVec<F> XNodal;
+    DistNodalMatrix<F> XNodal2d;
+    NodalRedistRequest<F> pullReq, pushReq;
+    bool pushing = false;
+    Int pushColOff = 0;
+
+    auto startPull = [&]( Int colOff )
+    {
+        const Int nb = Min(blockSize,width-colOff);
+        Int off;
+        const DistMultiVec<F>& B = source( colOff, nb, off );
+        XNodal.StartPull
+        ( inverseMap, info, B, off, nb, meta, pullReq, PULL_TAG );
+    };
+    auto finishPush = [&]()
+    {
+        Int off;
+        DistMultiVec<F>& Y = target( pushColOff, pushReq.width, off );
+        XNodal.FinishPush( Y, meta, pushReq );
+        done( pushColOff );
+        pushing = false;
+    };
+
+    if( width > 0 )
+        startPull( 0 );
+    for( Int colOff=0; colOff<width; colOff+=blockSize )
+    {
+        // Receive block k and immediately begin pulling block k+1
+        XNodal.FinishPull( info, meta, pullReq );
+        if( colOff+blockSize < width )
+            startPull( colOff+blockSize );
+
+        // Solve block k while blocks k+1 and k-1 are in flight
+        if( frontsAre1d )
+            Solve( info, L, XNodal );
+        else
+        {
+            XNodal2d = XNodal;
+            Solve( info, L, XNodal2d );
+            XNodal = XNodal2d;
+        }
+
+        // Complete the return of block k-1 and begin returning block k
+        if( pushing )
+            finishPush();
+        Int off;
+        const DistMultiVec<F>& Y = target( colOff, XNodal.Width(), off );
+        XNodal.StartPush( inverseMap, info, Y, off, meta, pushReq, PUSH_TAG );
+        pushColOff = colOff;
+        pushing = true;
+    }
+    if( pushing )
+        finishPush();
+}
+
+} // anonymous namespace
+
+template<typename F>
+void Solve
+( const DistMap& inverseMap, const DistSymmInfo& info,
+  const DistSymmFrontTree<F>& L, DistMultiVec<F>& X, Int blockSize )
+{
+    DEBUG_ONLY(CallStackEntry cse("Solve"))
+    // The blocks are read from and written back into X in place
+    auto inPlace = [&]( Int colOff, Int nb, Int& off ) -> DistMultiVec<F>&
+    {
+        off = colOff;
+        return X;
+    };
+    PipelinedSolve<F>
+    ( inverseMap, info, L, X.Width(), blockSize, inPlace, inPlace,
+      []( Int colOff ) { } );
+}
+
+template<typename F>
+void Solve
+( const DistMap& inverseMap, const DistSymmInfo& info,
+  const DistSymmFrontTree<F>& L, Int width,
+  std::function<void(Int colOff,DistMultiVec<F>& B)> produce,
+  std::function<void(Int colOff,const DistMultiVec<F>& X)> consume,
+  Int blockSize )
+{
+    DEBUG_ONLY(CallStackEntry cse("Solve"))
+    // Since the columns of a block are packed as soon as its pull is started,
+    // a single buffer suffices for the right-hand sides, and another for the
+    // solutions (which are only written once the corresponding push finishes)
+    const DistSymmNodeInfo& rootNode = info.distNodes.back();
+    const Int height = rootNode.size + rootNode.off;
+    DistMultiVec<F> B(rootNode.comm), Y(rootNode.comm);
+    auto source = [&]( Int colOff, Int nb, Int& off ) -> const DistMultiVec<F>&
+    {
+        B.Resize( height, nb );
+        produce( colOff, B );
+        off = 0;
+        return B;
+    };
+    auto target = [&]( Int colOff, Int nb, Int& off ) -> DistMultiVec<F>&
+    {
+        Y.Resize( height, nb );
+        off = 0;
+        return Y;
+    };
+    auto done = [&]( Int colOff ) { consume( colOff, Y ); };
+    PipelinedSolve<F>
+    ( inverseMap, info, L, width, blockSize, source, target, done );
+}
+
 template<typename F>
 void SymmetricSolve
 ( const DistSparseMatrix<F>& A, DistMultiVec<F>& X, 
@@ -103,6 +250,15 @@ void HermitianSolve
   template void Solve \
   ( const DistSymmInfo& info, \
     const DistSymmFrontTree<F>& L, DistNodalMatrix<F>& X ); \
+  template void Solve \
+  ( const DistMap& inverseMap, const DistSymmInfo& info, \
+    const DistSymmFrontTree<F>& L, DistMultiVec<F>& X, Int blockSize ); \
+  template void Solve \
+  ( const DistMap& inverseMap, const DistSymmInfo& info, \
+    const DistSymmFrontTree<F>& L, Int width, \
+    std::function<void(Int,DistMultiVec<F>&)> produce, \
+    std::function<void(Int,const DistMultiVec<F>&)> consume, \
+    Int blockSize ); \
   template void SymmetricSolve \
   ( const DistSparseMatrix<F>& A, DistMultiVec<F>& X, bool conjugate, \
     const BisectCtrl& ctrl ); \
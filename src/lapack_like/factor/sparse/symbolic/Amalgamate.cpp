@@ -0,0 +1,193 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson, Lexing Ying,
+   The University of Texas at Austin, Stanford University, and the
+   Georgia Insitute of Technology.
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+// Relaxed supernode amalgamation collapses each maximal local subtree which
+// may be treated as a single dense front (of bounded size and with a bounded
+// fraction of explicit zeros) into a leaf. Since the local nodes are stored in
+// postorder after ReverseOrder, the indices of each subtree are contiguous,
+// and so the reordering computed by nested dissection is left unchanged.
+
+namespace El {
+
+namespace {
+
+// The number of entries in the lower-trapezoidal portion of a front
+inline double FrontEntries( int size, int lowerSize )
+{ return 0.5*double(size)*double(size+1) + double(size)*double(lowerSize); }
+
+} // anonymous namespace
+
+void Amalgamate
+( DistSeparatorTree& sepTree, DistSymmElimTree& eTree,
+  AmalgamationStats& stats, int relaxSize, double relaxFraction )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("Amalgamate");
+        if( eTree.localNodes.size() != sepTree.localSepsAndLeaves.size() )
+            LogicError("Elimination and separator trees do not match");
+    )
+    const int numNodes = eTree.localNodes.size();
+
+    // Compute the size of the (filled-in) lower structure of each front, as
+    // well as the number of nodes, indices, and front entries in each subtree
+    std::vector<std::vector<int>> structs( numNodes );
+    std::vector<int> lowerSizes( numNodes ),
+                     subtreeNodes( numNodes ), subtreeSizes( numNodes );
+    std::vector<double> subtreeEntries( numNodes );
+    for( int s=0; s<numNodes; ++s )
+    {
+        const SymmNode& node = *eTree.localNodes[s];
+        std::vector<int> fullStruct = node.lowerStruct;
+        subtreeNodes[s] = 1;
+        subtreeSizes[s] = node.size;
+        subtreeEntries[s] = 0;
+        const int numChildren = node.children.size();
+        for( int c=0; c<numChildren; ++c )
+        {
+            const int child = node.children[c];
+            fullStruct.insert
+            ( fullStruct.end(), structs[child].begin(), structs[child].end() );
+            SwapClear( structs[child] );
+            subtreeNodes[s] += subtreeNodes[child];
+            subtreeSizes[s] += subtreeSizes[child];
+            subtreeEntries[s] += subtreeEntries[child];
+        }
+        std::sort( fullStruct.begin(), fullStruct.end() );
+        fullStruct.erase
+        ( std::unique( fullStruct.begin(), fullStruct.end() ),
+          fullStruct.end() );
+
+        // The children's structures contain our own indices, which lie
+        // immediately before those of our ancestors
+        const int nodeEnd = node.off + node.size;
+        auto ancestorBeg =
+            std::lower_bound( fullStruct.begin(), fullStruct.end(), nodeEnd );
+        structs[s].assign( ancestorBeg, fullStruct.end() );
+        lowerSizes[s] = structs[s].size();
+        subtreeEntries[s] += FrontEntries( node.size, lowerSizes[s] );
+    }
+    SwapClear( structs );
+
+    // Find the maximal subtrees which can be amalgamated by traversing from
+    // the root downwards (each subtree is the contiguous range of nodes
+    // ending at its root)
+    std::vector<bool> merged( numNodes, false ), collapsed( numNodes, false );
+    for( int s=numNodes-1; s>=0; --s )
+    {
+        if( merged[s] || eTree.localNodes[s]->children.size() == 0 ||
+            subtreeSizes[s] > relaxSize )
+            continue;
+        const double entries = FrontEntries( subtreeSizes[s], lowerSizes[s] );
+        const double numZeros = entries - subtreeEntries[s];
+        if( numZeros <= relaxFraction*entries )
+        {
+            collapsed[s] = true;
+            for( int t=s-subtreeNodes[s]+1; t<s; ++t )
+                merged[t] = true;
+        }
+    }
+
+    // Collapse the chosen subtrees into their roots
+    std::vector<int> newInds( numNodes, -1 );
+    int numNewNodes = 0;
+    for( int s=0; s<numNodes; ++s )
+        if( !merged[s] )
+            newInds[s] = numNewNodes++;
+    std::vector<SymmNode*> newNodes( numNewNodes );
+    std::vector<SepOrLeaf*> newSepsAndLeaves( numNewNodes );
+    double numEntries = 0;
+    for( int s=0; s<numNodes; ++s )
+    {
+        if( merged[s] )
+            continue;
+        SymmNode& node = *eTree.localNodes[s];
+        SepOrLeaf& sepOrLeaf = *sepTree.localSepsAndLeaves[s];
+        if( collapsed[s] )
+        {
+            const int first = s-subtreeNodes[s]+1;
+            const int off = eTree.localNodes[first]->off;
+            std::vector<int> inds, lowerStruct;
+            inds.reserve( subtreeSizes[s] );
+            for( int t=first; t<=s; ++t )
+            {
+                SymmNode* mergedNode = eTree.localNodes[t];
+                SepOrLeaf* mergedSepOrLeaf = sepTree.localSepsAndLeaves[t];
+                DEBUG_ONLY(
+                    if( mergedNode->off != off+int(inds.size()) )
+                        LogicError("Subtree indices were not contiguous");
+                )
+                inds.insert
+                ( inds.end(), mergedSepOrLeaf->inds.begin(),
+                  mergedSepOrLeaf->inds.end() );
+                lowerStruct.insert
+                ( lowerStruct.end(), mergedNode->lowerStruct.begin(),
+                  mergedNode->lowerStruct.end() );
+                if( t != s )
+                {
+                    delete mergedNode;
+                    delete mergedSepOrLeaf;
+                }
+            }
+
+            // Only keep the original connections to our ancestors
+            std::sort( lowerStruct.begin(), lowerStruct.end() );
+            lowerStruct.erase
+            ( std::unique( lowerStruct.begin(), lowerStruct.end() ),
+              lowerStruct.end() );
+            const int subtreeEnd = off + inds.size();
+            auto ancestorBeg =
+                std::lower_bound
+                ( lowerStruct.begin(), lowerStruct.end(), subtreeEnd );
+            node.lowerStruct.assign( ancestorBeg, lowerStruct.end() );
+
+            node.size = inds.size();
+            node.off = off;
+            SwapClear( node.children );
+            sepOrLeaf.off = off;
+            sepOrLeaf.inds.swap( inds );
+        }
+        else
+        {
+            const int numChildren = node.children.size();
+            for( int c=0; c<numChildren; ++c )
+                node.children[c] = newInds[node.children[c]];
+        }
+        if( node.parent != -1 )
+            node.parent = newInds[node.parent];
+        if( sepOrLeaf.parent != -1 )
+            sepOrLeaf.parent = newInds[sepOrLeaf.parent];
+        numEntries += FrontEntries( node.size, lowerSizes[s] );
+
+        newNodes[newInds[s]] = &node;
+        newSepsAndLeaves[newInds[s]] = &sepOrLeaf;
+    }
+    eTree.localNodes.swap( newNodes );
+    sepTree.localSepsAndLeaves.swap( newSepsAndLeaves );
+
+    // The local root is also the bottom node of the distributed tree
+    if( numNodes > 0 && collapsed[numNodes-1] && eTree.distNodes.size() > 0 )
+    {
+        const SymmNode& root = *eTree.localNodes.back();
+        DistSymmNode& bottom = eTree.distNodes[0];
+        bottom.size = root.size;
+        bottom.off = root.off;
+        bottom.lowerStruct = root.lowerStruct;
+    }
+
+    stats.numOrigLocalFronts = numNodes;
+    stats.numLocalFronts = numNewNodes;
+    stats.numOrigLocalEntries =
+        ( numNodes > 0 ? subtreeEntries[numNodes-1] : 0 );
+    stats.numLocalEntries = numEntries;
+}
+
+} // namespace El
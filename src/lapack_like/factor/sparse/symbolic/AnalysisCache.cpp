@@ -0,0 +1,475 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson, Lexing Ying,
+   The University of Texas at Austin, Stanford University, and the
+   Georgia Insitute of Technology.
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+// A saved analysis consists of a fixed-size header of 64-bit integers,
+//
+//    magic, numProcesses, numSources, graphHash, ctrlHash, distDepth,
+//
+// followed by a table of numProcesses+1 offsets of the pieces stored by each
+// process and then the pieces themselves. Each piece holds, as 64-bit
+// integers, the local portion of the reordering, the local separator tree,
+// and the local symbolic analysis. The communicators (and process grids) of
+// the distributed nodes are not stored, as they are recreated by following
+// the splits made by NestedDissection.
+
+namespace El {
+
+namespace {
+
+typedef long long int SymbInt;
+
+const SymbInt ANALYSIS_MAGIC = 0x454C53594D423031LL; // "ELSYMB01"
+const Int ANALYSIS_HEADER_SIZE = 6;
+const std::string ANALYSIS_EXTENSION = "symb";
+
+enum AnalysisField
+{
+    MAGIC_FIELD=0,
+    NUMPROCS_FIELD,
+    NUMSOURCES_FIELD,
+    GRAPHHASH_FIELD,
+    CTRLHASH_FIELD,
+    DISTDEPTH_FIELD
+};
+
+// FNV-1a
+inline void HashBytes( unsigned long long& hash, const void* data, Int size )
+{
+    const byte* bytes = (const byte*)data;
+    for( Int k=0; k<size; ++k )
+    {
+        hash ^= bytes[k];
+        hash *= 1099511628211ULL;
+    }
+}
+
+// The hash of the edges of each process, combined in rank order (the
+// distribution of a graph is determined by its size and the number of
+// processes)
+unsigned long long GraphHash( const DistGraph& graph )
+{
+    DEBUG_ONLY(CallStackEntry cse("GraphHash"))
+    mpi::Comm comm = graph.Comm();
+    const int commSize = mpi::Size( comm );
+    unsigned long long localHash = 14695981039346656037ULL;
+    const Int numLocalEdges = graph.NumLocalEdges();
+    HashBytes
+    ( localHash, graph.LockedSourceBuffer(), numLocalEdges*sizeof(Int) );
+    HashBytes
+    ( localHash, graph.LockedTargetBuffer(), numLocalEdges*sizeof(Int) );
+
+    std::vector<unsigned long long> localHashes( commSize );
+    mpi::AllGather( &localHash, 1, localHashes.data(), 1, comm );
+    unsigned long long hash = 14695981039346656037ULL;
+    const SymbInt numSources = graph.NumSources();
+    HashBytes( hash, &numSources, sizeof(SymbInt) );
+    HashBytes( hash, localHashes.data(), commSize*sizeof(unsigned long long) );
+    return hash;
+}
+
+// The parameters which affect the analysis, along with a description of how
+// the ordering was computed
+unsigned long long CtrlHash
+( const BisectCtrl& ctrl, const std::string& ordering )
+{
+    const SymbInt fields[9] =
+      { ctrl.sequential, ctrl.numDistSeps, ctrl.numSeqSeps, ctrl.cutoff,
+        ctrl.storeFactRecvInds, ctrl.relaxSize,
+        SymbInt(ctrl.relaxFraction*1e9), ctrl.native, 0 };
+    unsigned long long hash = 14695981039346656037ULL;
+    HashBytes( hash, fields, 9*sizeof(SymbInt) );
+    HashBytes( hash, ordering.data(), ordering.size() );
+    return hash;
+}
+
+class Packer
+{
+public:
+    void Put( SymbInt value ) { buffer_.push_back( value ); }
+
+    void Put( double value )
+    {
+        SymbInt bits;
+        MemCopy( (byte*)&bits, (const byte*)&value, sizeof(SymbInt) );
+        buffer_.push_back( bits );
+    }
+
+    void Put( const std::vector<int>& vec )
+    {
+        buffer_.push_back( vec.size() );
+        buffer_.insert( buffer_.end(), vec.begin(), vec.end() );
+    }
+
+    void Put( const std::vector<std::vector<int>>& vecs )
+    {
+        buffer_.push_back( vecs.size() );
+        for( const auto& vec : vecs )
+            Put( vec );
+    }
+
+    const std::vector<SymbInt>& Buffer() const { return buffer_; }
+
+private:
+    std::vector<SymbInt> buffer_;
+};
+
+class Unpacker
+{
+public:
+    Unpacker( const std::vector<SymbInt>& buffer, const std::string filename )
+    : buffer_(buffer), pos_(0), filename_(filename)
+    { }
+
+    SymbInt GetInt()
+    {
+        if( pos_ >= buffer_.size() )
+            RuntimeError("Unexpected end of analysis in ",filename_);
+        return buffer_[pos_++];
+    }
+
+    double GetDouble()
+    {
+        const SymbInt bits = GetInt();
+        double value;
+        MemCopy( (byte*)&value, (const byte*)&bits, sizeof(double) );
+        return value;
+    }
+
+    void Get( std::vector<int>& vec )
+    {
+        const SymbInt size = GetInt();
+        if( size < 0 || pos_+size > buffer_.size() )
+            RuntimeError("Corrupted analysis in ",filename_);
+        vec.resize( size );
+        for( SymbInt k=0; k<size; ++k )
+            vec[k] = buffer_[pos_++];
+    }
+
+    void Get( std::vector<std::vector<int>>& vecs )
+    {
+        const SymbInt size = GetInt();
+        if( size < 0 || pos_+size > buffer_.size() )
+            RuntimeError("Corrupted analysis in ",filename_);
+        vecs.resize( size );
+        for( auto& vec : vecs )
+            Get( vec );
+    }
+
+    bool Finished() const { return pos_ == buffer_.size(); }
+
+private:
+    const std::vector<SymbInt>& buffer_;
+    std::size_t pos_;
+    std::string filename_;
+};
+
+// Recreate the communicator of each distributed node by following the
+// splits in BuildChildFromPerm (the smaller team consists of the first
+// half of the processes)
+void FormDistComms( mpi::Comm comm, std::vector<mpi::Comm>& comms )
+{
+    DEBUG_ONLY(CallStackEntry cse("FormDistComms"))
+    const int distDepth = DistributedDepth( comm );
+    comms.resize( distDepth+1 );
+    mpi::Dup( comm, comms[distDepth] );
+    for( int s=distDepth; s>0; --s )
+    {
+        const int commSize = mpi::Size( comms[s] );
+        const int commRank = mpi::Rank( comms[s] );
+        const int smallTeamSize = commSize/2;
+        const bool inSmallTeam = ( commRank < smallTeamSize );
+        const int teamRank =
+            ( inSmallTeam ? commRank : commRank-smallTeamSize );
+        mpi::Split( comms[s], inSmallTeam, teamRank, comms[s-1] );
+    }
+}
+
+} // anonymous namespace
+
+void SaveAnalysis
+( const DistGraph& graph, const DistMap& map,
+  const DistSeparatorTree& sepTree, const DistSymmInfo& info,
+  std::string basename, const BisectCtrl& ctrl, std::string ordering )
+{
+    DEBUG_ONLY(CallStackEntry cse("SaveAnalysis"))
+    mpi::Comm comm = graph.Comm();
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    const std::string filename = basename + "." + ANALYSIS_EXTENSION;
+
+    Packer packer;
+    packer.Put( map.Map() );
+
+    const int numLocalSeps = sepTree.localSepsAndLeaves.size();
+    packer.Put( SymbInt(numLocalSeps) );
+    for( int s=0; s<numLocalSeps; ++s )
+    {
+        const SepOrLeaf& sep = *sepTree.localSepsAndLeaves[s];
+        packer.Put( SymbInt(sep.parent) );
+        packer.Put( SymbInt(sep.off) );
+        packer.Put( sep.inds );
+    }
+    const int numDistSeps = sepTree.distSeps.size();
+    packer.Put( SymbInt(numDistSeps) );
+    for( int s=0; s<numDistSeps; ++s )
+    {
+        const DistSeparator& sep = sepTree.distSeps[s];
+        packer.Put( SymbInt(sep.off) );
+        packer.Put( sep.inds );
+    }
+
+    const AmalgamationStats& amalgStats = info.amalgStats;
+    packer.Put( SymbInt(amalgStats.numOrigLocalFronts) );
+    packer.Put( SymbInt(amalgStats.numLocalFronts) );
+    packer.Put( amalgStats.numOrigLocalEntries );
+    packer.Put( amalgStats.numLocalEntries );
+    packer.Put( info.localFactorOrder );
+
+    const int numLocal = info.localNodes.size();
+    packer.Put( SymbInt(numLocal) );
+    for( int s=0; s<numLocal; ++s )
+    {
+        const SymmNodeInfo& node = info.localNodes[s];
+        packer.Put( SymbInt(node.size) );
+        packer.Put( SymbInt(node.off) );
+        packer.Put( SymbInt(node.parent) );
+        packer.Put( node.children );
+        packer.Put( node.origLowerStruct );
+        packer.Put( SymbInt(node.onLeft) );
+        packer.Put( SymbInt(node.myOff) );
+        packer.Put( node.lowerStruct );
+        packer.Put( node.origLowerRelInds );
+        packer.Put( node.leftRelInds );
+        packer.Put( node.rightRelInds );
+    }
+    const int numDist = info.distNodes.size();
+    packer.Put( SymbInt(numDist) );
+    for( int s=0; s<numDist; ++s )
+    {
+        const DistSymmNodeInfo& node = info.distNodes[s];
+        packer.Put( SymbInt(node.size) );
+        packer.Put( SymbInt(node.off) );
+        packer.Put( node.origLowerStruct );
+        packer.Put( SymbInt(node.onLeft) );
+        packer.Put( SymbInt(node.myOff) );
+        packer.Put( SymbInt(node.leftSize) );
+        packer.Put( SymbInt(node.rightSize) );
+        packer.Put( node.lowerStruct );
+        packer.Put( node.origLowerRelInds );
+        packer.Put( node.leftRelInds );
+        packer.Put( node.rightRelInds );
+        packer.Put( node.factorMeta.numChildSendInds );
+        packer.Put( node.factorMeta.childRecvInds );
+        packer.Put( SymbInt(node.multiVecMeta.localOff) );
+        packer.Put( SymbInt(node.multiVecMeta.localSize) );
+        packer.Put( node.multiVecMeta.numChildSendInds );
+        packer.Put( node.multiVecMeta.childRecvInds );
+    }
+    const std::vector<SymbInt>& piece = packer.Buffer();
+
+    // Form the table of offsets
+    const SymbInt pieceSize = piece.size();
+    std::vector<SymbInt> pieceSizes( commSize );
+    mpi::AllGather( &pieceSize, 1, pieceSizes.data(), 1, comm );
+    std::vector<SymbInt> table( commSize+1 );
+    table[0] = ANALYSIS_HEADER_SIZE + commSize + 1;
+    for( int q=0; q<commSize; ++q )
+        table[q+1] = table[q] + pieceSizes[q];
+
+    SymbInt header[ANALYSIS_HEADER_SIZE];
+    header[MAGIC_FIELD] = ANALYSIS_MAGIC;
+    header[NUMPROCS_FIELD] = commSize;
+    header[NUMSOURCES_FIELD] = graph.NumSources();
+    header[GRAPHHASH_FIELD] = GraphHash( graph );
+    header[CTRLHASH_FIELD] = CtrlHash( ctrl, ordering );
+    header[DISTDEPTH_FIELD] = numDist-1;
+
+    mpi::File file;
+    mpi::FileOpen( comm, filename, mpi::MODE_CREATE|mpi::MODE_WRONLY, file );
+    mpi::FileSetSize( file, table[commSize]*sizeof(SymbInt) );
+    if( commRank == 0 )
+    {
+        mpi::FileWriteAt
+        ( file, 0, (const byte*)header, ANALYSIS_HEADER_SIZE*sizeof(SymbInt) );
+        mpi::FileWriteAt
+        ( file, ANALYSIS_HEADER_SIZE*sizeof(SymbInt), (const byte*)table.data(),
+          (commSize+1)*sizeof(SymbInt) );
+    }
+    mpi::FileWriteAtAll
+    ( file, table[commRank]*sizeof(SymbInt), (const byte*)piece.data(),
+      pieceSize*sizeof(SymbInt) );
+    mpi::FileClose( file );
+}
+
+bool LoadAnalysis
+( const DistGraph& graph, DistMap& map,
+  DistSeparatorTree& sepTree, DistSymmInfo& info,
+  std::string basename, const BisectCtrl& ctrl, std::string ordering )
+{
+    DEBUG_ONLY(CallStackEntry cse("LoadAnalysis"))
+    mpi::Comm comm = graph.Comm();
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    const std::string filename = basename + "." + ANALYSIS_EXTENSION;
+
+    int exists = 0;
+    if( commRank == 0 )
+    {
+        std::ifstream file( filename.c_str() );
+        exists = file.is_open();
+    }
+    mpi::Broadcast( exists, 0, comm );
+    if( !exists )
+        return false;
+
+    mpi::File file;
+    mpi::FileOpen( comm, filename, mpi::MODE_RDONLY, file );
+    const mpi::Offset fileSize = mpi::FileSize( file );
+    SymbInt header[ANALYSIS_HEADER_SIZE];
+    for( Int k=0; k<ANALYSIS_HEADER_SIZE; ++k )
+        header[k] = 0;
+    if( fileSize >= mpi::Offset(ANALYSIS_HEADER_SIZE*sizeof(SymbInt)) )
+        mpi::FileReadAtAll
+        ( file, 0, (byte*)header, ANALYSIS_HEADER_SIZE*sizeof(SymbInt) );
+    const int distDepth = DistributedDepth( comm );
+    if( header[MAGIC_FIELD] != ANALYSIS_MAGIC ||
+        header[NUMPROCS_FIELD] != commSize ||
+        header[NUMSOURCES_FIELD] != graph.NumSources() ||
+        header[GRAPHHASH_FIELD] != SymbInt(GraphHash(graph)) ||
+        header[CTRLHASH_FIELD] != SymbInt(CtrlHash(ctrl,ordering)) ||
+        header[DISTDEPTH_FIELD] != distDepth )
+    {
+        mpi::FileClose( file );
+        return false;
+    }
+
+    SymbInt table[2];
+    mpi::FileReadAtAll
+    ( file, (ANALYSIS_HEADER_SIZE+commRank)*sizeof(SymbInt), (byte*)table,
+      2*sizeof(SymbInt) );
+    if( table[0] > table[1] ||
+        mpi::Offset(table[1]*sizeof(SymbInt)) > fileSize )
+        RuntimeError("Corrupted analysis table in ",filename);
+    std::vector<SymbInt> piece( table[1]-table[0] );
+    mpi::FileReadAtAll
+    ( file, table[0]*sizeof(SymbInt), (byte*)piece.data(),
+      piece.size()*sizeof(SymbInt) );
+    mpi::FileClose( file );
+
+    // NOTE: As in NestedDissection, the trees are assumed to be empty
+    Unpacker unpacker( piece, filename );
+    map.SetComm( comm );
+    map.Resize( graph.NumSources() );
+    std::vector<int> localMap;
+    unpacker.Get( localMap );
+    if( int(localMap.size()) != map.NumLocalSources() )
+        RuntimeError("Reordering in ",filename," has the wrong size");
+    map.Map() = localMap;
+
+    std::vector<mpi::Comm> comms;
+    FormDistComms( comm, comms );
+
+    SwapClear( sepTree.localSepsAndLeaves );
+    const int numLocalSeps = unpacker.GetInt();
+    for( int s=0; s<numLocalSeps; ++s )
+    {
+        sepTree.localSepsAndLeaves.push_back( new SepOrLeaf );
+        SepOrLeaf& sep = *sepTree.localSepsAndLeaves.back();
+        sep.parent = unpacker.GetInt();
+        sep.off = unpacker.GetInt();
+        unpacker.Get( sep.inds );
+    }
+    const int numDistSeps = unpacker.GetInt();
+    if( numDistSeps != distDepth )
+        RuntimeError("Separator tree in ",filename," has the wrong depth");
+    sepTree.distSeps.resize( numDistSeps );
+    for( int s=0; s<numDistSeps; ++s )
+    {
+        DistSeparator& sep = sepTree.distSeps[s];
+        mpi::Dup( comms[s+1], sep.comm );
+        sep.off = unpacker.GetInt();
+        unpacker.Get( sep.inds );
+    }
+
+    AmalgamationStats& amalgStats = info.amalgStats;
+    amalgStats.numOrigLocalFronts = unpacker.GetInt();
+    amalgStats.numLocalFronts = unpacker.GetInt();
+    amalgStats.numOrigLocalEntries = unpacker.GetDouble();
+    amalgStats.numLocalEntries = unpacker.GetDouble();
+    unpacker.Get( info.localFactorOrder );
+
+    const int numLocal = unpacker.GetInt();
+    info.localNodes.resize( numLocal );
+    for( int s=0; s<numLocal; ++s )
+    {
+        SymmNodeInfo& node = info.localNodes[s];
+        node.size = unpacker.GetInt();
+        node.off = unpacker.GetInt();
+        node.parent = unpacker.GetInt();
+        unpacker.Get( node.children );
+        unpacker.Get( node.origLowerStruct );
+        node.onLeft = unpacker.GetInt();
+        node.myOff = unpacker.GetInt();
+        unpacker.Get( node.lowerStruct );
+        unpacker.Get( node.origLowerRelInds );
+        unpacker.Get( node.leftRelInds );
+        unpacker.Get( node.rightRelInds );
+    }
+    const int numDist = unpacker.GetInt();
+    if( numDist != distDepth+1 )
+        RuntimeError("Analysis in ",filename," has the wrong depth");
+    info.distNodes.resize( numDist );
+    for( int s=0; s<numDist; ++s )
+    {
+        DistSymmNodeInfo& node = info.distNodes[s];
+        node.comm = comms[s];
+        node.grid = new Grid( node.comm );
+        node.size = unpacker.GetInt();
+        node.off = unpacker.GetInt();
+        unpacker.Get( node.origLowerStruct );
+        node.onLeft = unpacker.GetInt();
+        node.myOff = unpacker.GetInt();
+        node.leftSize = unpacker.GetInt();
+        node.rightSize = unpacker.GetInt();
+        unpacker.Get( node.lowerStruct );
+        unpacker.Get( node.origLowerRelInds );
+        unpacker.Get( node.leftRelInds );
+        unpacker.Get( node.rightRelInds );
+        unpacker.Get( node.factorMeta.numChildSendInds );
+        unpacker.Get( node.factorMeta.childRecvInds );
+        node.multiVecMeta.localOff = unpacker.GetInt();
+        node.multiVecMeta.localSize = unpacker.GetInt();
+        unpacker.Get( node.multiVecMeta.numChildSendInds );
+        unpacker.Get( node.multiVecMeta.childRecvInds );
+    }
+    if( !unpacker.Finished() )
+        RuntimeError("Unexpected data at the end of the analysis in ",filename);
+    return true;
+}
+
+bool CachedNestedDissection
+( const DistGraph& graph,
+        DistMap& map,
+        DistSeparatorTree& sepTree,
+        DistSymmInfo& info,
+        std::string basename,
+  const BisectCtrl& ctrl )
+{
+    DEBUG_ONLY(CallStackEntry cse("CachedNestedDissection"))
+    if( LoadAnalysis( graph, map, sepTree, info, basename, ctrl ) )
+        return true;
+    NestedDissection( graph, map, sepTree, info, ctrl );
+    SaveAnalysis( graph, map, sepTree, info, basename, ctrl );
+    return false;
+}
+
+} // namespace El
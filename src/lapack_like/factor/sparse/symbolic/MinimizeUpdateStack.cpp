@@ -0,0 +1,102 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson, Lexing Ying,
+   The University of Texas at Austin, Stanford University, and the
+   Georgia Insitute of Technology.
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+// The update matrix of each local front is held from the time the front is
+// factored until its parent is assembled, so the number of update matrices
+// which are simultaneously held depends upon the order in which the children
+// of each node are visited. Liu showed that visiting the children in order of
+// decreasing difference between the peak of their subtree and the size of
+// their own update matrix minimizes the peak of each subtree.
+
+namespace El {
+
+namespace {
+
+// LocalLDL allocates each update matrix as a full square
+inline double UpdateEntries( const SymmNodeInfo& node )
+{
+    const double updateSize = node.lowerStruct.size();
+    return updateSize*updateSize;
+}
+
+} // anonymous namespace
+
+void MinimizeUpdateStack( DistSymmInfo& info )
+{
+    DEBUG_ONLY(CallStackEntry cse("MinimizeUpdateStack"))
+    const int numNodes = info.localNodes.size();
+
+    // Since the children precede their parents, the peaks of the subtrees
+    // (and the best order for their children) may be formed in one sweep
+    std::vector<double> peaks( numNodes );
+    std::vector<std::vector<int>> childOrders( numNodes );
+    for( int s=0; s<numNodes; ++s )
+    {
+        const SymmNodeInfo& node = info.localNodes[s];
+        const int numChildren = node.children.size();
+        std::vector<std::pair<double,int>> keys( numChildren );
+        for( int c=0; c<numChildren; ++c )
+        {
+            const int child = node.children[c];
+            keys[c].first = peaks[child] - UpdateEntries(info.localNodes[child]);
+            keys[c].second = child;
+        }
+        std::sort
+        ( keys.begin(), keys.end(), std::greater<std::pair<double,int>>() );
+
+        double peak = 0, stack = 0;
+        childOrders[s].resize( numChildren );
+        for( int c=0; c<numChildren; ++c )
+        {
+            const int child = keys[c].second;
+            childOrders[s][c] = child;
+            peak = Max( peak, stack+peaks[child] );
+            stack += UpdateEntries( info.localNodes[child] );
+        }
+        peaks[s] = Max( peak, stack+UpdateEntries(node) );
+    }
+
+    // Form the postorder which visits the children in the chosen order
+    std::vector<int>& order = info.localFactorOrder;
+    order.resize( 0 );
+    order.reserve( numNodes );
+    std::vector<std::pair<int,int>> nodeStack;
+    for( int root=0; root<numNodes; ++root )
+    {
+        if( info.localNodes[root].parent != -1 )
+            continue;
+        nodeStack.push_back( std::make_pair(root,0) );
+        while( !nodeStack.empty() )
+        {
+            const int s = nodeStack.back().first;
+            int& nextChild = nodeStack.back().second;
+            if( nextChild < int(childOrders[s].size()) )
+            {
+                const int child = childOrders[s][nextChild++];
+                nodeStack.push_back( std::make_pair(child,0) );
+            }
+            else
+            {
+                order.push_back( s );
+                nodeStack.pop_back();
+            }
+        }
+    }
+    DEBUG_ONLY(
+        if( int(order.size()) != numNodes )
+            LogicError("Factorization order did not visit every node");
+        if( numNodes > 0 && order.back() != numNodes-1 )
+            LogicError("The local root must be factored last");
+    )
+}
+
+} // namespace El
@@ -0,0 +1,976 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson, Lexing Ying,
+   The University of Texas at Austin, Stanford University, and the
+   Georgia Insitute of Technology.
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+// A native replacement for the (Par)METIS bisection routines. The graph is
+// repeatedly coarsened by collapsing heavy-edge matchings, the coarsest graph
+// is bisected by greedy graph growing, and the bisection is projected back
+// through the finer graphs, where it is refined by Fiduccia-Mattheyses (or,
+// for distributed graphs, by a greedy parallel variant). The cut edges of the
+// final bisection are then covered by a vertex separator.
+//
+// Distributed graphs are coarsened in parallel by only matching vertices with
+// local neighbors, and the coarse graph is gathered onto a single process
+// once it is small enough (or once the local matchings stall).
+
+namespace El {
+
+namespace {
+
+// Coarsening stops once a sequential graph has this many vertices...
+const int coarsestSize = 100;
+// ...or once a distributed graph has this many vertices...
+const int gatherSize = 10000;
+// ...or once a level fails to remove at least five percent of the vertices
+const double stallRatio = 0.95;
+
+const int maxRefinePasses = 8;
+const int maxParallelRefinePasses = 4;
+
+// The edges of vertex i are [offs[i],offs[i+1]), and, for the local piece of
+// a distributed graph, the targets are global indices
+struct WeightedGraph
+{
+    std::vector<int> offs, targets, edgeWeights, vertexWeights;
+
+    int NumVertices() const { return vertexWeights.size(); }
+};
+
+struct DistWeightedGraph
+{
+    mpi::Comm comm;
+    // Process q owns vertices [vertexDist[q],vertexDist[q+1])
+    std::vector<int> vertexDist;
+    WeightedGraph local;
+
+    int FirstLocalVertex() const { return vertexDist[mpi::Rank(comm)]; }
+};
+
+// The pattern for reading the values associated with the targets of the local
+// edges of a distributed graph: the values of the local vertices are followed
+// by those of the 'ghost' vertices, and slots[e] is the position of the
+// target of local edge e in this extended vector
+struct GhostPattern
+{
+    std::vector<int> slots;
+    int numGhosts;
+    std::vector<int> sendInds;
+    std::vector<Int> sendSizes, sendOffs, recvSizes, recvOffs;
+};
+
+inline int TotalWeight( const std::vector<int>& weights )
+{
+    int total = 0;
+    const int n = weights.size();
+    for( int i=0; i<n; ++i )
+        total += weights[i];
+    return total;
+}
+
+inline int MaxWeight( const std::vector<int>& weights )
+{
+    int maxWeight = 0;
+    const int n = weights.size();
+    for( int i=0; i<n; ++i )
+        maxWeight = Max( maxWeight, weights[i] );
+    return maxWeight;
+}
+
+// The offsets of each block, followed by the total size
+template<typename T>
+inline void OffsetScan( const std::vector<T>& sizes, std::vector<T>& offs )
+{
+    const int n = sizes.size();
+    offs.resize( n+1 );
+    offs[0] = 0;
+    for( int i=0; i<n; ++i )
+        offs[i+1] = offs[i] + sizes[i];
+}
+
+// Visit the vertices in order of increasing degree and match each unmatched
+// vertex with the unmatched (local) neighbor with which it shares the
+// heaviest edge. The coarse index of each local vertex is returned in
+// 'fineToCoarse', and the number of coarse vertices is returned.
+int Match
+( const WeightedGraph& graph, int firstVertex, int maxVertexWeight,
+  std::vector<int>& fineToCoarse )
+{
+    DEBUG_ONLY(CallStackEntry cse("Match"))
+    const int numVertices = graph.NumVertices();
+    std::vector<std::pair<int,int>> order( numVertices );
+    for( int v=0; v<numVertices; ++v )
+        order[v] = std::make_pair( graph.offs[v+1]-graph.offs[v], v );
+    std::sort( order.begin(), order.end() );
+
+    fineToCoarse.assign( numVertices, -1 );
+    int numCoarse = 0;
+    for( int k=0; k<numVertices; ++k )
+    {
+        const int v = order[k].second;
+        if( fineToCoarse[v] != -1 )
+            continue;
+        int match = -1, matchWeight = 0;
+        for( int e=graph.offs[v]; e<graph.offs[v+1]; ++e )
+        {
+            const int t = graph.targets[e] - firstVertex;
+            if( t < 0 || t >= numVertices || t == v || fineToCoarse[t] != -1 )
+                continue;
+            if( graph.vertexWeights[v]+graph.vertexWeights[t] >
+                maxVertexWeight )
+                continue;
+            if( graph.edgeWeights[e] > matchWeight )
+            {
+                match = t;
+                matchWeight = graph.edgeWeights[e];
+            }
+        }
+        fineToCoarse[v] = numCoarse;
+        if( match != -1 )
+            fineToCoarse[match] = numCoarse;
+        ++numCoarse;
+    }
+    return numCoarse;
+}
+
+// Collapse each set of matched vertices into a single coarse vertex, where
+// coarseTargets[e] is the (global) coarse index of the target of edge e
+void Contract
+( const WeightedGraph& fine, const std::vector<int>& fineToCoarse,
+  const std::vector<int>& coarseTargets, int numCoarse, int firstCoarse,
+  WeightedGraph& coarse )
+{
+    DEBUG_ONLY(CallStackEntry cse("Contract"))
+    const int numFine = fine.NumVertices();
+    std::vector<int> memberSizes( numCoarse, 0 ), memberOffs;
+    for( int v=0; v<numFine; ++v )
+        ++memberSizes[fineToCoarse[v]];
+    OffsetScan( memberSizes, memberOffs );
+    std::vector<int> members( numFine );
+    for( int v=0; v<numFine; ++v )
+        members[memberOffs[fineToCoarse[v]]++] = v;
+    OffsetScan( memberSizes, memberOffs );
+
+    coarse.offs.resize( numCoarse+1 );
+    coarse.vertexWeights.assign( numCoarse, 0 );
+    coarse.targets.resize( 0 );
+    coarse.edgeWeights.resize( 0 );
+    coarse.targets.reserve( fine.targets.size() );
+    coarse.edgeWeights.reserve( fine.targets.size() );
+    std::vector<std::pair<int,int>> edges;
+    for( int c=0; c<numCoarse; ++c )
+    {
+        edges.resize( 0 );
+        for( int k=memberOffs[c]; k<memberOffs[c+1]; ++k )
+        {
+            const int v = members[k];
+            coarse.vertexWeights[c] += fine.vertexWeights[v];
+            for( int e=fine.offs[v]; e<fine.offs[v+1]; ++e )
+                if( coarseTargets[e] != firstCoarse+c )
+                    edges.push_back
+                    ( std::make_pair(coarseTargets[e],fine.edgeWeights[e]) );
+        }
+        std::sort( edges.begin(), edges.end() );
+
+        coarse.offs[c] = coarse.targets.size();
+        const int numEdges = edges.size();
+        for( int k=0; k<numEdges; ++k )
+        {
+            if( k > 0 && edges[k].first == edges[k-1].first )
+                coarse.edgeWeights.back() += edges[k].second;
+            else
+            {
+                coarse.targets.push_back( edges[k].first );
+                coarse.edgeWeights.push_back( edges[k].second );
+            }
+        }
+    }
+    coarse.offs[numCoarse] = coarse.targets.size();
+}
+
+// Bisections are compared first by how much the heavier side exceeds the
+// balance constraint and then by the weight of the edge cut
+inline std::pair<int,int>
+Objective( const int* sideWeights, int maxSideWeight, int cut )
+{
+    const int heavier = Max( sideWeights[0], sideWeights[1] );
+    return std::make_pair( Max(heavier-maxSideWeight,0), cut );
+}
+
+inline int MaxSideWeight( const WeightedGraph& graph, int totalWeight )
+{
+    const int maxVertexWeight = MaxWeight( graph.vertexWeights );
+    return Max( int(0.55*totalWeight), (totalWeight+maxVertexWeight)/2 );
+}
+
+int EdgeCut( const WeightedGraph& graph, const std::vector<int>& part )
+{
+    int cut = 0;
+    const int numVertices = graph.NumVertices();
+    for( int v=0; v<numVertices; ++v )
+        for( int e=graph.offs[v]; e<graph.offs[v+1]; ++e )
+            if( part[graph.targets[e]] != part[v] )
+                cut += graph.edgeWeights[e];
+    return cut/2;
+}
+
+// Fiduccia-Mattheyses: each pass moves vertices, one at a time and each at
+// most once, in order of decreasing reduction of the edge cut (subject to the
+// balance constraint) and then rolls back to the best bisection it visited
+void Refine( const WeightedGraph& graph, std::vector<int>& part )
+{
+    DEBUG_ONLY(CallStackEntry cse("Refine"))
+    const int numVertices = graph.NumVertices();
+    const int totalWeight = TotalWeight( graph.vertexWeights );
+    const int maxSideWeight = MaxSideWeight( graph, totalWeight );
+    const int maxBadMoves = Max( 25, Min( numVertices/20, 250 ) );
+
+    int sideWeights[2] = { 0, 0 };
+    for( int v=0; v<numVertices; ++v )
+        sideWeights[part[v]] += graph.vertexWeights[v];
+
+    std::vector<int> gains( numVertices ), external( numVertices );
+    std::vector<byte> locked( numVertices );
+    std::vector<int> moves;
+    std::set<std::pair<int,int>> queues[2];
+    for( int pass=0; pass<maxRefinePasses; ++pass )
+    {
+        queues[0].clear();
+        queues[1].clear();
+        int cut = 0;
+        for( int v=0; v<numVertices; ++v )
+        {
+            int degree = 0;
+            external[v] = 0;
+            for( int e=graph.offs[v]; e<graph.offs[v+1]; ++e )
+            {
+                degree += graph.edgeWeights[e];
+                if( part[graph.targets[e]] != part[v] )
+                    external[v] += graph.edgeWeights[e];
+            }
+            gains[v] = 2*external[v] - degree;
+            cut += external[v];
+            if( external[v] > 0 )
+                queues[part[v]].insert( std::make_pair(-gains[v],v) );
+        }
+        cut /= 2;
+        std::fill( locked.begin(), locked.end(), 0 );
+        moves.resize( 0 );
+
+        auto bestObjective = Objective( sideWeights, maxSideWeight, cut );
+        int numBestMoves = 0, numBadMoves = 0;
+        while( numBadMoves < maxBadMoves )
+        {
+            // Find the best allowable move from either side
+            int from = -1;
+            for( int side=0; side<2; ++side )
+            {
+                if( queues[side].empty() )
+                    continue;
+                const int v = queues[side].begin()->second;
+                const int newWeight =
+                    sideWeights[1-side] + graph.vertexWeights[v];
+                const bool allowed =
+                    newWeight <= maxSideWeight ||
+                    ( sideWeights[side] > maxSideWeight &&
+                      newWeight < sideWeights[side] );
+                if( !allowed )
+                    continue;
+                if( from == -1 ||
+                    gains[v] > gains[queues[from].begin()->second] ||
+                    ( gains[v] == gains[queues[from].begin()->second] &&
+                      sideWeights[side] > sideWeights[from] ) )
+                    from = side;
+            }
+            if( from == -1 )
+                break;
+
+            const int v = queues[from].begin()->second;
+            queues[from].erase( queues[from].begin() );
+            locked[v] = 1;
+            part[v] = 1-from;
+            sideWeights[from] -= graph.vertexWeights[v];
+            sideWeights[1-from] += graph.vertexWeights[v];
+            cut -= gains[v];
+            moves.push_back( v );
+
+            for( int e=graph.offs[v]; e<graph.offs[v+1]; ++e )
+            {
+                const int t = graph.targets[e];
+                if( locked[t] )
+                    continue;
+                if( external[t] > 0 )
+                    queues[part[t]].erase( std::make_pair(-gains[t],t) );
+                const int weight = graph.edgeWeights[e];
+                if( part[t] == from )
+                {
+                    external[t] += weight;
+                    gains[t] += 2*weight;
+                }
+                else
+                {
+                    external[t] -= weight;
+                    gains[t] -= 2*weight;
+                }
+                if( external[t] > 0 )
+                    queues[part[t]].insert( std::make_pair(-gains[t],t) );
+            }
+
+            const auto objective = Objective( sideWeights, maxSideWeight, cut );
+            if( objective < bestObjective )
+            {
+                bestObjective = objective;
+                numBestMoves = moves.size();
+                numBadMoves = 0;
+            }
+            else
+                ++numBadMoves;
+        }
+
+        // Roll back to the best bisection
+        const int numMoves = moves.size();
+        for( int k=numMoves-1; k>=numBestMoves; --k )
+        {
+            const int v = moves[k];
+            sideWeights[part[v]] -= graph.vertexWeights[v];
+            part[v] = 1-part[v];
+            sideWeights[part[v]] += graph.vertexWeights[v];
+        }
+        if( numBestMoves == 0 )
+            break;
+    }
+}
+
+// Returns the last vertex reached by a breadth-first search from 'root'
+int FarthestVertex( const WeightedGraph& graph, int root )
+{
+    const int numVertices = graph.NumVertices();
+    std::vector<byte> visited( numVertices, 0 );
+    std::vector<int> queue( 1, root );
+    visited[root] = 1;
+    for( int k=0; k<int(queue.size()); ++k )
+    {
+        const int v = queue[k];
+        for( int e=graph.offs[v]; e<graph.offs[v+1]; ++e )
+        {
+            const int t = graph.targets[e];
+            if( !visited[t] )
+            {
+                visited[t] = 1;
+                queue.push_back( t );
+            }
+        }
+    }
+    return queue.back();
+}
+
+// Grow side zero from a seed vertex, always absorbing the vertex whose move
+// most reduces the edge cut, until it holds half of the vertex weight
+void GrowBisection
+( const WeightedGraph& graph, int seed, std::vector<int>& part )
+{
+    DEBUG_ONLY(CallStackEntry cse("GrowBisection"))
+    const int numVertices = graph.NumVertices();
+    const int halfWeight = TotalWeight( graph.vertexWeights ) / 2;
+    part.assign( numVertices, 1 );
+
+    std::vector<int> gains( numVertices, 0 );
+    std::vector<byte> inFrontier( numVertices, 0 );
+    for( int v=0; v<numVertices; ++v )
+        for( int e=graph.offs[v]; e<graph.offs[v+1]; ++e )
+            gains[v] -= graph.edgeWeights[e];
+
+    std::set<std::pair<int,int>> frontier;
+    int weight = 0, nextUnvisited = 0, v = seed;
+    while( true )
+    {
+        part[v] = 0;
+        weight += graph.vertexWeights[v];
+        if( weight >= halfWeight )
+            break;
+        for( int e=graph.offs[v]; e<graph.offs[v+1]; ++e )
+        {
+            const int t = graph.targets[e];
+            if( part[t] == 0 )
+                continue;
+            if( inFrontier[t] )
+                frontier.erase( std::make_pair(-gains[t],t) );
+            gains[t] += 2*graph.edgeWeights[e];
+            frontier.insert( std::make_pair(-gains[t],t) );
+            inFrontier[t] = 1;
+        }
+
+        if( !frontier.empty() )
+        {
+            v = frontier.begin()->second;
+            frontier.erase( frontier.begin() );
+        }
+        else
+        {
+            // The component of the seed has been exhausted
+            while( nextUnvisited < numVertices && part[nextUnvisited] == 0 )
+                ++nextUnvisited;
+            if( nextUnvisited == numVertices )
+                break;
+            v = nextUnvisited;
+        }
+    }
+}
+
+// Bisect the coarsest graph by growing from several seeds
+void InitialBisection
+( const WeightedGraph& graph, int numTrials, std::vector<int>& part )
+{
+    DEBUG_ONLY(CallStackEntry cse("InitialBisection"))
+    const int numVertices = graph.NumVertices();
+    part.assign( numVertices, 0 );
+    if( numVertices <= 1 )
+        return;
+    const int totalWeight = TotalWeight( graph.vertexWeights );
+    const int maxSideWeight = MaxSideWeight( graph, totalWeight );
+
+    std::vector<int> trialPart;
+    std::pair<int,int> bestObjective;
+    for( int trial=0; trial<numTrials; ++trial )
+    {
+        // Start from a pseudo-peripheral vertex and then spread the seeds out
+        const int seed =
+            ( trial == 0 ? FarthestVertex(graph,FarthestVertex(graph,0))
+                         : (trial*numVertices)/numTrials );
+        GrowBisection( graph, seed, trialPart );
+        Refine( graph, trialPart );
+
+        int sideWeights[2] = { 0, 0 };
+        for( int v=0; v<numVertices; ++v )
+            sideWeights[trialPart[v]] += graph.vertexWeights[v];
+        const auto objective =
+            Objective( sideWeights, maxSideWeight, EdgeCut(graph,trialPart) );
+        if( trial == 0 || objective < bestObjective )
+        {
+            bestObjective = objective;
+            part = trialPart;
+        }
+    }
+}
+
+// Compute a two-way partition of the vertices which approximately minimizes
+// the weight of the edge cut
+void MultilevelPartition
+( const WeightedGraph& graph, int numTrials, std::vector<int>& part )
+{
+    DEBUG_ONLY(CallStackEntry cse("MultilevelPartition"))
+    const int totalWeight = TotalWeight( graph.vertexWeights );
+    const int maxVertexWeight = Max( 1, (3*totalWeight)/(2*coarsestSize) );
+
+    std::vector<WeightedGraph> coarseGraphs;
+    std::vector<std::vector<int>> maps;
+    const WeightedGraph* fine = &graph;
+    while( fine->NumVertices() > coarsestSize )
+    {
+        std::vector<int> map;
+        const int numCoarse = Match( *fine, 0, maxVertexWeight, map );
+        if( numCoarse > stallRatio*fine->NumVertices() )
+            break;
+
+        const int numEdges = fine->targets.size();
+        std::vector<int> coarseTargets( numEdges );
+        for( int e=0; e<numEdges; ++e )
+            coarseTargets[e] = map[fine->targets[e]];
+        WeightedGraph coarse;
+        Contract( *fine, map, coarseTargets, numCoarse, 0, coarse );
+
+        coarseGraphs.push_back( std::move(coarse) );
+        maps.push_back( std::move(map) );
+        fine = &coarseGraphs.back();
+    }
+
+    InitialBisection( *fine, numTrials, part );
+
+    const int numLevels = maps.size();
+    std::vector<int> finePart;
+    for( int level=numLevels-1; level>=0; --level )
+    {
+        const WeightedGraph& levelGraph =
+            ( level == 0 ? graph : coarseGraphs[level-1] );
+        const std::vector<int>& map = maps[level];
+        const int numVertices = levelGraph.NumVertices();
+        finePart.resize( numVertices );
+        for( int v=0; v<numVertices; ++v )
+            finePart[v] = part[map[v]];
+        std::swap( part, finePart );
+        Refine( levelGraph, part );
+    }
+}
+
+// Cover the cut edges with a vertex separator (marked with a 2) by greedily
+// taking the vertex which covers the most uncovered cut edges, with ties
+// broken in favor of the heavier side
+void CoverCut( const WeightedGraph& graph, std::vector<int>& part )
+{
+    DEBUG_ONLY(CallStackEntry cse("CoverCut"))
+    const int numVertices = graph.NumVertices();
+    int sideWeights[2] = { 0, 0 };
+    for( int v=0; v<numVertices; ++v )
+        sideWeights[part[v]] += graph.vertexWeights[v];
+    const int heavier = ( sideWeights[0] >= sideWeights[1] ? 0 : 1 );
+
+    std::vector<int> keys( numVertices, 0 );
+    std::set<std::pair<int,int>> queue;
+    for( int v=0; v<numVertices; ++v )
+    {
+        int numCut = 0;
+        for( int e=graph.offs[v]; e<graph.offs[v+1]; ++e )
+            if( part[graph.targets[e]] != part[v] )
+                ++numCut;
+        if( numCut > 0 )
+        {
+            keys[v] = -(2*numCut + (part[v]==heavier));
+            queue.insert( std::make_pair(keys[v],v) );
+        }
+    }
+
+    while( !queue.empty() )
+    {
+        const int v = queue.begin()->second;
+        queue.erase( queue.begin() );
+        const int side = part[v];
+        part[v] = 2;
+        for( int e=graph.offs[v]; e<graph.offs[v+1]; ++e )
+        {
+            const int t = graph.targets[e];
+            if( part[t] != 1-side )
+                continue;
+            queue.erase( std::make_pair(keys[t],t) );
+            keys[t] += 2;
+            if( keys[t] <= -2 )
+                queue.insert( std::make_pair(keys[t],t) );
+        }
+    }
+}
+
+void FormGhostPattern( const DistWeightedGraph& graph, GhostPattern& pattern )
+{
+    DEBUG_ONLY(CallStackEntry cse("FormGhostPattern"))
+    const int commSize = mpi::Size( graph.comm );
+    const int firstLocal = graph.FirstLocalVertex();
+    const int numLocal = graph.local.NumVertices();
+    const int numEdges = graph.local.targets.size();
+
+    std::vector<int> ghosts;
+    for( int e=0; e<numEdges; ++e )
+    {
+        const int t = graph.local.targets[e];
+        if( t < firstLocal || t >= firstLocal+numLocal )
+            ghosts.push_back( t );
+    }
+    std::sort( ghosts.begin(), ghosts.end() );
+    ghosts.erase( std::unique(ghosts.begin(),ghosts.end()), ghosts.end() );
+    pattern.numGhosts = ghosts.size();
+
+    pattern.slots.resize( numEdges );
+    for( int e=0; e<numEdges; ++e )
+    {
+        const int t = graph.local.targets[e];
+        if( t >= firstLocal && t < firstLocal+numLocal )
+            pattern.slots[e] = t - firstLocal;
+        else
+            pattern.slots[e] = numLocal +
+              (std::lower_bound(ghosts.begin(),ghosts.end(),t)-ghosts.begin());
+    }
+
+    // Request the ghost values from their owners
+    std::vector<Int> recvSizes( commSize, 0 );
+    for( int k=0; k<pattern.numGhosts; ++k )
+    {
+        const int owner =
+            std::upper_bound
+            (graph.vertexDist.begin(),graph.vertexDist.end(),ghosts[k]) -
+            graph.vertexDist.begin() - 1;
+        ++recvSizes[owner];
+    }
+    std::vector<Int> sendSizes( commSize );
+    mpi::AllToAll( recvSizes.data(), 1, sendSizes.data(), 1, graph.comm );
+    OffsetScan( recvSizes, pattern.recvOffs );
+    OffsetScan( sendSizes, pattern.sendOffs );
+    pattern.recvSizes = recvSizes;
+    pattern.sendSizes = sendSizes;
+
+    pattern.sendInds.resize( pattern.sendOffs[commSize] );
+    mpi::AllToAll
+    ( ghosts.data(), pattern.recvSizes.data(), pattern.recvOffs.data(),
+      pattern.sendInds.data(), pattern.sendSizes.data(),
+      pattern.sendOffs.data(), graph.comm );
+    const int numSends = pattern.sendInds.size();
+    for( int k=0; k<numSends; ++k )
+        pattern.sendInds[k] -= firstLocal;
+}
+
+// Append the values of the ghost vertices to those of the local vertices
+void ExchangeGhosts
+( const GhostPattern& pattern, std::vector<int>& values, mpi::Comm comm )
+{
+    DEBUG_ONLY(CallStackEntry cse("ExchangeGhosts"))
+    const int numLocal = values.size();
+    const int numSends = pattern.sendInds.size();
+    std::vector<int> sendBuf( numSends );
+    for( int k=0; k<numSends; ++k )
+        sendBuf[k] = values[pattern.sendInds[k]];
+    values.resize( numLocal+pattern.numGhosts );
+    mpi::AllToAll
+    ( sendBuf.data(), pattern.sendSizes.data(), pattern.sendOffs.data(),
+      values.data()+numLocal, pattern.recvSizes.data(),
+      pattern.recvOffs.data(), comm );
+}
+
+// Greedy parallel refinement: alternately move the vertices of each side
+// which would reduce the edge cut, with the slack in the balance constraint
+// evenly divided between the processes. Since all of the simultaneous moves
+// are in the same direction, the actual reduction of the cut is at least the
+// sum of the predicted reductions.
+void ParallelRefine
+( const DistWeightedGraph& graph, const GhostPattern& pattern,
+  std::vector<int>& part, int maxSideWeight )
+{
+    DEBUG_ONLY(CallStackEntry cse("ParallelRefine"))
+    const WeightedGraph& local = graph.local;
+    const int commSize = mpi::Size( graph.comm );
+    const int numLocal = local.NumVertices();
+
+    int sideWeights[2] = { 0, 0 };
+    for( int v=0; v<numLocal; ++v )
+        sideWeights[part[v]] += local.vertexWeights[v];
+    mpi::AllReduce( sideWeights, 2, mpi::SUM, graph.comm );
+
+    std::vector<int> values;
+    std::vector<std::pair<int,int>> candidates;
+    for( int pass=0; pass<maxParallelRefinePasses; ++pass )
+    {
+        int numMoved = 0;
+        for( int from=0; from<2; ++from )
+        {
+            const int to = 1-from;
+            values = part;
+            ExchangeGhosts( pattern, values, graph.comm );
+
+            candidates.resize( 0 );
+            for( int v=0; v<numLocal; ++v )
+            {
+                if( part[v] != from )
+                    continue;
+                int gain = 0;
+                for( int e=local.offs[v]; e<local.offs[v+1]; ++e )
+                    gain += ( values[pattern.slots[e]] == to ?
+                              local.edgeWeights[e] : -local.edgeWeights[e] );
+                if( gain > 0 )
+                    candidates.push_back( std::make_pair(-gain,v) );
+            }
+            std::sort( candidates.begin(), candidates.end() );
+
+            const int slack =
+                Max( Max( maxSideWeight-sideWeights[to],
+                          sideWeights[from]-maxSideWeight ), 0 );
+            const int budget = slack / commSize;
+            int movedWeight = 0;
+            const int numCandidates = candidates.size();
+            for( int k=0; k<numCandidates; ++k )
+            {
+                const int v = candidates[k].second;
+                if( movedWeight+local.vertexWeights[v] > budget )
+                    continue;
+                part[v] = to;
+                movedWeight += local.vertexWeights[v];
+                ++numMoved;
+            }
+            movedWeight = mpi::AllReduce( movedWeight, graph.comm );
+            sideWeights[from] -= movedWeight;
+            sideWeights[to] += movedWeight;
+        }
+        if( mpi::AllReduce( numMoved, graph.comm ) == 0 )
+            break;
+    }
+}
+
+// Gather a distributed graph onto the root process
+void GatherGraph( const DistWeightedGraph& graph, WeightedGraph& seqGraph )
+{
+    DEBUG_ONLY(CallStackEntry cse("GatherGraph"))
+    mpi::Comm comm = graph.comm;
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    const WeightedGraph& local = graph.local;
+    const int numLocal = local.NumVertices();
+    const Int numLocalEdges = local.targets.size();
+    const int numVertices = graph.vertexDist[commSize];
+
+    std::vector<Int> vertexSizes( commSize ), vertexOffs( commSize ),
+                     edgeSizes( commSize ), edgeOffs;
+    for( int q=0; q<commSize; ++q )
+    {
+        vertexSizes[q] = graph.vertexDist[q+1] - graph.vertexDist[q];
+        vertexOffs[q] = graph.vertexDist[q];
+    }
+    mpi::AllGather( &numLocalEdges, 1, edgeSizes.data(), 1, comm );
+    OffsetScan( edgeSizes, edgeOffs );
+
+    std::vector<int> degrees( numLocal ), allDegrees;
+    for( int v=0; v<numLocal; ++v )
+        degrees[v] = local.offs[v+1] - local.offs[v];
+    if( commRank == 0 )
+    {
+        allDegrees.resize( numVertices );
+        seqGraph.vertexWeights.resize( numVertices );
+        seqGraph.targets.resize( edgeOffs[commSize] );
+        seqGraph.edgeWeights.resize( edgeOffs[commSize] );
+    }
+    mpi::Gather
+    ( degrees.data(), numLocal, allDegrees.data(),
+      vertexSizes.data(), vertexOffs.data(), 0, comm );
+    mpi::Gather
+    ( local.vertexWeights.data(), numLocal, seqGraph.vertexWeights.data(),
+      vertexSizes.data(), vertexOffs.data(), 0, comm );
+    mpi::Gather
+    ( local.targets.data(), numLocalEdges, seqGraph.targets.data(),
+      edgeSizes.data(), edgeOffs.data(), 0, comm );
+    mpi::Gather
+    ( local.edgeWeights.data(), numLocalEdges, seqGraph.edgeWeights.data(),
+      edgeSizes.data(), edgeOffs.data(), 0, comm );
+    if( commRank == 0 )
+        OffsetScan( allDegrees, seqGraph.offs );
+}
+
+// The sources are ordered as [left, right, separator] (each in their
+// original relative order)
+void FormPerm
+( const std::vector<int>& part, const int* offs, std::vector<int>& perm )
+{
+    const int numVertices = part.size();
+    int next[3] = { offs[0], offs[1], offs[2] };
+    perm.resize( numVertices );
+    for( int v=0; v<numVertices; ++v )
+        perm[v] = next[part[v]]++;
+}
+
+} // anonymous namespace
+
+int MultilevelBisect
+( const Graph& graph, std::vector<int>& perm, std::vector<int>& sizes,
+  const BisectCtrl& ctrl )
+{
+    DEBUG_ONLY(CallStackEntry cse("MultilevelBisect"))
+    // Ignore the self-connections and the connections outside of the sources
+    const int numSources = graph.NumSources();
+    WeightedGraph wGraph;
+    wGraph.offs.resize( numSources+1 );
+    wGraph.vertexWeights.assign( numSources, 1 );
+    for( int s=0; s<numSources; ++s )
+    {
+        wGraph.offs[s] = wGraph.targets.size();
+        const int off = graph.EdgeOffset( s );
+        const int numConnections = graph.NumConnections( s );
+        for( int t=0; t<numConnections; ++t )
+        {
+            const int target = graph.Target( off+t );
+            if( target != s && target < numSources )
+                wGraph.targets.push_back( target );
+        }
+    }
+    wGraph.offs[numSources] = wGraph.targets.size();
+    wGraph.edgeWeights.assign( wGraph.targets.size(), 1 );
+
+    std::vector<int> part;
+    MultilevelPartition( wGraph, 4*Max(ctrl.numSeqSeps,1), part );
+    CoverCut( wGraph, part );
+
+    sizes.assign( 3, 0 );
+    for( int s=0; s<numSources; ++s )
+        ++sizes[part[s]];
+    const int offs[3] = { 0, sizes[0], sizes[0]+sizes[1] };
+    FormPerm( part, offs, perm );
+    return sizes[2];
+}
+
+int MultilevelBisect
+( const DistGraph& graph, DistMap& perm, std::vector<int>& sizes,
+  const BisectCtrl& ctrl )
+{
+    DEBUG_ONLY(CallStackEntry cse("MultilevelBisect"))
+    mpi::Comm comm = graph.Comm();
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    const int numSources = graph.NumSources();
+    const int numLocalSources = graph.NumLocalSources();
+    const int firstLocalSource = graph.FirstLocalSource();
+    const int blocksize = graph.Blocksize();
+
+    // Ignore the self-connections and the connections outside of the sources
+    std::vector<DistWeightedGraph> graphs( 1 );
+    DistWeightedGraph& fine = graphs[0];
+    fine.comm = comm;
+    fine.vertexDist.resize( commSize+1 );
+    for( int q=0; q<commSize; ++q )
+        fine.vertexDist[q] = q*blocksize;
+    fine.vertexDist[commSize] = numSources;
+    fine.local.offs.resize( numLocalSources+1 );
+    fine.local.vertexWeights.assign( numLocalSources, 1 );
+    for( int s=0; s<numLocalSources; ++s )
+    {
+        fine.local.offs[s] = fine.local.targets.size();
+        const int off = graph.EdgeOffset( s );
+        const int numConnections = graph.NumConnections( s );
+        for( int t=0; t<numConnections; ++t )
+        {
+            const int target = graph.Target( off+t );
+            if( target != s+firstLocalSource && target < numSources )
+                fine.local.targets.push_back( target );
+        }
+    }
+    fine.local.offs[numLocalSources] = fine.local.targets.size();
+    fine.local.edgeWeights.assign( fine.local.targets.size(), 1 );
+
+    // Coarsen in parallel until the graph is small enough to gather
+    // (a sequential bisection gathers the original graph)
+    const int maxVertexWeight = Max( 1, (3*numSources)/(2*coarsestSize) );
+    std::vector<GhostPattern> patterns;
+    std::vector<std::vector<int>> maps;
+    int numVertices = numSources;
+    while( !ctrl.sequential && numVertices > gatherSize )
+    {
+        const DistWeightedGraph& level = graphs.back();
+        const int firstLocal = level.FirstLocalVertex();
+        std::vector<int> map;
+        const int numLocalCoarse =
+            Match( level.local, firstLocal, maxVertexWeight, map );
+        const int numCoarse = mpi::AllReduce( numLocalCoarse, comm );
+        if( numCoarse > stallRatio*numVertices )
+            break;
+
+        DistWeightedGraph coarse;
+        coarse.comm = comm;
+        std::vector<int> coarseSizes( commSize );
+        mpi::AllGather( &numLocalCoarse, 1, coarseSizes.data(), 1, comm );
+        OffsetScan( coarseSizes, coarse.vertexDist );
+        const int firstCoarse = coarse.vertexDist[commRank];
+
+        // Form the coarse (global) indices of the targets
+        GhostPattern pattern;
+        FormGhostPattern( level, pattern );
+        std::vector<int> values( map );
+        const int numLocal = values.size();
+        for( int v=0; v<numLocal; ++v )
+            values[v] += firstCoarse;
+        ExchangeGhosts( pattern, values, comm );
+        const int numEdges = level.local.targets.size();
+        std::vector<int> coarseTargets( numEdges );
+        for( int e=0; e<numEdges; ++e )
+            coarseTargets[e] = values[pattern.slots[e]];
+        Contract
+        ( level.local, map, coarseTargets, numLocalCoarse, firstCoarse,
+          coarse.local );
+
+        patterns.push_back( std::move(pattern) );
+        maps.push_back( std::move(map) );
+        graphs.push_back( std::move(coarse) );
+        numVertices = numCoarse;
+    }
+    const int numLevels = maps.size();
+
+    // Bisect the coarsest graph on the root and broadcast the result. If the
+    // original graph was gathered, then the root also forms the separator.
+    std::vector<int> coarsePart( numVertices );
+    {
+        WeightedGraph seqGraph;
+        GatherGraph( graphs.back(), seqGraph );
+        if( commRank == 0 )
+        {
+            MultilevelPartition
+            ( seqGraph, 4*Max(ctrl.numSeqSeps,1), coarsePart );
+            if( numLevels == 0 )
+                CoverCut( seqGraph, coarsePart );
+        }
+    }
+    mpi::Broadcast( coarsePart.data(), numVertices, 0, comm );
+
+    // Project the bisection back onto the original graph
+    std::vector<int> part;
+    {
+        const DistWeightedGraph& coarsest = graphs.back();
+        const int firstLocal = coarsest.FirstLocalVertex();
+        const int numLocal = coarsest.local.NumVertices();
+        part.assign
+        ( coarsePart.begin()+firstLocal,
+          coarsePart.begin()+firstLocal+numLocal );
+    }
+    const int maxSideWeight =
+        Max( int(0.55*numSources), (numSources+maxVertexWeight)/2 );
+    for( int level=numLevels-1; level>=0; --level )
+    {
+        const std::vector<int>& map = maps[level];
+        const int numLocal = map.size();
+        std::vector<int> finePart( numLocal );
+        for( int v=0; v<numLocal; ++v )
+            finePart[v] = part[map[v]];
+        std::swap( part, finePart );
+        ParallelRefine
+        ( graphs[level], patterns[level], part, maxSideWeight );
+    }
+
+    // Form the separator from the boundary of the side with the smaller
+    // boundary
+    if( numLevels > 0 )
+    {
+        std::vector<int> values( part );
+        ExchangeGhosts( patterns[0], values, comm );
+        const WeightedGraph& local = graphs[0].local;
+        std::vector<byte> boundary( numLocalSources, 0 );
+        int counts[4] = { 0, 0, 0, 0 };
+        for( int s=0; s<numLocalSources; ++s )
+        {
+            for( int e=local.offs[s]; e<local.offs[s+1]; ++e )
+                if( values[patterns[0].slots[e]] != part[s] )
+                    boundary[s] = 1;
+            counts[part[s]] += boundary[s];
+            counts[2+part[s]] += 1;
+        }
+        mpi::AllReduce( counts, 4, mpi::SUM, comm );
+        const int sepSide =
+            ( counts[0] < counts[1] ||
+              (counts[0] == counts[1] && counts[2] >= counts[3]) ? 0 : 1 );
+        for( int s=0; s<numLocalSources; ++s )
+            if( part[s] == sepSide && boundary[s] )
+                part[s] = 2;
+    }
+
+    // Order the sources as [left, right, separator]
+    int localSizes[3] = { 0, 0, 0 };
+    for( int s=0; s<numLocalSources; ++s )
+        ++localSizes[part[s]];
+    std::vector<int> allSizes( 3*commSize );
+    mpi::AllGather( localSizes, 3, allSizes.data(), 3, comm );
+    sizes.assign( 3, 0 );
+    int offs[3] = { 0, 0, 0 };
+    for( int q=0; q<commSize; ++q )
+    {
+        for( int k=0; k<3; ++k )
+        {
+            if( q < commRank )
+                offs[k] += allSizes[3*q+k];
+            sizes[k] += allSizes[3*q+k];
+        }
+    }
+    offs[1] += sizes[0];
+    offs[2] += sizes[0] + sizes[1];
+
+    perm.SetComm( comm );
+    perm.Resize( numSources );
+    FormPerm( part, offs, perm.Map() );
+    return sizes[2];
+}
+
+} // namespace El
@@ -215,17 +215,17 @@ NaturalNestedDissectionRecursion
                 }
             }
         }
-        const int numLocalConnected = localConnectedAncestors.size();
+        const Int numLocalConnected = localConnectedAncestors.size();
         const int commSize = mpi::Size( comm );
-        std::vector<int> localConnectedSizes( commSize );
+        std::vector<Int> localConnectedSizes( commSize );
         mpi::AllGather
         ( &numLocalConnected, 1, &localConnectedSizes[0], 1, comm );
         std::vector<int> localConnectedVec( numLocalConnected );
         std::copy
         ( localConnectedAncestors.begin(), localConnectedAncestors.end(), 
           localConnectedVec.begin() );
-        int sumOfLocalConnectedSizes=0;
-        std::vector<int> localConnectedOffs( commSize );
+        Int sumOfLocalConnectedSizes=0;
+        std::vector<Int> localConnectedOffs( commSize );
         for( int q=0; q<commSize; ++q )
         {
             localConnectedOffs[q] = sumOfLocalConnectedSizes;
@@ -408,7 +408,9 @@ void NaturalNestedDissection
         DistSeparatorTree& sepTree, 
         DistSymmInfo& info,
         int cutoff, 
-        bool storeFactRecvInds )
+        bool storeFactRecvInds,
+        int relaxSize,
+        double relaxFraction )
 {
     DEBUG_ONLY(CallStackEntry cse("NaturalNestedDissection"))
     // NOTE: There is a potential memory leak here if these data structures 
@@ -437,6 +439,10 @@ void NaturalNestedDissection
     BuildMap( graph, sepTree, map );
     DEBUG_ONLY(EnsurePermutation( map ))
 
+    // Merge small local subtrees into single fronts
+    if( relaxSize > 0 )
+        Amalgamate( sepTree, eTree, info.amalgStats, relaxSize, relaxFraction );
+
     // Run the symbolic analysis
     SymmetricAnalysis( eTree, info, storeFactRecvInds );
 }
@@ -225,17 +225,17 @@ NestedDissectionRecursion
                 }
             }
         }
-        const int numLocalConnected = localConnectedAncestors.size();
+        const Int numLocalConnected = localConnectedAncestors.size();
         const int commSize = mpi::Size( comm );
-        std::vector<int> localConnectedSizes( commSize );
+        std::vector<Int> localConnectedSizes( commSize );
         mpi::AllGather
         ( &numLocalConnected, 1, &localConnectedSizes[0], 1, comm );
         std::vector<int> localConnectedVec( numLocalConnected );
         std::copy
         ( localConnectedAncestors.begin(), localConnectedAncestors.end(), 
           localConnectedVec.begin() );
-        int sumOfLocalConnectedSizes=0;
-        std::vector<int> localConnectedOffs( commSize );
+        Int sumOfLocalConnectedSizes=0;
+        std::vector<Int> localConnectedOffs( commSize );
         for( int q=0; q<commSize; ++q )
         {
             localConnectedOffs[q] = sumOfLocalConnectedSizes;
@@ -437,6 +437,12 @@ void NestedDissection
     BuildMap( graph, sepTree, map );
     DEBUG_ONLY(EnsurePermutation( map ))
 
+    // Merge small local subtrees into single fronts
+    if( ctrl.relaxSize > 0 )
+        Amalgamate
+        ( sepTree, eTree, info.amalgStats, ctrl.relaxSize,
+          ctrl.relaxFraction );
+
     // Run the symbolic analysis
     SymmetricAnalysis( eTree, info, ctrl.storeFactRecvInds );
 }
@@ -446,6 +452,15 @@ int Bisect
   std::vector<int>& perm, const BisectCtrl& ctrl )
 {
     DEBUG_ONLY(CallStackEntry cse("Bisect"))
+    if( ctrl.native )
+    {
+        std::vector<int> sizes;
+        const int sepSize = MultilevelBisect( graph, perm, sizes, ctrl );
+        DEBUG_ONLY(EnsurePermutation( perm ))
+        BuildChildrenFromPerm
+        ( graph, perm, sizes[0], leftChild, sizes[1], rightChild );
+        return sepSize;
+    }
 #ifdef EL_HAVE_METIS
     // METIS assumes that there are no self-connections or connections 
     // outside the sources, so we must manually remove them from our graph
@@ -517,6 +532,18 @@ int Bisect
   const BisectCtrl& ctrl )
 {
     DEBUG_ONLY(CallStackEntry cse("Bisect"))
+    if( ctrl.native )
+    {
+        if( mpi::Size( graph.Comm() ) == 1 )
+            LogicError
+            ("This routine assumes at least two processes are used, "
+             "otherwise one child will be lost");
+        std::vector<int> sizes;
+        const int sepSize = MultilevelBisect( graph, perm, sizes, ctrl );
+        DEBUG_ONLY(EnsurePermutation( perm ))
+        BuildChildFromPerm( graph, perm, sizes[0], sizes[1], onLeft, child );
+        return sepSize;
+    }
 #ifdef EL_HAVE_METIS
     mpi::Comm comm = graph.Comm();
     const int commSize = mpi::Size( comm );
@@ -909,7 +936,7 @@ void BuildChildFromPerm
     const int rightTeamBlocksize = rightChildSize / rightTeamSize;
 
     // Count how many rows we must send to each process 
-    std::vector<int> rowSendSizes( commSize, 0 );
+    std::vector<Int> rowSendSizes( commSize, 0 );
     for( int s=0; s<numLocalSources; ++s )
     {
         const int i = perm.GetLocal(s);
@@ -929,20 +956,20 @@ void BuildChildFromPerm
     }
 
     // Exchange the number of rows
-    std::vector<int> rowRecvSizes( commSize );
+    std::vector<Int> rowRecvSizes( commSize );
     mpi::AllToAll( &rowSendSizes[0], 1, &rowRecvSizes[0], 1, comm );
 
     // Prepare for the AllToAll to exchange the row indices and 
     // the number of column indices per row
-    int numSendRows=0;
-    std::vector<int> rowSendOffs( commSize );
+    Int numSendRows=0;
+    std::vector<Int> rowSendOffs( commSize );
     for( int q=0; q<commSize; ++q )
     {
         rowSendOffs[q] = numSendRows;
         numSendRows += rowSendSizes[q];
     }
-    int numRecvRows=0;
-    std::vector<int> rowRecvOffs( commSize );
+    Int numRecvRows=0;
+    std::vector<Int> rowRecvOffs( commSize );
     for( int q=0; q<commSize; ++q )
     {
         rowRecvOffs[q] = numRecvRows;
@@ -952,7 +979,7 @@ void BuildChildFromPerm
     // Pack the row indices and how many column entries there will be per row
     std::vector<int> rowSendLengths( numSendRows );
     std::vector<int> rowSendInds( numSendRows );
-    std::vector<int> offs = rowSendOffs;
+    std::vector<Int> offs = rowSendOffs;
     for( int s=0; s<numLocalSources; ++s )
     {
         const int i = perm.GetLocal(s);
@@ -989,9 +1016,9 @@ void BuildChildFromPerm
     SwapClear( rowSendInds );
 
     // Set up for sending the column indices
-    int numSendInds=0;
-    std::vector<int> indSendSizes( commSize, 0 );
-    std::vector<int> indSendOffs( commSize );
+    Int numSendInds=0;
+    std::vector<Int> indSendSizes( commSize, 0 );
+    std::vector<Int> indSendOffs( commSize );
     for( int q=0; q<commSize; ++q )
     {
         const int numRows = rowSendSizes[q];
@@ -1003,9 +1030,9 @@ void BuildChildFromPerm
         numSendInds += indSendSizes[q];
     }
     SwapClear( rowSendLengths );
-    int numRecvInds=0;
-    std::vector<int> indRecvSizes( commSize, 0 );
-    std::vector<int> indRecvOffs( commSize );
+    Int numRecvInds=0;
+    std::vector<Int> indRecvSizes( commSize, 0 );
+    std::vector<Int> indRecvOffs( commSize );
     for( int q=0; q<commSize; ++q )
     {
         const int numRows = rowRecvSizes[q];
@@ -1030,7 +1057,7 @@ void BuildChildFromPerm
             const int q = leftTeamOff + 
                 RowToProcess( i, leftTeamBlocksize, leftTeamSize );
 
-            int& off = offs[q];
+            Int& off = offs[q];
             const int numConnections = graph.NumConnections( s );
             const int localEdgeOff = graph.EdgeOffset( s );
             for( int j=0; j<numConnections; ++j )
@@ -1042,7 +1069,7 @@ void BuildChildFromPerm
                 RowToProcess
                 ( i-leftChildSize, rightTeamBlocksize, rightTeamSize );
                
-            int& off = offs[q];
+            Int& off = offs[q];
             const int numConnections = graph.NumConnections( s );
             const int localEdgeOff = graph.EdgeOffset( s );
             for( int j=0; j<numConnections; ++j )
@@ -1136,7 +1163,7 @@ BuildMap
 
     // Traverse local sepTree to count how many indices we should send the
     // final index for
-    std::vector<int> sendSizes( commSize, 0 );
+    std::vector<Int> sendSizes( commSize, 0 );
     for( int s=0; s<numLocal; ++s )
     {
         const SepOrLeaf& sepOrLeaf = *sepTree.localSepsAndLeaves[s];
@@ -1178,12 +1205,12 @@ BuildMap
 
     // Use a single-entry AllToAll to coordinate how many indices will be 
     // exchanges
-    std::vector<int> recvSizes( commSize );
+    std::vector<Int> recvSizes( commSize );
     mpi::AllToAll( &sendSizes[0], 1, &recvSizes[0], 1, comm );
 
     // Pack the reordered indices
     int numSends = 0;
-    std::vector<int> sendOffs( commSize );
+    std::vector<Int> sendOffs( commSize );
     for( int q=0; q<commSize; ++q )
     {
         sendOffs[q] = numSends;
@@ -1191,7 +1218,7 @@ BuildMap
     }
     std::vector<int> sendInds( numSends );
     std::vector<int> sendOrigInds( numSends );
-    std::vector<int> offs = sendOffs;
+    std::vector<Int> offs = sendOffs;
     for( int s=0; s<numLocal; ++s )
     {
         const SepOrLeaf& sepOrLeaf = *sepTree.localSepsAndLeaves[s];
@@ -1227,7 +1254,7 @@ BuildMap
 
     // Perform an AllToAll to exchange the reordered indices
     int numRecvs = 0;
-    std::vector<int> recvOffs( commSize );
+    std::vector<Int> recvOffs( commSize );
     for( int q=0; q<commSize; ++q )
     {
         recvOffs[q] = numRecvs;
@@ -35,7 +35,8 @@ ElError ElPermutationMetaClear( const ElPermutationMeta* meta )
     )
 }
 
-ElError ElPermutationMetaTotalSend( const ElPermutationMeta* meta, int* total )
+ElError ElPermutationMetaTotalSend
+( const ElPermutationMeta* meta, ElInt* total )
 {
     EL_TRY(
       int commSize;
@@ -44,7 +45,8 @@ ElError ElPermutationMetaTotalSend( const ElPermutationMeta* meta, int* total )
     )
 }
 
-ElError ElPermutationMetaTotalRecv( const ElPermutationMeta* meta, int* total )
+ElError ElPermutationMetaTotalRecv
+( const ElPermutationMeta* meta, ElInt* total )
 {
     EL_TRY(
       int commSize;
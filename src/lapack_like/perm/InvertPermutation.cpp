@@ -65,7 +65,7 @@ void InvertPermutation
 
     const mpi::Comm colComm = p.ColComm();
     const Int commSize = mpi::Size( colComm );
-    std::vector<int> sendCounts(commSize,0), sendDispls(commSize),
+    std::vector<Int> sendCounts(commSize,0), sendDispls(commSize),
                      recvCounts(commSize,0), recvDispls(commSize);
 
     // Compute the send counts
@@ -79,7 +79,7 @@ void InvertPermutation
     mpi::AllToAll( sendCounts.data(), 1, recvCounts.data(), 1, colComm );
 
     // Compute the displacements
-    int sendTotal=0, recvTotal=0;
+    Int sendTotal=0, recvTotal=0;
     for( Int q=0; q<commSize; ++q )
     {
         sendDispls[q] = sendTotal;
@@ -98,7 +98,7 @@ void PermuteRows( AbstractDistMatrix<T>& A, const PermutationMeta& oldMeta )
 
     // Fill vectors with the send data
     auto offsets = meta.sendDispls;
-    const int totalSend = meta.TotalSend();
+    const Int totalSend = meta.TotalSend();
     std::vector<T> sendData( mpi::Pad(totalSend) );
     const int numSends = meta.sendIdx.size();
     for( int send=0; send<numSends; ++send )
@@ -113,7 +113,7 @@ void PermuteRows( AbstractDistMatrix<T>& A, const PermutationMeta& oldMeta )
     }
 
     // Communicate all pivot rows
-    const int totalRecv = meta.TotalRecv();
+    const Int totalRecv = meta.TotalRecv();
     std::vector<T> recvData( mpi::Pad(totalRecv) );
     mpi::AllToAll
     ( sendData.data(), meta.sendCounts.data(), meta.sendDispls.data(),
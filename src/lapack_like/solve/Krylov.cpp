@@ -0,0 +1,150 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+#include "./Krylov/Util.hpp"
+#include "./Krylov/CG.hpp"
+#include "./Krylov/MINRES.hpp"
+#include "./Krylov/GMRES.hpp"
+#include "./Krylov/BiCGStab.hpp"
+
+namespace El {
+
+template<typename F>
+KrylovOperator<F> SparseOperator( const DistSparseMatrix<F>& A )
+{
+    DEBUG_ONLY(CallStackEntry cse("SparseOperator"))
+    return [&A]( const DistMultiVec<F>& X, DistMultiVec<F>& Y )
+    {
+        krylov::Shape( X, Y );
+        Zero( Y );
+        Multiply( NORMAL, F(1), A, X, F(0), Y );
+    };
+}
+
+template<typename F>
+KrylovOperator<F> JacobiPreconditioner( const DistSparseMatrix<F>& A )
+{
+    DEBUG_ONLY(CallStackEntry cse("JacobiPreconditioner"))
+    const Int firstLocalRow = A.FirstLocalRow();
+    const Int numLocalEntries = A.NumLocalEntries();
+    std::vector<F> diagInv( A.LocalHeight(), F(1) );
+    for( Int e=0; e<numLocalEntries; ++e )
+    {
+        const Int i = A.Row(e);
+        if( i == A.Col(e) && A.Value(e) != F(0) )
+            diagInv[i-firstLocalRow] = F(1)/A.Value(e);
+    }
+    return [diagInv]( const DistMultiVec<F>& X, DistMultiVec<F>& Y )
+    {
+        krylov::Shape( X, Y );
+        const Int localHeight = X.LocalHeight();
+        const Int width = X.Width();
+        for( Int j=0; j<width; ++j )
+        {
+            const F* XBuf = X.LockedMatrix().LockedBuffer(0,j);
+            F* YBuf = Y.Matrix().Buffer(0,j);
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                YBuf[iLoc] = diagInv[iLoc]*XBuf[iLoc];
+        }
+    };
+}
+
+template<typename F,typename FLow>
+KrylovOperator<F> LDLPreconditioner
+( const DistMap& inverseMap, const DistSymmInfo& info,
+  const DistSymmFrontTree<FLow>& L )
+{
+    DEBUG_ONLY(CallStackEntry cse("LDLPreconditioner"))
+    return [&inverseMap,&info,&L]
+           ( const DistMultiVec<F>& X, DistMultiVec<F>& Y )
+    {
+        DistMultiVec<FLow> YLow( X.Comm() );
+        Copy( X, YLow );
+        Solve( inverseMap, info, L, YLow, Max(YLow.Width(),Int(1)) );
+        Copy( YLow, Y );
+    };
+}
+
+template<typename F>
+void CG
+( const DistSparseMatrix<F>& A, const KrylovOperator<F>& M,
+  const DistMultiVec<F>& B, DistMultiVec<F>& X, KrylovStats& stats,
+  const KrylovCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CallStackEntry cse("CG"))
+    CG( SparseOperator(A), M, B, X, stats, ctrl );
+}
+
+template<typename F>
+void MINRES
+( const DistSparseMatrix<F>& A, const KrylovOperator<F>& M,
+  const DistMultiVec<F>& B, DistMultiVec<F>& X, KrylovStats& stats,
+  const KrylovCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CallStackEntry cse("MINRES"))
+    MINRES( SparseOperator(A), M, B, X, stats, ctrl );
+}
+
+template<typename F>
+void GMRES
+( const DistSparseMatrix<F>& A, const KrylovOperator<F>& M,
+  const DistMultiVec<F>& B, DistMultiVec<F>& X, KrylovStats& stats,
+  const KrylovCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CallStackEntry cse("GMRES"))
+    GMRES( SparseOperator(A), M, B, X, stats, ctrl );
+}
+
+template<typename F>
+void BiCGStab
+( const DistSparseMatrix<F>& A, const KrylovOperator<F>& M,
+  const DistMultiVec<F>& B, DistMultiVec<F>& X, KrylovStats& stats,
+  const KrylovCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CallStackEntry cse("BiCGStab"))
+    BiCGStab( SparseOperator(A), M, B, X, stats, ctrl );
+}
+
+#define PROTO_METHOD(F,METHOD) \
+  template void METHOD \
+  ( const KrylovOperator<F>& A, const KrylovOperator<F>& M, \
+    const DistMultiVec<F>& B, DistMultiVec<F>& X, KrylovStats& stats, \
+    const KrylovCtrl<Base<F>>& ctrl ); \
+  template void METHOD \
+  ( const DistSparseMatrix<F>& A, const KrylovOperator<F>& M, \
+    const DistMultiVec<F>& B, DistMultiVec<F>& X, KrylovStats& stats, \
+    const KrylovCtrl<Base<F>>& ctrl );
+
+#define PROTO_LDL(F,FLow) \
+  template KrylovOperator<F> LDLPreconditioner<F,FLow> \
+  ( const DistMap& inverseMap, const DistSymmInfo& info, \
+    const DistSymmFrontTree<FLow>& L );
+
+#define PROTO(F) \
+  template KrylovOperator<F> SparseOperator( const DistSparseMatrix<F>& A ); \
+  template KrylovOperator<F> JacobiPreconditioner \
+  ( const DistSparseMatrix<F>& A ); \
+  PROTO_LDL(F,F) \
+  PROTO_METHOD(F,CG) \
+  PROTO_METHOD(F,MINRES) \
+  PROTO_METHOD(F,GMRES) \
+  PROTO_METHOD(F,BiCGStab)
+
+#define PROTO_DOUBLE \
+  PROTO(double) \
+  PROTO_LDL(double,float)
+#define PROTO_COMPLEX_DOUBLE \
+  PROTO(Complex<double>) \
+  PROTO_LDL(Complex<double>,Complex<float>)
+
+#define EL_NO_INT_PROTO
+#include "El/macros/Instantiate.h"
+
+} // namespace El
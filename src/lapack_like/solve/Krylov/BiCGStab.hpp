@@ -0,0 +1,170 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_KRYLOV_BICGSTAB_HPP
+#define EL_KRYLOV_BICGSTAB_HPP
+
+namespace El {
+
+// Right-preconditioned BiCGStab with two reductions per iteration: the first
+// computes (rHat,v) along with || r ||_2^2 (which is thus checked for
+// convergence one half-step late), and the second computes every inner
+// product involving s and t = A inv(M) s, from which
+//
+//     (rHat,r) = (rHat,s) - omega (rHat,t)
+//
+// follows without a third reduction.
+
+template<typename F>
+void BiCGStab
+( const KrylovOperator<F>& A, const KrylovOperator<F>& M,
+  const DistMultiVec<F>& B, DistMultiVec<F>& X, KrylovStats& stats,
+  const KrylovCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CallStackEntry cse("BiCGStab"))
+    typedef Base<F> Real;
+    mpi::Comm comm = B.Comm();
+    const Int width = B.Width();
+    const Int localHeight = B.LocalHeight();
+
+    Matrix<Real> bNorms;
+    ColumnNorms( B, bNorms );
+    krylov::InitialGuess( B, X );
+
+    DistMultiVec<F> R(comm), RHat(comm), P(comm), PHat(comm), V(comm),
+                    S(comm), SHat(comm), T(comm);
+    krylov::Residual( A, B, X, R );
+    krylov::Assign( R, RHat );
+    krylov::Assign( R, P );
+    krylov::Shape( B, S );
+
+    std::vector<bool> active( width, true );
+    std::vector<Real> relResids( width );
+    std::vector<F> rhos( width ), alphas( width ), dots( 5*width );
+    stats.numIts = 0;
+    stats.history.clear();
+    while( true )
+    {
+        // phat := inv(M) p, v := A phat
+        krylov::ApplyPrecond( M, P, PHat );
+        A( PHat, V );
+        for( Int j=0; j<width; ++j )
+        {
+            dots[2*j  ] = krylov::LocalDot( RHat, V, j );
+            dots[2*j+1] = krylov::LocalDot( R, R, j );
+        }
+        mpi::AllReduce( dots.data(), 2*width, comm );
+
+        bool anyActive = false;
+        for( Int j=0; j<width; ++j )
+        {
+            if( !active[j] )
+                continue;
+            const F sigma = dots[2*j];
+            const Real rNormSq = RealPart(dots[2*j+1]);
+            relResids[j] = krylov::Relative( Sqrt(rNormSq), bNorms.Get(j,0) );
+            if( stats.numIts == 0 )
+                rhos[j] = rNormSq;
+            // Freeze converged columns and those which broke down
+            if( relResids[j] <= ctrl.relTol ||
+                sigma == F(0) || rhos[j] == F(0) )
+                active[j] = false;
+            anyActive = anyActive || active[j];
+        }
+        krylov::Record( "BiCGStab", relResids, stats, ctrl, comm );
+        if( !anyActive || stats.numIts == ctrl.maxIts )
+            break;
+
+        // s := r - alpha v, shat := inv(M) s, t := A shat
+        for( Int j=0; j<width; ++j )
+        {
+            if( !active[j] )
+                continue;
+            alphas[j] = rhos[j]/dots[2*j];
+            const F* RBuf = R.LockedMatrix().LockedBuffer(0,j);
+            const F* VBuf = V.LockedMatrix().LockedBuffer(0,j);
+            F* SBuf = S.Matrix().Buffer(0,j);
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                SBuf[iLoc] = RBuf[iLoc] - alphas[j]*VBuf[iLoc];
+        }
+        krylov::ApplyPrecond( M, S, SHat );
+        A( SHat, T );
+        for( Int j=0; j<width; ++j )
+        {
+            dots[5*j  ] = krylov::LocalDot( T, S, j );
+            dots[5*j+1] = krylov::LocalDot( T, T, j );
+            dots[5*j+2] = krylov::LocalDot( RHat, S, j );
+            dots[5*j+3] = krylov::LocalDot( RHat, T, j );
+            dots[5*j+4] = krylov::LocalDot( S, S, j );
+        }
+        mpi::AllReduce( dots.data(), 5*width, comm );
+
+        anyActive = false;
+        for( Int j=0; j<width; ++j )
+        {
+            if( !active[j] )
+                continue;
+            const F tsDot = dots[5*j];
+            const Real tNormSq = RealPart(dots[5*j+1]);
+            const Real sNormSq = RealPart(dots[5*j+4]);
+            const F alpha = alphas[j];
+            krylov::ColumnAxpy( alpha, PHat, X, j );
+
+            // Stop at the half-step if s is already small enough (or if the
+            // stabilizing step would break down)
+            const Real sRel =
+                krylov::Relative( Sqrt(sNormSq), bNorms.Get(j,0) );
+            const F omega =
+                ( tNormSq == Real(0) ? F(0) : tsDot/tNormSq );
+            if( sRel <= ctrl.relTol || omega == F(0) )
+            {
+                F* RBuf = R.Matrix().Buffer(0,j);
+                const F* SBuf = S.LockedMatrix().LockedBuffer(0,j);
+                for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                    RBuf[iLoc] = SBuf[iLoc];
+                relResids[j] = sRel;
+                active[j] = false;
+                continue;
+            }
+
+            // x += omega shat, r := s - omega t
+            krylov::ColumnAxpy( omega, SHat, X, j );
+            F* RBuf = R.Matrix().Buffer(0,j);
+            const F* SBuf = S.LockedMatrix().LockedBuffer(0,j);
+            const F* TBuf = T.LockedMatrix().LockedBuffer(0,j);
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                RBuf[iLoc] = SBuf[iLoc] - omega*TBuf[iLoc];
+
+            // p := r + beta (p - omega v)
+            const F rho = dots[5*j+2] - omega*dots[5*j+3];
+            const F beta = (rho/rhos[j])*(alpha/omega);
+            rhos[j] = rho;
+            F* PBuf = P.Matrix().Buffer(0,j);
+            const F* VBuf = V.LockedMatrix().LockedBuffer(0,j);
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                PBuf[iLoc] = RBuf[iLoc] + beta*(PBuf[iLoc]-omega*VBuf[iLoc]);
+            anyActive = true;
+        }
+        ++stats.numIts;
+        if( !anyActive )
+        {
+            krylov::Record( "BiCGStab", relResids, stats, ctrl, comm );
+            break;
+        }
+    }
+
+    stats.converged = true;
+    for( Int j=0; j<width; ++j )
+        if( relResids[j] > ctrl.relTol )
+            stats.converged = false;
+}
+
+} // namespace El
+
+#endif // ifndef EL_KRYLOV_BICGSTAB_HPP
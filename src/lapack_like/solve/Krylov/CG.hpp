@@ -0,0 +1,127 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_KRYLOV_CG_HPP
+#define EL_KRYLOV_CG_HPP
+
+namespace El {
+
+// The Chronopoulos/Gear formulation of preconditioned CG, which computes
+//
+//     gamma := (r,u), delta := (w,u), with u := inv(M) r and w := A u,
+//
+// in a single reduction and recovers the step length from
+//
+//     alpha := gamma / (delta - beta gamma / alphaOld),
+//
+// where the search direction p and s = A p are updated by recurrences.
+
+template<typename F>
+void CG
+( const KrylovOperator<F>& A, const KrylovOperator<F>& M,
+  const DistMultiVec<F>& B, DistMultiVec<F>& X, KrylovStats& stats,
+  const KrylovCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CallStackEntry cse("CG"))
+    typedef Base<F> Real;
+    mpi::Comm comm = B.Comm();
+    const Int width = B.Width();
+
+    Matrix<Real> bNorms;
+    ColumnNorms( B, bNorms );
+    krylov::InitialGuess( B, X );
+
+    DistMultiVec<F> R(comm), U(comm), W(comm), P(comm), S(comm);
+    krylov::Residual( A, B, X, R );
+    krylov::Shape( B, P );
+    krylov::Shape( B, S );
+    Zero( P );
+    Zero( S );
+
+    std::vector<bool> active( width, true );
+    std::vector<Real> relResids( width ), gammas( width ), alphas( width );
+    std::vector<F> dots( 3*width );
+    stats.numIts = 0;
+    stats.history.clear();
+    while( true )
+    {
+        krylov::ApplyPrecond( M, R, U );
+        A( U, W );
+        for( Int j=0; j<width; ++j )
+        {
+            dots[3*j  ] = krylov::LocalDot( R, U, j );
+            dots[3*j+1] = krylov::LocalDot( W, U, j );
+            dots[3*j+2] = krylov::LocalDot( R, R, j );
+        }
+        mpi::AllReduce( dots.data(), 3*width, comm );
+
+        for( Int j=0; j<width; ++j )
+            if( active[j] )
+                relResids[j] =
+                    krylov::Relative
+                    ( Sqrt(RealPart(dots[3*j+2])), bNorms.Get(j,0) );
+        krylov::Record( "CG", relResids, stats, ctrl, comm );
+
+        bool anyActive = false;
+        for( Int j=0; j<width; ++j )
+        {
+            // Freeze converged columns as well as those for which the
+            // preconditioned operator was found not to be positive-definite
+            const Real gamma = RealPart(dots[3*j]);
+            const Real delta = RealPart(dots[3*j+1]);
+            if( relResids[j] <= ctrl.relTol || !(gamma > Real(0)) )
+                active[j] = false;
+            else if( stats.numIts > 0 &&
+                     !(delta-gamma*gamma/(gammas[j]*alphas[j]) > Real(0)) )
+                active[j] = false;
+            else if( stats.numIts == 0 && !(delta > Real(0)) )
+                active[j] = false;
+            anyActive = anyActive || active[j];
+        }
+        if( !anyActive || stats.numIts == ctrl.maxIts )
+            break;
+
+        for( Int j=0; j<width; ++j )
+        {
+            if( !active[j] )
+                continue;
+            const Real gamma = RealPart(dots[3*j]);
+            const Real delta = RealPart(dots[3*j+1]);
+            Real alpha, beta;
+            if( stats.numIts == 0 )
+            {
+                beta = 0;
+                alpha = gamma/delta;
+            }
+            else
+            {
+                beta = gamma/gammas[j];
+                alpha = gamma/(delta-beta*gamma/alphas[j]);
+            }
+            gammas[j] = gamma;
+            alphas[j] = alpha;
+
+            // p := u + beta p, s := w + beta s, x += alpha p, r -= alpha s
+            krylov::ColumnXpby( U, F(beta), P, j );
+            krylov::ColumnXpby( W, F(beta), S, j );
+            krylov::ColumnAxpy( F(alpha), P, X, j );
+            krylov::ColumnAxpy( F(-alpha), S, R, j );
+        }
+        ++stats.numIts;
+    }
+
+    stats.converged = true;
+    for( Int j=0; j<width; ++j )
+        if( relResids[j] > ctrl.relTol )
+            stats.converged = false;
+}
+
+} // namespace El
+
+#endif // ifndef EL_KRYLOV_CG_HPP
@@ -0,0 +1,251 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_KRYLOV_GMRES_HPP
+#define EL_KRYLOV_GMRES_HPP
+
+namespace El {
+
+// Restarted flexible GMRES with right preconditioning, so that the residual
+// estimates are of the original system and the preconditioner may vary
+// between iterations (e.g., a factorization applied in a lower precision).
+//
+// The basis vectors are stored locally, with vector k of column j in column
+// k*width+j, and are orthogonalized with two passes of classical
+// Gram-Schmidt. The second pass also computes || w ||_2^2, so that the norm
+// of the orthogonalized vector follows from the Pythagorean theorem and each
+// iteration needs only two reductions (a third is only needed if the
+// orthogonalization removed most of the vector, where the subtraction would
+// lose accuracy).
+
+template<typename F>
+void GMRES
+( const KrylovOperator<F>& A, const KrylovOperator<F>& M,
+  const DistMultiVec<F>& B, DistMultiVec<F>& X, KrylovStats& stats,
+  const KrylovCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CallStackEntry cse("GMRES"))
+    typedef Base<F> Real;
+    mpi::Comm comm = B.Comm();
+    const Int height = B.Height();
+    const Int width = B.Width();
+    const Int localHeight = B.LocalHeight();
+    const Int restart = Max( ctrl.restart, Int(1) );
+
+    Matrix<Real> bNorms, norms;
+    ColumnNorms( B, bNorms );
+    krylov::InitialGuess( B, X );
+
+    DistMultiVec<F> R(comm), V(comm), Z(comm), W(comm);
+    V.Resize( height, width );
+    Matrix<F> VBasis, ZBasis, g, s, y;
+    Matrix<Real> c;
+    std::vector<Matrix<F>> H( width );
+    std::vector<F> dots;
+    std::vector<bool> active( width );
+    std::vector<Real> relResids( width );
+    std::vector<Int> lengths( width );
+    stats.numIts = 0;
+    stats.history.clear();
+    while( true )
+    {
+        // Restart from the true residual, which replaces the estimate from
+        // the last iteration of the previous cycle in the history
+        krylov::Residual( A, B, X, R );
+        ColumnNorms( R, norms );
+        bool anyActive = false;
+        for( Int j=0; j<width; ++j )
+        {
+            relResids[j] = krylov::Relative( norms.Get(j,0), bNorms.Get(j,0) );
+            active[j] = ( relResids[j] > ctrl.relTol );
+            anyActive = anyActive || active[j];
+        }
+        if( stats.numIts == 0 )
+            krylov::Record( "GMRES", relResids, stats, ctrl, comm );
+        else
+        {
+            Real maxRel = 0;
+            for( Int j=0; j<width; ++j )
+                maxRel = Max( maxRel, relResids[j] );
+            stats.history.back() = double(maxRel);
+        }
+        if( !anyActive || stats.numIts >= ctrl.maxIts )
+            break;
+
+        Zeros( VBasis, localHeight, (restart+1)*width );
+        Zeros( ZBasis, localHeight, restart*width );
+        Zeros( g, restart+1, width );
+        Zeros( c, restart, width );
+        Zeros( s, restart, width );
+        for( Int j=0; j<width; ++j )
+        {
+            Zeros( H[j], restart+1, restart );
+            lengths[j] = 0;
+            if( !active[j] )
+                continue;
+            const Real beta = norms.Get(j,0);
+            g.Set( 0, j, beta );
+            const F* RBuf = R.LockedMatrix().LockedBuffer(0,j);
+            F* VBuf = VBasis.Buffer(0,j);
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                VBuf[iLoc] = RBuf[iLoc]/beta;
+        }
+
+        Int k=0;
+        while( k < restart && stats.numIts < ctrl.maxIts && anyActive )
+        {
+            // z_k := inv(M) v_k, w := A z_k
+            V.Matrix() = VBasis( IR(0,localHeight), IR(k*width,(k+1)*width) );
+            krylov::ApplyPrecond( M, V, Z );
+            auto ZBasisk = ZBasis( IR(0,localHeight), IR(k*width,(k+1)*width) );
+            ZBasisk = Z.LockedMatrix();
+            A( Z, W );
+
+            // Two passes of classical Gram-Schmidt, where the second also
+            // computes || w ||_2^2
+            Real minRatio = 1;
+            std::vector<Real> wNorms( width );
+            for( Int pass=0; pass<2; ++pass )
+            {
+                const Int numDots = ( pass==0 ? k+1 : k+2 );
+                dots.assign( numDots*width, F(0) );
+                for( Int j=0; j<width; ++j )
+                {
+                    if( !active[j] )
+                        continue;
+                    const F* WBuf = W.LockedMatrix().LockedBuffer(0,j);
+                    for( Int l=0; l<=k; ++l )
+                    {
+                        const F* VBuf = VBasis.LockedBuffer(0,l*width+j);
+                        F dot = 0;
+                        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                            dot += Conj(VBuf[iLoc])*WBuf[iLoc];
+                        dots[j*numDots+l] = dot;
+                    }
+                    if( pass == 1 )
+                        dots[j*numDots+k+1] = krylov::LocalDot( W, W, j );
+                }
+                mpi::AllReduce( dots.data(), numDots*width, comm );
+
+                for( Int j=0; j<width; ++j )
+                {
+                    if( !active[j] )
+                        continue;
+                    F* WBuf = W.Matrix().Buffer(0,j);
+                    Real projNormSq = 0;
+                    for( Int l=0; l<=k; ++l )
+                    {
+                        const F dot = dots[j*numDots+l];
+                        H[j].Update( l, k, dot );
+                        projNormSq += RealPart(Conj(dot)*dot);
+                        const F* VBuf = VBasis.LockedBuffer(0,l*width+j);
+                        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                            WBuf[iLoc] -= dot*VBuf[iLoc];
+                    }
+                    if( pass == 1 )
+                    {
+                        const Real wNormSq = RealPart(dots[j*numDots+k+1]);
+                        const Real newNormSq = wNormSq - projNormSq;
+                        wNorms[j] = Sqrt(Max(newNormSq,Real(0)));
+                        if( wNormSq > Real(0) )
+                            minRatio = Min( minRatio, newNormSq/wNormSq );
+                    }
+                }
+            }
+            if( minRatio < Real(1)/Real(2) )
+            {
+                ColumnNorms( W, norms );
+                for( Int j=0; j<width; ++j )
+                    wNorms[j] = norms.Get(j,0);
+            }
+
+            anyActive = false;
+            for( Int j=0; j<width; ++j )
+            {
+                if( !active[j] )
+                    continue;
+                const Real wNorm = wNorms[j];
+                H[j].Set( k+1, k, wNorm );
+                if( wNorm != Real(0) )
+                {
+                    const F* WBuf = W.LockedMatrix().LockedBuffer(0,j);
+                    F* VBuf = VBasis.Buffer(0,(k+1)*width+j);
+                    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                        VBuf[iLoc] = WBuf[iLoc]/wNorm;
+                }
+
+                // Apply the previous rotations to the new column of H and
+                // then eliminate its subdiagonal entry
+                for( Int i=0; i<k; ++i )
+                {
+                    const Real cij = c.Get(i,j);
+                    const F sij = s.Get(i,j);
+                    const F eta0 = H[j].Get(i,k);
+                    const F eta1 = H[j].Get(i+1,k);
+                    H[j].Set( i,   k,  cij*eta0 + sij*eta1 );
+                    H[j].Set( i+1, k, -Conj(sij)*eta0 + cij*eta1 );
+                }
+                Real ckj;
+                F skj;
+                const F rho =
+                    lapack::Givens
+                    ( H[j].Get(k,k), H[j].Get(k+1,k), &ckj, &skj );
+                H[j].Set( k,   k, rho );
+                H[j].Set( k+1, k, 0 );
+                c.Set( k, j, ckj );
+                s.Set( k, j, skj );
+                const F gamma = g.Get(k,j);
+                g.Set( k,   j, ckj*gamma );
+                g.Set( k+1, j, -Conj(skj)*gamma );
+
+                lengths[j] = k+1;
+                relResids[j] =
+                    krylov::Relative( Abs(g.Get(k+1,j)), bNorms.Get(j,0) );
+                if( relResids[j] <= ctrl.relTol )
+                    active[j] = false;
+                anyActive = anyActive || active[j];
+            }
+            ++k;
+            ++stats.numIts;
+            krylov::Record( "GMRES", relResids, stats, ctrl, comm );
+        }
+
+        // x := x + Z y, where H(0:k,0:k) y = g(0:k)
+        for( Int j=0; j<width; ++j )
+        {
+            const Int length = lengths[j];
+            Zeros( y, length, 1 );
+            for( Int i=length-1; i>=0; --i )
+            {
+                F eta = g.Get(i,j);
+                for( Int l=i+1; l<length; ++l )
+                    eta -= H[j].Get(i,l)*y.Get(l,0);
+                const F diag = H[j].Get(i,i);
+                y.Set( i, 0, ( diag == F(0) ? F(0) : eta/diag ) );
+            }
+            F* XBuf = X.Matrix().Buffer(0,j);
+            for( Int l=0; l<length; ++l )
+            {
+                const F eta = y.Get(l,0);
+                const F* ZBuf = ZBasis.LockedBuffer(0,l*width+j);
+                for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                    XBuf[iLoc] += eta*ZBuf[iLoc];
+            }
+        }
+    }
+
+    stats.converged = true;
+    for( Int j=0; j<width; ++j )
+        if( relResids[j] > ctrl.relTol )
+            stats.converged = false;
+}
+
+} // namespace El
+
+#endif // ifndef EL_KRYLOV_GMRES_HPP
@@ -0,0 +1,181 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_KRYLOV_MINRES_HPP
+#define EL_KRYLOV_MINRES_HPP
+
+namespace El {
+
+// The preconditioned MINRES of Paige and Saunders. The preconditioned Lanczos
+// process requires one reduction for the diagonal entry of the tridiagonal
+// matrix and a second for the M-norm of the next Lanczos vector, and the
+// residual norms, || r ||_M = sqrt(r^H inv(M) r), are available for free
+// from the QR factorization of the tridiagonal matrix.
+
+template<typename F>
+void MINRES
+( const KrylovOperator<F>& A, const KrylovOperator<F>& M,
+  const DistMultiVec<F>& B, DistMultiVec<F>& X, KrylovStats& stats,
+  const KrylovCtrl<Base<F>>& ctrl )
+{
+    DEBUG_ONLY(CallStackEntry cse("MINRES"))
+    typedef Base<F> Real;
+    mpi::Comm comm = B.Comm();
+    const Int width = B.Width();
+    const Int localHeight = B.LocalHeight();
+    const Real eps = lapack::MachineEpsilon<Real>();
+
+    krylov::InitialGuess( B, X );
+
+    DistMultiVec<F> MB(comm), R1(comm), R2(comm), Y(comm), V(comm),
+                    W(comm), W2(comm);
+    krylov::ApplyPrecond( M, B, MB );
+    krylov::Residual( A, B, X, R1 );
+    krylov::ApplyPrecond( M, R1, Y );
+    krylov::Assign( R1, R2 );
+    krylov::Shape( B, V );
+    krylov::Shape( B, W );
+    krylov::Shape( B, W2 );
+    Zero( W );
+    Zero( W2 );
+
+    // Compute the M-norms of b and the initial residual
+    std::vector<F> dots( 2*width );
+    for( Int j=0; j<width; ++j )
+    {
+        dots[2*j  ] = krylov::LocalDot( B, MB, j );
+        dots[2*j+1] = krylov::LocalDot( R1, Y, j );
+    }
+    mpi::AllReduce( dots.data(), 2*width, comm );
+
+    std::vector<bool> active( width, true );
+    std::vector<Real> bNorms( width ), relResids( width ),
+                      betas( width ), oldBetas( width, 0 ),
+                      dBars( width, 0 ), epsilons( width, 0 ),
+                      phiBars( width ), cs( width, -1 ), sn( width, 0 ),
+                      alphas( width );
+    stats.numIts = 0;
+    stats.history.clear();
+    bool anyActive = false;
+    for( Int j=0; j<width; ++j )
+    {
+        bNorms[j] = Sqrt(Max(RealPart(dots[2*j]),Real(0)));
+        betas[j] = Sqrt(Max(RealPart(dots[2*j+1]),Real(0)));
+        phiBars[j] = betas[j];
+        relResids[j] = krylov::Relative( betas[j], bNorms[j] );
+        if( relResids[j] <= ctrl.relTol || betas[j] == Real(0) )
+            active[j] = false;
+        anyActive = anyActive || active[j];
+    }
+    krylov::Record( "MINRES", relResids, stats, ctrl, comm );
+
+    while( anyActive && stats.numIts < ctrl.maxIts )
+    {
+        // v := y / beta, y := A v - (beta/oldBeta) r1, alpha := (v,y)
+        for( Int j=0; j<width; ++j )
+        {
+            if( !active[j] )
+                continue;
+            const F* YBuf = Y.LockedMatrix().LockedBuffer(0,j);
+            F* VBuf = V.Matrix().Buffer(0,j);
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                VBuf[iLoc] = YBuf[iLoc]/betas[j];
+        }
+        A( V, Y );
+        for( Int j=0; j<width; ++j )
+        {
+            dots[j] = 0;
+            if( !active[j] )
+                continue;
+            if( stats.numIts > 0 )
+                krylov::ColumnAxpy( F(-betas[j]/oldBetas[j]), R1, Y, j );
+            dots[j] = krylov::LocalDot( V, Y, j );
+        }
+        mpi::AllReduce( dots.data(), width, comm );
+        for( Int j=0; j<width; ++j )
+            alphas[j] = RealPart(dots[j]);
+
+        // y := y - (alpha/beta) r2, r1 := r2, r2 := y, y := inv(M) r2
+        for( Int j=0; j<width; ++j )
+        {
+            if( !active[j] )
+                continue;
+            krylov::ColumnAxpy( F(-alphas[j]/betas[j]), R2, Y, j );
+            F* R1Buf = R1.Matrix().Buffer(0,j);
+            F* R2Buf = R2.Matrix().Buffer(0,j);
+            const F* YBuf = Y.LockedMatrix().LockedBuffer(0,j);
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            {
+                R1Buf[iLoc] = R2Buf[iLoc];
+                R2Buf[iLoc] = YBuf[iLoc];
+            }
+        }
+        krylov::ApplyPrecond( M, R2, Y );
+        for( Int j=0; j<width; ++j )
+            dots[j] = ( active[j] ? krylov::LocalDot( R2, Y, j ) : F(0) );
+        mpi::AllReduce( dots.data(), width, comm );
+
+        // Apply the previous rotation to the new column of the tridiagonal
+        // matrix, form the next rotation, and update the solution
+        anyActive = false;
+        for( Int j=0; j<width; ++j )
+        {
+            if( !active[j] )
+                continue;
+            const Real betaSquared = RealPart(dots[j]);
+            oldBetas[j] = betas[j];
+            betas[j] = Sqrt(Max(betaSquared,Real(0)));
+
+            const Real oldEpsilon = epsilons[j];
+            const Real delta = cs[j]*dBars[j] + sn[j]*alphas[j];
+            const Real gammaBar = sn[j]*dBars[j] - cs[j]*alphas[j];
+            epsilons[j] = sn[j]*betas[j];
+            dBars[j] = -cs[j]*betas[j];
+            const Real gamma =
+                Max( lapack::SafeNorm( gammaBar, betas[j] ), eps );
+            cs[j] = gammaBar/gamma;
+            sn[j] = betas[j]/gamma;
+            const Real phi = cs[j]*phiBars[j];
+            phiBars[j] = sn[j]*phiBars[j];
+
+            // w := (v - oldEpsilon w2 - delta w)/gamma, w2 := w, x += phi w
+            const F* VBuf = V.LockedMatrix().LockedBuffer(0,j);
+            F* WBuf = W.Matrix().Buffer(0,j);
+            F* W2Buf = W2.Matrix().Buffer(0,j);
+            F* XBuf = X.Matrix().Buffer(0,j);
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            {
+                const F wOld = WBuf[iLoc];
+                const F wNew =
+                    (VBuf[iLoc]-oldEpsilon*W2Buf[iLoc]-delta*wOld)/gamma;
+                W2Buf[iLoc] = wOld;
+                WBuf[iLoc] = wNew;
+                XBuf[iLoc] += phi*wNew;
+            }
+
+            relResids[j] = krylov::Relative( phiBars[j], bNorms[j] );
+            // A nonpositive beta signals either an invariant subspace (and
+            // hence the exact solution) or an indefinite preconditioner
+            if( relResids[j] <= ctrl.relTol || !(betaSquared > Real(0)) )
+                active[j] = false;
+            anyActive = anyActive || active[j];
+        }
+        ++stats.numIts;
+        krylov::Record( "MINRES", relResids, stats, ctrl, comm );
+    }
+
+    stats.converged = true;
+    for( Int j=0; j<width; ++j )
+        if( relResids[j] > ctrl.relTol )
+            stats.converged = false;
+}
+
+} // namespace El
+
+#endif // ifndef EL_KRYLOV_MINRES_HPP
@@ -0,0 +1,129 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_KRYLOV_UTIL_HPP
+#define EL_KRYLOV_UTIL_HPP
+
+namespace El {
+namespace krylov {
+
+// Give Y the communicator and dimensions of X, avoiding duplicating the
+// communicator when the existing one is already equivalent
+template<typename F,typename T>
+void Shape( const DistMultiVec<F>& X, DistMultiVec<T>& Y )
+{
+    if( !mpi::Congruent( X.Comm(), Y.Comm() ) )
+        Y.SetComm( X.Comm() );
+    if( Y.Height() != X.Height() || Y.Width() != X.Width() )
+        Y.Resize( X.Height(), X.Width() );
+}
+
+// Y := X
+template<typename F>
+void Assign( const DistMultiVec<F>& X, DistMultiVec<F>& Y )
+{
+    Shape( X, Y );
+    Y.Matrix() = X.LockedMatrix();
+}
+
+// Y := inv(M) X, where an empty M is the identity
+template<typename F>
+void ApplyPrecond
+( const KrylovOperator<F>& M, const DistMultiVec<F>& X, DistMultiVec<F>& Y )
+{
+    if( M )
+        M( X, Y );
+    else
+        Assign( X, Y );
+}
+
+// The contribution of our local rows to X(:,j)^H Y(:,j)
+template<typename F>
+F LocalDot( const DistMultiVec<F>& X, const DistMultiVec<F>& Y, Int j )
+{
+    const Int localHeight = X.LocalHeight();
+    const F* XBuf = X.LockedMatrix().LockedBuffer(0,j);
+    const F* YBuf = Y.LockedMatrix().LockedBuffer(0,j);
+    F dot = 0;
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        dot += Conj(XBuf[iLoc])*YBuf[iLoc];
+    return dot;
+}
+
+// Y(:,j) := alpha X(:,j) + Y(:,j)
+template<typename F>
+void ColumnAxpy( F alpha, const DistMultiVec<F>& X, DistMultiVec<F>& Y, Int j )
+{
+    const Int localHeight = X.LocalHeight();
+    const F* XBuf = X.LockedMatrix().LockedBuffer(0,j);
+    F* YBuf = Y.Matrix().Buffer(0,j);
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        YBuf[iLoc] += alpha*XBuf[iLoc];
+}
+
+// Y(:,j) := X(:,j) + beta Y(:,j)
+template<typename F>
+void ColumnXpby( const DistMultiVec<F>& X, F beta, DistMultiVec<F>& Y, Int j )
+{
+    const Int localHeight = X.LocalHeight();
+    const F* XBuf = X.LockedMatrix().LockedBuffer(0,j);
+    F* YBuf = Y.Matrix().Buffer(0,j);
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        YBuf[iLoc] = XBuf[iLoc] + beta*YBuf[iLoc];
+}
+
+// R := B - A X
+template<typename F>
+void Residual
+( const KrylovOperator<F>& A, const DistMultiVec<F>& B,
+  const DistMultiVec<F>& X, DistMultiVec<F>& R )
+{
+    A( X, R );
+    Scale( F(-1), R );
+    Axpy( F(1), B, R );
+}
+
+// Use X as the initial guess if it matches B and zero otherwise
+template<typename F>
+void InitialGuess( const DistMultiVec<F>& B, DistMultiVec<F>& X )
+{
+    const bool matches =
+        X.Height() == B.Height() && X.Width() == B.Width() &&
+        mpi::Congruent( X.Comm(), B.Comm() );
+    if( !matches )
+    {
+        Shape( B, X );
+        Zero( X );
+    }
+}
+
+template<typename Real>
+Real Relative( Real rNorm, Real bNorm )
+{ return ( bNorm == Real(0) ? rNorm : rNorm/bNorm ); }
+
+// Append the largest relative residual to the convergence history
+template<typename Real>
+Real Record
+( const std::string& method, const std::vector<Real>& relResids,
+  KrylovStats& stats, const KrylovCtrl<Real>& ctrl, mpi::Comm comm )
+{
+    Real maxRel = 0;
+    for( auto relResid : relResids )
+        maxRel = Max( maxRel, relResid );
+    stats.history.push_back( double(maxRel) );
+    if( ctrl.progress && mpi::Rank(comm) == 0 )
+        std::cout << "  " << method << " iteration " << stats.numIts
+                  << ": max relative residual " << maxRel << std::endl;
+    return maxRel;
+}
+
+} // namespace krylov
+} // namespace El
+
+#endif // ifndef EL_KRYLOV_UTIL_HPP
@@ -176,7 +176,7 @@ RandomizedSignDivide
         if( part.value <= tol || it == ctrl.maxInnerIts )
             break;
         else
-            A = V;
+            A = std::move(V);
     }
     return part;
 }
@@ -244,7 +244,7 @@ RandomizedSignDivide
         if( part.value <= tol || it == ctrl.maxInnerIts )
             break;
         else
-            A = V;
+            A = std::move(V);
     }
     return part;
 }
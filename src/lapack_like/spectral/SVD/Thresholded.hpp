@@ -67,7 +67,7 @@ inline void TallAbsoluteThresholded
     // NOTE: A (potentially better) alternative would be to compute the norm of
     //       each column of A and normalize via it, as it might vary slightly
     //       from the corresponding computed singular value.
-    A = Y;
+    A = std::move(Y);
     for( Int j=0; j<k; ++j )
     {
         const Real sigma = s.Get( j, 0 );
@@ -122,7 +122,7 @@ inline void TallRelativeThresholded
     // NOTE: A (potentially better) alternative would be to compute the norm of
     //       each column of A and normalize via it, as it might vary slightly
     //       from the corresponding computed singular value.
-    A = Y;
+    A = std::move(Y);
     for( Int j=0; j<k; ++j )
     {
         const Real sigma = s.Get( j, 0 );
@@ -205,7 +205,7 @@ TallAbsoluteThresholded
     // NOTE: A (potentially better) alternative would be to compute the norm of
     //       each column of A and normalize via it, as it might vary slightly
     //       from the corresponding computed singular value.
-    A = Y;
+    A = std::move(Y);
     {
         DistMatrix<Real,MR,STAR> s_MR_STAR(g);
         s_MR_STAR.AlignWith( A.DistData() );
@@ -275,7 +275,7 @@ TallRelativeThresholded
     // NOTE: A (potentially better) alternative would be to compute the norm of
     //       each column of A and normalize via it, as it might vary slightly
     //       from the corresponding computed singular value.
-    A = Y;
+    A = std::move(Y);
     {
         DistMatrix<Real,MR,STAR> s_MR_STAR(g);
         s_MR_STAR.AlignWith( A.DistData() );
@@ -368,7 +368,7 @@ TallAbsoluteThresholded
     // NOTE: A (potentially better) alternative would be to compute the norm of
     //       each column of A and normalize via it, as it might vary slightly
     //       from the corresponding computed singular value.
-    A = Y;
+    A = std::move(Y);
     {
         const Int localHeight = A.LocalHeight();
         for( Int j=0; j<k; ++j )
@@ -438,7 +438,7 @@ TallRelativeThresholded
     // NOTE: A (potentially better) alternative would be to compute the norm of
     //       each column of A and normalize via it, as it might vary slightly
     //       from the corresponding computed singular value.
-    A = Y;
+    A = std::move(Y);
     {
         const Int localHeight = A.LocalHeight();
         for( Int j=0; j<k; ++j )
@@ -521,7 +521,7 @@ WideAbsoluteThresholded
         for( Int i=0; i<n; ++i )
             V.Set( i, j, V.Get(i,j)/sigma );
     }
-    A = U;
+    A = std::move(U);
 }
 
 template<typename F>
@@ -577,7 +577,7 @@ WideRelativeThresholded
         for( Int i=0; i<n; ++i )
             V.Set( i, j, V.Get(i,j)/sigma );
     }
-    A = U;
+    A = std::move(U);
 }
 
 template<typename F>
@@ -667,7 +667,7 @@ WideAbsoluteThresholded
                 V.SetLocal( iLoc, jLoc, V.GetLocal(iLoc,jLoc)/sigma );
         }
     }
-    A = U;
+    A = std::move(U);
 }
 
 template<typename F>
@@ -737,7 +737,7 @@ WideRelativeThresholded
                 V.SetLocal( iLoc, jLoc, V.GetLocal(iLoc,jLoc)/sigma );
         }
     }
-    A = U;
+    A = std::move(U);
 }
 
 template<typename F>
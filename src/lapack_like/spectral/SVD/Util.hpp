@@ -56,7 +56,7 @@ DivideAndConquerSVD( Matrix<F>& A, Matrix<Base<F>>& s, Matrix<F>& V )
     ( m, n, A.Buffer(), A.LDim(), s.Buffer(), U.Buffer(), U.LDim(),
       VAdj.Buffer(), VAdj.LDim() );
 
-    A = U;
+    A = std::move(U);
     Adjoint( VAdj, V );
 }
 
@@ -75,7 +75,7 @@ QRSVD( Matrix<F>& A, Matrix<Base<F>>& s, Matrix<F>& V )
     ( m, n, A.Buffer(), A.LDim(), s.Buffer(), U.Buffer(), U.LDim(),
       VAdj.Buffer(), VAdj.LDim() );
 
-    A = U;
+    A = std::move(U);
     Adjoint( VAdj, V );
 }
 
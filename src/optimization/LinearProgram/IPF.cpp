@@ -539,8 +539,10 @@ void IPF
         {
             NestedDissection( J.LockedDistGraph(), map, sepTree, info );
             map.FormInverse( invMap );
+            JFrontTree.Initialize( J, map, sepTree, info );
         }
-        JFrontTree.Initialize( J, map, sepTree, info );
+        else
+            JFrontTree.Refactor( J );
         LDL( info, JFrontTree, LDL_INTRAPIV_1D ); 
         dlNodal.Pull( invMap, info, dl );
         Solve( info, JFrontTree, dlNodal );
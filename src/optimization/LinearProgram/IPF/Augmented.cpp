@@ -127,7 +127,7 @@ void AugmentedKKT
 
     // Compute the number of entries to send to each process
     // =====================================================
-    std::vector<int> sendCounts(commSize,0);
+    std::vector<Int> sendCounts(commSize,0);
     // For placing A into the bottom-left corner
     // -----------------------------------------
     for( Int k=0; k<A.NumLocalEntries(); ++k )
@@ -143,14 +143,14 @@ void AugmentedKKT
         ++sendCounts[ J.RowOwner( k+x.FirstLocalRow() ) ];
     // Communicate to determine the number we receive from each process
     // ----------------------------------------------------------------
-    std::vector<int> recvCounts(commSize);
+    std::vector<Int> recvCounts(commSize);
     mpi::AllToAll( sendCounts.data(), 1, recvCounts.data(), 1, comm );
 
     // Convert the send/recv counts into offsets and total sizes
     // =========================================================
-    std::vector<int> sendOffsets, recvOffsets;
-    int totalSend = Scan( sendCounts, sendOffsets );
-    int totalRecv = Scan( recvCounts, recvOffsets );
+    std::vector<Int> sendOffsets, recvOffsets;
+    Int totalSend = Scan( sendCounts, sendOffsets );
+    Int totalRecv = Scan( recvCounts, recvOffsets );
 
     // Pack the triplets
     // =================
@@ -303,7 +303,7 @@ void AugmentedKKTRHS
 
     // Compute the number of entries to send to each process
     // =====================================================
-    std::vector<int> sendCounts(commSize), recvCounts(commSize);
+    std::vector<Int> sendCounts(commSize), recvCounts(commSize);
     for( Int q=0; q<commSize; ++q )
         sendCounts[q] = 0;
     for( Int k=0; k<yx.LocalHeight(); ++k )
@@ -314,9 +314,9 @@ void AugmentedKKTRHS
     
     // Convert the send/recv counts into offsets and total sizes
     // =========================================================
-    std::vector<int> sendOffsets, recvOffsets;
-    const int totalSend = Scan( sendCounts, sendOffsets );
-    const int totalRecv = Scan( recvCounts, recvOffsets );
+    std::vector<Int> sendOffsets, recvOffsets;
+    const Int totalSend = Scan( sendCounts, sendOffsets );
+    const Int totalRecv = Scan( recvCounts, recvOffsets );
 
     // Pack the triplets
     // =================
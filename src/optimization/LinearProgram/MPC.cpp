@@ -947,8 +947,10 @@ void MPC
         {
             NestedDissection( J.LockedDistGraph(), map, sepTree, info );
             map.FormInverse( invMap );
+            JFrontTree.Initialize( J, map, sepTree, info );
         }
-        JFrontTree.Initialize( J, map, sepTree, info );
+        else
+            JFrontTree.Refactor( J );
         LDL( info, JFrontTree, LDL_INTRAPIV_1D );
         dlNodal.Pull( invMap, info, dlAff );
         Solve( info, JFrontTree, dlNodal );
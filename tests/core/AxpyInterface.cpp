@@ -22,19 +22,28 @@ main( int argc, char* argv[] )
     {
         const Int m = 3*commSize;
         const Int n = 2*commSize;
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
 
         Grid g( comm );
 
+        DistMatrix<double> ATwoSided(g);
         for( Int k=0; k<50; ++k )
         {
+            // Alternate between the two-sided and one-sided backends
+            const AxpyBackend backend =
+                ( k % 2 == 0 ? AXPY_TWO_SIDED : AXPY_ONE_SIDED );
             if( commRank == 0 )
-                std::cout << "Iteration " << k << std::endl;
+                std::cout << "Iteration " << k
+                          << ( backend == AXPY_ONE_SIDED ?
+                               " (one-sided)" : " (two-sided)" ) << std::endl;
 
             DistMatrix<double> A(g);
             Zeros( A, m, n );
 
             AxpyInterface<double> interface;
-            interface.Attach( LOCAL_TO_GLOBAL, A );
+            interface.Attach( LOCAL_TO_GLOBAL, A, backend );
             Matrix<double> X( commSize, 1 );
             for( Int j=0; j<X.Width(); ++j )
                 for( Int i=0; i<commSize; ++i )
@@ -46,9 +55,21 @@ main( int argc, char* argv[] )
             }
             interface.Detach();
 
-            Print( A, "A" );
+            if( print )
+                Print( A, "A" );
+            if( backend == AXPY_TWO_SIDED )
+                ATwoSided = A;
+            else
+            {
+                DistMatrix<double> E( A );
+                Axpy( -1., ATwoSided, E );
+                const double ENorm = FrobeniusNorm( E );
+                if( commRank == 0 )
+                    std::cout << "|| A_one - A_two ||_F = " << ENorm
+                              << std::endl;
+            }
 
-            interface.Attach( GLOBAL_TO_LOCAL, A );
+            interface.Attach( GLOBAL_TO_LOCAL, A, backend );
             Matrix<double> Y;
             if( commRank == 0 )
             {
@@ -57,7 +78,7 @@ main( int argc, char* argv[] )
             }
             interface.Detach();
 
-            if( commRank == 0 )
+            if( commRank == 0 && print )
                 Print( Y, "Copy of global matrix on root process:" );
 
             // TODO: Check to ensure that the result is correct
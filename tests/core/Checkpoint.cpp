@@ -0,0 +1,125 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+int 
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+    const Int commSize = mpi::Size( comm );
+    
+    try
+    {
+        const Int m = Input("--height","height of matrix",100);
+        const Int n = Input("--width","width of matrix",80);
+        const Int colAlign = Input("--colAlign","column alignment",1);
+        const std::string basename = 
+            Input("--basename","basename of checkpoints",std::string("ckpt"));
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        // Checkpoint an aligned [MC,MR] matrix on the default grid
+        const Grid& grid = DefaultGrid();
+        DistMatrix<Complex<double>> A(grid);
+        A.AlignCols( colAlign % grid.Height() );
+        Uniform( A, m, n );
+        if( print )
+            Print( A, "A" );
+        Checkpoint( A, basename+"-dense" );
+
+        // Restart onto a 1 x p grid in a [VC,* ] distribution
+        const Grid flatGrid( comm, 1 );
+        DistMatrix<Complex<double>,VC,STAR> B(flatGrid);
+        Restart( B, basename+"-dense.ckpt" );
+        if( print )
+            Print( B, "B" );
+        DistMatrix<Complex<double>> BCopy(grid);
+        Copy( B, BCopy );
+        Axpy( Complex<double>(-1), A, BCopy );
+        const double denseError = FrobeniusNorm( BCopy );
+
+        // Restart onto the original grid and recover the alignment
+        DistMatrix<Complex<double>> C(grid);
+        Restart( C, basename+"-dense.ckpt" );
+        if( C.ColAlign() != A.ColAlign() )
+            LogicError("Alignment of the checkpoint was not recovered");
+
+        // Checkpoint a multivector and a sparse matrix
+        DistMultiVec<double> X( comm ), Y( comm );
+        Uniform( X, m, 3 );
+        Checkpoint( X, basename+"-multivec" );
+        Restart( Y, basename+"-multivec.ckpt" );
+        Axpy( -1., X, Y );
+        const double multiVecError = 
+          Sqrt(mpi::AllReduce(Pow(FrobeniusNorm(Y.LockedMatrix()),2.),comm));
+
+        // Overlap nonblocking checkpoints and restarts with other work
+        // (the source of a checkpoint may be modified while it is pending)
+        DistMatrix<double,VC,STAR> D(grid), E(grid);
+        Uniform( D, m, n );
+        DistMatrix<double,VC,STAR> DCopy( D );
+        auto ckptReq = ICheckpoint( D, basename+"-async" );
+        auto vecReq = ICheckpoint( X, basename+"-multivec-async" );
+        Zero( D );
+        ckptReq.Wait();
+        vecReq.Wait();
+        DistMultiVec<double> Z( comm );
+        auto restartReq = IRestart( E, basename+"-async.ckpt" );
+        auto vecRestartReq = IRestart( Z, basename+"-multivec-async.ckpt" );
+        while( !restartReq.Test() );
+        restartReq.Wait();
+        vecRestartReq.Wait();
+        Axpy( -1., DCopy, E );
+        const double asyncError = FrobeniusNorm( E );
+        Axpy( -1., X, Z );
+        const double asyncMultiVecError =
+          Sqrt(mpi::AllReduce(Pow(FrobeniusNorm(Z.LockedMatrix()),2.),comm));
+
+        DistSparseMatrix<double> S( m, comm ), T( comm );
+        const Int localHeight = S.LocalHeight();
+        S.Reserve( 3*localHeight );
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const Int i = S.FirstLocalRow() + iLoc;
+            S.QueueLocalUpdate( iLoc, i, 2. );
+            if( i > 0 )
+                S.QueueLocalUpdate( iLoc, i-1, -1. );
+            if( i < m-1 )
+                S.QueueLocalUpdate( iLoc, i+1, -1.+commSize );
+        }
+        S.MakeConsistent();
+        Checkpoint( S, basename+"-sparse" );
+        Restart( T, basename+"-sparse.ckpt" );
+        Int numLocalMismatches = 0;
+        if( S.NumLocalEntries() != T.NumLocalEntries() )
+            numLocalMismatches = 1;
+        else
+            for( Int k=0; k<S.NumLocalEntries(); ++k )
+                if( S.Row(k) != T.Row(k) || S.Col(k) != T.Col(k) ||
+                    S.Value(k) != T.Value(k) )
+                    ++numLocalMismatches;
+        const Int numMismatches = mpi::AllReduce( numLocalMismatches, comm );
+
+        if( commRank == 0 )
+            std::cout << "|| A - B ||_F = " << denseError << "\n"
+                      << "|| X - Y ||_F = " << multiVecError << "\n"
+                      << "|| D - E ||_F = " << asyncError << "\n"
+                      << "|| X - Z ||_F = " << asyncMultiVecError << "\n"
+                      << "Sparse restart had " << numMismatches 
+                      << " mismatches" << std::endl;
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,107 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// Redistribute A asynchronously (while overwriting A) and compare against a
+// synchronous redistribution of the original A
+template<Dist U,Dist V>
+double TestCopyAsync
+( const DistMatrix<double>& AOrig, AbstractDistMatrix<double>& B,
+  bool print )
+{
+    DistMatrix<double> A( AOrig );
+    DistMatrix<double,U,V> BSync( A.Grid() );
+    Copy( A, BSync );
+
+    auto request = CopyAsync( A, B );
+    Zero( A );
+    while( !request.Test() ) { }
+    if( print )
+        Print( B, "B" );
+
+    DistMatrix<double,U,V> E( B );
+    Axpy( -1., BSync, E );
+    return FrobeniusNorm( E );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+
+    try
+    {
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int m = Input("--height","height of matrix",100);
+        const Int n = Input("--width","width of matrix",100);
+        const Int mb = Input("--blockHeight","height of blocks",7);
+        const Int nb = Input("--blockWidth","width of blocks",5);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const Grid grid( comm, order );
+        DistMatrix<double> A(grid);
+        Uniform( A, m, n );
+        if( print )
+            Print( A, "A" );
+
+        // Gathers (which use a nonblocking AllGather when available)
+        DistMatrix<double,STAR,STAR> A_STAR_STAR(grid);
+        DistMatrix<double,STAR,MR> A_STAR_MR(grid);
+        DistMatrix<double,MC,STAR> A_MC_STAR(grid);
+        const double errorStarStar =
+            TestCopyAsync<STAR,STAR>( A, A_STAR_STAR, print );
+        const double errorStarMR =
+            TestCopyAsync<STAR,MR>( A, A_STAR_MR, print );
+        const double errorMCStar =
+            TestCopyAsync<MC,STAR>( A, A_MC_STAR, print );
+
+        // Gather a misaligned matrix into an aligned one
+        DistMatrix<double> AMis(grid);
+        AMis.Align( grid.Height()-1, grid.Width()-1 );
+        AMis = A;
+        DistMatrix<double,STAR,MR> B_STAR_MR(grid);
+        B_STAR_MR.AlignRows( 0 );
+        auto request = CopyAsync( AMis, B_STAR_MR );
+        request.Wait();
+        DistMatrix<double,STAR,MR> E_STAR_MR( A );
+        Axpy( -1., B_STAR_MR, E_STAR_MR );
+        const double errorMisaligned = FrobeniusNorm( E_STAR_MR );
+
+        // General redistributions (which use a cached plan)
+        DistMatrix<double,MR,MC> A_MR_MC(grid);
+        const double errorMRMC = TestCopyAsync<MR,MC>( A, A_MR_MC, print );
+        BlockDistMatrix<double> ABlock(grid,mb,nb);
+        auto blockRequest = CopyAsync( A, ABlock );
+        blockRequest.Wait();
+        DistMatrix<double> ARoundTrip(grid);
+        Copy( ABlock, ARoundTrip );
+        Axpy( -1., A, ARoundTrip );
+        const double errorBlock = FrobeniusNorm( ARoundTrip );
+
+        if( commRank == 0 )
+            std::cout << "[STAR,STAR] error: " << errorStarStar << "\n"
+                      << "[STAR,MR  ] error: " << errorStarMR << "\n"
+                      << "[MC,  STAR] error: " << errorMCStar << "\n"
+                      << "misaligned [STAR,MR] error: " << errorMisaligned
+                      << "\n"
+                      << "[MR,  MC  ] error: " << errorMRMC << "\n"
+                      << "block round trip error: " << errorBlock
+                      << std::endl;
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
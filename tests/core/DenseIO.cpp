@@ -0,0 +1,112 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// Since the file is a bitwise image of the matrix, any difference is an error
+template<typename T,Dist U,Dist V>
+Base<T> ReadBack
+( const DistMatrix<T>& A, const std::string& basename, FileFormat format )
+{
+    DistMatrix<T,U,V> B(A.Grid());
+    if( format == BINARY_FLAT )
+        B.Resize( A.Height(), A.Width() );
+    Read( B, basename+"."+FileExtension(format), format );
+    DistMatrix<T> C( B );
+    Axpy( T(-1), A, C );
+    return MaxNorm( C );
+}
+
+// Write A from the [U,V] distribution and read it back into each of the
+// tested distributions
+template<typename T,Dist U,Dist V>
+Base<T> RoundTrips
+( const DistMatrix<T>& A, const std::string& basename, FileFormat format )
+{
+    DistMatrix<T,U,V> AWrite( A );
+    Write( AWrite, basename, format );
+    Base<T> error = ReadBack<T,MC,  MR  >( A, basename, format );
+    error = Max( error, ReadBack<T,VC,  STAR>( A, basename, format ) );
+    error = Max( error, ReadBack<T,STAR,STAR>( A, basename, format ) );
+    error = Max( error, ReadBack<T,CIRC,CIRC>( A, basename, format ) );
+    return error;
+}
+
+template<typename T>
+void TestRoundTrips
+( Int m, Int n, const std::string& basename, const Grid& grid )
+{
+    const Int commRank = mpi::Rank( grid.Comm() );
+    DistMatrix<T> A(grid);
+    Uniform( A, m, n );
+    FileFormat formats[2] = { BINARY, BINARY_FLAT };
+    for( Int k=0; k<2; ++k )
+    {
+        const FileFormat format = formats[k];
+        const Base<T> errMCMR = RoundTrips<T,MC,MR>( A, basename, format );
+        const Base<T> errVCSTAR = RoundTrips<T,VC,STAR>( A, basename, format );
+        const Base<T> errSTARSTAR =
+            RoundTrips<T,STAR,STAR>( A, basename, format );
+        const Base<T> errCIRCCIRC =
+            RoundTrips<T,CIRC,CIRC>( A, basename, format );
+        if( commRank == 0 )
+            std::cout << ( format == BINARY ? "BINARY" : "BINARY_FLAT" )
+                      << " round trips of a " << m << " x " << n
+                      << ( IsComplex<T>::val ? " complex" : " real" )
+                      << " matrix:\n"
+                      << "  from [MC,  MR  ]: " << errMCMR << "\n"
+                      << "  from [VC,  STAR]: " << errVCSTAR << "\n"
+                      << "  from [STAR,STAR]: " << errSTARSTAR << "\n"
+                      << "  from [CIRC,CIRC]: " << errCIRCCIRC << std::endl;
+        if( errMCMR != Base<T>(0) || errVCSTAR != Base<T>(0) ||
+            errSTARSTAR != Base<T>(0) || errCIRCCIRC != Base<T>(0) )
+            LogicError("Dense round trip failed");
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::Rank( comm );
+
+    try
+    {
+        const Int m = Input("--height","height of matrix",100);
+        const Int n = Input("--width","width of matrix",70);
+        const Int gridHeight = Input("--gridHeight","process grid height",1);
+        const Int maxCount =
+            Input("--maxCount","maximum message (and file run) count",13);
+        const std::string basename =
+            Input("--basename","basename of files",std::string("denseio"));
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm, gridHeight );
+        if( commRank == 0 )
+            std::cout << "Using a " << grid.Height() << " x " << grid.Width()
+                      << " process grid" << std::endl;
+
+        TestRoundTrips<double>( m, n, basename, grid );
+        TestRoundTrips<Complex<double>>( m, n, basename, grid );
+
+        // Split the runs of the file views (and the messages) into pieces
+        if( commRank == 0 )
+            std::cout << "With a maximum count of " << maxCount << ":"
+                      << std::endl;
+        mpi::SetMaxMessageCount( maxCount );
+        TestRoundTrips<double>( m, n, basename, grid );
+        mpi::SetMaxMessageCount( 2147483647 );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -22,6 +22,8 @@ main( int argc, char* argv[] )
         const bool colMajorSqrt = Input("--colMajorSqrt","colMajor sqrt?",true);
         const Int m = Input("--height","height of matrix",100);
         const Int n = Input("--width","width of matrix",100);
+        const Int mb = Input("--blockHeight","height of blocks",7);
+        const Int nb = Input("--blockWidth","width of blocks",5);
         const bool print = Input("--print","print matrices?",false);
         ProcessInput();
         PrintInputReport();
@@ -63,6 +65,23 @@ main( int argc, char* argv[] )
         if( print )
             Print( A, "A := ASqrt" );
 
+        // Move through block and element distributions on both grids
+        Uniform( A, m, n );
+        BlockDistMatrix<double,MC,MR> ABlock(sqrtGrid,mb,nb);
+        Copy( A, ABlock );
+        BlockDistMatrix<double,STAR,VR> ABlockVR(grid,nb,mb);
+        Copy( ABlock, ABlockVR );
+        DistMatrix<double,VC,STAR> AElem(sqrtGrid);
+        Copy( ABlockVR, AElem );
+        DistMatrix<double> E(grid);
+        Copy( AElem, E );
+        Axpy( -1., A, E );
+        const double ANorm = FrobeniusNorm( A );
+        const double ENorm = FrobeniusNorm( E );
+        if( mpi::Rank(comm) == 0 )
+            std::cout << "|| A ||_F = " << ANorm << "\n"
+                      << "|| A - A_round_trip ||_F = " << ENorm << std::endl;
+
         const Grid newGrid( comm, order );
         A.SetGrid( newGrid );
         if( print )
@@ -56,6 +56,22 @@ Check( DistMatrix<T,AColDist,ARowDist>& A,
             break;
     }
 
+    // Repeat the redistribution with a cached plan
+    DistMatrix<T,AColDist,ARowDist> APlan(g);
+    APlan.Align( colAlign, rowAlign );
+    for( Int rep=0; rep<2; ++rep )
+    {
+        CachedRedistPlan( B, APlan ).Execute( B, APlan );
+        if( APlan.LocalHeight() != A.LocalHeight() ||
+            APlan.LocalWidth() != A.LocalWidth() )
+            myErrorFlag = 1;
+        else
+            for( Int jLoc=0; jLoc<A.LocalWidth(); ++jLoc )
+                for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+                    if( APlan.GetLocal(iLoc,jLoc) != A.GetLocal(iLoc,jLoc) )
+                        myErrorFlag = 1;
+    }
+
     Int summedErrorFlag;
     mpi::AllReduce( &myErrorFlag, &summedErrorFlag, 1, mpi::SUM, g.Comm() );
 
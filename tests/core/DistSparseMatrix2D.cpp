@@ -0,0 +1,112 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+
+    try
+    {
+        const Int n1 = Input("--n1","first grid dimension",20);
+        const Int n2 = Input("--n2","second grid dimension",30);
+        const Int numRhs = Input("--numRhs","number of right-hand sides",3);
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const Grid grid( comm, order );
+
+        // Fill a 1D distribution of a nonsymmetric 2D five-point stencil
+        const Int N = n1*n2;
+        DistSparseMatrix<double> A( N, comm );
+        const Int firstLocalRow = A.FirstLocalRow();
+        const Int localHeight = A.LocalHeight();
+        A.Reserve( 5*localHeight );
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const Int i = firstLocalRow + iLoc;
+            const Int x = i % n1;
+            const Int y = i / n1;
+            A.QueueLocalUpdate( iLoc, i, 4. );
+            if( x != 0 )
+                A.QueueLocalUpdate( iLoc, i-1, -1. );
+            if( x != n1-1 )
+                A.QueueLocalUpdate( iLoc, i+1, -2. );
+            if( y != 0 )
+                A.QueueLocalUpdate( iLoc, i-n1, -3. );
+            if( y != n2-1 )
+                A.QueueLocalUpdate( iLoc, i+n1, -4. );
+        }
+        A.MakeConsistent();
+
+        // Redistribute A into a checkerboard distribution and back
+        DistSparseMatrix2D<double> A2D( grid );
+        Copy( A, A2D );
+        DistSparseMatrix<double> ACopy( comm );
+        Copy( A2D, ACopy );
+        Int numLocalMismatches = 0;
+        if( ACopy.NumLocalEntries() != A.NumLocalEntries() )
+            ++numLocalMismatches;
+        else
+            for( Int k=0; k<A.NumLocalEntries(); ++k )
+                if( ACopy.Row(k) != A.Row(k) || ACopy.Col(k) != A.Col(k) ||
+                    ACopy.Value(k) != A.Value(k) )
+                    ++numLocalMismatches;
+        const Int numMismatches = mpi::AllReduce( numLocalMismatches, comm );
+        if( commRank == 0 )
+            std::cout << "Round-trip of A had " << numMismatches
+                      << " mismatches" << std::endl;
+
+        DistMultiVec<double> X( comm ), Y( comm ), Z( comm ), E( comm );
+        Uniform( X, N, numRhs );
+        const double XNorm = FrobeniusNorm( X.LockedMatrix() );
+        if( print )
+            Print( X.LockedMatrix(), "XLoc" );
+
+        DistMultiVec2D<double> X2D( MR, grid ), Y2D( MC, grid );
+        for( Int orient=0; orient<2; ++orient )
+        {
+            const Orientation orientation = ( orient==0 ? NORMAL : TRANSPOSE );
+            X2D.SetDist( orientation==NORMAL ? MR : MC );
+            Y2D.SetDist( orientation==NORMAL ? MC : MR );
+
+            // Y := A X (or A^T X) using both distributions
+            Zeros( Y, N, numRhs );
+            Multiply( orientation, 1., A, X, 0., Y );
+            Copy( X, X2D );
+            Y2D.Resize( N, numRhs );
+            Zeros( Y2D.Matrix(), Y2D.LocalHeight(), numRhs );
+            Multiply( orientation, 1., A2D, X2D, 0., Y2D );
+            Copy( Y2D, Z );
+
+            // Compare the results
+            E = Y;
+            Axpy( -1., Z, E );
+            const double YNorm =
+              Sqrt(mpi::AllReduce(Pow(FrobeniusNorm(Y.LockedMatrix()),2.),comm));
+            const double ENorm =
+              Sqrt(mpi::AllReduce(Pow(FrobeniusNorm(E.LockedMatrix()),2.),comm));
+            if( commRank == 0 )
+                std::cout << "|| X ||_F (local) = " << XNorm << "\n"
+                          << "|| Y ||_F         = " << YNorm << "\n"
+                          << "|| Y - Y2D ||_F   = " << ENorm << std::endl;
+        }
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
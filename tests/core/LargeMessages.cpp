@@ -0,0 +1,185 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// Messages longer than the maximum message count are split into derived
+// datatypes (or, for reductions, into pieces). Since forming messages of more
+// than 2^31 entries is impractical in a test, the maximum is instead lowered.
+
+template<typename T>
+Base<T> Difference( const std::vector<T>& x, const std::vector<T>& y )
+{
+    Base<T> diff = 0;
+    for( std::size_t j=0; j<x.size(); ++j )
+        diff = Max( diff, Abs(x[j]-y[j]) );
+    return diff;
+}
+
+template<typename T>
+Base<T> TestCollectives( Int count, Int maxCount, mpi::Comm comm )
+{
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+    const int to = Mod( commRank+1, commSize );
+    const int from = Mod( commRank-1, commSize );
+
+    std::vector<T> x(commSize*count);
+    for( Int j=0; j<commSize*count; ++j )
+        x[j] = T(commRank*commSize*count+j);
+
+    // Compute the results with, and then without, split messages
+    std::vector<std::vector<T>> results[2];
+    for( Int pass=0; pass<2; ++pass )
+    {
+        mpi::SetMaxMessageCount( pass==0 ? maxCount : Int(2147483647) );
+        std::vector<std::vector<T>>& res = results[pass];
+
+        std::vector<T> y(count);
+        mpi::SendRecv( x.data(), count, to, y.data(), count, from, comm );
+        res.push_back( y );
+
+        y.assign( x.begin(), x.begin()+count );
+        mpi::Broadcast( y.data(), count, commSize-1, comm );
+        res.push_back( y );
+
+        y.resize( commSize*count );
+        mpi::AllGather( x.data(), count, y.data(), count, comm );
+        res.push_back( y );
+
+        mpi::AllToAll( x.data(), count, y.data(), count, comm );
+        res.push_back( y );
+
+        mpi::AllReduce( x.data(), y.data(), commSize*count, comm );
+        res.push_back( y );
+
+        y.resize( count );
+        std::vector<T> z( x );
+        mpi::ReduceScatter( z.data(), y.data(), count, comm );
+        res.push_back( y );
+
+        mpi::ReduceScatter( z.data(), count, comm );
+        z.resize( count );
+        res.push_back( z );
+
+        y.assign( count, T(0) );
+        z.assign( x.begin(), x.begin()+count );
+        if( commRank == 0 )
+        {
+            for( int q=1; q<commSize; ++q )
+            {
+                mpi::Recv( y.data(), count, q, comm );
+                for( Int j=0; j<count; ++j )
+                    z[j] += y[j];
+            }
+            y = z;
+        }
+        else
+            mpi::Send( x.data(), count, 0, comm );
+        mpi::Broadcast( y.data(), count, 0, comm );
+        res.push_back( y );
+
+        // The variable-length collectives, with counts which differ between
+        // pairs of processes (the exchange sizes are symmetric in the ranks)
+        std::vector<Int> sizes(commSize), offs(commSize);
+        Int totalSize=0;
+        for( int q=0; q<commSize; ++q )
+        {
+            sizes[q] = count - Mod(commRank+q,3);
+            offs[q] = totalSize;
+            totalSize += sizes[q];
+        }
+        const Int mySize = count - Mod(commRank,2);
+        std::vector<Int> gatherSizes(commSize), gatherOffs(commSize);
+        Int totalGather=0;
+        for( int q=0; q<commSize; ++q )
+        {
+            gatherSizes[q] = count - Mod(q,2);
+            gatherOffs[q] = totalGather;
+            totalGather += gatherSizes[q];
+        }
+
+        y.assign( totalGather, T(0) );
+        mpi::Gather
+        ( x.data(), mySize,
+          y.data(), gatherSizes.data(), gatherOffs.data(), commSize-1, comm );
+        res.push_back( y );
+
+        y.assign( totalGather, T(0) );
+        mpi::AllGather
+        ( x.data(), mySize,
+          y.data(), gatherSizes.data(), gatherOffs.data(), comm );
+        res.push_back( y );
+
+        y.assign( totalSize, T(0) );
+        mpi::AllToAll
+        ( x.data(), sizes.data(), offs.data(),
+          y.data(), sizes.data(), offs.data(), comm );
+        res.push_back( y );
+    }
+
+    Base<T> error = 0;
+    for( std::size_t k=0; k<results[0].size(); ++k )
+        error = Max( error, Difference( results[0][k], results[1][k] ) );
+    return mpi::AllReduce( error, mpi::MAX, comm );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::Rank( comm );
+
+    try
+    {
+        const Int m = Input("--height","height of matrix",100);
+        const Int n = Input("--width","width of matrix",100);
+        const Int count = Input("--count","length of the messages",1000);
+        const Int maxCount = Input("--maxCount","maximum message count",7);
+        ProcessInput();
+        PrintInputReport();
+
+        const double realError =
+            TestCollectives<double>( count, maxCount, comm );
+        const double complexError =
+            TestCollectives<Complex<double>>( count, maxCount, comm );
+        const Int intError = TestCollectives<Int>( count, maxCount, comm );
+        if( commRank == 0 )
+            std::cout << "Split double messages error: " << realError << "\n"
+                      << "Split complex messages error: " << complexError
+                      << "\n"
+                      << "Split integer messages error: " << intError
+                      << std::endl;
+
+        // Redistribute a matrix through split messages
+        const Grid grid( comm );
+        DistMatrix<double> A(grid);
+        Uniform( A, m, n );
+        DistMatrix<double,STAR,STAR> A_STAR_STAR(grid);
+        DistMatrix<double,VR,STAR> A_VR_STAR(grid);
+        mpi::SetMaxMessageCount( maxCount );
+        A_STAR_STAR = A;
+        A_VR_STAR = A;
+        mpi::SetMaxMessageCount( 2147483647 );
+        DistMatrix<double> B(A_STAR_STAR), C(A_VR_STAR);
+        Axpy( -1., A, B );
+        Axpy( -1., A, C );
+        const double BNorm = FrobeniusNorm( B );
+        const double CNorm = FrobeniusNorm( C );
+        if( commRank == 0 )
+            std::cout << "[STAR,STAR] redistribution error: " << BNorm << "\n"
+                      << "[VR,  STAR] redistribution error: " << CNorm
+                      << std::endl;
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,166 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// The number of mappings of the given file in this process's address space,
+// or -1 if they cannot be queried (outside of Linux)
+Int NumMappings( const std::string& filename )
+{
+    std::ifstream maps( "/proc/self/maps" );
+    if( !maps.is_open() )
+        return -1;
+    const std::string suffix = "/" + filename;
+    Int numMappings = 0;
+    std::string line;
+    while( std::getline( maps, line ) )
+        if( line.size() >= suffix.size() &&
+            line.compare( line.size()-suffix.size(), suffix.size(), suffix )
+            == 0 )
+            ++numMappings;
+    return numMappings;
+}
+
+void CheckMapped( const std::string& filename, bool mapped, std::string when )
+{
+    const Int numMappings = NumMappings( filename );
+    if( numMappings == -1 || (numMappings > 0) == mapped )
+        return;
+    if( mapped )
+        LogicError(filename," was not mapped ",when);
+    else
+        LogicError(filename," was still mapped ",when);
+}
+
+template<typename T>
+Int NumMismatches( const Matrix<T>& A, const Matrix<T>& B )
+{
+    if( A.Height() != B.Height() || A.Width() != B.Width() )
+        return 1;
+    Int numMismatches = 0;
+    for( Int j=0; j<A.Width(); ++j )
+        for( Int i=0; i<A.Height(); ++i )
+            if( A.Get(i,j) != B.Get(i,j) )
+                ++numMismatches;
+    return numMismatches;
+}
+
+template<typename T>
+void MapFile
+( Matrix<T>& B, Int m, Int n, const std::string& filename, FileFormat format,
+  bool copyOnWrite )
+{
+    if( format == BINARY_FLAT )
+        B.Resize( m, n );
+    ReadMapped( B, filename, format, copyOnWrite );
+}
+
+template<typename T>
+void TestMapping
+( Int m, Int n, const std::string& basename, FileFormat format )
+{
+    Matrix<T> A;
+    Uniform( A, m, n );
+    Write( A, basename, format );
+    const std::string filename = basename + "." + FileExtension(format);
+
+    // A shared mapping is locked
+    Matrix<T> B;
+    MapFile( B, m, n, filename, format, false );
+    CheckMapped( filename, true, "by a shared read" );
+    if( !B.Locked() )
+        LogicError("A shared mapping was not locked");
+    if( NumMismatches( A, B ) != 0 )
+        LogicError("The shared mapping did not match the matrix");
+
+    // Emptying the matrix unmaps the file
+    B.Empty();
+    CheckMapped( filename, false, "after Empty()" );
+
+    // Growing a shared mapping reallocates a private (and writable) buffer
+    MapFile( B, m, n, filename, format, false );
+    B.Resize( m+1, n );
+    CheckMapped( filename, false, "after growing a shared mapping" );
+    if( B.Locked() )
+        LogicError("Growing a shared mapping left the matrix locked");
+    B.Set( m, 0, T(1) );
+
+    // Modifying a private mapping leaves the file unchanged
+    MapFile( B, m, n, filename, format, true );
+    if( B.Locked() )
+        LogicError("A copy-on-write mapping was locked");
+    if( NumMismatches( A, B ) != 0 )
+        LogicError("The copy-on-write mapping did not match the matrix");
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            B.Update( i, j, T(1) );
+    Matrix<T> C;
+    if( format == BINARY_FLAT )
+        C.Resize( m, n );
+    Read( C, filename, format );
+    if( NumMismatches( A, C ) != 0 )
+        LogicError("Writing to a copy-on-write mapping modified the file");
+
+    // Shrinking keeps the mapping, while growing reallocates and unmaps it
+    B.Resize( m/2, n );
+    CheckMapped( filename, true, "after shrinking" );
+    B.Resize( m+1, n );
+    CheckMapped( filename, false, "after Resize()" );
+
+    // Destroying the matrix unmaps the file
+    {
+        Matrix<T> D;
+        MapFile( D, m, n, filename, format, true );
+        CheckMapped( filename, true, "by a copy-on-write read" );
+    }
+    CheckMapped( filename, false, "after destruction" );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::Rank( comm );
+
+    try
+    {
+        const Int m = Input("--height","height of matrix",100);
+        const Int n = Input("--width","width of matrix",70);
+        const std::string basename =
+            Input("--basename","basename of files",std::string("mappedio"));
+        ProcessInput();
+        PrintInputReport();
+
+#ifdef EL_HAVE_MMAP
+        // Each process maps its own files
+        std::ostringstream os;
+        os << basename << "-" << commRank;
+        TestMapping<double>( m, n, os.str()+"-real", BINARY );
+        TestMapping<double>( m, n, os.str()+"-real", BINARY_FLAT );
+        TestMapping<Complex<double>>( m, n, os.str()+"-complex", BINARY );
+        TestMapping<Complex<double>>( m, n, os.str()+"-complex", BINARY_FLAT );
+        mpi::Barrier( comm );
+        if( commRank == 0 )
+        {
+            std::cout << "Memory-mapped reads passed";
+            if( NumMappings( basename ) == -1 )
+                std::cout << " (without checking the mappings)";
+            std::cout << std::endl;
+        }
+#else
+        if( commRank == 0 )
+            std::cout << "Memory-mapped reads are not supported" << std::endl;
+#endif
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -38,6 +38,109 @@ void TestMatrix( Int m, Int n, Int ldim )
         std::cout << "passed" << std::endl;
 }
 
+// Transfer buffers into and out of (distributed) matrices and move them
+template<typename T>
+void TestOwnership( Int m, Int n )
+{
+    // Control a buffer and then move the matrix twice
+    Int numDeleted = 0;
+    auto deleter = [&]( T* buf ) { delete[] buf; ++numDeleted; };
+    T* buffer = new T[m*n];
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            buffer[i+j*m] = i+j*m;
+    {
+        Matrix<T> A;
+        A.Control( m, n, buffer, m, deleter );
+        Matrix<T> B( std::move(A) );
+        Matrix<T> C;
+        C = std::move(B);
+        if( C.LockedBuffer() != buffer || A.Height() != 0 )
+            LogicError("Moving did not transfer the buffer");
+        for( Int j=0; j<n; ++j )
+            for( Int i=0; i<m; ++i )
+                if( C.Get(i,j) != T(i+j*m) )
+                    LogicError("Moved matrix has the wrong entries");
+    }
+    if( numDeleted != 1 )
+        LogicError("Controlled buffer was not freed exactly once");
+
+    // Release a buffer allocated by a matrix and reuse the moved-from matrix
+    Matrix<T> A;
+    Ones( A, m, n );
+    T* released = A.Release();
+    if( A.Height() != 0 || A.Width() != 0 )
+        LogicError("Matrix was not emptied by Release");
+    for( Int k=0; k<m*n; ++k )
+        if( released[k] != T(1) )
+            LogicError("Released buffer has the wrong entries");
+    delete[] released;
+    Matrix<T> B( std::move(A) );
+    Zeros( A, m, n );
+
+    // Moving into a view must copy rather than steal the buffer
+    Matrix<T> D;
+    Zeros( D, m, n );
+    auto DView = View( D, 0, 0, m, n );
+    Matrix<T> E;
+    Ones( E, m, n );
+    DView = std::move(E);
+    if( DView.LockedBuffer() != D.LockedBuffer() || D.Get(m-1,n-1) != T(1) )
+        LogicError("Moving into a view did not copy");
+
+    // Control, move, and release the local buffer of a DistMatrix
+    const Grid g( mpi::COMM_WORLD );
+    numDeleted = 0;
+    const Int localHeight = Length( m, g.Row(), g.Height() );
+    const Int localWidth = Length( n, g.Col(), g.Width() );
+    const Int ldim = Max( localHeight, 1 );
+    T* localBuffer = new T[ldim*localWidth];
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            localBuffer[iLoc+jLoc*ldim] =
+                (g.Row()+iLoc*g.Height()) + (g.Col()+jLoc*g.Width())*m;
+    {
+        DistMatrix<T> ADist(g);
+        ADist.Control( m, n, g, 0, 0, localBuffer, ldim, deleter );
+        DistMatrix<T> BDist( std::move(ADist) );
+        DistMatrix<T> CDist(g);
+        CDist = std::move(BDist);
+        if( CDist.LockedBuffer() != localBuffer )
+            LogicError("Moving did not transfer the local buffer");
+        DistMatrix<T,STAR,STAR> C_STAR_STAR( CDist );
+        for( Int j=0; j<n; ++j )
+            for( Int i=0; i<m; ++i )
+                if( C_STAR_STAR.GetLocal(i,j) != T(i+j*m) )
+                    LogicError("Controlled DistMatrix has the wrong entries");
+
+        // Moving into a matrix with a different constrained alignment must
+        // copy rather than steal the buffer
+        DistMatrix<T> DDist(g);
+        DDist.Align( g.Height()-1, g.Width()-1 );
+        DDist = std::move(CDist);
+        if( DDist.ColAlign() != g.Height()-1 ||
+            DDist.RowAlign() != g.Width()-1 )
+            LogicError("Moving did not respect the alignment constraints");
+        DistMatrix<T,STAR,STAR> D_STAR_STAR( DDist );
+        for( Int j=0; j<n; ++j )
+            for( Int i=0; i<m; ++i )
+                if( D_STAR_STAR.GetLocal(i,j) != T(i+j*m) )
+                    LogicError("Realigned DistMatrix has the wrong entries");
+
+        Ones( BDist, m, n );
+        T* localReleased = BDist.Release();
+        if( BDist.Height() != 0 )
+            LogicError("DistMatrix was not emptied by Release");
+        delete[] localReleased;
+    }
+    if( numDeleted != 1 )
+        LogicError("Controlled local buffer was not freed exactly once");
+
+    const Int commRank = mpi::Rank( mpi::COMM_WORLD );
+    if( commRank == 0 )
+        std::cout << "passed" << std::endl;
+}
+
 int 
 main( int argc, char* argv[] )
 {
@@ -63,6 +166,21 @@ main( int argc, char* argv[] )
             std::cout.flush();
         }
         TestMatrix<Complex<double>>( m, n, ldim );
+
+        if( mpi::WorldRank() == 0 )
+        {
+            std::cout << "Testing ownership transfer with doubles...";
+            std::cout.flush();
+        }
+        TestOwnership<double>( m, n );
+
+        if( mpi::WorldRank() == 0 )
+        {
+            std::cout << "Testing ownership transfer with "
+                         "double-precision complex...";
+            std::cout.flush();
+        }
+        TestOwnership<Complex<double>>( m, n );
     }
     catch( std::exception& e ) { ReportException(e); }
 
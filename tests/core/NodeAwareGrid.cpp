@@ -0,0 +1,148 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+int 
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+
+    try
+    {
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int m = Input("--height","height of matrix",100);
+        const Int n = Input("--width","width of matrix",100);
+        const Int k = Input("--inner","inner dimension of product",100);
+        const Int count = Input("--count","length of the collectives",10);
+        ProcessInput();
+        PrintInputReport();
+
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const Grid grid( comm, order );
+        const Grid nodeGrid( comm, order, true );
+        if( commRank == 0 )
+            std::cout << "Node-aware grid is " << nodeGrid.Height() << " x " 
+                      << nodeGrid.Width() << " over " << nodeGrid.NumNodes() 
+                      << " node(s)" << std::endl;
+
+        // Compare the two-level collectives against their flat counterparts
+        mpi::Comm nodeComm = nodeGrid.NodeComm();
+        mpi::Comm interNodeComm = nodeGrid.InterNodeComm();
+        mpi::Comm owningComm = nodeGrid.OwningComm();
+        std::vector<double> x(count), y(count);
+        for( Int j=0; j<count; ++j )
+            x[j] = y[j] = commRank*count + j;
+        mpi::AllReduce( x.data(), count, mpi::SUM, owningComm );
+        mpi::HierarchicalAllReduce
+        ( y.data(), count, mpi::SUM, nodeComm, interNodeComm );
+        double reduceError = 0;
+        for( Int j=0; j<count; ++j )
+            reduceError = Max( reduceError, Abs(x[j]-y[j]) );
+
+        std::vector<double> xAll(commSize*count), yAll(commSize*count);
+        mpi::AllGather( x.data(), count, xAll.data(), count, owningComm );
+        mpi::HierarchicalAllGather
+        ( x.data(), count, yAll.data(), count, 
+          owningComm, nodeComm, interNodeComm );
+        double gatherError = 0;
+        for( Int j=0; j<commSize*count; ++j )
+            gatherError = Max( gatherError, Abs(xAll[j]-yAll[j]) );
+        reduceError = mpi::AllReduce( reduceError, mpi::MAX, comm );
+        gatherError = mpi::AllReduce( gatherError, mpi::MAX, comm );
+        if( commRank == 0 )
+            std::cout << "Two-level AllReduce error: " << reduceError << "\n"
+                      << "Two-level AllGather error: " << gatherError 
+                      << std::endl;
+
+        // Form the same product on both grids
+        DistMatrix<double> A(grid), B(grid), C(grid);
+        Uniform( A, m, k );
+        Uniform( B, k, n );
+        Gemm( NORMAL, NORMAL, 1., A, B, C );
+        DistMatrix<double> ANode(nodeGrid), BNode(nodeGrid), CNode(nodeGrid);
+        Copy( A, ANode );
+        Copy( B, BNode );
+        Gemm( NORMAL, NORMAL, 1., ANode, BNode, CNode );
+        DistMatrix<double> E(grid);
+        Copy( CNode, E );
+        Axpy( -1., C, E );
+        const double CNorm = FrobeniusNorm( C );
+        const double ENorm = FrobeniusNorm( E );
+        if( commRank == 0 )
+            std::cout << "|| C ||_F = " << CNorm << "\n"
+                      << "|| C - C_node ||_F = " << ENorm << std::endl;
+
+        // Gather into replicated distributions which store one copy per node
+        DistMatrix<double,STAR,STAR> C_STAR_STAR(grid), CShared_STAR_STAR(grid);
+        DistMatrix<double,MC,  STAR> C_MC_STAR(grid),   CShared_MC_STAR(grid);
+        DistMatrix<double,STAR,MR  > C_STAR_MR(grid),   CShared_STAR_MR(grid);
+        CShared_STAR_STAR.SetNodeShared();
+        CShared_MC_STAR.SetNodeShared();
+        CShared_STAR_MR.SetNodeShared();
+        C_STAR_STAR = C;
+        C_MC_STAR = C;
+        C_STAR_MR = C;
+        CShared_STAR_STAR = C;
+        CShared_MC_STAR = C;
+        CShared_STAR_MR = C;
+        // (the node-shared data may only be modified by the node writers)
+        Matrix<double> E_STAR_STAR( CShared_STAR_STAR.LockedMatrix() ),
+                       E_MC_STAR( CShared_MC_STAR.LockedMatrix() ),
+                       E_STAR_MR( CShared_STAR_MR.LockedMatrix() );
+        Axpy( -1., C_STAR_STAR.LockedMatrix(), E_STAR_STAR );
+        Axpy( -1., C_MC_STAR.LockedMatrix(), E_MC_STAR );
+        Axpy( -1., C_STAR_MR.LockedMatrix(), E_STAR_MR );
+        const double sharedError = 
+            MaxNorm( E_STAR_STAR ) + MaxNorm( E_MC_STAR ) + 
+            MaxNorm( E_STAR_MR );
+        const double maxSharedError = 
+            mpi::AllReduce( sharedError, mpi::MAX, comm );
+        if( commRank == 0 )
+            std::cout << "Node-shared gather error: " << maxSharedError 
+                      << std::endl;
+
+        // In-place operations on node-shared matrices must update the data
+        // of each node once (rather than once per process on the node), and
+        // the local matrices of the non-writers must be locked
+        Scale( 2., CShared_STAR_STAR );
+        Axpy( -2., C_STAR_STAR, CShared_STAR_STAR );
+        Scale( 3., CShared_MC_STAR );
+        Axpy( -3., C_MC_STAR, CShared_MC_STAR );
+        DistMatrix<double,STAR,MR> DShared_STAR_MR(grid);
+        DShared_STAR_MR.SetNodeShared();
+        DShared_STAR_MR = CShared_STAR_MR;
+        Axpy( -1., C_STAR_MR, DShared_STAR_MR );
+        const double updateError = 
+            MaxNorm( CShared_STAR_STAR.LockedMatrix() ) + 
+            MaxNorm( CShared_MC_STAR.LockedMatrix() ) + 
+            MaxNorm( DShared_STAR_MR.LockedMatrix() );
+        const double maxUpdateError = 
+            mpi::AllReduce( updateError, mpi::MAX, comm );
+        const Int numBadLocks =
+            ( CShared_STAR_STAR.NodeWriter() == 
+              CShared_STAR_STAR.LockedMatrix().Locked() ) +
+            ( CShared_MC_STAR.NodeWriter() == 
+              CShared_MC_STAR.LockedMatrix().Locked() );
+        const Int maxBadLocks = mpi::AllReduce( numBadLocks, mpi::MAX, comm );
+        if( commRank == 0 )
+            std::cout << "Node-shared update error: " << maxUpdateError << "\n"
+                      << "Node-shared locking errors: " << maxBadLocks 
+                      << std::endl;
+        if( maxUpdateError != 0. || maxBadLocks != 0 )
+            LogicError("Node-shared matrices were not updated once per node");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
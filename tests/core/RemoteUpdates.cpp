@@ -0,0 +1,103 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// Every process queues an update of every entry (in a different order), so
+// that A(i,j) should become p (i + j m), and then pulls every entry back
+template<typename DistType>
+void TestQueues( DistType& A, Int m, Int n, const std::string& label )
+{
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+    const Int commSize = mpi::Size( comm );
+    Zeros( A, m, n );
+
+    A.Reserve( m*n );
+    for( Int k=0; k<m*n; ++k )
+    {
+        const Int index = (k+commRank) % (m*n);
+        const Int i = index % m;
+        const Int j = index / m;
+        A.QueueUpdate( i, j, double(i+j*m) );
+    }
+    A.ProcessQueues();
+
+    double localError = 0;
+    if( A.Participating() )
+    {
+        for( Int jLoc=0; jLoc<A.LocalWidth(); ++jLoc )
+        {
+            const Int j = A.GlobalCol(jLoc);
+            for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+            {
+                const Int i = A.GlobalRow(iLoc);
+                const double expected = commSize*double(i+j*m);
+                localError =
+                    Max( localError, Abs(A.GetLocal(iLoc,jLoc)-expected) );
+            }
+        }
+    }
+    const double updateError = mpi::AllReduce( localError, mpi::MAX, comm );
+
+    A.ReservePulls( m*n );
+    for( Int k=0; k<m*n; ++k )
+    {
+        const Int index = (k+commRank) % (m*n);
+        A.QueuePull( index % m, index / m );
+    }
+    std::vector<double> pullBuf;
+    A.ProcessPullQueue( pullBuf );
+    localError = ( Int(pullBuf.size()) == m*n ? 0 : 1 );
+    for( Int k=0; k<Int(pullBuf.size()); ++k )
+    {
+        const Int index = (k+commRank) % (m*n);
+        localError = Max( localError, Abs(pullBuf[k]-commSize*double(index)) );
+    }
+    const double pullError = mpi::AllReduce( localError, mpi::MAX, comm );
+
+    if( commRank == 0 )
+        std::cout << label << " update error: " << updateError
+                  << ", pull error: " << pullError << std::endl;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--height","height of matrix",20);
+        const Int n = Input("--width","width of matrix",15);
+        const Int mb = Input("--blockHeight","height of blocks",3);
+        const Int nb = Input("--blockWidth","width of blocks",2);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm );
+        DistMatrix<double> A_MC_MR(grid);
+        DistMatrix<double,STAR,STAR> A_STAR_STAR(grid);
+        DistMatrix<double,CIRC,CIRC> A_CIRC_CIRC(grid);
+        DistMatrix<double,VC,STAR> A_VC_STAR(grid);
+        DistMatrix<double,MD,STAR> A_MD_STAR(grid);
+        BlockDistMatrix<double> ABlock(grid,mb,nb);
+        TestQueues( A_MC_MR,     m, n, "[MC,  MR  ]" );
+        TestQueues( A_STAR_STAR, m, n, "[STAR,STAR]" );
+        TestQueues( A_CIRC_CIRC, m, n, "[CIRC,CIRC]" );
+        TestQueues( A_VC_STAR,   m, n, "[VC,  STAR]" );
+        TestQueues( A_MD_STAR,   m, n, "[MD,  STAR]" );
+        TestQueues( ABlock,      m, n, "block [MC,MR]" );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,145 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+template<typename T>
+Int NumMismatches( const SparseMatrix<T>& A, const SparseMatrix<T>& B )
+{
+    if( A.Height() != B.Height() || A.Width() != B.Width() ||
+        A.NumEntries() != B.NumEntries() )
+        return 1;
+    Int numMismatches = 0;
+    for( Int k=0; k<A.NumEntries(); ++k )
+        if( A.Row(k) != B.Row(k) || A.Col(k) != B.Col(k) ||
+            A.Value(k) != B.Value(k) )
+            ++numMismatches;
+    return numMismatches;
+}
+
+template<typename T>
+Int NumMismatches( const DistSparseMatrix<T>& A, const DistSparseMatrix<T>& B )
+{
+    Int numLocalMismatches = 0;
+    if( A.Height() != B.Height() || A.Width() != B.Width() ||
+        A.NumLocalEntries() != B.NumLocalEntries() )
+        numLocalMismatches = 1;
+    else
+        for( Int k=0; k<A.NumLocalEntries(); ++k )
+            if( A.Row(k) != B.Row(k) || A.Col(k) != B.Col(k) ||
+                A.Value(k) != B.Value(k) )
+                ++numLocalMismatches;
+    return mpi::AllReduce( numLocalMismatches, A.Comm() );
+}
+
+// Fill a rectangular matrix with a pattern of exactly representable entries
+template<typename T>
+void FillSequential( SparseMatrix<T>& A, Int m, Int n )
+{
+    A.Resize( m, n );
+    A.Reserve( 3*m );
+    for( Int i=0; i<m; ++i )
+    {
+        A.QueueUpdate( i, i % n, T(i+1) );
+        A.QueueUpdate( i, (3*i+1) % n, T(-0.5) );
+        if( i % 3 == 0 )
+            A.QueueUpdate( i, (i/3) % n, T(0.25) );
+    }
+    A.MakeConsistent();
+}
+
+template<typename T>
+void FillDistributed( DistSparseMatrix<T>& A, Int m, Int n )
+{
+    A.Resize( m, n );
+    const Int firstLocalRow = A.FirstLocalRow();
+    const Int localHeight = A.LocalHeight();
+    A.Reserve( 3*localHeight );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = firstLocalRow + iLoc;
+        A.QueueLocalUpdate( iLoc, i % n, T(i+1) );
+        A.QueueLocalUpdate( iLoc, (3*i+1) % n, T(-0.5) );
+        if( i % 3 == 0 )
+            A.QueueLocalUpdate( iLoc, (i/3) % n, T(0.25) );
+    }
+    A.MakeConsistent();
+}
+
+template<typename T>
+void TestRoundTrips
+( Int m, Int n, const std::string& basename, mpi::Comm comm )
+{
+    const Int commRank = mpi::Rank( comm );
+    const std::string typeName = ( IsComplex<T>::val ? "-complex" : "-real" );
+
+    // Each process writes and reads back its own sequential matrix
+    SparseMatrix<T> A, B;
+    FillSequential( A, m, n );
+    std::ostringstream os;
+    os << basename << typeName << "-seq-" << commRank;
+    const std::string seqBase = os.str();
+    Write( A, seqBase, BINARY_CSR );
+    Read( B, seqBase+".csr" );
+    Int seqCSR = NumMismatches( A, B );
+    Write( A, seqBase, MATRIX_MARKET );
+    Read( B, seqBase+".mm" );
+    Int seqMM = NumMismatches( A, B );
+    seqCSR = mpi::AllReduce( seqCSR, comm );
+    seqMM = mpi::AllReduce( seqMM, comm );
+
+    DistSparseMatrix<T> ADist( comm ), BDist( comm );
+    FillDistributed( ADist, m, n );
+    const std::string distBase = basename + typeName + "-dist";
+    Write( ADist, distBase, BINARY_CSR );
+    Read( BDist, distBase+".csr" );
+    const Int distCSR = NumMismatches( ADist, BDist );
+    Write( ADist, distBase, MATRIX_MARKET );
+    Read( BDist, distBase+".mm" );
+    const Int distMM = NumMismatches( ADist, BDist );
+
+    if( commRank == 0 )
+        std::cout << "Round trips of " << m << " x " << n
+                  << ( IsComplex<T>::val ? " complex" : " real" )
+                  << " sparse matrices:\n"
+                  << "  sequential BINARY_CSR:    " << seqCSR
+                  << " mismatches\n"
+                  << "  sequential MATRIX_MARKET: " << seqMM
+                  << " mismatches\n"
+                  << "  distributed BINARY_CSR:    " << distCSR
+                  << " mismatches\n"
+                  << "  distributed MATRIX_MARKET: " << distMM
+                  << " mismatches" << std::endl;
+    if( seqCSR != 0 || seqMM != 0 || distCSR != 0 || distMM != 0 )
+        LogicError("Sparse round trip failed");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--height","height of matrix",100);
+        const Int n = Input("--width","width of matrix",70);
+        const std::string basename =
+            Input("--basename","basename of files",std::string("sparseio"));
+        ProcessInput();
+        PrintInputReport();
+
+        TestRoundTrips<double>( m, n, basename, comm );
+        TestRoundTrips<Complex<double>>( m, n, basename, comm );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,185 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson, Lexing Ying,
+   The University of Texas at Austin, Stanford University, and the
+   Georgia Insitute of Technology.
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+void RunMethod
+( int method, const DistSparseMatrix<double>& A,
+  const KrylovOperator<double>& M,
+  const DistMultiVec<double>& B, DistMultiVec<double>& X,
+  KrylovStats& stats, const KrylovCtrl<double>& ctrl )
+{
+    switch( method )
+    {
+    case 0: CG( A, M, B, X, stats, ctrl ); break;
+    case 1: MINRES( A, M, B, X, stats, ctrl ); break;
+    case 2: GMRES( A, M, B, X, stats, ctrl ); break;
+    case 3: BiCGStab( A, M, B, X, stats, ctrl ); break;
+    default: LogicError("Invalid method");
+    }
+}
+
+// Precondition with a sparse-direct factorization of A with fronts of type FLow
+template<typename FLow>
+void LDLPreconditionedSolve
+( int method, const DistSparseMatrix<double>& A,
+  const DistMultiVec<double>& B, DistMultiVec<double>& X,
+  KrylovStats& stats, const KrylovCtrl<double>& ctrl )
+{
+    mpi::Comm comm = A.Comm();
+    const int commRank = mpi::Rank( comm );
+
+    if( commRank == 0 )
+    {
+        std::cout << "Factoring A...";
+        std::cout.flush();
+    }
+    mpi::Barrier( comm );
+    const double factorStart = mpi::Time();
+    DistSymmInfo info;
+    DistSeparatorTree sepTree;
+    DistMap map, inverseMap;
+    NestedDissection( A.LockedDistGraph(), map, sepTree, info );
+    map.FormInverse( inverseMap );
+    DistSparseMatrix<FLow> ALow;
+    Copy( A, ALow );
+    DistSymmFrontTree<FLow> frontTree( ALow, map, sepTree, info, false );
+    ALow.Empty();
+    LDL( info, frontTree, LDL_1D );
+    mpi::Barrier( comm );
+    const double factorStop = mpi::Time();
+    if( commRank == 0 )
+        std::cout << "done, " << factorStop-factorStart << " seconds"
+                  << std::endl;
+
+    RunMethod
+    ( method, A, LDLPreconditioner<double>( inverseMap, info, frontTree ),
+      B, X, stats, ctrl );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::Rank( comm );
+
+    try
+    {
+        const int n1 = Input("--n1","first grid dimension",20);
+        const int n2 = Input("--n2","second grid dimension",20);
+        const int n3 = Input("--n3","third grid dimension",20);
+        const int numRhs = Input("--numRhs","number of right-hand sides",3);
+        const double shift = Input("--shift","shift of the Laplacian",0.);
+        const int method = Input
+            ("--method","0: CG, 1: MINRES, 2: GMRES, 3: BiCGStab",0);
+        const int precond = Input
+            ("--precond","0: none, 1: Jacobi, 2: sparse LDL",1);
+        const bool single = Input
+            ("--single","factor the preconditioner in single precision?",
+             true);
+        const double relTol = Input
+            ("--relTol","relative residual tolerance",1e-8);
+        const int maxIts = Input("--maxIts","maximum iterations",1000);
+        const int restart = Input("--restart","GMRES restart length",30);
+        const bool progress = Input("--progress","print progress?",false);
+        const bool history = Input
+            ("--history","print the convergence history?",false);
+        ProcessInput();
+
+        KrylovCtrl<double> ctrl;
+        ctrl.relTol = relTol;
+        ctrl.maxIts = maxIts;
+        ctrl.restart = restart;
+        ctrl.progress = progress;
+
+        const int N = n1*n2*n3;
+        DistSparseMatrix<double> A( N, comm );
+
+        // Fill our portion of the (shifted) 3D negative Laplacian using a
+        // n1 x n2 x n3 7-point stencil in natural ordering
+        const int firstLocalRow = A.FirstLocalRow();
+        const int localHeight = A.LocalHeight();
+        A.Reserve( 7*localHeight );
+        for( int iLocal=0; iLocal<localHeight; ++iLocal )
+        {
+            const int i = firstLocalRow + iLocal;
+            const int x = i % n1;
+            const int y = (i/n1) % n2;
+            const int z = i/(n1*n2);
+
+            A.QueueLocalUpdate( iLocal, i, 6.-shift );
+            if( x != 0 )
+                A.QueueLocalUpdate( iLocal, i-1, -1. );
+            if( x != n1-1 )
+                A.QueueLocalUpdate( iLocal, i+1, -1. );
+            if( y != 0 )
+                A.QueueLocalUpdate( iLocal, i-n1, -1. );
+            if( y != n2-1 )
+                A.QueueLocalUpdate( iLocal, i+n1, -1. );
+            if( z != 0 )
+                A.QueueLocalUpdate( iLocal, i-n1*n2, -1. );
+            if( z != n3-1 )
+                A.QueueLocalUpdate( iLocal, i+n1*n2, -1. );
+        }
+        A.MakeConsistent();
+
+        DistMultiVec<double> XTrue( N, numRhs, comm ), B( N, numRhs, comm ),
+                             X( comm );
+        MakeUniform( XTrue );
+        Zero( B );
+        Multiply( NORMAL, 1., A, XTrue, 0., B );
+
+        KrylovStats stats;
+        mpi::Barrier( comm );
+        const double solveStart = mpi::Time();
+        if( precond == 2 )
+        {
+            if( single )
+                LDLPreconditionedSolve<float>( method, A, B, X, stats, ctrl );
+            else
+                LDLPreconditionedSolve<double>( method, A, B, X, stats, ctrl );
+        }
+        else
+        {
+            const KrylovOperator<double> M =
+                ( precond == 1 ? JacobiPreconditioner( A )
+                               : KrylovOperator<double>() );
+            RunMethod( method, A, M, B, X, stats, ctrl );
+        }
+        mpi::Barrier( comm );
+        const double solveStop = mpi::Time();
+
+        if( commRank == 0 && history )
+            for( unsigned it=0; it<stats.history.size(); ++it )
+                std::cout << "  " << it << ": " << stats.history[it]
+                          << std::endl;
+
+        const double BNorm = FrobeniusNorm( B );
+        const double XNorm = FrobeniusNorm( XTrue );
+        Multiply( NORMAL, -1., A, X, 1., B );
+        const double residNorm = FrobeniusNorm( B );
+        Axpy( -1., X, XTrue );
+        const double errorNorm = FrobeniusNorm( XTrue );
+        if( commRank == 0 )
+            std::cout << stats.numIts << " iterations in "
+                      << solveStop-solveStart << " seconds"
+                      << ( stats.converged ? " (converged)" : "" ) << "\n"
+                      << "|| B - A X ||_F / || B ||_F = "
+                      << residNorm/BNorm << "\n"
+                      << "|| X - XComp ||_F / || X ||_F = "
+                      << errorNorm/XNorm << std::endl;
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,218 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson, Lexing Ying,
+   The University of Texas at Austin, Stanford University, and the
+   Georgia Insitute of Technology.
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// Factor A with fronts of type FLow and solve A X = B with refinement
+template<typename FLow>
+void FactorAndSolve
+( const DistSparseMatrix<double>& A, const DistMap& map,
+  const DistMap& inverseMap, const DistSeparatorTree& sepTree,
+  DistSymmInfo& info, SymmFrontType frontType,
+  DistMultiVec<double>& B, RefineStats& stats,
+  const RefineCtrl<double>& ctrl )
+{
+    mpi::Comm comm = A.Comm();
+    const int commRank = mpi::Rank( comm );
+
+    if( commRank == 0 )
+    {
+        std::cout << "Building DistSymmFrontTree...";
+        std::cout.flush();
+    }
+    mpi::Barrier( comm );
+    const double buildStart = mpi::Time();
+    DistSparseMatrix<FLow> ALow;
+    Copy( A, ALow );
+    DistSymmFrontTree<FLow> frontTree( ALow, map, sepTree, info, false );
+    ALow.Empty();
+    mpi::Barrier( comm );
+    const double buildStop = mpi::Time();
+    if( commRank == 0 )
+        std::cout << "done, " << buildStop-buildStart << " seconds"
+                  << std::endl;
+
+    if( commRank == 0 )
+    {
+        std::cout << "Running LDL^T and redistribution...";
+        std::cout.flush();
+    }
+    mpi::Barrier( comm );
+    const double ldlStart = mpi::Time();
+    LDL( info, frontTree, frontType );
+    mpi::Barrier( comm );
+    const double ldlStop = mpi::Time();
+    if( commRank == 0 )
+        std::cout << "done, " << ldlStop-ldlStart << " seconds" << std::endl;
+
+    double localEntries, minLocalEntries, maxLocalEntries, globalEntries;
+    frontTree.MemoryInfo
+    ( localEntries, minLocalEntries, maxLocalEntries, globalEntries );
+    if( commRank == 0 )
+        std::cout << "Memory usage for fronts after factorization...\n"
+                  << "  max local: " << maxLocalEntries*sizeof(FLow)/1e6
+                  << " MB\n"
+                  << "  global:    " << globalEntries*sizeof(FLow)/1e6
+                  << " MB\n" << std::endl;
+
+    if( commRank == 0 )
+        std::cout << "Solving with refinement..." << std::endl;
+    mpi::Barrier( comm );
+    const double solveStart = mpi::Time();
+    RefinedSolve( A, inverseMap, info, frontTree, B, stats, ctrl );
+    mpi::Barrier( comm );
+    const double solveStop = mpi::Time();
+    if( commRank == 0 )
+        std::cout << "done, " << solveStop-solveStart << " seconds"
+                  << std::endl;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::Rank( comm );
+
+    try
+    {
+        const int n1 = Input("--n1","first grid dimension",30);
+        const int n2 = Input("--n2","second grid dimension",30);
+        const int n3 = Input("--n3","third grid dimension",30);
+        const int numRhs = Input("--numRhs","number of right-hand sides",5);
+        const double shift = Input("--shift","shift of the Laplacian",0.);
+        const bool single = Input
+            ("--single","factor in single precision?",true);
+        const bool intraPiv = Input("--intraPiv","frontal pivoting?",false);
+        const bool sequential = Input
+            ("--sequential","sequential partitions?",true);
+        const int numDistSeps = Input
+            ("--numDistSeps",
+             "number of partitions to try per distributed partition",1);
+        const int numSeqSeps = Input
+            ("--numSeqSeps",
+             "number of partitions to try per sequential partition",1);
+        const int cutoff = Input("--cutoff","cutoff for nested dissection",128);
+        const double relTol = Input
+            ("--relTol","relative residual tolerance",
+             RefineCtrl<double>().relTol);
+        const int maxRefineIts = Input
+            ("--maxRefineIts","max refinement iterations",10);
+        const bool gmres = Input("--gmres","fall back to GMRES-IR?",true);
+        const int restart = Input("--restart","GMRES restart length",30);
+        const bool progress = Input("--progress","print progress?",true);
+        ProcessInput();
+
+        BisectCtrl ctrl;
+        ctrl.sequential = sequential;
+        ctrl.numSeqSeps = numSeqSeps;
+        ctrl.numDistSeps = numDistSeps;
+        ctrl.cutoff = cutoff;
+
+        RefineCtrl<double> refineCtrl;
+        refineCtrl.relTol = relTol;
+        refineCtrl.maxRefineIts = maxRefineIts;
+        refineCtrl.gmresFallback = gmres;
+        refineCtrl.restart = restart;
+        refineCtrl.progress = progress;
+
+        const int N = n1*n2*n3;
+        DistSparseMatrix<double> A( N, comm );
+
+        // Fill our portion of the (shifted) 3D negative Laplacian using a
+        // n1 x n2 x n3 7-point stencil in natural ordering
+        if( commRank == 0 )
+        {
+            std::cout << "Filling local portion of matrix...";
+            std::cout.flush();
+        }
+        const double fillStart = mpi::Time();
+        const int firstLocalRow = A.FirstLocalRow();
+        const int localHeight = A.LocalHeight();
+        A.Reserve( 7*localHeight );
+        for( int iLocal=0; iLocal<localHeight; ++iLocal )
+        {
+            const int i = firstLocalRow + iLocal;
+            const int x = i % n1;
+            const int y = (i/n1) % n2;
+            const int z = i/(n1*n2);
+
+            A.QueueLocalUpdate( iLocal, i, 6.-shift );
+            if( x != 0 )
+                A.QueueLocalUpdate( iLocal, i-1, -1. );
+            if( x != n1-1 )
+                A.QueueLocalUpdate( iLocal, i+1, -1. );
+            if( y != 0 )
+                A.QueueLocalUpdate( iLocal, i-n1, -1. );
+            if( y != n2-1 )
+                A.QueueLocalUpdate( iLocal, i+n1, -1. );
+            if( z != 0 )
+                A.QueueLocalUpdate( iLocal, i-n1*n2, -1. );
+            if( z != n3-1 )
+                A.QueueLocalUpdate( iLocal, i+n1*n2, -1. );
+        }
+        A.MakeConsistent();
+        mpi::Barrier( comm );
+        const double fillStop =  mpi::Time();
+        if( commRank == 0 )
+            std::cout << "done, " << fillStop-fillStart << " seconds"
+                      << std::endl;
+
+        if( commRank == 0 )
+        {
+            std::cout << "Running nested dissection...";
+            std::cout.flush();
+        }
+        const double nestedStart = mpi::Time();
+        const DistGraph& graph = A.DistGraph();
+        DistSymmInfo info;
+        DistSeparatorTree sepTree;
+        DistMap map, inverseMap;
+        NestedDissection( graph, map, sepTree, info, ctrl );
+        map.FormInverse( inverseMap );
+        mpi::Barrier( comm );
+        const double nestedStop = mpi::Time();
+        if( commRank == 0 )
+            std::cout << "done, " << nestedStop-nestedStart << " seconds"
+                      << std::endl;
+
+        DistMultiVec<double> X( N, numRhs, comm ), B( N, numRhs, comm );
+        MakeUniform( X );
+        Zero( B );
+        Multiply( NORMAL, 1., A, X, 0., B );
+
+        const SymmFrontType frontType = ( intraPiv ? LDL_INTRAPIV_1D : LDL_1D );
+        RefineStats stats;
+        if( single )
+            FactorAndSolve<float>
+            ( A, map, inverseMap, sepTree, info, frontType, B, stats,
+              refineCtrl );
+        else
+            FactorAndSolve<double>
+            ( A, map, inverseMap, sepTree, info, frontType, B, stats,
+              refineCtrl );
+
+        const double XNorm = FrobeniusNorm( X );
+        Axpy( -1., X, B );
+        const double errorNorm = FrobeniusNorm( B );
+        if( commRank == 0 )
+            std::cout << stats.numRefineIts << " refinement iterations, "
+                      << stats.numGMRESIts << " GMRES iterations\n"
+                      << "max relative residual: " << stats.relResidual
+                      << ( stats.converged ? " (converged)" : "" ) << "\n"
+                      << "|| X - XComp ||_F / || X ||_F = "
+                      << errorNorm/XNorm << std::endl;
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
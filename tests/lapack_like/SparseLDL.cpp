@@ -27,6 +27,7 @@ main( int argc, char* argv[] )
         const bool solve2d = Input("--solve2d","use 2d solve?",false);
         const bool selInv = Input("--selInv","selectively invert?",false);
         const bool intraPiv = Input("--intraPiv","pivot within fronts?",false);
+        const bool cholesky = Input("--cholesky","use Cholesky fronts?",false);
         const bool natural = Input("--natural","analytical nested-diss?",true);
         const bool sequential = Input
             ("--sequential","sequential partitions?",true);
@@ -36,9 +37,30 @@ main( int argc, char* argv[] )
         const int numSeqSeps = Input
             ("--numSeqSeps",
              "number of separators to try per sequential partition",1);
+        const bool native = Input
+            ("--native","native multilevel bisection?",BisectCtrl().native);
         const int nbFact = Input("--nbFact","factorization blocksize",96);
         const int nbSolve = Input("--nbSolve","solve blocksize",96);
+        const int rhsBlock = Input
+            ("--rhsBlock","stream RHS in blocks of this width (0 disables)",0);
+        const bool rhsCallbacks = Input
+            ("--rhsCallbacks","produce/consume the streamed RHS blocks?",false);
         const int cutoff = Input("--cutoff","cutoff for nested dissection",128);
+        const int relaxSize = Input
+            ("--relaxSize","max size of amalgamated fronts (0 disables)",0);
+        const double relaxFraction = Input
+            ("--relaxFraction","max fraction of zeros in amalgamated fronts",
+             0.1);
+        const std::string cache = Input
+            ("--cache","basename of cached analysis (empty disables)",
+             std::string(""));
+        const bool minStack = Input
+            ("--minStack","order fronts to minimize update stack?",false);
+        const bool blr = Input("--blr","compress large fronts (1D)?",false);
+        const int blrMinHeight = Input
+            ("--blrMinHeight","min height of compressed fronts",1000);
+        const int blrTileSize = Input("--blrTileSize","BLR tile size",128);
+        const double blrTol = Input("--blrTol","BLR relative tolerance",1e-8);
         const bool print = Input("--print","print matrix?",false);
         const bool display = Input("--display","display matrix?",false);
         ProcessInput();
@@ -48,6 +70,9 @@ main( int argc, char* argv[] )
         ctrl.numSeqSeps = numSeqSeps;
         ctrl.numDistSeps = numDistSeps;
         ctrl.cutoff = cutoff;
+        ctrl.native = native;
+        ctrl.relaxSize = relaxSize;
+        ctrl.relaxFraction = relaxFraction;
 
         const int N = n1*n2*n3;
         DistSparseMatrix<double> A( N, comm );
@@ -129,17 +154,35 @@ main( int argc, char* argv[] )
         DistSymmInfo info;
         DistSeparatorTree sepTree;
         DistMap map, inverseMap;
+        // The cutoff and relaxation parameters of the natural ordering are
+        // those of 'ctrl', so only its grid dimensions need to be added
+        std::ostringstream ordering;
         if( natural )
-            NaturalNestedDissection
-            ( n1, n2, n3, graph, map, sepTree, info, cutoff );
-        else
-            NestedDissection( graph, map, sepTree, info, ctrl );
+            ordering << "natural " << n1 << " " << n2 << " " << n3;
+        const bool loaded =
+            ( cache != "" &&
+              LoadAnalysis
+              ( graph, map, sepTree, info, cache, ctrl, ordering.str() ) );
+        if( !loaded )
+        {
+            if( natural )
+                NaturalNestedDissection
+                ( n1, n2, n3, graph, map, sepTree, info, cutoff, false,
+                  relaxSize, relaxFraction );
+            else
+                NestedDissection( graph, map, sepTree, info, ctrl );
+            if( cache != "" )
+                SaveAnalysis
+                ( graph, map, sepTree, info, cache, ctrl, ordering.str() );
+        }
         map.FormInverse( inverseMap );
+        if( minStack )
+            MinimizeUpdateStack( info );
         mpi::Barrier( comm );
         const double nestedStop = mpi::Time();
         if( commRank == 0 )
             std::cout << "done, " << nestedStop-nestedStart << " seconds"
-                      << std::endl;
+                      << ( loaded ? " (loaded from cache)" : "" ) << std::endl;
 
         if( commRank == 0 )
         {
@@ -154,6 +197,55 @@ main( int argc, char* argv[] )
                       << rootSepSize << " vertices in root separator\n"
                       << std::endl;
         }
+        if( relaxSize > 0 )
+        {
+            const AmalgamationStats& stats = info.amalgStats;
+            const int origFronts =
+                mpi::AllReduce( stats.numOrigLocalFronts, comm );
+            const int fronts = mpi::AllReduce( stats.numLocalFronts, comm );
+            const double origEntries =
+                mpi::AllReduce( stats.numOrigLocalEntries, comm );
+            const double entries =
+                mpi::AllReduce( stats.numLocalEntries, comm );
+            if( commRank == 0 )
+                std::cout << "Amalgamation reduced the local fronts from "
+                          << origFronts << " to " << fronts << " and added "
+                          << 100*(entries-origEntries)/origEntries
+                          << "% explicit zeros to them\n" << std::endl;
+        }
+        SymmFrontType frontType;
+        if( cholesky )
+            frontType = ( solve2d ? CHOLESKY_2D : CHOLESKY_1D );
+        else if( solve2d )
+        {
+            if( intraPiv )
+                frontType = ( selInv ? LDL_INTRAPIV_SELINV_2D
+                                     : LDL_INTRAPIV_2D );
+            else
+                frontType = ( selInv ? LDL_SELINV_2D
+                                     : LDL_2D );
+        }
+        else
+        {
+            if( intraPiv )
+                frontType = ( selInv ? LDL_INTRAPIV_SELINV_1D
+                                     : LDL_INTRAPIV_1D );
+            else
+                frontType = ( selInv ? LDL_SELINV_1D
+                                     : LDL_1D );
+        }
+        double localFactorEntries, maxLocalFactorEntries,
+               localPeakEntries, maxLocalPeakEntries;
+        PredictFactorMemory
+        ( info, localFactorEntries, maxLocalFactorEntries,
+          localPeakEntries, maxLocalPeakEntries, frontType );
+        if( commRank == 0 )
+            std::cout << "Predicted memory usage for fronts...\n"
+                      << "  max local factor: "
+                      << maxLocalFactorEntries*sizeof(double)/1e6 << " MB\n"
+                      << "  max local peak:   "
+                      << maxLocalPeakEntries*sizeof(double)/1e6 << " MB\n"
+                      << std::endl;
         if( display )
         {
             std::ostringstream osBefore, osAfter;
@@ -219,28 +311,17 @@ main( int argc, char* argv[] )
             std::cout.flush();
         }
         SetBlocksize( nbFact );
+        BLRCtrl<double> blrCtrl;
+        blrCtrl.minHeight = blrMinHeight;
+        blrCtrl.tileSize = blrTileSize;
+        blrCtrl.tol = blrTol;
+        BLRStats blrStats;
         mpi::Barrier( comm );
         const double ldlStart = mpi::Time();
-        SymmFrontType frontType;
-        if( solve2d )
-        {
-            if( intraPiv )
-                frontType = ( selInv ? LDL_INTRAPIV_SELINV_2D 
-                                     : LDL_INTRAPIV_2D );
-            else
-                frontType = ( selInv ? LDL_SELINV_2D
-                                     : LDL_2D );
-        }
+        if( blr )
+            LDL( info, frontTree, blrCtrl, blrStats, frontType );
         else
-        {
-            if( intraPiv )
-                frontType = ( selInv ? LDL_INTRAPIV_SELINV_1D
-                                     : LDL_INTRAPIV_1D );
-            else
-                frontType = ( selInv ? LDL_SELINV_1D
-                                     : LDL_1D );
-        }
-        LDL( info, frontTree, frontType );
+            LDL( info, frontTree, frontType );
         mpi::Barrier( comm );
         const double ldlStop = mpi::Time();
         const double factTime = ldlStop - ldlStart;
@@ -248,6 +329,14 @@ main( int argc, char* argv[] )
         if( commRank == 0 )
             std::cout << "done, " << factTime << " seconds, " 
                       << factGFlops << " GFlop/s" << std::endl;
+        if( commRank == 0 && blrStats.numEntries > 0 )
+            std::cout << "Compressed " << blrStats.numFronts
+                      << " fronts, reducing their bottom-left blocks "
+                      << "from " << blrStats.numOrigEntries
+                      << " to " << blrStats.numEntries
+                      << " entries (a ratio of "
+                      << blrStats.numOrigEntries/blrStats.numEntries
+                      << ")" << std::endl;
 
         if( commRank == 0 )
             std::cout << "Memory usage for fronts after factorization..."
@@ -272,7 +361,38 @@ main( int argc, char* argv[] )
         }
         SetBlocksize( nbSolve );
         double solveStart, solveStop;
-        if( solve2d )
+        if( rhsBlock > 0 )
+        {
+            // The timing includes the redistributions of the blocks
+            mpi::Barrier( comm );
+            solveStart = mpi::Time();
+            if( rhsCallbacks )
+            {
+                // Copy each block out of (and back into) Y as if it were
+                // being generated and stored elsewhere
+                const int localHeight = Y.LocalHeight();
+                auto produce = [&]( Int colOff, DistMultiVec<double>& B )
+                {
+                    for( int j=0; j<B.Width(); ++j )
+                        for( int iLoc=0; iLoc<localHeight; ++iLoc )
+                            B.SetLocal( iLoc, j, Y.GetLocal(iLoc,colOff+j) );
+                };
+                auto consume = [&]( Int colOff, const DistMultiVec<double>& B )
+                {
+                    for( int j=0; j<B.Width(); ++j )
+                        for( int iLoc=0; iLoc<localHeight; ++iLoc )
+                            Y.SetLocal( iLoc, colOff+j, B.GetLocal(iLoc,j) );
+                };
+                Solve<double>
+                ( inverseMap, info, frontTree, Y.Width(), produce, consume,
+                  rhsBlock );
+            }
+            else
+                Solve( inverseMap, info, frontTree, Y, rhsBlock );
+            mpi::Barrier( comm );
+            solveStop = mpi::Time();
+        }
+        else if( solve2d )
         {
             DistNodalMatrix<double> YNodal;
             YNodal.Pull( inverseMap, info, Y );
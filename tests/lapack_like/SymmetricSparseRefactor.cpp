@@ -147,20 +147,17 @@ main( int argc, char* argv[] )
         {
             if( repeat != 0 )
             {
-                // Reset to an unfactored, implicitly symmetric frontal tree
+                // Shift the diagonal of A (which leaves the sparsity pattern
+                // unchanged) and reload the fronts from it
                 if( commRank == 0 )
-                    std::cout << "Resetting frontal tree." << std::endl;
-                ChangeFrontType( frontTree, SYMM_2D );
-
-                // Randomize the fronts
-                if( commRank == 0 )
-                    std::cout << "Randomizing fronts." << std::endl;
-                const int numDistFronts = frontTree.distFronts.size();
-                const int numLocalFronts = frontTree.localFronts.size();
-                for( int s=0; s<numLocalFronts; ++s )
-                    MakeUniform( frontTree.localFronts[s].frontL );
-                for( int s=1; s<numDistFronts; ++s )
-                    MakeUniform( frontTree.distFronts[s].front2dL );
+                    std::cout << "Shifting diagonal and refactoring."
+                              << std::endl;
+                double* values = A.ValueBuffer();
+                const int numLocalEntries = A.NumLocalEntries();
+                for( int k=0; k<numLocalEntries; ++k )
+                    if( A.Row(k) == A.Col(k) )
+                        values[k] += 1.;
+                frontTree.Refactor( A );
             }
 
             if( commRank == 0 )
@@ -186,8 +183,10 @@ main( int argc, char* argv[] )
                 std::cout.flush();
             }
             const double solveStart = mpi::Time();
-            DistMultiVec<double> y( N, 1, comm );
-            MakeUniform( y );
+            DistMultiVec<double> b( N, 1, comm );
+            MakeUniform( b );
+            DistMultiVec<double> y( comm );
+            y = b;
             DistNodalMultiVec<double> yNodal;
             yNodal.Pull( inverseMap, info, y );
             Solve( info, frontTree, yNodal );
@@ -198,7 +197,12 @@ main( int argc, char* argv[] )
                 std::cout << "done, " << solveStop-solveStart << " seconds"
                           << std::endl;
 
-            // TODO: Check residual error
+            const double bNorm = Nrm2( b );
+            Multiply( NORMAL, -1., A, y, 1., b );
+            const double relResidual = Nrm2( b ) / bNorm;
+            if( commRank == 0 )
+                std::cout << "|| b - A y ||_2 / || b ||_2 = " << relResidual
+                          << std::endl;
         }
     }
     catch( std::exception& e ) { ReportException(e); }